@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/quickstart"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/quickstart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
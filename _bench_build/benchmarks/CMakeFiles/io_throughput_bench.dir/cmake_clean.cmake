@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_throughput_bench.dir/io_throughput_bench.cpp.o"
+  "CMakeFiles/io_throughput_bench.dir/io_throughput_bench.cpp.o.d"
+  "io_throughput_bench"
+  "io_throughput_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_throughput_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/packet_core_bench.dir/packet_core_bench.cpp.o"
+  "CMakeFiles/packet_core_bench.dir/packet_core_bench.cpp.o.d"
+  "packet_core_bench"
+  "packet_core_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/packet_core_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+// Auto-generated version header for VRTIGO
+// DO NOT EDIT - Generated by CMake from cmake/version.hpp.in
+
+#pragma once
+
+// Preprocessor macros for compile-time version checks
+#define VRTIGO_VERSION_MAJOR 0
+#define VRTIGO_VERSION_MINOR 0
+#define VRTIGO_VERSION_PATCH 1
+#define VRTIGO_VERSION_STRING "0.0.1"
+
+// Encoded version number: MMNNPP (Major, Minor, Patch)
+// Example: 1.2.3 -> 10203
+#define VRTIGO_VERSION_NUMBER (0 * 10000 + \
+                              0 * 100 + \
+                              1)
+
+// Modern C++ interface (C++17+)
+namespace vrtigo {
+    /// Major version number
+    inline constexpr int version_major = 0;
+
+    /// Minor version number
+    inline constexpr int version_minor = 0;
+
+    /// Patch version number
+    inline constexpr int version_patch = 1;
+
+    /// Full version string (e.g., "0.0.1")
+    inline constexpr const char* version_string = "0.0.1";
+
+    /// Encoded version number for comparisons
+    inline constexpr int version_number = 0 * 10000 +
+                                          0 * 100 +
+                                          1;
+}
+
+// Usage examples:
+//
+// 1. Print version at runtime:
+//    std::cout << "Using vrtigo " << vrtigo::version_string << "\n";
+//
+// 2. Compile-time version check:
+//    #if VRTIGO_VERSION_NUMBER >= 10000
+//        // Use features from vrtigo 1.0.0+
+//    #endif
+//
+// 3. Static assertion:
+//    static_assert(VRTIGO_VERSION_MAJOR >= 1, "Requires vrtigo 1.x or later");
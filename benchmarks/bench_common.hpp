@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <vrtigo.hpp>
+#include <vrtigo/detail/buffer_io.hpp>
+#include <vrtigo/detail/cif.hpp>
+#include <vrtigo/detail/header.hpp>
+
+namespace bench_utils {
+
+/**
+ * @brief CIF population used by the context-packet benchmarks
+ *
+ * - sparse: a handful of common CIF0 fields (sample rate, bandwidth, RF reference)
+ * - cif0_full: every fixed-size CIF0 field
+ * - all_cif_words: every fixed-size field in CIF0 through CIF3
+ */
+enum class CifDensity : uint8_t { sparse = 0, cif0_full = 1, all_cif_words = 2 };
+
+/**
+ * @brief Mask of fixed-size fields supported for the given CIF word
+ *
+ * Excludes CIF0 enable bits and variable-length fields so the result can be used directly
+ * as a CIF word value.
+ */
+constexpr uint32_t fixed_field_mask(uint8_t cif_word) noexcept {
+    switch (cif_word) {
+        case 0:
+            return vrtigo::cif::CIF0_COMPILETIME_SUPPORTED_MASK & ~vrtigo::cif::CIF_ENABLE_MASK;
+        case 1:
+            return vrtigo::cif::CIF1_SUPPORTED_MASK;
+        case 2:
+            return vrtigo::cif::CIF2_SUPPORTED_MASK;
+        case 3:
+            return vrtigo::cif::CIF3_SUPPORTED_MASK;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Build a signal data packet (type 1) with UTC/real-time timestamps
+ *
+ * Payload bytes are filled with a ramp so checksum-style consumers see non-zero data.
+ *
+ * @param payload_words Payload size in 32-bit words
+ * @param with_trailer Append a trailer word (valid data + calibrated time)
+ * @param stream_id Stream identifier
+ * @param packet_count 4-bit packet count
+ */
+inline std::vector<uint8_t> make_data_packet(size_t payload_words, bool with_trailer = false,
+                                             uint32_t stream_id = 0x12345678,
+                                             uint8_t packet_count = 0) {
+    namespace hdr = vrtigo::header;
+
+    const size_t total_words = 1 + 1 + 3 + payload_words + (with_trailer ? 1 : 0);
+    std::vector<uint8_t> bytes(total_words * vrtigo::vrt_word_size);
+
+    uint32_t header =
+        (static_cast<uint32_t>(vrtigo::PacketType::signal_data) << hdr::packet_type_shift) |
+        (static_cast<uint32_t>(vrtigo::TsiType::utc) << hdr::tsi_shift) |
+        (static_cast<uint32_t>(vrtigo::TsfType::real_time) << hdr::tsf_shift) |
+        ((packet_count & hdr::packet_count_mask) << hdr::packet_count_shift) |
+        static_cast<uint32_t>(total_words);
+    if (with_trailer) {
+        header |= 1U << hdr::indicator_bit_26_shift;
+    }
+
+    size_t offset = 0;
+    vrtigo::detail::write_u32(bytes.data(), offset, header);
+    offset += 4;
+    vrtigo::detail::write_u32(bytes.data(), offset, stream_id);
+    offset += 4;
+    vrtigo::detail::write_u32(bytes.data(), offset, 1699000000U);
+    offset += 4;
+    vrtigo::detail::write_u64(bytes.data(), offset, 250000000000ULL);
+    offset += 8;
+
+    for (size_t i = 0; i < payload_words * vrtigo::vrt_word_size; ++i) {
+        bytes[offset + i] = static_cast<uint8_t>(i & 0xFF);
+    }
+    offset += payload_words * vrtigo::vrt_word_size;
+
+    if (with_trailer) {
+        // Valid data (enable 30, value 18) and calibrated time (enable 31, value 19)
+        vrtigo::detail::write_u32(bytes.data(), offset, 0xC00C0000U);
+    }
+    return bytes;
+}
+
+/**
+ * @brief Build a context packet (type 4) with the given CIF words and zero-filled fields
+ *
+ * CIF0 enable bits are derived from the non-zero CIF1-CIF3 words. Only fixed-size fields
+ * may be requested.
+ */
+inline std::vector<uint8_t> make_context_packet(uint32_t cif0, uint32_t cif1 = 0,
+                                                uint32_t cif2 = 0, uint32_t cif3 = 0,
+                                                uint32_t stream_id = 0x0C0FFEE0) {
+    namespace hdr = vrtigo::header;
+    namespace cif = vrtigo::cif;
+
+    cif0 &= ~cif::CIF_ENABLE_MASK;
+    if (cif1 != 0) {
+        cif0 |= 1U << cif::CIF1_ENABLE_BIT;
+    }
+    if (cif2 != 0) {
+        cif0 |= 1U << cif::CIF2_ENABLE_BIT;
+    }
+    if (cif3 != 0) {
+        cif0 |= 1U << cif::CIF3_ENABLE_BIT;
+    }
+
+    size_t field_words = 0;
+    for (uint32_t bit = 0; bit < 32; ++bit) {
+        const uint32_t mask = 1U << bit;
+        field_words += (cif0 & mask) ? cif::CIF0_FIELDS[bit].size_words : 0;
+        field_words += (cif1 & mask) ? cif::CIF1_FIELDS[bit].size_words : 0;
+        field_words += (cif2 & mask) ? cif::CIF2_FIELDS[bit].size_words : 0;
+        field_words += (cif3 & mask) ? cif::CIF3_FIELDS[bit].size_words : 0;
+    }
+
+    const size_t cif_words = 1 + (cif1 != 0 ? 1 : 0) + (cif2 != 0 ? 1 : 0) + (cif3 != 0 ? 1 : 0);
+    const size_t total_words = 1 + 1 + cif_words + field_words;
+    std::vector<uint8_t> bytes(total_words * vrtigo::vrt_word_size);
+
+    const uint32_t header =
+        (static_cast<uint32_t>(vrtigo::PacketType::context) << hdr::packet_type_shift) |
+        static_cast<uint32_t>(total_words);
+
+    size_t offset = 0;
+    vrtigo::detail::write_u32(bytes.data(), offset, header);
+    offset += 4;
+    vrtigo::detail::write_u32(bytes.data(), offset, stream_id);
+    offset += 4;
+    vrtigo::detail::write_u32(bytes.data(), offset, cif0);
+    offset += 4;
+    for (uint32_t word : {cif1, cif2, cif3}) {
+        if (word != 0) {
+            vrtigo::detail::write_u32(bytes.data(), offset, word);
+            offset += 4;
+        }
+    }
+    return bytes;
+}
+
+/**
+ * @brief Build a context packet with the requested CIF population
+ */
+inline std::vector<uint8_t> make_context_packet(CifDensity density) {
+    switch (density) {
+        case CifDensity::sparse:
+            return make_context_packet((1U << 21) | (1U << 27) | (1U << 29));
+        case CifDensity::cif0_full:
+            return make_context_packet(fixed_field_mask(0));
+        case CifDensity::all_cif_words:
+            return make_context_packet(fixed_field_mask(0), fixed_field_mask(1),
+                                       fixed_field_mask(2), fixed_field_mask(3));
+    }
+    return {};
+}
+
+/**
+ * @brief Build a control command packet (type 6) addressed to a 32-bit controllee ID
+ *
+ * The body is the context packet make_context_packet() builds for the same CIF words,
+ * preceded by the CAM word, message ID, and controllee ID, so it validates as a
+ * RuntimeCommandPacket.
+ */
+inline std::vector<uint8_t> make_command_packet(uint32_t cif0, uint32_t message_id = 1,
+                                                uint32_t stream_id = 0x0C0FFEE0,
+                                                uint32_t controllee_id = 0x00C0FFEE) {
+    namespace hdr = vrtigo::header;
+
+    auto context = make_context_packet(cif0, 0, 0, 0, stream_id);
+    constexpr size_t prologue_bytes = 2 * vrtigo::vrt_word_size; // header + stream ID
+    constexpr size_t control_words = 3;                          // CAM, message ID, controllee
+    const size_t total_words = context.size() / vrtigo::vrt_word_size + control_words;
+    std::vector<uint8_t> bytes(total_words * vrtigo::vrt_word_size);
+
+    const uint32_t header =
+        (static_cast<uint32_t>(vrtigo::PacketType::command) << hdr::packet_type_shift) |
+        static_cast<uint32_t>(total_words);
+    vrtigo::detail::write_u32(bytes.data(), 0, header);
+    vrtigo::detail::write_u32(bytes.data(), 4, stream_id);
+    vrtigo::detail::write_u32(bytes.data(), 8, 1U << vrtigo::cam::controllee_enable_shift);
+    vrtigo::detail::write_u32(bytes.data(), 12, message_id);
+    vrtigo::detail::write_u32(bytes.data(), 16, controllee_id);
+    std::copy(context.begin() + prologue_bytes, context.end(),
+              bytes.begin() + prologue_bytes + control_words * vrtigo::vrt_word_size);
+    return bytes;
+}
+
+/**
+ * @brief Mixed corpus of data, context, and command packets for dispatch benchmarks
+ *
+ * Roughly 3 data packets for every context packet, plus one control command packet
+ * (dispatched to RuntimeCommandPacket) per 8 entries unless include_commands is false, in
+ * which case that entry is another context packet. Data packets rotate through
+ * num_streams stream IDs and payloads of up to max_payload_words.
+ */
+inline std::vector<std::vector<uint8_t>> make_mixed_corpus(size_t count, size_t num_streams = 4,
+                                                           size_t max_payload_words = 2048,
+                                                           bool include_commands = true) {
+    std::vector<std::vector<uint8_t>> corpus;
+    corpus.reserve(count);
+
+    constexpr size_t payload_sizes[] = {16, 64, 256, 1024, 2048};
+    for (size_t i = 0; i < count; ++i) {
+        switch (i % 8) {
+            case 3:
+                corpus.push_back(make_context_packet(CifDensity::sparse));
+                break;
+            case 7:
+                corpus.push_back(include_commands
+                                     ? make_command_packet((1U << 21) | (1U << 27) | (1U << 29),
+                                                           static_cast<uint32_t>(i))
+                                     : make_context_packet(CifDensity::sparse));
+                break;
+            case 5:
+                corpus.push_back(make_context_packet(CifDensity::cif0_full));
+                break;
+            default:
+                corpus.push_back(make_data_packet(
+                    std::min(payload_sizes[i % std::size(payload_sizes)], max_payload_words),
+                    (i % 2) == 0, 0x1000 + static_cast<uint32_t>(i % num_streams),
+                    static_cast<uint8_t>(i & 0xF)));
+                break;
+        }
+    }
+    return corpus;
+}
+
+} // namespace bench_utils
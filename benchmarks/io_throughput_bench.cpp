@@ -0,0 +1,246 @@
+// End-to-end throughput and latency benchmarks for the file, PCAP, and UDP loopback
+// transports. Each benchmark runs over a synthetic mixed data/context corpus generated
+// in-process, parameterized by stream count.
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <unistd.h>
+#include <vrtigo/vrtigo_io.hpp>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "bench_common.hpp"
+#include "latency_stats.hpp"
+
+namespace {
+
+using Clock = bench_utils::LatencyRecorder::clock;
+
+constexpr size_t corpus_packets = 1024;
+
+/**
+ * Synthetic corpus plus pre-parsed views over it (views reference corpus storage).
+ */
+struct Corpus {
+    std::vector<std::vector<uint8_t>> bytes;
+    std::vector<vrtigo::PacketVariant> packets;
+    size_t total_bytes = 0;
+
+    explicit Corpus(size_t num_streams, size_t max_payload_words = 2048)
+        : bytes(bench_utils::make_mixed_corpus(corpus_packets, num_streams, max_payload_words,
+                                               false)) {
+        packets.reserve(bytes.size());
+        for (const auto& pkt : bytes) {
+            packets.push_back(vrtigo::parse_packet(pkt));
+            total_bytes += pkt.size();
+        }
+    }
+};
+
+std::string temp_path(const char* suffix) {
+    auto path = std::filesystem::temp_directory_path() /
+                ("vrtigo_bench_" + std::to_string(::getpid()) + suffix);
+    return path.string();
+}
+
+template <typename Writer>
+void write_corpus(Writer& writer, const Corpus& corpus) {
+    for (const auto& pkt : corpus.packets) {
+        writer.write_packet(pkt);
+    }
+    writer.flush();
+}
+
+// =============================================================================
+// File transport
+// =============================================================================
+
+void BM_FileWrite(benchmark::State& state) {
+    const Corpus corpus(static_cast<size_t>(state.range(0)));
+    const auto path = temp_path(".vrt");
+    bench_utils::LatencyRecorder latency;
+    uint64_t cycles = 0;
+
+    for (auto _ : state) {
+        vrtigo::VRTFileWriter<> writer(path);
+        const uint64_t start_cycles = bench_utils::read_cycle_counter();
+        for (const auto& pkt : corpus.packets) {
+            const auto t0 = Clock::now();
+            benchmark::DoNotOptimize(writer.write_packet(pkt));
+            latency.record(t0, Clock::now());
+        }
+        writer.flush();
+        cycles += bench_utils::read_cycle_counter() - start_cycles;
+    }
+
+    std::filesystem::remove(path);
+    latency.report(state, state.iterations() * corpus.packets.size(),
+                   state.iterations() * corpus.total_bytes, cycles);
+}
+BENCHMARK(BM_FileWrite)->ArgName("streams")->Arg(1)->Arg(4)->Arg(16);
+
+void BM_FileRead(benchmark::State& state) {
+    const Corpus corpus(static_cast<size_t>(state.range(0)));
+    const auto path = temp_path(".vrt");
+    {
+        vrtigo::VRTFileWriter<> writer(path);
+        write_corpus(writer, corpus);
+    }
+
+    bench_utils::LatencyRecorder latency;
+    uint64_t cycles = 0;
+    size_t packets = 0;
+
+    for (auto _ : state) {
+        vrtigo::VRTFileReader<> reader(path.c_str());
+        const uint64_t start_cycles = bench_utils::read_cycle_counter();
+        while (true) {
+            const auto t0 = Clock::now();
+            auto pkt = reader.read_next_packet();
+            if (!pkt) {
+                break;
+            }
+            latency.record(t0, Clock::now());
+            benchmark::DoNotOptimize(*pkt);
+            ++packets;
+        }
+        cycles += bench_utils::read_cycle_counter() - start_cycles;
+    }
+
+    std::filesystem::remove(path);
+    latency.report(state, packets, state.iterations() * corpus.total_bytes, cycles);
+}
+BENCHMARK(BM_FileRead)->ArgName("streams")->Arg(1)->Arg(4)->Arg(16);
+
+// =============================================================================
+// PCAP transport
+// =============================================================================
+
+void BM_PCAPWrite(benchmark::State& state) {
+    const Corpus corpus(static_cast<size_t>(state.range(0)));
+    const auto path = temp_path(".pcap");
+    bench_utils::LatencyRecorder latency;
+    uint64_t cycles = 0;
+
+    for (auto _ : state) {
+        vrtigo::PCAPVRTWriter writer(path);
+        const uint64_t start_cycles = bench_utils::read_cycle_counter();
+        for (const auto& pkt : corpus.packets) {
+            const auto t0 = Clock::now();
+            benchmark::DoNotOptimize(writer.write_packet(pkt));
+            latency.record(t0, Clock::now());
+        }
+        writer.flush();
+        cycles += bench_utils::read_cycle_counter() - start_cycles;
+    }
+
+    std::filesystem::remove(path);
+    latency.report(state, state.iterations() * corpus.packets.size(),
+                   state.iterations() * corpus.total_bytes, cycles);
+}
+BENCHMARK(BM_PCAPWrite)->ArgName("streams")->Arg(1)->Arg(4)->Arg(16);
+
+void BM_PCAPRead(benchmark::State& state) {
+    const Corpus corpus(static_cast<size_t>(state.range(0)));
+    const auto path = temp_path(".pcap");
+    {
+        vrtigo::PCAPVRTWriter writer(path);
+        write_corpus(writer, corpus);
+    }
+
+    bench_utils::LatencyRecorder latency;
+    uint64_t cycles = 0;
+    size_t packets = 0;
+
+    vrtigo::PCAPVRTReader<> reader(path);
+    for (auto _ : state) {
+        reader.rewind();
+        const uint64_t start_cycles = bench_utils::read_cycle_counter();
+        while (true) {
+            const auto t0 = Clock::now();
+            auto pkt = reader.read_next_packet();
+            if (!pkt) {
+                break;
+            }
+            latency.record(t0, Clock::now());
+            benchmark::DoNotOptimize(*pkt);
+            ++packets;
+        }
+        cycles += bench_utils::read_cycle_counter() - start_cycles;
+    }
+
+    std::filesystem::remove(path);
+    latency.report(state, packets, state.iterations() * corpus.total_bytes, cycles);
+}
+BENCHMARK(BM_PCAPRead)->ArgName("streams")->Arg(1)->Arg(4)->Arg(16);
+
+// =============================================================================
+// UDP loopback
+// =============================================================================
+
+/**
+ * Send a burst of packets over loopback, then drain it. Latency is measured per packet
+ * from the send call to the parsed result, so burst=1 is one-way latency and larger
+ * bursts include queueing in the socket buffer.
+ *
+ * Each packet's stream ID is overwritten with a running sequence number, which the
+ * receive side uses to look up the matching send time, so a lost datagram (or a late
+ * one from an earlier burst) cannot shift the samples that follow it. That also replaces
+ * the corpus stream IDs, so unlike the file benchmarks this one has no streams argument.
+ */
+void BM_UDPLoopback(benchmark::State& state) {
+    Corpus corpus(1);
+    const auto burst = static_cast<size_t>(state.range(0));
+
+    vrtigo::UDPVRTReader<> reader(uint16_t{0}); // ephemeral port
+    reader.try_set_timeout(std::chrono::milliseconds(100));
+    reader.try_set_receive_buffer_size(8 * 1024 * 1024);
+    vrtigo::UDPVRTWriter writer("127.0.0.1", reader.socket_port());
+    writer.set_mtu(vrtigo::max_packet_bytes);
+
+    bench_utils::LatencyRecorder latency;
+    std::vector<Clock::time_point> send_times(burst);
+    uint64_t cycles = 0;
+    size_t packets = 0;
+    size_t bytes = 0;
+    size_t lost = 0;
+    size_t next = 0;
+    uint32_t sequence = 0;
+
+    for (auto _ : state) {
+        const uint32_t first = sequence;
+        const uint64_t start_cycles = bench_utils::read_cycle_counter();
+        for (size_t i = 0; i < burst; ++i) {
+            // The corpus views alias these bytes, so the stamped ID goes out with the packet
+            vrtigo::detail::write_u32(corpus.bytes[next].data(), 4, sequence++);
+            send_times[i] = Clock::now();
+            writer.write_packet(corpus.packets[next]);
+            bytes += corpus.bytes[next].size();
+            next = (next + 1 == corpus.packets.size()) ? 0 : next + 1;
+        }
+        for (size_t i = 0; i < burst; ++i) {
+            auto pkt = reader.read_next_packet();
+            const auto received = Clock::now();
+            auto id = pkt ? vrtigo::stream_id(*pkt) : std::nullopt;
+            if (!id || *id - first >= burst) {
+                ++lost;
+                continue;
+            }
+            latency.record(send_times[*id - first], received);
+            benchmark::DoNotOptimize(*pkt);
+            ++packets;
+        }
+        cycles += bench_utils::read_cycle_counter() - start_cycles;
+    }
+
+    latency.report(state, packets, bytes, cycles);
+    state.counters["lost"] = static_cast<double>(lost);
+}
+BENCHMARK(BM_UDPLoopback)->ArgName("burst")->Arg(1)->Arg(32)->UseRealTime();
+
+} // namespace
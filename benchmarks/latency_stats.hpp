@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bench_utils {
+
+/**
+ * @brief Read the CPU cycle counter
+ *
+ * Uses the TSC on x86 (reference cycles, not core cycles under frequency scaling).
+ * Other architectures fall back to steady_clock nanoseconds.
+ */
+inline uint64_t read_cycle_counter() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * @brief Per-packet latency recorder with percentile reporting
+ *
+ * Samples are kept in a preallocated ring so recording never allocates inside the timed
+ * loop. Once full, the oldest samples are overwritten, which keeps the percentiles
+ * representative of the steady state.
+ */
+class LatencyRecorder {
+public:
+    using clock = std::chrono::steady_clock;
+
+    explicit LatencyRecorder(size_t capacity = size_t{1} << 20) : samples_(capacity) {}
+
+    void record(clock::time_point start, clock::time_point end) noexcept {
+        record_ns(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    void record_ns(int64_t ns) noexcept {
+        samples_[next_] = ns;
+        next_ = (next_ + 1 == samples_.size()) ? 0 : next_ + 1;
+        count_ = std::min(count_ + 1, samples_.size());
+    }
+
+    /**
+     * @brief Publish packets/s, bytes/s, cycles/packet, and latency percentiles
+     *
+     * @param state Benchmark state to annotate
+     * @param packets Total packets processed across all iterations
+     * @param bytes Total bytes processed across all iterations
+     * @param cycles Total cycle-counter ticks spent in the timed region
+     */
+    void report(benchmark::State& state, size_t packets, size_t bytes, uint64_t cycles) {
+        state.SetItemsProcessed(static_cast<int64_t>(packets));
+        state.SetBytesProcessed(static_cast<int64_t>(bytes));
+        if (packets > 0) {
+            state.counters["cycles_per_packet"] =
+                static_cast<double>(cycles) / static_cast<double>(packets);
+        }
+        state.counters["p50_ns"] = percentile(0.50);
+        state.counters["p99_ns"] = percentile(0.99);
+        state.counters["p999_ns"] = percentile(0.999);
+    }
+
+private:
+    double percentile(double p) {
+        if (count_ == 0) {
+            return 0.0;
+        }
+        auto end = samples_.begin() + static_cast<std::ptrdiff_t>(count_);
+        auto rank = static_cast<std::ptrdiff_t>(p * static_cast<double>(count_ - 1));
+        auto nth = samples_.begin() + rank;
+        std::nth_element(samples_.begin(), nth, end);
+        return static_cast<double>(*nth);
+    }
+
+    std::vector<int64_t> samples_;
+    size_t next_ = 0;
+    size_t count_ = 0;
+};
+
+} // namespace bench_utils
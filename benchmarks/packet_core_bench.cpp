@@ -0,0 +1,256 @@
+// Microbenchmarks for the core packet paths: building, setters, runtime validation,
+// parse_packet dispatch, CIF field proxies, and trailer accessors.
+
+#include <array>
+#include <bit>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vrtigo.hpp>
+#include <vrtigo/vrtigo_io.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+
+using vrtigo::NoClassId;
+using vrtigo::Trailer;
+using vrtigo::UtcRealTimestamp;
+
+template <size_t PayloadWords>
+using BenchDataPacket = vrtigo::SignalDataPacket<NoClassId, UtcRealTimestamp, Trailer::included,
+                                                 PayloadWords>;
+
+template <size_t PayloadWords>
+std::array<uint8_t, PayloadWords * 4> make_payload() {
+    std::array<uint8_t, PayloadWords * 4> payload{};
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i & 0xFF);
+    }
+    return payload;
+}
+
+void set_packet_counters(benchmark::State& state, size_t bytes_per_packet) {
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes_per_packet));
+}
+
+// =============================================================================
+// Compile-time path: PacketBuilder and DataPacket setters
+// =============================================================================
+
+template <size_t PayloadWords>
+void BM_PacketBuilder(benchmark::State& state) {
+    using PacketType = BenchDataPacket<PayloadWords>;
+
+    alignas(4) std::array<uint8_t, PacketType::size_bytes> buffer{};
+    const auto payload = make_payload<PayloadWords>();
+    const auto trailer_cfg = vrtigo::TrailerBuilder{}.valid_data(true).calibrated_time(true);
+    uint32_t seconds = 1699000000;
+    uint8_t count = 0;
+
+    for (auto _ : state) {
+        auto packet = vrtigo::PacketBuilder<PacketType>(buffer.data())
+                          .stream_id(0x12345678)
+                          .timestamp(UtcRealTimestamp(seconds++, 0))
+                          .trailer(trailer_cfg)
+                          .packet_count(count++)
+                          .payload(payload.data(), payload.size())
+                          .build();
+        benchmark::DoNotOptimize(packet);
+        benchmark::ClobberMemory();
+    }
+    set_packet_counters(state, PacketType::size_bytes);
+}
+BENCHMARK(BM_PacketBuilder<16>);
+BENCHMARK(BM_PacketBuilder<256>);
+BENCHMARK(BM_PacketBuilder<2048>);
+
+template <size_t PayloadWords>
+void BM_DataPacketSetters(benchmark::State& state) {
+    using PacketType = BenchDataPacket<PayloadWords>;
+
+    alignas(4) std::array<uint8_t, PacketType::size_bytes> buffer{};
+    PacketType packet(buffer.data());
+    const auto payload = make_payload<PayloadWords>();
+    uint32_t seconds = 1699000000;
+    uint8_t count = 0;
+
+    // Escape the buffer so the stores below cannot be elided
+    benchmark::DoNotOptimize(buffer.data());
+    for (auto _ : state) {
+        packet.set_stream_id(seconds);
+        packet.set_timestamp(UtcRealTimestamp(seconds++, 500000000000ULL));
+        packet.set_packet_count(count++ & 0xF);
+        packet.trailer().set_valid_data(true);
+        packet.trailer().set_context_packet_count(count & 0x7F);
+        packet.set_payload(payload.data(), payload.size());
+        benchmark::ClobberMemory();
+    }
+    set_packet_counters(state, PacketType::size_bytes);
+}
+BENCHMARK(BM_DataPacketSetters<16>);
+BENCHMARK(BM_DataPacketSetters<256>);
+BENCHMARK(BM_DataPacketSetters<2048>);
+
+// =============================================================================
+// Runtime path: validation and dispatch
+// =============================================================================
+
+// The validating and trusted variants run the same loop body: the view escapes and one
+// field is read, so neither the header decode nor the offset computation can be elided.
+
+void BM_RuntimeDataValidation(benchmark::State& state) {
+    const auto bytes = bench_utils::make_data_packet(static_cast<size_t>(state.range(0)), true);
+
+    for (auto _ : state) {
+        vrtigo::RuntimeDataPacket packet(bytes.data(), bytes.size());
+        benchmark::DoNotOptimize(packet);
+        benchmark::DoNotOptimize(packet.payload().size());
+    }
+    set_packet_counters(state, bytes.size());
+}
+BENCHMARK(BM_RuntimeDataValidation)->ArgName("payload_words")->RangeMultiplier(8)->Range(16, 8192);
+
+void BM_RuntimeDataTrusted(benchmark::State& state) {
+    const auto bytes = bench_utils::make_data_packet(static_cast<size_t>(state.range(0)), true);
+
+    for (auto _ : state) {
+        vrtigo::RuntimeDataPacket packet(bytes.data(), bytes.size(), vrtigo::trusted);
+        benchmark::DoNotOptimize(packet);
+        benchmark::DoNotOptimize(packet.payload().size());
+    }
+    set_packet_counters(state, bytes.size());
+}
+BENCHMARK(BM_RuntimeDataTrusted)->ArgName("payload_words")->RangeMultiplier(8)->Range(16, 8192);
+
+void BM_RuntimeContextValidation(benchmark::State& state) {
+    const auto density = static_cast<bench_utils::CifDensity>(state.range(0));
+    const auto bytes = bench_utils::make_context_packet(density);
+
+    for (auto _ : state) {
+        vrtigo::RuntimeContextPacket packet(bytes.data(), bytes.size());
+        benchmark::DoNotOptimize(packet);
+        benchmark::DoNotOptimize(packet[vrtigo::field::bandwidth].encoded());
+    }
+    set_packet_counters(state, bytes.size());
+}
+BENCHMARK(BM_RuntimeContextValidation)->ArgName("cif_density")->DenseRange(0, 2);
+
+void BM_RuntimeContextTrusted(benchmark::State& state) {
+    const auto density = static_cast<bench_utils::CifDensity>(state.range(0));
+    const auto bytes = bench_utils::make_context_packet(density);
+
+    for (auto _ : state) {
+        vrtigo::RuntimeContextPacket packet(bytes.data(), bytes.size(), vrtigo::trusted);
+        benchmark::DoNotOptimize(packet);
+        benchmark::DoNotOptimize(packet[vrtigo::field::bandwidth].encoded());
+    }
+    set_packet_counters(state, bytes.size());
+}
+BENCHMARK(BM_RuntimeContextTrusted)->ArgName("cif_density")->DenseRange(0, 2);
+
+void BM_ParsePacketDispatch(benchmark::State& state) {
+    const auto corpus = bench_utils::make_mixed_corpus(static_cast<size_t>(state.range(0)));
+
+    size_t total_bytes = 0;
+    for (const auto& pkt : corpus) {
+        total_bytes += pkt.size();
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        auto result = vrtigo::parse_packet(corpus[index]);
+        benchmark::DoNotOptimize(result);
+        index = (index + 1 == corpus.size()) ? 0 : index + 1;
+    }
+    set_packet_counters(state, total_bytes / corpus.size());
+}
+BENCHMARK(BM_ParsePacketDispatch)->ArgName("corpus")->Arg(64)->Arg(4096);
+
+// =============================================================================
+// FieldProxy access for every fixed-size field in each CIF word
+// =============================================================================
+
+template <uint8_t Cif, uint8_t Bit>
+void touch_field(const vrtigo::RuntimeContextPacket& packet, bool interpreted) {
+    if constexpr ((bench_utils::fixed_field_mask(Cif) >> Bit) & 1U) {
+        using Tag = vrtigo::field::field_tag_t<Cif, Bit>;
+        auto proxy = packet[Tag{}];
+        if constexpr (vrtigo::detail::HasInterpretedAccess<Tag>) {
+            if (interpreted) {
+                benchmark::DoNotOptimize(proxy.value());
+                return;
+            }
+        }
+        benchmark::DoNotOptimize(proxy.encoded());
+    }
+}
+
+template <uint8_t Cif, size_t... Bits>
+void touch_cif_word(const vrtigo::RuntimeContextPacket& packet, bool interpreted,
+                    std::index_sequence<Bits...>) {
+    (touch_field<Cif, static_cast<uint8_t>(Bits)>(packet, interpreted), ...);
+}
+
+template <uint8_t Cif>
+void BM_FieldProxyCifWord(benchmark::State& state) {
+    const bool interpreted = state.range(0) != 0;
+    const uint32_t mask = bench_utils::fixed_field_mask(Cif);
+    const auto bytes = bench_utils::make_context_packet(
+        Cif == 0 ? mask : 0, Cif == 1 ? mask : 0, Cif == 2 ? mask : 0, Cif == 3 ? mask : 0);
+
+    vrtigo::RuntimeContextPacket packet(bytes.data(), bytes.size());
+    if (!packet.is_valid()) {
+        state.SkipWithError(vrtigo::validation_error_string(packet.error()));
+        return;
+    }
+
+    for (auto _ : state) {
+        touch_cif_word<Cif>(packet, interpreted, std::make_index_sequence<32>{});
+    }
+    state.SetItemsProcessed(state.iterations() * std::popcount(mask));
+}
+BENCHMARK(BM_FieldProxyCifWord<0>)->ArgName("value")->Arg(0)->Arg(1);
+BENCHMARK(BM_FieldProxyCifWord<1>)->ArgName("value")->Arg(0);
+BENCHMARK(BM_FieldProxyCifWord<2>)->ArgName("value")->Arg(0);
+BENCHMARK(BM_FieldProxyCifWord<3>)->ArgName("value")->Arg(0);
+
+// =============================================================================
+// Trailer view accessors
+// =============================================================================
+
+void BM_TrailerViewAccessors(benchmark::State& state) {
+    alignas(4) std::array<uint8_t, 4> word{};
+    vrtigo::MutableTrailerView writer(word.data());
+    writer.set_valid_data(true);
+    writer.set_calibrated_time(true);
+    writer.set_reference_lock(true);
+    writer.set_sample_loss(false);
+    writer.set_context_packet_count(3);
+
+    const vrtigo::TrailerView view(word.data());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.raw());
+        benchmark::DoNotOptimize(view.context_packet_count());
+        benchmark::DoNotOptimize(view.calibrated_time());
+        benchmark::DoNotOptimize(view.valid_data());
+        benchmark::DoNotOptimize(view.reference_lock());
+        benchmark::DoNotOptimize(view.agc_mgc());
+        benchmark::DoNotOptimize(view.detected_signal());
+        benchmark::DoNotOptimize(view.spectral_inversion());
+        benchmark::DoNotOptimize(view.over_range());
+        benchmark::DoNotOptimize(view.sample_loss());
+        benchmark::DoNotOptimize(view.sample_frame_0());
+        benchmark::DoNotOptimize(view.sample_frame_1());
+        benchmark::DoNotOptimize(view.user_defined_0());
+        benchmark::DoNotOptimize(view.user_defined_1());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TrailerViewAccessors);
+
+} // namespace
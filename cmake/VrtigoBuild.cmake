@@ -56,3 +56,10 @@ function(vrtigo_add_gtest target_name)
 
     add_test(NAME ${ARG_NAME} COMMAND ${target_name})
 endfunction()
+
+# Helper for Google Benchmark executables.
+function(vrtigo_add_benchmark target_name)
+    add_executable(${target_name} ${ARGN})
+    target_link_libraries(${target_name} PRIVATE vrtigo benchmark::benchmark_main)
+    vrtigo_set_target_defaults(${target_name})
+endfunction()
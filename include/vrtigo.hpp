@@ -22,6 +22,14 @@
 // - Variable-length field handling (GPS ASCII, Context Association Lists)
 // - Full Class ID support with 24-bit OUI and 32-bit PCC
 // - Unified field access API via operator[]
+//
+// Command Packet Features:
+// - Control and Acknowledge packets (types 6-7)
+// - Runtime parsing with RuntimeCommandPacket
+// - Compile-time creation with ControlPacket, CancellationPacket, QueryStateAckPacket
+//   and AckPacket templates
+// - CAM field, message ID, controllee/controller IDs (32-bit or UUID)
+// - Same CIF field tables and operator[] field access as context packets
 
 // ====================
 // Public API
@@ -33,20 +41,43 @@
 // Timestamp types (users instantiate these directly)
 #include "vrtigo/timestamp.hpp"
 
+// Sample-rate-aware timestamp arithmetic (sample_count TSF, sample indexing)
+#include "vrtigo/sample_clock.hpp"
+
+// VRT-to-host clock offset/drift estimation
+#include "vrtigo/clock_model.hpp"
+
+// Metadata-only extraction (timestamps, stream IDs, packet counts) into SoA columns
+#include "vrtigo/packet_metadata.hpp"
+
+// Compact trivially copyable packet handle for queues and batches
+#include "vrtigo/packet_handle.hpp"
+
 // ClassId types (users instantiate these directly)
 #include "vrtigo/class_id.hpp"
 
 // Field tags for context packet field access
 #include "vrtigo/field_tags.hpp"
 
+// Control/Acknowledge Mode (CAM) field and controllee/controller ID types
+#include "vrtigo/command_cam.hpp"
+
+// Batch field extraction across packets (encoded or exact integer units)
+#include "vrtigo/field_batch.hpp"
+
+// Compile-time codec reading/writing a fixed field set at constant offsets
+#include "vrtigo/field_codec.hpp"
+
 // ====================
 // Implementation
 // ====================
 
 // Packet implementations (exposed via this header but users don't include detail/ directly)
 #include "vrtigo/detail/builder.hpp"
+#include "vrtigo/detail/command_packet.hpp"
 #include "vrtigo/detail/context_packet.hpp"
 #include "vrtigo/detail/data_packet.hpp"
+#include "vrtigo/detail/runtime_command_packet.hpp"
 #include "vrtigo/detail/runtime_context_packet.hpp"
 #include "vrtigo/detail/runtime_data_packet.hpp"
 
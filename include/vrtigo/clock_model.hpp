@@ -0,0 +1,371 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "timestamp.hpp"
+
+namespace vrtigo {
+
+namespace detail {
+
+/// UTC or GPS real-time timestamps convert to and from std::chrono::system_clock
+constexpr bool is_epoch_real_time(TsiType tsi, TsfType tsf) noexcept {
+    return (tsi == TsiType::utc || tsi == TsiType::gps) && tsf == TsfType::real_time;
+}
+
+} // namespace detail
+
+/**
+ * @brief Outlier handling for ClockModel
+ */
+struct ClockModelConfig {
+    /**
+     * Reject samples whose innovation exceeds this many residual RMS (0 disables rejection).
+     * Rejected samples are reported but not added to the fit.
+     */
+    double outlier_sigma = 0.0;
+
+    /** Innovations within this bound are never rejected, however tight the fit */
+    std::chrono::nanoseconds outlier_floor{std::chrono::microseconds(50)};
+
+    /**
+     * After this many consecutive rejections the model is assumed to describe a clock that
+     * no longer exists (upstream step or restart) and is reset from the latest sample.
+     */
+    size_t reset_after_outliers = 8;
+};
+
+/**
+ * @brief Outcome of ClockModel::update()
+ */
+struct ClockModelUpdate {
+    /** Host time minus the model's prediction for this sample (before it was added) */
+    std::optional<std::chrono::nanoseconds> innovation;
+
+    /** Sample was rejected as an outlier */
+    bool outlier = false;
+
+    /** Model was reset (consecutive outliers) and restarted from this sample */
+    bool reset = false;
+};
+
+/**
+ * @brief Online affine model between a stream's VRT time and host time
+ *
+ * Fits host = offset + (1 + drift) * vrt by least squares over a sliding window of the last
+ * WindowSize (VRT timestamp, host receive time) pairs. The regression is on host - vrt
+ * against vrt, so the sums hold small offset changes rather than two nearly equal clocks.
+ * Each update is O(1): running sums are adjusted for the sample entering and the one
+ * leaving the window. Every WindowSize
+ * updates the sums are re-centred on the oldest sample (an O(WindowSize) pass, so O(1)
+ * amortized) to keep double precision as the stream runs for days.
+ *
+ * The model predicts in both directions: the host time at which a VRT timestamp is (or
+ * was) observed, for deadline scheduling, and the VRT time corresponding to a host time.
+ * Innovations (prediction error of each new sample) and the residual RMS expose upstream
+ * clock faults: steps show up as large innovations, a slipping reference as a drift change.
+ *
+ * VRT times are taken as std::chrono::system_clock time points; the Timestamp overloads
+ * accept UTC or GPS real-time timestamps (GPS via the leap-second table). No allocation.
+ *
+ * @tparam WindowSize Samples in the sliding window (at least 2)
+ *
+ * Example:
+ * @code
+ * ClockModel<256> model;
+ * auto pkt = reader.read_next_timestamped_packet();
+ * auto& data = std::get<RuntimeDataPacket>(pkt->packet);
+ * model.update(UtcRealTimestamp(*data.timestamp_integer(), *data.timestamp_fractional()),
+ *              pkt->receive_time.time);
+ * auto deadline = model.predict_host_time(next_frame_time);
+ * @endcode
+ */
+template <size_t WindowSize = 128>
+class ClockModel {
+    static_assert(WindowSize >= 2, "ClockModel window needs at least 2 samples");
+
+public:
+    using time_point = std::chrono::system_clock::time_point;
+
+    constexpr ClockModel() noexcept = default;
+
+    constexpr explicit ClockModel(ClockModelConfig config) noexcept : config_(config) {}
+
+    /**
+     * @brief Add a (VRT time, host time) observation
+     *
+     * @param vrt VRT time of the sample (e.g. a packet timestamp)
+     * @param host Host time at which it was observed (e.g. the kernel receive timestamp)
+     * @return Innovation and outlier/reset flags
+     */
+    ClockModelUpdate update(time_point vrt, time_point host) noexcept {
+        ClockModelUpdate result;
+        if (count_ == 0) {
+            vrt_ref_ = vrt;
+            host_ref_ = host;
+        }
+
+        double x = seconds_between(vrt_ref_, vrt);
+        double y = seconds_between(host_ref_, host) - x;
+
+        if (auto fit = solve()) {
+            double innovation = y - (fit->intercept + fit->slope * x);
+            result.innovation = to_nanoseconds(innovation);
+
+            if (config_.outlier_sigma > 0.0 && count_ > 2) {
+                double floor = std::chrono::duration<double>(config_.outlier_floor).count();
+                double bound = std::max(floor, config_.outlier_sigma * residual_rms_seconds());
+                if (std::abs(innovation) > bound) {
+                    if (++consecutive_outliers_ < config_.reset_after_outliers) {
+                        result.outlier = true;
+                        return result;
+                    }
+                    reset();
+                    vrt_ref_ = vrt;
+                    host_ref_ = host;
+                    x = 0.0;
+                    y = 0.0;
+                    result.reset = true;
+                }
+            }
+        }
+        consecutive_outliers_ = 0;
+
+        if (count_ == WindowSize) {
+            const Sample& oldest = samples_[head_];
+            remove(oldest.x, oldest.y);
+        } else {
+            ++count_;
+        }
+        samples_[head_] = {x, y};
+        add(x, y);
+        head_ = (head_ + 1) % WindowSize;
+
+        if (++updates_since_rebase_ >= WindowSize) {
+            rebase();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Add an observation with a UTC or GPS real-time VRT timestamp
+     */
+    template <TsiType TSI, TsfType TSF>
+    ClockModelUpdate update(const Timestamp<TSI, TSF>& vrt, time_point host) noexcept
+        requires(detail::is_epoch_real_time(TSI, TSF))
+    {
+        return update(vrt.to_chrono(), host);
+    }
+
+    /**
+     * @brief Predicted host time at which a VRT time is observed
+     *
+     * @return Prediction, or std::nullopt until the window spans two distinct VRT times
+     */
+    std::optional<time_point> predict_host_time(time_point vrt) const noexcept {
+        auto fit = solve();
+        if (!fit) {
+            return std::nullopt;
+        }
+        double x = seconds_between(vrt_ref_, vrt);
+        return host_ref_ + (vrt - vrt_ref_) + to_nanoseconds(fit->intercept + fit->slope * x);
+    }
+
+    template <TsiType TSI, TsfType TSF>
+    std::optional<time_point> predict_host_time(const Timestamp<TSI, TSF>& vrt) const noexcept
+        requires(detail::is_epoch_real_time(TSI, TSF))
+    {
+        return predict_host_time(vrt.to_chrono());
+    }
+
+    /**
+     * @brief Predicted VRT time corresponding to a host time
+     *
+     * @return Prediction, or std::nullopt until the model is established
+     */
+    std::optional<time_point> predict_vrt_time(time_point host) const noexcept {
+        auto fit = solve();
+        if (!fit || fit->slope <= -1.0) {
+            return std::nullopt;
+        }
+        double y = seconds_between(host_ref_, host);
+        return vrt_ref_ + to_nanoseconds((y - fit->intercept) / (1.0 + fit->slope));
+    }
+
+    /**
+     * @brief Predicted VRT timestamp (UTC or GPS real-time) for a host time
+     */
+    template <typename TimeStampType>
+    std::optional<TimeStampType> predict_vrt_timestamp(time_point host) const noexcept
+        requires(detail::is_epoch_real_time(TimeStampType{}.tsi_kind(), TimeStampType{}.tsf_kind()))
+    {
+        auto vrt = predict_vrt_time(host);
+        if (!vrt) {
+            return std::nullopt;
+        }
+        return TimeStampType::from_chrono(*vrt);
+    }
+
+    /**
+     * @brief Host time minus VRT time at the newest sample, per the model
+     */
+    std::optional<std::chrono::nanoseconds> offset() const noexcept {
+        auto fit = solve();
+        if (!fit) {
+            return std::nullopt;
+        }
+        const Sample& newest = samples_[(head_ + WindowSize - 1) % WindowSize];
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(host_ref_ - vrt_ref_) +
+               to_nanoseconds(fit->intercept + fit->slope * newest.x);
+    }
+
+    /**
+     * @brief Host clock rate relative to the VRT clock, in parts per million
+     *
+     * Positive when host time advances faster than VRT time.
+     */
+    std::optional<double> drift_ppm() const noexcept {
+        auto fit = solve();
+        if (!fit) {
+            return std::nullopt;
+        }
+        return fit->slope * 1e6;
+    }
+
+    /**
+     * @brief RMS of the fit residuals over the window
+     */
+    std::chrono::nanoseconds residual_rms() const noexcept {
+        return to_nanoseconds(residual_rms_seconds());
+    }
+
+    /**
+     * @brief True once the window spans two distinct VRT times
+     */
+    bool has_model() const noexcept { return solve().has_value(); }
+
+    size_t sample_count() const noexcept { return count_; }
+
+    static constexpr size_t window_size() noexcept { return WindowSize; }
+
+    const ClockModelConfig& config() const noexcept { return config_; }
+
+    /**
+     * @brief Discard all samples
+     */
+    void reset() noexcept {
+        count_ = 0;
+        head_ = 0;
+        updates_since_rebase_ = 0;
+        consecutive_outliers_ = 0;
+        sx_ = sy_ = sxx_ = sxy_ = syy_ = 0.0;
+    }
+
+private:
+    struct Sample {
+        double x; ///< VRT time, seconds since vrt_ref_
+        double y; ///< Host time since host_ref_ minus x: offset change, seconds
+    };
+
+    struct Fit {
+        double intercept;
+        double slope;
+    };
+
+    static double seconds_between(time_point from, time_point to) noexcept {
+        return std::chrono::duration<double>(to - from).count();
+    }
+
+    static std::chrono::nanoseconds to_nanoseconds(double seconds) noexcept {
+        return std::chrono::nanoseconds(static_cast<int64_t>(std::llround(seconds * 1e9)));
+    }
+
+    void add(double x, double y) noexcept {
+        sx_ += x;
+        sy_ += y;
+        sxx_ += x * x;
+        sxy_ += x * y;
+        syy_ += y * y;
+    }
+
+    void remove(double x, double y) noexcept {
+        sx_ -= x;
+        sy_ -= y;
+        sxx_ -= x * x;
+        sxy_ -= x * y;
+        syy_ -= y * y;
+    }
+
+    /// Centred second moments
+    double var_x() const noexcept { return sxx_ - sx_ * sx_ / static_cast<double>(count_); }
+    double cov_xy() const noexcept { return sxy_ - sx_ * sy_ / static_cast<double>(count_); }
+    double var_y() const noexcept { return syy_ - sy_ * sy_ / static_cast<double>(count_); }
+
+    std::optional<Fit> solve() const noexcept {
+        if (count_ < 2) {
+            return std::nullopt;
+        }
+        double vx = var_x();
+        // Degenerate if every sample carries (nearly) the same VRT time
+        if (!(vx > 1e-18 * static_cast<double>(count_))) {
+            return std::nullopt;
+        }
+        double n = static_cast<double>(count_);
+        double slope = cov_xy() / vx;
+        return Fit{(sy_ - slope * sx_) / n, slope};
+    }
+
+    double residual_rms_seconds() const noexcept {
+        if (count_ < 3 || !solve()) {
+            return 0.0;
+        }
+        double sse = var_y() - cov_xy() * cov_xy() / var_x();
+        return sse > 0.0 ? std::sqrt(sse / static_cast<double>(count_ - 2)) : 0.0;
+    }
+
+    /// Move the reference point to the oldest sample and recompute the sums exactly
+    void rebase() noexcept {
+        updates_since_rebase_ = 0;
+        size_t oldest = (head_ + WindowSize - count_) % WindowSize;
+        Sample origin = samples_[oldest];
+        auto shift_x = std::chrono::duration_cast<time_point::duration>(
+            std::chrono::duration<double>(origin.x));
+        auto shift_y = std::chrono::duration_cast<time_point::duration>(
+            std::chrono::duration<double>(origin.y));
+        vrt_ref_ += shift_x;
+        host_ref_ += shift_x + shift_y;
+        // Shift samples by what was applied to the references (whole clock ticks)
+        double dx = std::chrono::duration<double>(shift_x).count();
+        double dy = std::chrono::duration<double>(shift_y).count();
+        sx_ = sy_ = sxx_ = sxy_ = syy_ = 0.0;
+        for (size_t i = 0; i < count_; ++i) {
+            Sample& s = samples_[(oldest + i) % WindowSize];
+            s.x -= dx;
+            s.y -= dy;
+            add(s.x, s.y);
+        }
+    }
+
+    ClockModelConfig config_{};
+    std::array<Sample, WindowSize> samples_{};
+    size_t count_ = 0;
+    size_t head_ = 0;
+    size_t updates_since_rebase_ = 0;
+    size_t consecutive_outliers_ = 0;
+    time_point vrt_ref_{};
+    time_point host_ref_{};
+    double sx_ = 0.0;
+    double sy_ = 0.0;
+    double sxx_ = 0.0;
+    double sxy_ = 0.0;
+    double syy_ = 0.0;
+};
+
+} // namespace vrtigo
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vrtigo {
+
+/**
+ * @brief Control/Acknowledge Mode (CAM) field bit positions (VITA 49.2 command packets)
+ *
+ * The CAM word follows the prologue of every command packet. In control packets
+ * bits 20-16 request acknowledgements; in acknowledge packets the same bits say which
+ * acknowledgement this is and whether warning/error indicator fields follow.
+ *
+ * CAM format (32 bits):
+ * - Bit 31: ControlleeE - Controllee ID present
+ * - Bit 30: ControlleeI - Controllee ID is a 128-bit UUID (else a 32-bit word)
+ * - Bit 29: ControllerE - Controller ID present
+ * - Bit 28: ControllerI - Controller ID is a 128-bit UUID (else a 32-bit word)
+ * - Bit 27: P  - Partial execution permitted
+ * - Bit 26: W  - Execution with warnings permitted
+ * - Bit 25: Er - Execution with errors permitted
+ * - Bits 24-23: Action mode (no action, dry run, execute)
+ * - Bit 22: NK - Not-acknowledge only
+ * - Bit 20: V  - Validation acknowledge
+ * - Bit 19: X  - Execution acknowledge
+ * - Bit 18: S  - Query-state acknowledge
+ * - Bit 17: W  - Warnings (requested / warning indicator fields present)
+ * - Bit 16: Er - Errors (requested / error indicator fields present)
+ * - Bits 14-12: Timing control
+ */
+namespace cam {
+
+inline constexpr uint8_t controllee_enable_shift = 31;
+inline constexpr uint8_t controllee_uuid_shift = 30;
+inline constexpr uint8_t controller_enable_shift = 29;
+inline constexpr uint8_t controller_uuid_shift = 28;
+inline constexpr uint8_t permit_partial_shift = 27;
+inline constexpr uint8_t permit_warnings_shift = 26;
+inline constexpr uint8_t permit_errors_shift = 25;
+inline constexpr uint8_t action_mode_shift = 23;
+inline constexpr uint32_t action_mode_mask = 0x3; // After shift (2 bits)
+inline constexpr uint8_t not_ack_only_shift = 22;
+inline constexpr uint8_t validation_ack_shift = 20;
+inline constexpr uint8_t execution_ack_shift = 19;
+inline constexpr uint8_t query_state_ack_shift = 18;
+inline constexpr uint8_t warnings_shift = 17;
+inline constexpr uint8_t errors_shift = 16;
+inline constexpr uint8_t timing_control_shift = 12;
+inline constexpr uint32_t timing_control_mask = 0x7; // After shift (3 bits)
+
+// ID presence/format bits, managed by the command packet templates
+inline constexpr uint32_t id_bits_mask = 0xF0000000;
+
+} // namespace cam
+
+// Action requested by a control packet (CAM bits 24-23)
+enum class ActionMode : uint8_t {
+    none = 0,     // Take no action (acknowledge only)
+    dry_run = 1,  // Validate without applying
+    execute = 2,  // Apply the settings
+    reserved = 3  // Reserved
+};
+
+// Runtime CAM value type - trivially copyable
+class CamValue {
+private:
+    uint32_t word_;
+
+    constexpr bool bit(uint8_t shift) const noexcept { return (word_ >> shift) & 1U; }
+
+    constexpr void set_bit(uint8_t shift, bool value) noexcept {
+        word_ = (word_ & ~(1U << shift)) | (static_cast<uint32_t>(value) << shift);
+    }
+
+public:
+    constexpr CamValue() noexcept : word_(0) {}
+    constexpr explicit CamValue(uint32_t word) noexcept : word_(word) {}
+
+    // Raw CAM word
+    [[nodiscard]] constexpr uint32_t word() const noexcept { return word_; }
+
+    // ID presence and format (bits 31-28)
+    [[nodiscard]] constexpr bool has_controllee_id() const noexcept {
+        return bit(cam::controllee_enable_shift);
+    }
+    [[nodiscard]] constexpr bool controllee_id_is_uuid() const noexcept {
+        return bit(cam::controllee_uuid_shift);
+    }
+    [[nodiscard]] constexpr bool has_controller_id() const noexcept {
+        return bit(cam::controller_enable_shift);
+    }
+    [[nodiscard]] constexpr bool controller_id_is_uuid() const noexcept {
+        return bit(cam::controller_uuid_shift);
+    }
+
+    // Execution permissions (bits 27-25)
+    [[nodiscard]] constexpr bool permit_partial() const noexcept {
+        return bit(cam::permit_partial_shift);
+    }
+    [[nodiscard]] constexpr bool permit_warnings() const noexcept {
+        return bit(cam::permit_warnings_shift);
+    }
+    [[nodiscard]] constexpr bool permit_errors() const noexcept {
+        return bit(cam::permit_errors_shift);
+    }
+    constexpr void set_permit_partial(bool value) noexcept {
+        set_bit(cam::permit_partial_shift, value);
+    }
+    constexpr void set_permit_warnings(bool value) noexcept {
+        set_bit(cam::permit_warnings_shift, value);
+    }
+    constexpr void set_permit_errors(bool value) noexcept {
+        set_bit(cam::permit_errors_shift, value);
+    }
+
+    // Action mode (bits 24-23)
+    [[nodiscard]] constexpr ActionMode action_mode() const noexcept {
+        return static_cast<ActionMode>((word_ >> cam::action_mode_shift) & cam::action_mode_mask);
+    }
+    constexpr void set_action_mode(ActionMode mode) noexcept {
+        word_ = (word_ & ~(cam::action_mode_mask << cam::action_mode_shift)) |
+                ((static_cast<uint32_t>(mode) & cam::action_mode_mask) << cam::action_mode_shift);
+    }
+
+    // Not-acknowledge only (bit 22)
+    [[nodiscard]] constexpr bool not_ack_only() const noexcept {
+        return bit(cam::not_ack_only_shift);
+    }
+    constexpr void set_not_ack_only(bool value) noexcept {
+        set_bit(cam::not_ack_only_shift, value);
+    }
+
+    // Acknowledge requests (control) or acknowledge kind and contents (ack), bits 20-16
+    [[nodiscard]] constexpr bool validation_ack() const noexcept {
+        return bit(cam::validation_ack_shift);
+    }
+    [[nodiscard]] constexpr bool execution_ack() const noexcept {
+        return bit(cam::execution_ack_shift);
+    }
+    [[nodiscard]] constexpr bool query_state_ack() const noexcept {
+        return bit(cam::query_state_ack_shift);
+    }
+    [[nodiscard]] constexpr bool warnings() const noexcept { return bit(cam::warnings_shift); }
+    [[nodiscard]] constexpr bool errors() const noexcept { return bit(cam::errors_shift); }
+    constexpr void set_validation_ack(bool value) noexcept {
+        set_bit(cam::validation_ack_shift, value);
+    }
+    constexpr void set_execution_ack(bool value) noexcept {
+        set_bit(cam::execution_ack_shift, value);
+    }
+    constexpr void set_query_state_ack(bool value) noexcept {
+        set_bit(cam::query_state_ack_shift, value);
+    }
+    constexpr void set_warnings(bool value) noexcept { set_bit(cam::warnings_shift, value); }
+    constexpr void set_errors(bool value) noexcept { set_bit(cam::errors_shift, value); }
+
+    // Timing control (bits 14-12)
+    [[nodiscard]] constexpr uint8_t timing_control() const noexcept {
+        return static_cast<uint8_t>((word_ >> cam::timing_control_shift) &
+                                    cam::timing_control_mask);
+    }
+    constexpr void set_timing_control(uint8_t value) noexcept {
+        word_ = (word_ & ~(cam::timing_control_mask << cam::timing_control_shift)) |
+                ((static_cast<uint32_t>(value) & cam::timing_control_mask)
+                 << cam::timing_control_shift);
+    }
+
+    constexpr bool operator==(const CamValue&) const noexcept = default;
+};
+
+// Verify trivially copyable for performance and constexpr use
+static_assert(std::is_trivially_copyable_v<CamValue>, "CamValue must be trivially copyable");
+
+// 128-bit controllee/controller UUID, in packet (network) byte order
+using CommandUuidValue = std::array<uint8_t, 16>;
+
+// Marker types for controllee/controller ID presence and format
+struct NoCommandId {}; // ID field absent
+struct CommandId {};   // 32-bit ID word (1 word)
+struct CommandUuid {}; // 128-bit UUID (4 words)
+
+// Command ID trait system (mirrors ClassIdTraits)
+template <typename T>
+struct CommandIdTraits;
+
+template <>
+struct CommandIdTraits<NoCommandId> {
+    static constexpr size_t size_words = 0;
+    static constexpr bool present = false;
+    static constexpr bool is_uuid = false;
+};
+
+template <>
+struct CommandIdTraits<CommandId> {
+    static constexpr size_t size_words = 1;
+    static constexpr bool present = true;
+    static constexpr bool is_uuid = false;
+};
+
+template <>
+struct CommandIdTraits<CommandUuid> {
+    static constexpr size_t size_words = 4;
+    static constexpr bool present = true;
+    static constexpr bool is_uuid = true;
+};
+
+// Concept for valid controllee/controller ID marker types
+template <typename T>
+concept ValidCommandIdType = requires {
+    { CommandIdTraits<T>::size_words } -> std::convertible_to<size_t>;
+    { CommandIdTraits<T>::present } -> std::convertible_to<bool>;
+    { CommandIdTraits<T>::is_uuid } -> std::convertible_to<bool>;
+};
+
+} // namespace vrtigo
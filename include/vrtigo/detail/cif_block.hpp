@@ -0,0 +1,213 @@
+#pragma once
+
+#include <bit>
+
+#include <cstddef>
+#include <cstdint>
+#include <vrtigo/types.hpp>
+
+#include "cif.hpp"
+
+namespace vrtigo::detail {
+
+/**
+ * @brief CIF words of a packet and the extent of the fields they indicate
+ *
+ * Shared by the runtime context and command parsers. Populated by parse_cif_words()
+ * and parse_cif_fields(); CIF1-CIF3 are zero unless enabled in CIF0.
+ */
+struct CifBlock {
+    uint32_t cif0 = 0;
+    uint32_t cif1 = 0;
+    uint32_t cif2 = 0;
+    uint32_t cif3 = 0;
+    size_t fields_offset_bytes = 0; ///< First byte after the CIF words
+    size_t fields_words = 0;        ///< Words occupied by the indicated fields
+};
+
+/**
+ * @brief Read CIF0 and the CIF1-CIF3 words it enables
+ *
+ * Rejects any bit that is reserved or not supported by the field tables, so the
+ * table-driven offsets used by field access are valid for the whole block.
+ *
+ * @param buffer Packet buffer
+ * @param buffer_size Buffer size in bytes
+ * @param offset_words Word offset of CIF0; advanced past the last CIF word
+ * @param block Receives the CIF words and fields_offset_bytes
+ * @return ValidationError::none on success
+ */
+inline ValidationError parse_cif_words(const uint8_t* buffer, size_t buffer_size,
+                                       size_t& offset_words, CifBlock& block) noexcept {
+    if ((offset_words + 1) * 4 > buffer_size) {
+        return ValidationError::buffer_too_small;
+    }
+    block.cif0 = cif::read_u32_safe(buffer, offset_words * 4);
+    offset_words++;
+
+    if (block.cif0 & (1U << cif::CIF1_ENABLE_BIT)) {
+        if ((offset_words + 1) * 4 > buffer_size) {
+            return ValidationError::buffer_too_small;
+        }
+        block.cif1 = cif::read_u32_safe(buffer, offset_words * 4);
+        offset_words++;
+    }
+
+    if (block.cif0 & (1U << cif::CIF2_ENABLE_BIT)) {
+        if ((offset_words + 1) * 4 > buffer_size) {
+            return ValidationError::buffer_too_small;
+        }
+        block.cif2 = cif::read_u32_safe(buffer, offset_words * 4);
+        offset_words++;
+    }
+
+    if (block.cif0 & (1U << cif::CIF3_ENABLE_BIT)) {
+        if ((offset_words + 1) * 4 > buffer_size) {
+            return ValidationError::buffer_too_small;
+        }
+        block.cif3 = cif::read_u32_safe(buffer, offset_words * 4);
+        offset_words++;
+    }
+
+    // COMPLETE validation: reject ANY unsupported bits
+    // CIF0_SUPPORTED_MASK includes the CIF1/CIF2/CIF3 enable bits (1, 2 and 3)
+    if ((block.cif0 & ~cif::CIF0_SUPPORTED_MASK) || (block.cif1 & ~cif::CIF1_SUPPORTED_MASK) ||
+        (block.cif2 & ~cif::CIF2_SUPPORTED_MASK) || (block.cif3 & ~cif::CIF3_SUPPORTED_MASK)) {
+        return ValidationError::unsupported_field;
+    }
+
+    block.fields_offset_bytes = offset_words * 4;
+    return ValidationError::none;
+}
+
+/**
+ * @brief Read CIF0 and the CIF1-CIF3 words it enables without validating them
+ *
+ * Trusted-mode counterpart of parse_cif_words(): no supported-bit checks. The words are
+ * only read while they lie inside the packet, so a corrupted header cannot send the
+ * reads past the buffer.
+ *
+ * @param buffer Packet buffer
+ * @param size_words Packet size in words (already checked against the buffer)
+ * @param offset_words Word offset of CIF0; advanced past the last CIF word
+ * @param block Receives the CIF words and fields_offset_bytes
+ * @return false if the CIF words run past the end of the packet
+ */
+inline bool read_cif_words(const uint8_t* buffer, size_t size_words, size_t& offset_words,
+                           CifBlock& block) noexcept {
+    if (offset_words + 1 > size_words) {
+        return false;
+    }
+    block.cif0 = cif::read_u32_safe(buffer, offset_words++ * 4);
+    const size_t enabled = std::popcount(block.cif0 & cif::CIF_ENABLE_MASK);
+    if (offset_words + enabled > size_words) {
+        return false;
+    }
+    if (block.cif0 & (1U << cif::CIF1_ENABLE_BIT)) {
+        block.cif1 = cif::read_u32_safe(buffer, offset_words++ * 4);
+    }
+    if (block.cif0 & (1U << cif::CIF2_ENABLE_BIT)) {
+        block.cif2 = cif::read_u32_safe(buffer, offset_words++ * 4);
+    }
+    if (block.cif0 & (1U << cif::CIF3_ENABLE_BIT)) {
+        block.cif3 = cif::read_u32_safe(buffer, offset_words++ * 4);
+    }
+    block.fields_offset_bytes = offset_words * 4;
+    return true;
+}
+
+/**
+ * @brief Size the fields indicated by a CIF block
+ *
+ * Fixed fields are sized from the CIF tables; the variable-length GPS ASCII and Context
+ * Association fields (CIF0 bits 10 and 9, in that order) are sized from their length
+ * words, which must lie inside the buffer along with the whole field.
+ *
+ * @param buffer Packet buffer
+ * @param buffer_size Buffer size in bytes
+ * @param block Block from parse_cif_words(); receives fields_words
+ * @return ValidationError::none on success
+ */
+inline ValidationError parse_cif_fields(const uint8_t* buffer, size_t buffer_size,
+                                        CifBlock& block) noexcept {
+    const size_t base_words = block.fields_offset_bytes / 4;
+    size_t words = 0;
+
+    // Process all fixed CIF0 fields first (from MSB to LSB)
+    for (int bit = 31; bit >= 0; bit--) {
+        if (bit == cif::GPS_ASCII_BIT || bit == cif::CONTEXT_ASSOC_BIT)
+            continue; // Variable fields are sized from the buffer below
+
+        if (block.cif0 & (1U << bit)) {
+            words += cif::CIF0_FIELDS[bit].size_words;
+        }
+    }
+
+    // Variable fields IN ORDER (bit 10 before bit 9)
+    if (block.cif0 & (1U << cif::GPS_ASCII_BIT)) {
+        if ((base_words + words + 1) * 4 > buffer_size) {
+            return ValidationError::buffer_too_small;
+        }
+        words += cif::read_gps_ascii_length_words(buffer, (base_words + words) * 4);
+        if ((base_words + words) * 4 > buffer_size) {
+            return ValidationError::buffer_too_small;
+        }
+    }
+
+    if (block.cif0 & (1U << cif::CONTEXT_ASSOC_BIT)) {
+        if ((base_words + words + 1) * 4 > buffer_size) {
+            return ValidationError::buffer_too_small;
+        }
+        words += cif::read_context_assoc_length_words(buffer, (base_words + words) * 4);
+        if ((base_words + words) * 4 > buffer_size) {
+            return ValidationError::buffer_too_small;
+        }
+    }
+
+    // CIF1-CIF3 fields (zero words unless enabled)
+    for (int bit = 31; bit >= 0; --bit) {
+        if (block.cif1 & (1U << bit)) {
+            words += cif::CIF1_FIELDS[bit].size_words;
+        }
+        if (block.cif2 & (1U << bit)) {
+            words += cif::CIF2_FIELDS[bit].size_words;
+        }
+        if (block.cif3 & (1U << bit)) {
+            words += cif::CIF3_FIELDS[bit].size_words;
+        }
+    }
+
+    block.fields_words = words;
+    return ValidationError::none;
+}
+
+/**
+ * @brief Number of fields indicated by CIF words (enable bits excluded)
+ *
+ * Used for indicator blocks that carry one word per field, such as the warning and
+ * error indicator fields of command acknowledge packets.
+ */
+inline constexpr size_t cif_field_count(uint32_t cif0, uint32_t cif1, uint32_t cif2,
+                                        uint32_t cif3) noexcept {
+    return static_cast<size_t>(std::popcount(cif0 & ~cif::CIF_ENABLE_MASK) +
+                               std::popcount(cif1) + std::popcount(cif2) + std::popcount(cif3));
+}
+
+/**
+ * @brief Position of a field among the fields indicated by CIF words
+ *
+ * Fields are ordered CIF0 to CIF3, most significant bit first, so the fields preceding
+ * the target are all set bits of earlier words plus the higher bits of its own word.
+ */
+inline constexpr size_t cif_field_index(uint32_t cif0, uint32_t cif1, uint32_t cif2,
+                                        uint32_t cif3, uint8_t cif_word, uint8_t bit) noexcept {
+    const uint32_t words[4] = {cif0 & ~cif::CIF_ENABLE_MASK, cif1, cif2, cif3};
+    const uint32_t preceding = (bit >= 31) ? 0U : ~((2U << bit) - 1U);
+    size_t index = 0;
+    for (uint8_t w = 0; w < cif_word && w < 4; ++w) {
+        index += static_cast<size_t>(std::popcount(words[w]));
+    }
+    return index + static_cast<size_t>(std::popcount(words[cif_word & 3] & preceding));
+}
+
+} // namespace vrtigo::detail
@@ -0,0 +1,588 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+
+#include <cstring>
+#include <vrtigo/class_id.hpp>
+#include <vrtigo/command_cam.hpp>
+#include <vrtigo/field_tags.hpp>
+#include <vrtigo/types.hpp>
+
+#include "cif.hpp"
+#include "cif_block.hpp"
+#include "endian.hpp"
+#include "field_access.hpp"
+#include "field_mask.hpp"
+#include "header_decode.hpp"
+#include "header_init.hpp"
+#include "packet_header_accessor.hpp"
+#include "prologue.hpp"
+#include "timestamp_traits.hpp"
+
+namespace vrtigo {
+
+// Kind of command packet built by CommandPacketBase (header bits 26/24 and CAM S)
+enum class CommandKind : uint8_t {
+    control,        // Control packet: CIF words and field values to apply
+    cancellation,   // Cancellation packet (bit 24): CIF words naming fields, no values
+    query_state_ack // Query-state acknowledge (bit 26, CAM S): CIF words and current values
+};
+
+// Set of fields given as field tags (warning/error indicators of AckPacket)
+template <auto... Fields>
+using FieldSet = detail::FieldMask<Fields...>;
+
+namespace detail {
+
+/**
+ * @brief Common part of the compile-time command packets
+ *
+ * Owns the standard prologue (stream ID always present) followed by the CAM word, the
+ * message ID, and the controllee and controller IDs (0, 1 or 4 words each). The CAM bits
+ * in FixedCamMask describe the packet structure (ID presence/format, acknowledge kind,
+ * indicator blocks) and are kept when the user replaces the CAM with set_cam().
+ */
+template <typename TimestampType, typename ClassIdType, typename ControlleeIdType,
+          typename ControllerIdType, uint32_t FixedCamMask>
+    requires ValidTimestampType<TimestampType> && ValidClassIdType<ClassIdType> &&
+             ValidCommandIdType<ControlleeIdType> && ValidCommandIdType<ControllerIdType>
+class CommandPrologue {
+protected:
+    using prologue_type = Prologue<PacketType::command, ClassIdType, TimestampType, true>;
+    using controllee_traits = CommandIdTraits<ControlleeIdType>;
+    using controller_traits = CommandIdTraits<ControllerIdType>;
+
+    // Word offsets from start of packet
+    static constexpr size_t cam_offset = prologue_type::payload_offset;
+    static constexpr size_t message_id_offset = cam_offset + 1;
+    static constexpr size_t controllee_offset = message_id_offset + 1;
+    static constexpr size_t controller_offset = controllee_offset + controllee_traits::size_words;
+    static constexpr size_t body_offset = controller_offset + controller_traits::size_words;
+
+    // CAM bits implied by the ID marker types
+    static constexpr uint32_t id_cam_bits =
+        (controllee_traits::present ? (1U << cam::controllee_enable_shift) : 0U) |
+        (controllee_traits::is_uuid ? (1U << cam::controllee_uuid_shift) : 0U) |
+        (controller_traits::present ? (1U << cam::controller_enable_shift) : 0U) |
+        (controller_traits::is_uuid ? (1U << cam::controller_uuid_shift) : 0U);
+
+    uint8_t* buffer_;
+    mutable prologue_type prologue_;
+
+    explicit CommandPrologue(uint8_t* buffer) noexcept : buffer_(buffer), prologue_(buffer) {}
+
+    /**
+     * @brief Write header, zeroed prologue fields, CAM and zeroed message ID and IDs
+     */
+    void init_prologue(uint16_t size_words, bool ack, bool cancel, uint32_t cam_word) noexcept {
+        const uint32_t header =
+            build_header(static_cast<uint8_t>(PacketType::command), prologue_type::has_class_id,
+                         ack,    // Bit 26: Acknowledge
+                         false,  // Bit 25: Reserved
+                         cancel, // Bit 24: Cancellation
+                         prologue_type::tsi, prologue_type::tsf, 0, size_words);
+        cif::write_u32_safe(buffer_, 0, header);
+        prologue_.init_stream_id();
+        if constexpr (prologue_type::has_class_id) {
+            prologue_.init_class_id();
+        }
+        if constexpr (prologue_type::has_timestamp) {
+            prologue_.init_timestamps();
+        }
+        cif::write_u32_safe(buffer_, cam_offset * vrt_word_size, cam_word);
+        std::memset(buffer_ + message_id_offset * vrt_word_size, 0,
+                    (body_offset - message_id_offset) * vrt_word_size);
+    }
+
+    // Write CIF-format indicator words (CIF0 with enable bits, then enabled CIF1-CIF3)
+    template <uint32_t CIF0, uint32_t CIF1, uint32_t CIF2, uint32_t CIF3>
+    size_t write_cif_words(size_t offset) noexcept {
+        cif::write_u32_safe(buffer_, offset, CIF0);
+        offset += 4;
+        if constexpr (CIF1 != 0) {
+            cif::write_u32_safe(buffer_, offset, CIF1);
+            offset += 4;
+        }
+        if constexpr (CIF2 != 0) {
+            cif::write_u32_safe(buffer_, offset, CIF2);
+            offset += 4;
+        }
+        if constexpr (CIF3 != 0) {
+            cif::write_u32_safe(buffer_, offset, CIF3);
+            offset += 4;
+        }
+        return offset;
+    }
+
+public:
+    // Packet component presence (per VITA 49.2 spec)
+    static constexpr bool has_stream_id = true; // Always present per spec
+    static constexpr bool has_class_id = prologue_type::has_class_id;
+    static constexpr bool has_timestamp = prologue_type::has_timestamp;
+    static constexpr bool has_timestamp_integer = (prologue_type::tsi != TsiType::none);
+    static constexpr bool has_timestamp_fractional = (prologue_type::tsf != TsfType::none);
+    static constexpr bool has_trailer = false; // Bit 26 is the acknowledge indicator
+
+    /**
+     * Get header accessor (mutable)
+     * @return Mutable accessor for header fields
+     */
+    MutableHeaderView header() noexcept { return MutableHeaderView{&prologue_.header_word()}; }
+
+    /**
+     * Get header accessor (const)
+     * @return Const accessor for header fields
+     */
+    HeaderView header() const noexcept { return HeaderView{&prologue_.header_word()}; }
+
+    // Stream ID accessor (always present per VITA 49.2 spec)
+    uint32_t stream_id() const noexcept { return prologue_.stream_id(); }
+
+    void set_stream_id(uint32_t id) noexcept { prologue_.set_stream_id(id); }
+
+    // Packet count accessor (4-bit field in header, valid range 0-15)
+    uint8_t packet_count() const noexcept { return prologue_.packet_count(); }
+
+    void set_packet_count(uint8_t count) noexcept { prologue_.set_packet_count(count); }
+
+    // Timestamp accessors
+
+    TimestampType timestamp() const noexcept
+        requires(has_timestamp)
+    {
+        return prologue_.timestamp();
+    }
+
+    void set_timestamp(TimestampType ts) noexcept
+        requires(has_timestamp)
+    {
+        prologue_.set_timestamp(ts);
+    }
+
+    // Class ID accessors
+
+    ClassIdValue class_id() const noexcept
+        requires(has_class_id)
+    {
+        return prologue_.class_id();
+    }
+
+    void set_class_id(ClassIdValue cid) noexcept
+        requires(has_class_id)
+    {
+        prologue_.set_class_id(cid);
+    }
+
+    // CAM accessors
+
+    CamValue cam() const noexcept { return CamValue(cif::read_u32_safe(buffer_, cam_offset * 4)); }
+
+    /**
+     * Replace the CAM field
+     *
+     * Structural bits (ID presence/format, acknowledge kind and indicator presence) are
+     * fixed by the packet template and keep their current value.
+     */
+    void set_cam(CamValue value) noexcept {
+        uint32_t merged = (value.word() & ~FixedCamMask) | (cam().word() & FixedCamMask);
+        cif::write_u32_safe(buffer_, cam_offset * 4, merged);
+    }
+
+    // Message ID accessor (pairs acknowledgements with their control packet)
+    uint32_t message_id() const noexcept {
+        return cif::read_u32_safe(buffer_, message_id_offset * 4);
+    }
+
+    void set_message_id(uint32_t id) noexcept {
+        cif::write_u32_safe(buffer_, message_id_offset * 4, id);
+    }
+
+    // Controllee ID accessors
+
+    uint32_t controllee_id() const noexcept
+        requires(std::same_as<ControlleeIdType, CommandId>)
+    {
+        return cif::read_u32_safe(buffer_, controllee_offset * 4);
+    }
+
+    void set_controllee_id(uint32_t id) noexcept
+        requires(std::same_as<ControlleeIdType, CommandId>)
+    {
+        cif::write_u32_safe(buffer_, controllee_offset * 4, id);
+    }
+
+    CommandUuidValue controllee_uuid() const noexcept
+        requires(std::same_as<ControlleeIdType, CommandUuid>)
+    {
+        return read_uuid(controllee_offset);
+    }
+
+    void set_controllee_uuid(const CommandUuidValue& id) noexcept
+        requires(std::same_as<ControlleeIdType, CommandUuid>)
+    {
+        std::memcpy(buffer_ + controllee_offset * 4, id.data(), id.size());
+    }
+
+    // Controller ID accessors
+
+    uint32_t controller_id() const noexcept
+        requires(std::same_as<ControllerIdType, CommandId>)
+    {
+        return cif::read_u32_safe(buffer_, controller_offset * 4);
+    }
+
+    void set_controller_id(uint32_t id) noexcept
+        requires(std::same_as<ControllerIdType, CommandId>)
+    {
+        cif::write_u32_safe(buffer_, controller_offset * 4, id);
+    }
+
+    CommandUuidValue controller_uuid() const noexcept
+        requires(std::same_as<ControllerIdType, CommandUuid>)
+    {
+        return read_uuid(controller_offset);
+    }
+
+    void set_controller_uuid(const CommandUuidValue& id) noexcept
+        requires(std::same_as<ControllerIdType, CommandUuid>)
+    {
+        std::memcpy(buffer_ + controller_offset * 4, id.data(), id.size());
+    }
+
+private:
+    CommandUuidValue read_uuid(size_t offset_words) const noexcept {
+        CommandUuidValue value{};
+        std::memcpy(value.data(), buffer_ + offset_words * 4, value.size());
+        return value;
+    }
+};
+
+// CAM bits fixed by the ID marker types
+inline constexpr uint32_t command_id_cam_mask = cam::id_bits_mask;
+
+} // namespace detail
+
+// Base compile-time command packet template (low-level API)
+// Builds control, cancellation and query-state acknowledge packets from CIF bitmasks.
+// Variable-length fields are NOT supported in this template.
+//
+// Layout: prologue, CAM, message ID, controllee ID, controller ID, CIF words, then the
+// field values (none for cancellation packets, which only name the cancelled fields).
+//
+// NOTE: Most users should use the field-based ControlPacket, CancellationPacket and
+// QueryStateAckPacket templates instead.
+template <CommandKind Kind, typename TimestampType = NoTimestamp, typename ClassIdType = NoClassId,
+          typename ControlleeIdType = NoCommandId, typename ControllerIdType = NoCommandId,
+          uint32_t CIF0 = 0, uint32_t CIF1 = 0, uint32_t CIF2 = 0, uint32_t CIF3 = 0>
+class CommandPacketBase
+    : public detail::CommandPrologue<
+          TimestampType, ClassIdType, ControlleeIdType, ControllerIdType,
+          detail::command_id_cam_mask |
+              (Kind == CommandKind::query_state_ack ? (1U << cam::query_state_ack_shift) : 0U)> {
+private:
+    using common_type = detail::CommandPrologue<
+        TimestampType, ClassIdType, ControlleeIdType, ControllerIdType,
+        detail::command_id_cam_mask |
+            (Kind == CommandKind::query_state_ack ? (1U << cam::query_state_ack_shift) : 0U)>;
+
+    // Compute actual CIF0 with automatic CIF1/CIF2/CIF3 enable bits
+    static constexpr uint32_t computed_cif0 = CIF0 |
+                                              ((CIF1 != 0) ? (1U << cif::CIF1_ENABLE_BIT) : 0) |
+                                              ((CIF2 != 0) ? (1U << cif::CIF2_ENABLE_BIT) : 0) |
+                                              ((CIF3 != 0) ? (1U << cif::CIF3_ENABLE_BIT) : 0);
+
+    static_assert((CIF0 & cif::CIF_ENABLE_MASK) == 0,
+                  "Do not set CIF1/CIF2/CIF3 enable bits (1,2,3) in CIF0 - they are auto-managed "
+                  "based on CIF1/CIF2/CIF3 parameters");
+    static_assert((CIF0 & ~cif::CIF0_COMPILETIME_SUPPORTED_MASK) == 0,
+                  "CIF0 contains unsupported, reserved, or variable-length fields");
+    static_assert(CIF1 == 0 || (CIF1 & ~cif::CIF1_SUPPORTED_MASK) == 0,
+                  "CIF1 contains unsupported or reserved fields");
+    static_assert(CIF2 == 0 || (CIF2 & ~cif::CIF2_SUPPORTED_MASK) == 0,
+                  "CIF2 contains unsupported or reserved fields");
+    static_assert(CIF3 == 0 || (CIF3 & ~cif::CIF3_SUPPORTED_MASK) == 0,
+                  "CIF3 contains unsupported or reserved fields");
+
+    static constexpr size_t cif_words =
+        1 + ((CIF1 != 0) ? 1 : 0) + ((CIF2 != 0) ? 1 : 0) + ((CIF3 != 0) ? 1 : 0);
+
+    // Cancellation packets list the fields without values
+    static constexpr bool carries_values = Kind != CommandKind::cancellation;
+
+    static constexpr size_t fields_words =
+        carries_values ? cif::calculate_context_size_ct<CIF0, CIF1, CIF2, CIF3>() : 0;
+
+    static constexpr uint32_t initial_cam =
+        common_type::id_cam_bits |
+        (Kind == CommandKind::query_state_ack ? (1U << cam::query_state_ack_shift) : 0U);
+
+public:
+    // Packet size configuration
+    static constexpr size_t size_words = common_type::body_offset + cif_words + fields_words;
+    static constexpr size_t size_bytes = size_words * 4;
+    static constexpr uint32_t cif0_value = computed_cif0; // For field access (with enable bits)
+    static constexpr uint32_t cif1_value = CIF1;
+    static constexpr uint32_t cif2_value = CIF2;
+    static constexpr uint32_t cif3_value = CIF3;
+    static constexpr CommandKind kind = Kind;
+
+    explicit CommandPacketBase(uint8_t* buffer, bool init = true) noexcept
+        : common_type(buffer) {
+        if (init) {
+            this->init_prologue(size_words, Kind == CommandKind::query_state_ack,
+                                Kind == CommandKind::cancellation, initial_cam);
+            this->template write_cif_words<computed_cif0, CIF1, CIF2, CIF3>(
+                common_type::body_offset * 4);
+        }
+    }
+
+    // Buffer access
+    std::span<uint8_t, size_bytes> as_bytes() noexcept {
+        return std::span<uint8_t, size_bytes>(this->buffer_, size_bytes);
+    }
+
+    std::span<const uint8_t, size_bytes> as_bytes() const noexcept {
+        return std::span<const uint8_t, size_bytes>(this->buffer_, size_bytes);
+    }
+
+    // Field access via subscript operator (not for cancellation packets)
+    template <uint8_t CifWord, uint8_t Bit>
+    auto operator[](field::field_tag_t<CifWord, Bit> tag) noexcept
+        -> FieldProxy<field::field_tag_t<CifWord, Bit>, CommandPacketBase>
+        requires(carries_values)
+    {
+        return detail::make_field_proxy(*this, tag);
+    }
+
+    template <uint8_t CifWord, uint8_t Bit>
+    auto operator[](field::field_tag_t<CifWord, Bit> tag) const noexcept
+        -> FieldProxy<field::field_tag_t<CifWord, Bit>, const CommandPacketBase>
+        requires(carries_values)
+    {
+        return detail::make_field_proxy(*this, tag);
+    }
+
+    // Internal implementation details - DO NOT USE DIRECTLY
+    // These methods are required by the field access implementation (CifPacketBase concept)
+    const uint8_t* context_buffer() const noexcept { return this->buffer_; }
+    uint8_t* mutable_context_buffer() noexcept { return this->buffer_; }
+    static constexpr size_t context_base_offset() noexcept {
+        return (common_type::body_offset + cif_words) * 4;
+    }
+    static constexpr uint32_t cif0() noexcept { return computed_cif0; }
+    static constexpr uint32_t cif1() noexcept { return CIF1; }
+    static constexpr uint32_t cif2() noexcept { return CIF2; }
+    static constexpr uint32_t cif3() noexcept { return CIF3; }
+    static constexpr size_t buffer_size() noexcept { return size_bytes; }
+
+    // Validation (primarily for testing)
+    ValidationError validate(size_t buffer_size) const noexcept {
+        if (buffer_size < size_bytes) {
+            return ValidationError::buffer_too_small;
+        }
+
+        auto decoded = detail::decode_header(cif::read_u32_safe(this->buffer_, 0));
+        if (!detail::is_command_packet(decoded.type) ||
+            decoded.command_ack != (Kind == CommandKind::query_state_ack) ||
+            decoded.command_cancel != (Kind == CommandKind::cancellation)) {
+            return ValidationError::packet_type_mismatch;
+        }
+        if (decoded.size_words != size_words) {
+            return ValidationError::size_field_mismatch;
+        }
+        return ValidationError::none;
+    }
+};
+
+/**
+ * Compile-time validation/execution acknowledge packet
+ *
+ * Carries warning indicator words (when Warnings is non-empty), error indicator words
+ * (when Errors is non-empty), then one 32-bit response word per indicated field. CAM W
+ * and Er are set from the sets; set V or X (validation or execution) with set_cam().
+ *
+ * Example usage:
+ *     using Ack = AckPacket<NoTimestamp, NoClassId, CommandId, NoCommandId,
+ *                           FieldSet<>, FieldSet<field::rf_reference_frequency>>;
+ *     Ack ack(buffer);
+ *     ack.set_error_response(field::rf_reference_frequency, code);
+ */
+template <typename TimestampType = NoTimestamp, typename ClassIdType = NoClassId,
+          typename ControlleeIdType = NoCommandId, typename ControllerIdType = NoCommandId,
+          typename Warnings = FieldSet<>, typename Errors = FieldSet<>>
+class AckPacket
+    : public detail::CommandPrologue<TimestampType, ClassIdType, ControlleeIdType,
+                                     ControllerIdType,
+                                     detail::command_id_cam_mask | (1U << cam::warnings_shift) |
+                                         (1U << cam::errors_shift) |
+                                         (1U << cam::query_state_ack_shift)> {
+private:
+    using common_type =
+        detail::CommandPrologue<TimestampType, ClassIdType, ControlleeIdType, ControllerIdType,
+                                detail::command_id_cam_mask | (1U << cam::warnings_shift) |
+                                    (1U << cam::errors_shift) |
+                                    (1U << cam::query_state_ack_shift)>;
+
+    template <typename Set>
+    static constexpr uint32_t indicator_cif0 =
+        Set::cif0 | ((Set::cif1 != 0) ? (1U << cif::CIF1_ENABLE_BIT) : 0) |
+        ((Set::cif2 != 0) ? (1U << cif::CIF2_ENABLE_BIT) : 0) |
+        ((Set::cif3 != 0) ? (1U << cif::CIF3_ENABLE_BIT) : 0);
+
+    template <typename Set>
+    static constexpr bool is_empty_set =
+        Set::cif0 == 0 && Set::cif1 == 0 && Set::cif2 == 0 && Set::cif3 == 0;
+
+    template <typename Set>
+    static constexpr size_t indicator_words =
+        is_empty_set<Set> ? 0
+                          : 1 + ((Set::cif1 != 0) ? 1 : 0) + ((Set::cif2 != 0) ? 1 : 0) +
+                                ((Set::cif3 != 0) ? 1 : 0);
+
+    template <typename Set>
+    static constexpr size_t field_count =
+        detail::cif_field_count(Set::cif0, Set::cif1, Set::cif2, Set::cif3);
+
+    static_assert(((Warnings::cif0 | Errors::cif0) & ~cif::CIF0_SUPPORTED_MASK) == 0 &&
+                      ((Warnings::cif0 | Errors::cif0) & cif::CIF_ENABLE_MASK) == 0 &&
+                      ((Warnings::cif1 | Errors::cif1) & ~cif::CIF1_SUPPORTED_MASK) == 0 &&
+                      ((Warnings::cif2 | Errors::cif2) & ~cif::CIF2_SUPPORTED_MASK) == 0 &&
+                      ((Warnings::cif3 | Errors::cif3) & ~cif::CIF3_SUPPORTED_MASK) == 0,
+                  "Warning/error sets contain unsupported or reserved fields");
+
+    static constexpr size_t warnings_offset = common_type::body_offset;
+    static constexpr size_t errors_offset = warnings_offset + indicator_words<Warnings>;
+    static constexpr size_t warning_responses_offset = errors_offset + indicator_words<Errors>;
+    static constexpr size_t error_responses_offset =
+        warning_responses_offset + field_count<Warnings>;
+
+    static constexpr uint32_t initial_cam =
+        common_type::id_cam_bits |
+        (is_empty_set<Warnings> ? 0U : (1U << cam::warnings_shift)) |
+        (is_empty_set<Errors> ? 0U : (1U << cam::errors_shift));
+
+    template <typename Set, uint8_t CifWord, uint8_t Bit>
+    static constexpr size_t response_index() noexcept {
+        static_assert(detail::is_field_present<CifWord, Bit>(Set::cif0, Set::cif1, Set::cif2,
+                                                             Set::cif3),
+                      "Field is not in this acknowledge packet's indicator set");
+        return detail::cif_field_index(Set::cif0, Set::cif1, Set::cif2, Set::cif3, CifWord, Bit);
+    }
+
+public:
+    // Packet size configuration
+    static constexpr size_t size_words = error_responses_offset + field_count<Errors>;
+    static constexpr size_t size_bytes = size_words * 4;
+
+    explicit AckPacket(uint8_t* buffer, bool init = true) noexcept : common_type(buffer) {
+        if (init) {
+            this->init_prologue(size_words, true, false, initial_cam);
+            if constexpr (!is_empty_set<Warnings>) {
+                this->template write_cif_words<indicator_cif0<Warnings>, Warnings::cif1,
+                                               Warnings::cif2, Warnings::cif3>(warnings_offset *
+                                                                               4);
+            }
+            if constexpr (!is_empty_set<Errors>) {
+                this->template write_cif_words<indicator_cif0<Errors>, Errors::cif1, Errors::cif2,
+                                               Errors::cif3>(errors_offset * 4);
+            }
+            std::memset(this->buffer_ + warning_responses_offset * 4, 0,
+                        (size_words - warning_responses_offset) * 4);
+        }
+    }
+
+    // Buffer access
+    std::span<uint8_t, size_bytes> as_bytes() noexcept {
+        return std::span<uint8_t, size_bytes>(this->buffer_, size_bytes);
+    }
+
+    std::span<const uint8_t, size_bytes> as_bytes() const noexcept {
+        return std::span<const uint8_t, size_bytes>(this->buffer_, size_bytes);
+    }
+
+    // Warning response word for a field in Warnings
+    template <uint8_t CifWord, uint8_t Bit>
+    uint32_t warning_response(field::field_tag_t<CifWord, Bit>) const noexcept {
+        constexpr size_t index = response_index<Warnings, CifWord, Bit>();
+        return cif::read_u32_safe(this->buffer_, (warning_responses_offset + index) * 4);
+    }
+
+    template <uint8_t CifWord, uint8_t Bit>
+    void set_warning_response(field::field_tag_t<CifWord, Bit>, uint32_t response) noexcept {
+        constexpr size_t index = response_index<Warnings, CifWord, Bit>();
+        cif::write_u32_safe(this->buffer_, (warning_responses_offset + index) * 4, response);
+    }
+
+    // Error response word for a field in Errors
+    template <uint8_t CifWord, uint8_t Bit>
+    uint32_t error_response(field::field_tag_t<CifWord, Bit>) const noexcept {
+        constexpr size_t index = response_index<Errors, CifWord, Bit>();
+        return cif::read_u32_safe(this->buffer_, (error_responses_offset + index) * 4);
+    }
+
+    template <uint8_t CifWord, uint8_t Bit>
+    void set_error_response(field::field_tag_t<CifWord, Bit>, uint32_t response) noexcept {
+        constexpr size_t index = response_index<Errors, CifWord, Bit>();
+        cif::write_u32_safe(this->buffer_, (error_responses_offset + index) * 4, response);
+    }
+
+    // Validation (primarily for testing)
+    ValidationError validate(size_t buffer_size) const noexcept {
+        if (buffer_size < size_bytes) {
+            return ValidationError::buffer_too_small;
+        }
+
+        auto decoded = detail::decode_header(cif::read_u32_safe(this->buffer_, 0));
+        if (!detail::is_command_packet(decoded.type) || !decoded.command_ack) {
+            return ValidationError::packet_type_mismatch;
+        }
+        if (decoded.size_words != size_words) {
+            return ValidationError::size_field_mismatch;
+        }
+        return ValidationError::none;
+    }
+};
+
+// Field-based command packet templates (user-friendly API)
+// Automatically compute CIF bitmasks from field tags
+//
+// Example usage:
+//     using namespace vrtigo::field;
+//     using Tune = ControlPacket<NoTimestamp, NoClassId, CommandId, NoCommandId,
+//                                bandwidth, sample_rate>;
+//     Tune cmd(buffer);
+//     cmd.set_message_id(42);
+//     cmd[bandwidth].set_value(20e6);
+
+template <CommandKind Kind, typename TimestampType, typename ClassIdType,
+          typename ControlleeIdType, typename ControllerIdType, auto... Fields>
+using FieldCommandPacket =
+    CommandPacketBase<Kind, TimestampType, ClassIdType, ControlleeIdType, ControllerIdType,
+                      detail::FieldMask<Fields...>::cif0, detail::FieldMask<Fields...>::cif1,
+                      detail::FieldMask<Fields...>::cif2, detail::FieldMask<Fields...>::cif3>;
+
+// Control packet carrying the values to apply
+template <typename TimestampType = NoTimestamp, typename ClassIdType = NoClassId,
+          typename ControlleeIdType = NoCommandId, typename ControllerIdType = NoCommandId,
+          auto... Fields>
+using ControlPacket = FieldCommandPacket<CommandKind::control, TimestampType, ClassIdType,
+                                         ControlleeIdType, ControllerIdType, Fields...>;
+
+// Cancellation packet naming the fields whose pending control is cancelled
+template <typename TimestampType = NoTimestamp, typename ClassIdType = NoClassId,
+          typename ControlleeIdType = NoCommandId, typename ControllerIdType = NoCommandId,
+          auto... Fields>
+using CancellationPacket = FieldCommandPacket<CommandKind::cancellation, TimestampType,
+                                              ClassIdType, ControlleeIdType, ControllerIdType,
+                                              Fields...>;
+
+// Query-state acknowledge packet carrying the current values
+template <typename TimestampType = NoTimestamp, typename ClassIdType = NoClassId,
+          typename ControlleeIdType = NoCommandId, typename ControllerIdType = NoCommandId,
+          auto... Fields>
+using QueryStateAckPacket = FieldCommandPacket<CommandKind::query_state_ack, TimestampType,
+                                               ClassIdType, ControlleeIdType, ControllerIdType,
+                                               Fields...>;
+
+} // namespace vrtigo
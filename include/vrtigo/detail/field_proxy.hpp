@@ -21,6 +21,7 @@ namespace vrtigo {
  * - .bytes() / .set_bytes() - Literal on-wire bytes
  * - .encoded() / .set_encoded() - Structured wire format (uint32_t, FieldView, etc.)
  * - .value() / .set_value() - Interpreted values (Hz, dBm, etc.) - opt-in only
+ * - .scaled() / .set_scaled() - Exact integer units (mHz, centi-dB, etc.) - opt-in only
  *
  * @tparam FieldTag Field tag type (field::field_tag_t<CifWord, Bit>)
  * @tparam Packet Packet or view type (const or non-const)
@@ -31,6 +32,7 @@ namespace vrtigo {
  *       auto bytes = bw.bytes();              // Raw on-wire bytes
  *       uint64_t enc = bw.encoded();          // Structured Q52.12 encoding
  *       double hz = bw.value();               // Interpreted Hz (if supported)
+ *       uint64_t mhz = bw.scaled();           // Integer millihertz (if supported)
  *   }
  */
 template <typename FieldTag, typename Packet>
@@ -283,6 +285,78 @@ public:
                       "Cannot dereference field proxy without interpreted support. "
                       "Use .encoded() instead, or add interpreted support to enable operator*.");
     }
+
+    /**
+     * Get field value in exact integer units (millihertz, centi-dB, etc.)
+     *
+     * Converts the fixed-point encoding with integer arithmetic only, so results are exact,
+     * reproducible across platforms, and cheap enough for bulk use.
+     * Only available for fields with scaled support (FieldTraits defines scaled_type and
+     * to_scaled()/from_scaled()).
+     *
+     * @return Scaled value (e.g., uint64_t mHz for bandwidth, int32_t centi-dBm for
+     *         reference level)
+     *
+     * Precondition: has_value() must be true (checked by assertion in debug builds)
+     */
+    [[nodiscard]] auto scaled() const noexcept -> detail::scaled_type_or_dummy_t<FieldTag>
+        requires detail::HasScaledAccess<FieldTag>
+    {
+        assert(present_ && "FieldProxy::scaled() called on field that is not present");
+        assert(packet_ && "FieldProxy::scaled() called on invalid proxy");
+
+        using Trait = detail::FieldTraits<FieldTag::cif, FieldTag::bit>;
+        return Trait::to_scaled(encoded());
+    }
+
+    /**
+     * Diagnostic fallback: Helpful error when .scaled() called without scaled support
+     */
+    template <typename T = void>
+    auto scaled() const noexcept -> void
+        requires(!detail::HasScaledAccess<FieldTag>)
+    {
+        static_assert(detail::always_false<T>,
+                      "Field does not have scaled integer support. "
+                      "Use .encoded() to access the on-wire format, "
+                      "or add scaled_type/to_scaled()/from_scaled() "
+                      "to the FieldTraits specialization to enable .scaled().");
+    }
+
+    /**
+     * Write value given in integer units to field (mutable packets only)
+     *
+     * Values beyond the field's fixed-point range saturate.
+     *
+     * @param v Scaled value to write (e.g., uint64_t mHz)
+     */
+    void set_scaled(detail::scaled_type_or_dummy_t<FieldTag> v) noexcept
+        requires detail::HasScaledAccess<FieldTag> &&
+                 requires(Packet& p) {
+                     { p.mutable_context_buffer() } -> std::same_as<uint8_t*>;
+                 } && detail::FixedFieldTrait<detail::FieldTraits<FieldTag::cif, FieldTag::bit>>
+    {
+        if (!present_ || !packet_) {
+            return;
+        }
+
+        using Trait = detail::FieldTraits<FieldTag::cif, FieldTag::bit>;
+        set_encoded(Trait::from_scaled(v));
+    }
+
+    /**
+     * Diagnostic fallback: Helpful error when .set_scaled() called without scaled support
+     */
+    template <typename T = void>
+    void set_scaled(const auto&) const noexcept
+        requires(!detail::HasScaledAccess<FieldTag>)
+    {
+        static_assert(detail::always_false<T>,
+                      "Field does not have scaled integer support. "
+                      "Use .set_encoded() to write the on-wire format, "
+                      "or add scaled_type/to_scaled()/from_scaled() "
+                      "to the FieldTraits specialization to enable .set_scaled().");
+    }
 };
 
 } // namespace vrtigo
@@ -6,6 +6,7 @@
 
 #include "cif.hpp"
 #include "field_values.hpp"
+#include "fixed_point.hpp"
 
 namespace vrtigo::detail {
 
@@ -79,6 +80,54 @@ struct InterpretedTypeOrDummy<Tag> {
 template <typename Tag>
 using interpreted_type_or_dummy_t = typename InterpretedTypeOrDummy<Tag>::type;
 
+/// Concept: Field has scaled integer support (exact fixed-point ↔ integer units)
+/// A field has scaled access if its FieldTraits specialization defines:
+/// - scaled_type (e.g., int64_t millihertz, int32_t centi-dB)
+/// - to_scaled(value_type) -> scaled_type (constexpr, no floating point)
+/// - from_scaled(scaled_type) -> value_type
+template <typename Tag>
+concept HasScaledAccess = requires {
+    typename FieldTraits<Tag::cif, Tag::bit>::scaled_type;
+    {
+        FieldTraits<Tag::cif, Tag::bit>::to_scaled(
+            std::declval<typename FieldTraits<Tag::cif, Tag::bit>::value_type>())
+    } -> std::same_as<typename FieldTraits<Tag::cif, Tag::bit>::scaled_type>;
+    {
+        FieldTraits<Tag::cif, Tag::bit>::from_scaled(
+            std::declval<typename FieldTraits<Tag::cif, Tag::bit>::scaled_type>())
+    } -> std::same_as<typename FieldTraits<Tag::cif, Tag::bit>::value_type>;
+};
+
+/// Dummy type for fields without scaled support
+struct NoScaledType {};
+
+/// Helper: Get scaled_type if it exists, otherwise NoScaledType
+template <typename Tag>
+struct ScaledTypeOrDummy {
+    using type = NoScaledType;
+};
+
+template <typename Tag>
+    requires requires { typename FieldTraits<Tag::cif, Tag::bit>::scaled_type; }
+struct ScaledTypeOrDummy<Tag> {
+    using type = typename FieldTraits<Tag::cif, Tag::bit>::scaled_type;
+};
+
+template <typename Tag>
+using scaled_type_or_dummy_t = typename ScaledTypeOrDummy<Tag>::type;
+
+/// Q52.12 Hz ↔ millihertz (unsigned rates: sample rate, bandwidth)
+using RateMilliHz = FixedPointScale<uint64_t, uint64_t, 12, 1000>;
+
+/// Q52.12 Hz ↔ millihertz (two's complement frequencies and offsets)
+using FrequencyMilliHz = FixedPointScale<int64_t, int64_t, 12, 1000>;
+
+/// Q9.7 dB/dBm ↔ centi-dB (reference level, gain stages)
+using DecibelCenti = FixedPointScale<int16_t, int32_t, 7, 100>;
+
+/// Q10.6 °C ↔ centi-degrees (temperature)
+using CelsiusCenti = FixedPointScale<int16_t, int32_t, 6, 100>;
+
 // ============================================================================
 // CIF0 Field Trait Specializations
 // ============================================================================
@@ -242,6 +291,17 @@ struct FieldTraits<0, 18> {
     static void write(uint8_t* base, size_t offset, value_type v) noexcept {
         cif::write_u32_safe(base, offset, v);
     }
+
+    // Scaled support: Q10.6 °C in the low 16 bits ↔ centi-degrees (upper 16 bits reserved)
+    using scaled_type = int32_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return CelsiusCenti::to_scaled(static_cast<int16_t>(raw & 0xFFFF));
+    }
+
+    static constexpr value_type from_scaled(scaled_type centi_c) noexcept {
+        return static_cast<uint16_t>(CelsiusCenti::from_scaled(centi_c));
+    }
 };
 
 // CIF0 Bit 19: Timestamp Calibration Time
@@ -298,6 +358,17 @@ struct FieldTraits<0, 21> {
     static value_type from_interpreted(interpreted_type hz) noexcept {
         return static_cast<value_type>(hz * 4096.0 + 0.5); // Round to nearest
     }
+
+    // Scaled support: Q52.12 fixed-point ↔ millihertz (exact, integer only)
+    using scaled_type = uint64_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return RateMilliHz::to_scaled(raw);
+    }
+
+    static constexpr value_type from_scaled(scaled_type mhz) noexcept {
+        return RateMilliHz::from_scaled(mhz);
+    }
 };
 
 // CIF0 Bit 22: Over-Range Count
@@ -328,6 +399,19 @@ struct FieldTraits<0, 23> {
     static void write(uint8_t* base, size_t offset, value_type v) noexcept {
         cif::write_u32_safe(base, offset, v);
     }
+
+    // Scaled support: stage 1 (low 16 bits) and stage 2 (high 16 bits), Q9.7 dB ↔ centi-dB
+    using scaled_type = GainCentiDb;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return {DecibelCenti::to_scaled(static_cast<int16_t>(raw & 0xFFFF)),
+                DecibelCenti::to_scaled(static_cast<int16_t>(raw >> 16))};
+    }
+
+    static constexpr value_type from_scaled(scaled_type cdb) noexcept {
+        return (value_type(static_cast<uint16_t>(DecibelCenti::from_scaled(cdb.stage2))) << 16) |
+               static_cast<uint16_t>(DecibelCenti::from_scaled(cdb.stage1));
+    }
 };
 
 // CIF0 Bit 24: Reference Level
@@ -343,6 +427,17 @@ struct FieldTraits<0, 24> {
     static void write(uint8_t* base, size_t offset, value_type v) noexcept {
         cif::write_u32_safe(base, offset, v);
     }
+
+    // Scaled support: Q9.7 dBm in the low 16 bits ↔ centi-dBm (upper 16 bits reserved)
+    using scaled_type = int32_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return DecibelCenti::to_scaled(static_cast<int16_t>(raw & 0xFFFF));
+    }
+
+    static constexpr value_type from_scaled(scaled_type cdbm) noexcept {
+        return static_cast<uint16_t>(DecibelCenti::from_scaled(cdbm));
+    }
 };
 
 // CIF0 Bit 25: IF Band Offset (2 words)
@@ -358,6 +453,17 @@ struct FieldTraits<0, 25> {
     static void write(uint8_t* base, size_t offset, value_type v) noexcept {
         cif::write_u64_safe(base, offset, v);
     }
+
+    // Scaled support: two's complement Q52.12 ↔ millihertz (exact, integer only)
+    using scaled_type = int64_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return FrequencyMilliHz::to_scaled(static_cast<int64_t>(raw));
+    }
+
+    static constexpr value_type from_scaled(scaled_type mhz) noexcept {
+        return static_cast<value_type>(FrequencyMilliHz::from_scaled(mhz));
+    }
 };
 
 // CIF0 Bit 26: RF Frequency Offset (2 words)
@@ -373,6 +479,17 @@ struct FieldTraits<0, 26> {
     static void write(uint8_t* base, size_t offset, value_type v) noexcept {
         cif::write_u64_safe(base, offset, v);
     }
+
+    // Scaled support: two's complement Q52.12 ↔ millihertz (exact, integer only)
+    using scaled_type = int64_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return FrequencyMilliHz::to_scaled(static_cast<int64_t>(raw));
+    }
+
+    static constexpr value_type from_scaled(scaled_type mhz) noexcept {
+        return static_cast<value_type>(FrequencyMilliHz::from_scaled(mhz));
+    }
 };
 
 // CIF0 Bit 27: RF Reference Frequency (2 words)
@@ -388,6 +505,17 @@ struct FieldTraits<0, 27> {
     static void write(uint8_t* base, size_t offset, value_type v) noexcept {
         cif::write_u64_safe(base, offset, v);
     }
+
+    // Scaled support: two's complement Q52.12 ↔ millihertz (exact, integer only)
+    using scaled_type = int64_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return FrequencyMilliHz::to_scaled(static_cast<int64_t>(raw));
+    }
+
+    static constexpr value_type from_scaled(scaled_type mhz) noexcept {
+        return static_cast<value_type>(FrequencyMilliHz::from_scaled(mhz));
+    }
 };
 
 // CIF0 Bit 28: IF Reference Frequency (2 words)
@@ -403,6 +531,17 @@ struct FieldTraits<0, 28> {
     static void write(uint8_t* base, size_t offset, value_type v) noexcept {
         cif::write_u64_safe(base, offset, v);
     }
+
+    // Scaled support: two's complement Q52.12 ↔ millihertz (exact, integer only)
+    using scaled_type = int64_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return FrequencyMilliHz::to_scaled(static_cast<int64_t>(raw));
+    }
+
+    static constexpr value_type from_scaled(scaled_type mhz) noexcept {
+        return static_cast<value_type>(FrequencyMilliHz::from_scaled(mhz));
+    }
 };
 
 // CIF0 Bit 29: Bandwidth (2 words)
@@ -431,6 +570,17 @@ struct FieldTraits<0, 29> {
         // Convert Hz to Q52.12 format with rounding
         return static_cast<value_type>(hz * 4096.0 + 0.5);
     }
+
+    // Scaled support: Q52.12 fixed-point ↔ millihertz (exact, integer only)
+    using scaled_type = uint64_t;
+
+    static constexpr scaled_type to_scaled(value_type raw) noexcept {
+        return RateMilliHz::to_scaled(raw);
+    }
+
+    static constexpr value_type from_scaled(scaled_type mhz) noexcept {
+        return RateMilliHz::from_scaled(mhz);
+    }
 };
 
 // CIF0 Bit 30: Reference Point ID
@@ -91,6 +91,14 @@ public:
     bool empty() const noexcept { return count_ == 0; }
 };
 
+/// Gain field (CIF0 bit 23) as integer centi-dB: two Q9.7 stages in one word
+struct GainCentiDb {
+    int32_t stage1 = 0; ///< Stage 1 gain (low 16 bits), 0.01 dB units
+    int32_t stage2 = 0; ///< Stage 2 gain (high 16 bits), 0.01 dB units
+
+    constexpr bool operator==(const GainCentiDb&) const noexcept = default;
+};
+
 /// View for Context Association Lists field (CIF0 bit 9)
 /// Contains two variable-length lists: stream IDs and context IDs
 struct ContextAssociationLists {
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include <cstdint>
+
+namespace vrtigo::detail {
+
+/**
+ * @brief Exact integer conversion between binary fixed point and integer units
+ *
+ * Converts a two's complement (or unsigned) fixed-point value with FracBits fractional bits
+ * to an integer count of 1/UnitsPerWhole units and back, e.g. Q52.12 Hz ↔ millihertz
+ * (FracBits = 12, UnitsPerWhole = 1000) or Q9.7 dB ↔ centi-dB (7, 100). The scale factor
+ * UnitsPerWhole / 2^FracBits is applied as an exact rational: the whole part is multiplied
+ * and only the fractional part is rounded, so no floating point or 128-bit arithmetic is
+ * needed and every conversion is usable in constant expressions.
+ *
+ * Both directions round half up (toward +infinity). from_scaled() saturates to the range
+ * of Raw; to_scaled() is exact for every Raw value as long as the whole part times
+ * UnitsPerWhole fits in Scaled (checked below for the full Raw range).
+ *
+ * @tparam Raw On-wire integer type (signedness selects two's complement interpretation)
+ * @tparam Scaled Integer unit type returned to callers
+ * @tparam FracBits Number of fractional bits in the fixed-point format
+ * @tparam UnitsPerWhole Scaled units per whole unit (1000 for milli, 100 for centi)
+ */
+template <typename Raw, typename Scaled, unsigned FracBits, int64_t UnitsPerWhole>
+struct FixedPointScale {
+    static_assert(std::is_integral_v<Raw> && std::is_integral_v<Scaled>);
+    static_assert(FracBits > 0 && FracBits < std::numeric_limits<Raw>::digits);
+    static_assert(UnitsPerWhole > 0 && uint64_t(UnitsPerWhole) < (uint64_t(1) << (63 - FracBits)),
+                  "fractional product must fit in 64 bits");
+    static_assert(std::is_signed_v<Scaled> || !std::is_signed_v<Raw>,
+                  "signed fixed-point values need a signed scaled type");
+
+    using raw_type = Raw;
+    using scaled_type = Scaled;
+
+    /// Wide working type with the signedness of Scaled
+    using wide_type = std::conditional_t<std::is_signed_v<Scaled>, int64_t, uint64_t>;
+
+    static constexpr uint64_t one = uint64_t(1) << FracBits;
+    static constexpr uint64_t frac_mask = one - 1;
+    static constexpr wide_type units = wide_type(UnitsPerWhole);
+    static constexpr wide_type min_whole = wide_type(std::numeric_limits<Raw>::min() >> FracBits);
+    static constexpr wide_type max_whole = wide_type(std::numeric_limits<Raw>::max() >> FracBits);
+
+    static_assert(max_whole <= wide_type(std::numeric_limits<Scaled>::max() / units) - 1,
+                  "Scaled cannot hold every Raw value");
+    static_assert(min_whole >= wide_type(std::numeric_limits<Scaled>::min() / units),
+                  "Scaled cannot hold every Raw value");
+
+    /**
+     * @brief Fixed point → integer units (round half up)
+     */
+    static constexpr Scaled to_scaled(Raw raw) noexcept {
+        // Arithmetic shift floors negative values; the fraction is then always positive
+        wide_type whole = wide_type(raw >> FracBits);
+        uint64_t frac = uint64_t(raw) & frac_mask;
+        uint64_t frac_units = (frac * uint64_t(UnitsPerWhole) + one / 2) >> FracBits;
+        return Scaled(whole * units + wide_type(frac_units));
+    }
+
+    /**
+     * @brief Integer units → fixed point (round half up, saturating)
+     */
+    static constexpr Raw from_scaled(Scaled value) noexcept {
+        // Floor division so the remainder is in [0, units)
+        wide_type v = wide_type(value);
+        wide_type whole = v / units;
+        wide_type rem = v % units;
+        if constexpr (std::is_signed_v<wide_type>) {
+            if (rem < 0) {
+                whole -= 1;
+                rem += units;
+            }
+        }
+        uint64_t frac = ((uint64_t(rem) << FracBits) + uint64_t(UnitsPerWhole) / 2) /
+                        uint64_t(UnitsPerWhole);
+        if (whole < min_whole) {
+            return std::numeric_limits<Raw>::min();
+        }
+        if (whole > max_whole || (whole == max_whole && frac == one)) {
+            return std::numeric_limits<Raw>::max();
+        }
+        // Two's complement assembly in unsigned arithmetic (well defined for negative whole)
+        return Raw((uint64_t(whole) << FracBits) + frac);
+    }
+};
+
+} // namespace vrtigo::detail
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <initializer_list>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vrtigo {
+
+/// GPS epoch (1980-01-06 00:00:00 UTC) in POSIX seconds
+inline constexpr uint32_t gps_epoch_unix_seconds = 315964800;
+
+/// Seconds in a GPS week
+inline constexpr uint32_t gps_seconds_per_week = 604800;
+
+/**
+ * @brief One leap-second table entry
+ *
+ * From utc_seconds (POSIX time) onward, GPS time is ahead of UTC by gps_minus_utc seconds.
+ */
+struct LeapSecond {
+    uint32_t utc_seconds;  ///< POSIX time at which the offset takes effect
+    int32_t gps_minus_utc; ///< GPS - UTC in seconds from then on
+};
+
+/**
+ * @brief Fixed-capacity GPS-UTC leap-second table
+ *
+ * constexpr and allocation-free so the built-in table is baked in at compile time. Entries
+ * must be in increasing utc_seconds order. Before the first entry the offset is 0 (GPS and
+ * UTC coincided at the GPS epoch); after the last entry the last offset stays in effect.
+ */
+class LeapSecondTable {
+public:
+    static constexpr size_t capacity = 64;
+
+    constexpr LeapSecondTable() noexcept = default;
+
+    constexpr LeapSecondTable(std::initializer_list<LeapSecond> entries) noexcept {
+        for (const auto& entry : entries) {
+            push_back(entry);
+        }
+    }
+
+    constexpr explicit LeapSecondTable(std::span<const LeapSecond> entries) noexcept {
+        for (const auto& entry : entries) {
+            push_back(entry);
+        }
+    }
+
+    /**
+     * @brief Append an entry
+     *
+     * @return false if the table is full or the entry is not after the last one
+     */
+    constexpr bool push_back(LeapSecond entry) noexcept {
+        if (size_ == capacity ||
+            (size_ > 0 && entry.utc_seconds <= entries_[size_ - 1].utc_seconds)) {
+            return false;
+        }
+        entries_[size_++] = entry;
+        return true;
+    }
+
+    constexpr size_t size() const noexcept { return size_; }
+
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr std::span<const LeapSecond> entries() const noexcept {
+        return std::span<const LeapSecond>(entries_.data(), size_);
+    }
+
+    /**
+     * @brief GPS - UTC offset in effect at a UTC (POSIX) time
+     */
+    constexpr int32_t gps_minus_utc_at_utc(uint32_t utc_seconds) const noexcept {
+        int32_t offset = 0;
+        for (size_t i = 0; i < size_ && entries_[i].utc_seconds <= utc_seconds; ++i) {
+            offset = entries_[i].gps_minus_utc;
+        }
+        return offset;
+    }
+
+    /**
+     * @brief GPS - UTC offset in effect at a GPS time (seconds since the GPS epoch)
+     */
+    constexpr int32_t gps_minus_utc_at_gps(uint32_t gps_seconds) const noexcept {
+        int32_t offset = 0;
+        for (size_t i = 0; i < size_ && gps_start(i) <= gps_seconds; ++i) {
+            offset = entries_[i].gps_minus_utc;
+        }
+        return offset;
+    }
+
+    /**
+     * @brief Half-open range [begin, end) of UTC times sharing the offset at utc_seconds
+     */
+    constexpr void utc_interval(uint32_t utc_seconds, uint32_t& begin, uint32_t& end,
+                                int32_t& offset) const noexcept {
+        begin = 0;
+        end = UINT32_MAX;
+        offset = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            if (entries_[i].utc_seconds > utc_seconds) {
+                end = entries_[i].utc_seconds;
+                return;
+            }
+            begin = entries_[i].utc_seconds;
+            offset = entries_[i].gps_minus_utc;
+        }
+    }
+
+    /**
+     * @brief Half-open range [begin, end) of GPS times sharing the offset at gps_seconds
+     */
+    constexpr void gps_interval(uint32_t gps_seconds, uint32_t& begin, uint32_t& end,
+                                int32_t& offset) const noexcept {
+        begin = 0;
+        end = UINT32_MAX;
+        offset = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            if (gps_start(i) > gps_seconds) {
+                end = gps_start(i);
+                return;
+            }
+            begin = gps_start(i);
+            offset = entries_[i].gps_minus_utc;
+        }
+    }
+
+private:
+    /// GPS time at which entry i takes effect
+    constexpr uint32_t gps_start(size_t i) const noexcept {
+        int64_t gps = static_cast<int64_t>(entries_[i].utc_seconds) - gps_epoch_unix_seconds +
+                      entries_[i].gps_minus_utc;
+        return gps < 0 ? 0 : static_cast<uint32_t>(gps);
+    }
+
+    std::array<LeapSecond, capacity> entries_{};
+    size_t size_ = 0;
+};
+
+/**
+ * @brief Leap seconds compiled into the library (IERS Bulletin C, through 2017-01-01)
+ *
+ * Install a newer table at runtime with set_leap_second_table() when IERS announces one.
+ */
+inline constexpr LeapSecondTable builtin_leap_second_table{
+    {362793600, 1},   // 1981-07-01
+    {394329600, 2},   // 1982-07-01
+    {425865600, 3},   // 1983-07-01
+    {489024000, 4},   // 1985-07-01
+    {567993600, 5},   // 1988-01-01
+    {631152000, 6},   // 1990-01-01
+    {662688000, 7},   // 1991-01-01
+    {709948800, 8},   // 1992-07-01
+    {741484800, 9},   // 1993-07-01
+    {773020800, 10},  // 1994-07-01
+    {820454400, 11},  // 1996-01-01
+    {867715200, 12},  // 1997-07-01
+    {915148800, 13},  // 1999-01-01
+    {1136073600, 14}, // 2006-01-01
+    {1230768000, 15}, // 2009-01-01
+    {1341100800, 16}, // 2012-07-01
+    {1435708800, 17}, // 2015-07-01
+    {1483228800, 18}, // 2017-01-01
+};
+
+namespace detail {
+
+inline std::atomic<const LeapSecondTable*> active_leap_second_table{&builtin_leap_second_table};
+inline std::atomic<uint32_t> leap_second_table_generation{0};
+
+} // namespace detail
+
+/**
+ * @brief Get the leap-second table used by GPS/UTC timestamp conversions
+ */
+inline const LeapSecondTable& leap_second_table() noexcept {
+    return *detail::active_leap_second_table.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Replace the leap-second table used by GPS/UTC timestamp conversions
+ *
+ * The table is referenced, not copied: it must outlive every conversion that may use it
+ * (static storage is the usual choice). Cached offsets in all threads are invalidated.
+ *
+ * @param table New table
+ */
+inline void set_leap_second_table(const LeapSecondTable& table) noexcept {
+    detail::active_leap_second_table.store(&table, std::memory_order_release);
+    detail::leap_second_table_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Restore the built-in leap-second table
+ */
+inline void reset_leap_second_table() noexcept {
+    set_leap_second_table(builtin_leap_second_table);
+}
+
+/**
+ * @brief O(1) cached GPS-UTC offset lookup
+ *
+ * Remembers the interval between leap seconds that contained the last query, so
+ * steady-state lookups are a range check plus one relaxed atomic load (to notice a table
+ * swap). Not thread-safe; keep one per thread or per stream.
+ */
+class LeapSecondCache {
+public:
+    /**
+     * @brief GPS - UTC offset at a UTC (POSIX) time
+     */
+    int32_t gps_minus_utc_at_utc(uint32_t utc_seconds) noexcept {
+        if (utc_seconds - utc_.begin >= utc_.end - utc_.begin || stale(utc_)) {
+            refresh(utc_);
+            leap_second_table().utc_interval(utc_seconds, utc_.begin, utc_.end, utc_.offset);
+        }
+        return utc_.offset;
+    }
+
+    /**
+     * @brief GPS - UTC offset at a GPS time (seconds since the GPS epoch)
+     */
+    int32_t gps_minus_utc_at_gps(uint32_t gps_seconds) noexcept {
+        if (gps_seconds - gps_.begin >= gps_.end - gps_.begin || stale(gps_)) {
+            refresh(gps_);
+            leap_second_table().gps_interval(gps_seconds, gps_.begin, gps_.end, gps_.offset);
+        }
+        return gps_.offset;
+    }
+
+private:
+    struct Interval {
+        uint32_t begin = 0;
+        uint32_t end = 0; // empty until first lookup
+        int32_t offset = 0;
+        uint32_t generation = 0;
+    };
+
+    static bool stale(const Interval& interval) noexcept {
+        return interval.generation !=
+               detail::leap_second_table_generation.load(std::memory_order_relaxed);
+    }
+
+    static void refresh(Interval& interval) noexcept {
+        interval.generation = detail::leap_second_table_generation.load(std::memory_order_acquire);
+    }
+
+    Interval utc_;
+    Interval gps_;
+};
+
+namespace detail {
+
+/// Per-thread cache behind the Timestamp GPS/UTC conversions
+inline LeapSecondCache& thread_leap_second_cache() noexcept {
+    thread_local LeapSecondCache cache;
+    return cache;
+}
+
+} // namespace detail
+
+} // namespace vrtigo
@@ -8,6 +8,7 @@
 #include "buffer_io.hpp"
 #include "header_decode.hpp"
 #include "packet_variant.hpp"
+#include "runtime_command_packet.hpp"
 #include "runtime_context_packet.hpp"
 #include "runtime_data_packet.hpp"
 
@@ -19,14 +20,15 @@ namespace vrtigo::detail {
  * This function:
  * 1. Validates minimum buffer size (at least 4 bytes for header)
  * 2. Decodes the packet header to determine packet type
- * 3. Creates the appropriate packet view (RuntimeDataPacket or RuntimeContextPacket)
+ * 3. Creates the appropriate packet view (RuntimeDataPacket, RuntimeContextPacket or
+ *    RuntimeCommandPacket)
  * 4. Returns the validated view or InvalidPacket on error
  *
  * Supported packet types:
  * - Signal Data (0-1) -> RuntimeDataPacket
  * - Extension Data (2-3) -> RuntimeDataPacket
  * - Context (4-5) -> RuntimeContextPacket
- * - Command (6-7) -> InvalidPacket (not yet implemented)
+ * - Command (6-7) -> RuntimeCommandPacket
  *
  * @note This is an internal implementation. Users should use vrtigo::parse_packet()
  * from the public API instead.
@@ -86,12 +88,64 @@ inline PacketVariant parse_packet(std::span<const uint8_t> bytes) noexcept {
             return InvalidPacket{view.error(), header.type, header, bytes};
         }
     } else if (type_value == 6 || type_value == 7) {
-        // Command (6) or Extension Command (7) - not yet implemented
-        return InvalidPacket{ValidationError::unsupported_field, header.type, header, bytes};
+        // Command (6) or Extension Command (7)
+        RuntimeCommandPacket view(bytes.data(), bytes.size());
+        if (view.is_valid()) {
+            // Suppress false positive: GCC's optimizer incorrectly thinks padding bytes
+            // in RuntimeCommandPacket::ParsedStructure might be uninitialized when copied
+            // into std::variant, despite structure_{} initialization in constructor.
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+            return view;
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+        } else {
+            return InvalidPacket{view.error(), header.type, header, bytes};
+        }
     } else {
         // Invalid/reserved packet type (8-15)
         return InvalidPacket{ValidationError::invalid_packet_type, header.type, header, bytes};
     }
 }
 
+/**
+ * @brief Parse a VRT packet from a trusted source (internal implementation)
+ *
+ * Same dispatch as parse_packet(), but data and context packets are built with their
+ * trusted constructors, which skip validation (see trusted_t). Command packets are
+ * always fully validated.
+ *
+ * @param bytes Raw packet bytes (must remain valid while using returned view)
+ * @return PacketVariant containing the view, or InvalidPacket for reserved packet types
+ *         and buffers too small for a header
+ */
+inline PacketVariant parse_packet(std::span<const uint8_t> bytes, trusted_t) noexcept {
+    if (bytes.size() < 4) {
+        return InvalidPacket{ValidationError::buffer_too_small, PacketType::signal_data_no_id,
+                             DecodedHeader{}, bytes};
+    }
+
+    uint32_t header_word = vrtigo::detail::read_u32(bytes.data(), 0);
+    uint8_t type_value = static_cast<uint8_t>((header_word >> 28) & 0x0F);
+
+    // Same GCC false positive as parse_packet() when copying the views into the variant
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    if (type_value <= 3) {
+        return RuntimeDataPacket(bytes.data(), bytes.size(), trusted);
+    }
+    if (type_value == 4 || type_value == 5) {
+        return RuntimeContextPacket(bytes.data(), bytes.size(), trusted);
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+    return parse_packet(bytes);
+}
+
 } // namespace vrtigo::detail
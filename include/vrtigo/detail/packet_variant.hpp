@@ -6,6 +6,7 @@
 
 #include "../types.hpp"
 #include "header_decode.hpp"
+#include "runtime_command_packet.hpp"
 #include "runtime_context_packet.hpp"
 #include "runtime_data_packet.hpp"
 
@@ -36,11 +37,13 @@ struct InvalidPacket {
  * After parsing a packet, it will be validated and returned as one of:
  * - RuntimeDataPacket: Signal or Extension data packets (types 0-3)
  * - RuntimeContextPacket: Context or Extension Context packets (types 4-5)
- * - InvalidPacket: Validation failed or unsupported packet type (types 6-7)
+ * - RuntimeCommandPacket: Command or Extension Command packets (types 6-7)
+ * - InvalidPacket: Validation failed or reserved packet type (types 8-15)
  */
 using PacketVariant = std::variant<RuntimeDataPacket,    // Signal/Extension data packets
                                    RuntimeContextPacket, // Context/Extension context packets
-                                   InvalidPacket         // Validation failed or unsupported type
+                                   RuntimeCommandPacket, // Command/Extension command packets
+                                   InvalidPacket         // Validation failed or reserved type
                                    >;
 
 /**
@@ -69,6 +72,8 @@ inline PacketType packet_type(const PacketVariant& pkt) noexcept {
                 // Context packets are always type 4 or 5
                 // We can't tell which without accessing internals, so default to 4
                 return PacketType::context;
+            } else if constexpr (std::is_same_v<T, RuntimeCommandPacket>) {
+                return p.type();
             } else if constexpr (std::is_same_v<T, InvalidPacket>) {
                 return p.attempted_type;
             }
@@ -93,6 +98,8 @@ inline std::optional<uint32_t> stream_id(const PacketVariant& pkt) noexcept {
                 return p.stream_id();
             } else if constexpr (std::is_same_v<T, RuntimeContextPacket>) {
                 return p.stream_id();
+            } else if constexpr (std::is_same_v<T, RuntimeCommandPacket>) {
+                return p.stream_id();
             }
 
             return std::nullopt;
@@ -118,4 +125,13 @@ inline bool is_context_packet(const PacketVariant& pkt) noexcept {
     return std::holds_alternative<RuntimeContextPacket>(pkt);
 }
 
+/**
+ * @brief Check if a packet variant holds a command packet
+ * @param pkt The packet variant to check
+ * @return true if the packet is a RuntimeCommandPacket, false otherwise
+ */
+inline bool is_command_packet(const PacketVariant& pkt) noexcept {
+    return std::holds_alternative<RuntimeCommandPacket>(pkt);
+}
+
 } // namespace vrtigo
@@ -0,0 +1,556 @@
+#pragma once
+
+#include <optional>
+#include <span>
+
+#include <cstring>
+#include <vrtigo/class_id.hpp>
+#include <vrtigo/command_cam.hpp>
+#include <vrtigo/field_tags.hpp>
+#include <vrtigo/types.hpp>
+
+#include "cif.hpp"
+#include "cif_block.hpp"
+#include "endian.hpp"
+#include "field_access.hpp"
+#include "header_decode.hpp"
+#include "packet_header_accessor.hpp"
+#include "variable_field_dispatch.hpp"
+
+namespace vrtigo {
+
+/**
+ * Set of fields named by CIF-format indicator words
+ *
+ * Used for the fields a cancellation packet cancels and for the warning/error
+ * indicator fields of validation and execution acknowledge packets. The CIF1-CIF3
+ * enable bits in cif0 are structural and never count as fields.
+ */
+struct FieldIndicators {
+    uint32_t cif0 = 0;
+    uint32_t cif1 = 0;
+    uint32_t cif2 = 0;
+    uint32_t cif3 = 0;
+
+    // Check whether a field is indicated
+    template <uint8_t CifWord, uint8_t Bit>
+    constexpr bool contains(field::field_tag_t<CifWord, Bit>) const noexcept {
+        return detail::is_field_present<CifWord, Bit>(cif0, cif1, cif2, cif3);
+    }
+
+    // Check whether no field is indicated
+    constexpr bool empty() const noexcept {
+        return (cif0 & ~cif::CIF_ENABLE_MASK) == 0 && cif1 == 0 && cif2 == 0 && cif3 == 0;
+    }
+
+    constexpr bool operator==(const FieldIndicators&) const noexcept = default;
+};
+
+/**
+ * Runtime parser for command packets (Control and Acknowledge, types 6-7)
+ *
+ * Validates on construction like RuntimeContextPacket and never allocates. After the
+ * prologue a command packet carries the CAM word, a 32-bit message ID and the optional
+ * controllee and controller IDs (one word or a 128-bit UUID each, per the CAM), followed
+ * by a body that depends on the packet kind:
+ *
+ * - Control packet: CIF words and the field values to apply (read via operator[])
+ * - Cancellation packet (header bit 24): CIF words naming the fields to cancel, no values
+ *   (see cancelled_fields())
+ * - Query-state acknowledge (bit 26 with CAM S): CIF words and the current field values
+ * - Validation/execution acknowledge (bit 26 with CAM V/X): warning indicator words when
+ *   CAM W is set, error indicator words when CAM Er is set, then one 32-bit response
+ *   word per indicated field (see warning_response() and error_response())
+ *
+ * Usage:
+ *   RuntimeCommandPacket cmd(rx_buffer, buffer_size);
+ *   if (cmd.is_valid() && !cmd.is_ack()) {
+ *       if (auto bw = cmd[field::bandwidth]) {
+ *           set_bandwidth(bw.value());
+ *       }
+ *   }
+ */
+class RuntimeCommandPacket {
+private:
+    const uint8_t* buffer_;
+    size_t buffer_size_;
+    ValidationError error_;
+
+    struct ParsedStructure {
+        // Header data (consolidated from decode_header)
+        detail::DecodedHeader header{}; // Value-initialize to zero
+
+        // Command prologue
+        uint32_t cam = 0;
+        uint32_t cam_offset_bytes = 0;        // CAM word (message ID follows)
+        uint32_t controllee_offset_bytes = 0; // 0 when absent
+        uint32_t controller_offset_bytes = 0; // 0 when absent
+
+        // CIF words (control fields, state, or cancelled fields)
+        uint32_t cif0 = 0;
+        uint32_t cif1 = 0;
+        uint32_t cif2 = 0;
+        uint32_t cif3 = 0;
+        bool has_field_values = false; // False for cancellation and V/X acknowledge packets
+
+        // Store base offset for control fields
+        size_t context_base_bytes = 0;
+
+        // Validation/execution acknowledge indicator blocks and their response words
+        FieldIndicators warnings;
+        FieldIndicators errors;
+        uint32_t warning_responses_bytes = 0;
+        uint32_t error_responses_bytes = 0;
+    } structure_;
+
+    ValidationError read_id(size_t& offset_words, bool present, bool uuid,
+                            uint32_t& offset_bytes) const noexcept {
+        if (!present) {
+            // Format bit without the enable bit is malformed
+            return uuid ? ValidationError::unsupported_field : ValidationError::none;
+        }
+        size_t words = uuid ? 4 : 1;
+        if ((offset_words + words) * 4 > buffer_size_) {
+            return ValidationError::buffer_too_small;
+        }
+        offset_bytes = static_cast<uint32_t>(offset_words * 4);
+        offset_words += words;
+        return ValidationError::none;
+    }
+
+    static FieldIndicators indicators(const detail::CifBlock& block) noexcept {
+        return FieldIndicators{block.cif0, block.cif1, block.cif2, block.cif3};
+    }
+
+    ValidationError validate_internal() noexcept {
+        if (!buffer_ || buffer_size_ < 4) {
+            return ValidationError::buffer_too_small;
+        }
+
+        // 1. Read and decode header using shared utility
+        uint32_t header = cif::read_u32_safe(buffer_, 0);
+        auto decoded = detail::decode_header(header);
+        structure_.header = decoded;
+
+        // 2. Validate packet type (must be command: 6 or 7)
+        if (!detail::is_command_packet(decoded.type)) {
+            return ValidationError::invalid_packet_type;
+        }
+
+        // 3. Bit 25 is Reserved for command packets (must be 0)
+        if (decoded.bit_25) {
+            return ValidationError::unsupported_field;
+        }
+
+        // 4. Initial buffer size check
+        size_t required_bytes = decoded.size_words * 4;
+        if (buffer_size_ < required_bytes) {
+            return ValidationError::buffer_too_small;
+        }
+
+        // 5. Prologue: header, stream ID (always present), class ID, timestamps
+        size_t offset_words = 2;
+        if (decoded.has_class_id) {
+            offset_words += 2;
+        }
+        offset_words += (decoded.tsi != TsiType::none) ? 1 : 0;
+        offset_words += (decoded.tsf != TsfType::none) ? 2 : 0;
+
+        // 6. CAM and message ID
+        if ((offset_words + 2) * 4 > buffer_size_) {
+            return ValidationError::buffer_too_small;
+        }
+        structure_.cam_offset_bytes = static_cast<uint32_t>(offset_words * 4);
+        structure_.cam = cif::read_u32_safe(buffer_, offset_words * 4);
+        offset_words += 2;
+
+        // 7. Controllee and controller IDs
+        CamValue cam(structure_.cam);
+        if (auto err = read_id(offset_words, cam.has_controllee_id(), cam.controllee_id_is_uuid(),
+                               structure_.controllee_offset_bytes);
+            err != ValidationError::none) {
+            return err;
+        }
+        if (auto err = read_id(offset_words, cam.has_controller_id(), cam.controller_id_is_uuid(),
+                               structure_.controller_offset_bytes);
+            err != ValidationError::none) {
+            return err;
+        }
+
+        // 8. Body
+        if (!decoded.command_ack || cam.query_state_ack()) {
+            // Control fields, cancelled fields, or queried state: CIF-format block
+            detail::CifBlock cifs;
+            if (auto err = detail::parse_cif_words(buffer_, buffer_size_, offset_words, cifs);
+                err != ValidationError::none) {
+                return err;
+            }
+            structure_.cif0 = cifs.cif0;
+            structure_.cif1 = cifs.cif1;
+            structure_.cif2 = cifs.cif2;
+            structure_.cif3 = cifs.cif3;
+            structure_.context_base_bytes = cifs.fields_offset_bytes;
+
+            // Cancellation packets name the fields but carry no values
+            structure_.has_field_values = decoded.command_ack || !decoded.command_cancel;
+            if (structure_.has_field_values) {
+                if (auto err = detail::parse_cif_fields(buffer_, buffer_size_, cifs);
+                    err != ValidationError::none) {
+                    return err;
+                }
+                offset_words += cifs.fields_words;
+            }
+        } else {
+            // Validation/execution acknowledge: WIF words, EIF words, then responses
+            detail::CifBlock warnings;
+            detail::CifBlock errors;
+            if (cam.warnings()) {
+                if (auto err =
+                        detail::parse_cif_words(buffer_, buffer_size_, offset_words, warnings);
+                    err != ValidationError::none) {
+                    return err;
+                }
+            }
+            if (cam.errors()) {
+                if (auto err = detail::parse_cif_words(buffer_, buffer_size_, offset_words, errors);
+                    err != ValidationError::none) {
+                    return err;
+                }
+            }
+            structure_.warnings = indicators(warnings);
+            structure_.errors = indicators(errors);
+            structure_.context_base_bytes = offset_words * 4;
+
+            structure_.warning_responses_bytes = static_cast<uint32_t>(offset_words * 4);
+            offset_words += detail::cif_field_count(warnings.cif0, warnings.cif1, warnings.cif2,
+                                                    warnings.cif3);
+            structure_.error_responses_bytes = static_cast<uint32_t>(offset_words * 4);
+            offset_words +=
+                detail::cif_field_count(errors.cif0, errors.cif1, errors.cif2, errors.cif3);
+        }
+
+        // 9. Final validation: calculated size must match header
+        if (offset_words != decoded.size_words) {
+            return ValidationError::size_field_mismatch;
+        }
+
+        return ValidationError::none;
+    }
+
+    template <uint8_t CifWord, uint8_t Bit>
+    std::optional<uint32_t> response(const FieldIndicators& ind, uint32_t base_bytes,
+                                     field::field_tag_t<CifWord, Bit> tag) const noexcept {
+        if (!is_valid() || !ind.contains(tag)) {
+            return std::nullopt;
+        }
+        size_t index =
+            detail::cif_field_index(ind.cif0, ind.cif1, ind.cif2, ind.cif3, CifWord, Bit);
+        return cif::read_u32_safe(buffer_, base_bytes + index * vrt_word_size);
+    }
+
+    std::optional<CommandUuidValue> read_uuid(uint32_t offset_bytes) const noexcept {
+        CommandUuidValue uuid{};
+        std::memcpy(uuid.data(), buffer_ + offset_bytes, uuid.size());
+        return uuid;
+    }
+
+public:
+    /**
+     * Construct runtime parser and automatically validate
+     * @param buffer Pointer to packet buffer
+     * @param buffer_size Size of buffer in bytes
+     */
+    explicit RuntimeCommandPacket(const uint8_t* buffer, size_t buffer_size) noexcept
+        : buffer_(buffer),
+          buffer_size_(buffer_size),
+          error_(ValidationError::none),
+          structure_{} {
+        // structure_{} zero-initializes all members including padding
+        error_ = validate_internal();
+    }
+
+    /**
+     * Get validation error
+     * @return ValidationError::none if packet is valid, otherwise specific error
+     */
+    ValidationError error() const noexcept { return error_; }
+
+    /**
+     * Check if packet is valid
+     * @return true if validation passed
+     */
+    bool is_valid() const noexcept { return error_ == ValidationError::none; }
+
+    /**
+     * Get header accessor
+     * @return Const accessor for header word fields
+     */
+    HeaderView header() const noexcept { return HeaderView{&structure_.header}; }
+
+    /**
+     * Get packet type decoded from the header
+     */
+    PacketType type() const noexcept { return structure_.header.type; }
+
+    // Command packet kind (header bits 26 and 24)
+
+    /**
+     * Check if this is an acknowledge packet (header bit 26)
+     */
+    bool is_ack() const noexcept { return structure_.header.command_ack; }
+
+    /**
+     * Check if this is a cancellation packet (header bit 24)
+     */
+    bool is_cancel() const noexcept { return structure_.header.command_cancel; }
+
+    // Header field accessors
+
+    /**
+     * Get timestamp integer format type (TSI field)
+     * @return TSI type from header
+     */
+    TsiType tsi_kind() const noexcept { return structure_.header.tsi; }
+
+    /**
+     * Get timestamp fractional format type (TSF field)
+     * @return TSF type from header
+     */
+    TsfType tsf_kind() const noexcept { return structure_.header.tsf; }
+
+    /**
+     * Check if packet has stream ID
+     * @return true (always present per VITA 49.2 spec for command packets)
+     */
+    bool has_stream_id() const noexcept { return true; }
+
+    /**
+     * Check if packet has class ID
+     * @return true if class ID indicator is set
+     */
+    bool has_class_id() const noexcept { return header().has_class_id(); }
+
+    /**
+     * Check if packet has trailer
+     * @return false (command packets have no trailer; bit 26 is the ack indicator)
+     */
+    bool has_trailer() const noexcept { return false; }
+
+    /**
+     * Check if packet has integer timestamp
+     * @return true if TSI != none
+     */
+    bool has_timestamp_integer() const noexcept { return header().has_timestamp_integer(); }
+
+    /**
+     * Check if packet has fractional timestamp
+     * @return true if TSF != none
+     */
+    bool has_timestamp_fractional() const noexcept { return header().has_timestamp_fractional(); }
+
+    /**
+     * Get integer timestamp
+     * @return Integer timestamp if packet has TSI and is valid, otherwise std::nullopt
+     */
+    std::optional<uint32_t> timestamp_integer() const noexcept {
+        if (!is_valid() || structure_.header.tsi == TsiType::none) {
+            return std::nullopt;
+        }
+
+        // After header and stream ID, plus 64-bit class ID if present
+        size_t offset = structure_.header.has_class_id ? 16 : 8;
+        return cif::read_u32_safe(buffer_, offset);
+    }
+
+    /**
+     * Get fractional timestamp
+     * @return Fractional timestamp if packet has TSF and is valid, otherwise std::nullopt
+     */
+    std::optional<uint64_t> timestamp_fractional() const noexcept {
+        if (!is_valid() || structure_.header.tsf == TsfType::none) {
+            return std::nullopt;
+        }
+
+        size_t offset = structure_.header.has_class_id ? 16 : 8;
+        if (structure_.header.tsi != TsiType::none) {
+            offset += 4; // Integer timestamp
+        }
+
+        // Read fractional timestamp (size depends on TSF type per VITA 49.2)
+        if (structure_.header.tsf == TsfType::free_running) {
+            // 32-bit free running count (pad to 64-bit)
+            return static_cast<uint64_t>(cif::read_u32_safe(buffer_, offset));
+        }
+        return cif::read_u64_safe(buffer_, offset);
+    }
+
+    // Stream ID accessor (always present for command packets)
+    std::optional<uint32_t> stream_id() const noexcept {
+        if (!is_valid()) {
+            return std::nullopt;
+        }
+        return cif::read_u32_safe(buffer_, 4); // Right after header
+    }
+
+    // Packet count accessor (4-bit field in header, always present)
+    uint8_t packet_count() const noexcept { return structure_.header.packet_count; }
+
+    // Class ID accessor
+    [[nodiscard]] std::optional<ClassIdValue> class_id() const noexcept {
+        if (!is_valid() || !structure_.header.has_class_id) {
+            return std::nullopt;
+        }
+
+        uint32_t word0 = cif::read_u32_safe(buffer_, 8);
+        uint32_t word1 = cif::read_u32_safe(buffer_, 12);
+
+        return ClassIdValue::fromWords(word0, word1);
+    }
+
+    // Command prologue accessors
+
+    /**
+     * Get the Control/Acknowledge Mode field
+     * @return CAM value (zero if the packet is invalid)
+     */
+    CamValue cam() const noexcept { return is_valid() ? CamValue(structure_.cam) : CamValue(); }
+
+    /**
+     * Get the message ID that pairs acknowledgements with their control packet
+     */
+    std::optional<uint32_t> message_id() const noexcept {
+        if (!is_valid()) {
+            return std::nullopt;
+        }
+        return cif::read_u32_safe(buffer_, structure_.cam_offset_bytes + 4);
+    }
+
+    /**
+     * Get the controllee ID (32-bit word format)
+     * @return ID, or std::nullopt if absent, UUID-formatted, or packet invalid
+     */
+    std::optional<uint32_t> controllee_id() const noexcept {
+        if (!is_valid() || structure_.controllee_offset_bytes == 0 ||
+            cam().controllee_id_is_uuid()) {
+            return std::nullopt;
+        }
+        return cif::read_u32_safe(buffer_, structure_.controllee_offset_bytes);
+    }
+
+    /**
+     * Get the controllee ID (128-bit UUID format)
+     * @return UUID bytes, or std::nullopt if absent, word-formatted, or packet invalid
+     */
+    std::optional<CommandUuidValue> controllee_uuid() const noexcept {
+        if (!is_valid() || structure_.controllee_offset_bytes == 0 ||
+            !cam().controllee_id_is_uuid()) {
+            return std::nullopt;
+        }
+        return read_uuid(structure_.controllee_offset_bytes);
+    }
+
+    /**
+     * Get the controller ID (32-bit word format)
+     * @return ID, or std::nullopt if absent, UUID-formatted, or packet invalid
+     */
+    std::optional<uint32_t> controller_id() const noexcept {
+        if (!is_valid() || structure_.controller_offset_bytes == 0 ||
+            cam().controller_id_is_uuid()) {
+            return std::nullopt;
+        }
+        return cif::read_u32_safe(buffer_, structure_.controller_offset_bytes);
+    }
+
+    /**
+     * Get the controller ID (128-bit UUID format)
+     * @return UUID bytes, or std::nullopt if absent, word-formatted, or packet invalid
+     */
+    std::optional<CommandUuidValue> controller_uuid() const noexcept {
+        if (!is_valid() || structure_.controller_offset_bytes == 0 ||
+            !cam().controller_id_is_uuid()) {
+            return std::nullopt;
+        }
+        return read_uuid(structure_.controller_offset_bytes);
+    }
+
+    // Cancellation and acknowledge bodies
+
+    /**
+     * Get the fields a cancellation packet cancels
+     * @return Indicated fields (empty unless this is a valid cancellation packet)
+     */
+    FieldIndicators cancelled_fields() const noexcept {
+        if (!is_valid() || !is_cancel() || is_ack()) {
+            return {};
+        }
+        return FieldIndicators{structure_.cif0, structure_.cif1, structure_.cif2,
+                               structure_.cif3};
+    }
+
+    /**
+     * Get the fields with warnings (validation/execution acknowledge packets)
+     */
+    const FieldIndicators& warning_fields() const noexcept { return structure_.warnings; }
+
+    /**
+     * Get the fields with errors (validation/execution acknowledge packets)
+     */
+    const FieldIndicators& error_fields() const noexcept { return structure_.errors; }
+
+    /**
+     * Get the warning response word for a field
+     * @return Response word, or std::nullopt if the field has no warning
+     */
+    template <uint8_t CifWord, uint8_t Bit>
+    std::optional<uint32_t> warning_response(field::field_tag_t<CifWord, Bit> tag) const noexcept {
+        return response(structure_.warnings, structure_.warning_responses_bytes, tag);
+    }
+
+    /**
+     * Get the error response word for a field
+     * @return Response word, or std::nullopt if the field has no error
+     */
+    template <uint8_t CifWord, uint8_t Bit>
+    std::optional<uint32_t> error_response(field::field_tag_t<CifWord, Bit> tag) const noexcept {
+        return response(structure_.errors, structure_.error_responses_bytes, tag);
+    }
+
+    // CIF accessors (zero when the packet carries no field values)
+
+    uint32_t cif0() const noexcept { return structure_.has_field_values ? structure_.cif0 : 0; }
+    uint32_t cif1() const noexcept { return structure_.has_field_values ? structure_.cif1 : 0; }
+    uint32_t cif2() const noexcept { return structure_.has_field_values ? structure_.cif2 : 0; }
+    uint32_t cif3() const noexcept { return structure_.has_field_values ? structure_.cif3 : 0; }
+
+    // Size queries
+    size_t packet_size_bytes() const noexcept { return structure_.header.size_words * 4; }
+
+    size_t packet_size_words() const noexcept { return structure_.header.size_words; }
+
+    // Field access API support - expose buffer and offsets
+    const uint8_t* context_buffer() const noexcept { return buffer_; }
+
+    size_t context_base_offset() const noexcept { return structure_.context_base_bytes; }
+
+    size_t buffer_size() const noexcept { return buffer_size_; }
+
+    /**
+     * Get entire packet as bytes
+     * @return Span of entire packet if valid, otherwise empty span
+     */
+    std::span<const uint8_t> as_bytes() const noexcept {
+        if (!is_valid()) {
+            return {};
+        }
+        return std::span<const uint8_t>(buffer_, packet_size_bytes());
+    }
+
+    // Field access via subscript operator (control fields and query-state values)
+    template <uint8_t CifWord, uint8_t Bit>
+    auto operator[](field::field_tag_t<CifWord, Bit> tag) const noexcept
+        -> FieldProxy<field::field_tag_t<CifWord, Bit>, const RuntimeCommandPacket> {
+        return detail::make_field_proxy(*this, tag);
+    }
+};
+
+} // namespace vrtigo
@@ -3,11 +3,13 @@
 #include <optional>
 #include <span>
 
+#include <cassert>
 #include <cstring>
 #include <vrtigo/class_id.hpp>
 #include <vrtigo/types.hpp>
 
 #include "cif.hpp"
+#include "cif_block.hpp"
 #include "endian.hpp"
 #include "field_access.hpp"
 #include "header_decode.hpp"
@@ -60,15 +62,6 @@ private:
         uint32_t cif2 = 0;
         uint32_t cif3 = 0;
 
-        // Variable field info (populated during validation)
-        struct VariableFieldInfo {
-            bool present = false;
-            size_t offset_bytes = 0;
-            size_t size_words = 0;
-        };
-        VariableFieldInfo gps_ascii;
-        VariableFieldInfo context_assoc;
-
         // Store base offset for context fields
         size_t context_base_bytes = 0;
 
@@ -131,149 +124,26 @@ private:
         size_t tsf_words = (structure_.header.tsf != TsfType::none) ? 2 : 0;
         offset_words += tsi_words + tsf_words;
 
-        // 7. Read CIF words
-        if ((offset_words + 1) * 4 > buffer_size_) {
-            return ValidationError::buffer_too_small;
-        }
-        structure_.cif0 = cif::read_u32_safe(buffer_, offset_words * 4);
-        offset_words++;
-
-        if (structure_.cif0 & (1U << cif::CIF1_ENABLE_BIT)) {
-            if ((offset_words + 1) * 4 > buffer_size_) {
-                return ValidationError::buffer_too_small;
-            }
-            structure_.cif1 = cif::read_u32_safe(buffer_, offset_words * 4);
-            offset_words++;
-        }
-
-        if (structure_.cif0 & (1U << cif::CIF2_ENABLE_BIT)) {
-            if ((offset_words + 1) * 4 > buffer_size_) {
-                return ValidationError::buffer_too_small;
-            }
-            structure_.cif2 = cif::read_u32_safe(buffer_, offset_words * 4);
-            offset_words++;
-        }
-
-        if (structure_.cif0 & (1U << cif::CIF3_ENABLE_BIT)) {
-            if ((offset_words + 1) * 4 > buffer_size_) {
-                return ValidationError::buffer_too_small;
-            }
-            structure_.cif3 = cif::read_u32_safe(buffer_, offset_words * 4);
-            offset_words++;
-        }
-
-        // COMPLETE validation: reject ANY unsupported bits
-        // CIF0_SUPPORTED_MASK now includes the CIF1/CIF2 enable bits (1 and 2)
-        if (structure_.cif0 & ~cif::CIF0_SUPPORTED_MASK) {
-            return ValidationError::unsupported_field;
-        }
-
-        // Check CIF1 if present
-        if (structure_.cif0 & (1U << cif::CIF1_ENABLE_BIT)) {
-            if (structure_.cif1 & ~cif::CIF1_SUPPORTED_MASK) {
-                return ValidationError::unsupported_field;
-            }
-        }
-
-        // Check CIF2 if present
-        if (structure_.cif0 & (1U << cif::CIF2_ENABLE_BIT)) {
-            if (structure_.cif2 & ~cif::CIF2_SUPPORTED_MASK) {
-                return ValidationError::unsupported_field;
-            }
-        }
-
-        // Check CIF3 if present
-        if (structure_.cif0 & (1U << cif::CIF3_ENABLE_BIT)) {
-            if (structure_.cif3 & ~cif::CIF3_SUPPORTED_MASK) {
-                return ValidationError::unsupported_field;
-            }
+        // 7. Read CIF words (rejects unsupported bits)
+        detail::CifBlock cifs;
+        if (auto err = detail::parse_cif_words(buffer_, buffer_size_, offset_words, cifs);
+            err != ValidationError::none) {
+            return err;
         }
+        structure_.cif0 = cifs.cif0;
+        structure_.cif1 = cifs.cif1;
+        structure_.cif2 = cifs.cif2;
+        structure_.cif3 = cifs.cif3;
 
         // Store context field base offset
-        structure_.context_base_bytes = offset_words * 4;
+        structure_.context_base_bytes = cifs.fields_offset_bytes;
 
         // 8. Calculate context field sizes with variable field handling
-        size_t context_fields_words = 0;
-
-        // Process all fixed fields first (from MSB to LSB)
-        for (int bit = 31; bit >= 0; bit--) {
-            if (bit == cif::GPS_ASCII_BIT || bit == cif::CONTEXT_ASSOC_BIT)
-                continue; // Skip variable fields for now
-
-            if (structure_.cif0 & (1U << bit)) {
-                context_fields_words += cif::CIF0_FIELDS[bit].size_words;
-            }
-        }
-
-        // Now handle variable fields IN ORDER (bit 10 before bit 9)
-        if (structure_.cif0 & (1U << cif::GPS_ASCII_BIT)) {
-            structure_.gps_ascii.present = true;
-            structure_.gps_ascii.offset_bytes = (offset_words + context_fields_words) * 4;
-
-            // Read the length from the buffer
-            if ((offset_words + context_fields_words + 1) * 4 > buffer_size_) {
-                return ValidationError::buffer_too_small;
-            }
-            structure_.gps_ascii.size_words =
-                cif::read_gps_ascii_length_words(buffer_, structure_.gps_ascii.offset_bytes);
-
-            // Check entire field fits in buffer!
-            if ((offset_words + context_fields_words + structure_.gps_ascii.size_words) * 4 >
-                buffer_size_) {
-                return ValidationError::buffer_too_small;
-            }
-
-            context_fields_words += structure_.gps_ascii.size_words;
-        }
-
-        if (structure_.cif0 & (1U << cif::CONTEXT_ASSOC_BIT)) {
-            structure_.context_assoc.present = true;
-            structure_.context_assoc.offset_bytes = (offset_words + context_fields_words) * 4;
-
-            // Check counts word is present
-            if ((offset_words + context_fields_words + 1) * 4 > buffer_size_) {
-                return ValidationError::buffer_too_small;
-            }
-
-            // Read length with CORRECTED format
-            structure_.context_assoc.size_words = cif::read_context_assoc_length_words(
-                buffer_, structure_.context_assoc.offset_bytes);
-
-            // Check entire field fits!
-            if ((offset_words + context_fields_words + structure_.context_assoc.size_words) * 4 >
-                buffer_size_) {
-                return ValidationError::buffer_too_small;
-            }
-
-            context_fields_words += structure_.context_assoc.size_words;
-        }
-
-        // Process CIF1 fields
-        if (structure_.cif0 & (1U << cif::CIF1_ENABLE_BIT)) {
-            for (int bit = 31; bit >= 0; --bit) {
-                if (structure_.cif1 & (1U << bit)) {
-                    context_fields_words += cif::CIF1_FIELDS[bit].size_words;
-                }
-            }
-        }
-
-        // Process CIF2 fields
-        if (structure_.cif0 & (1U << cif::CIF2_ENABLE_BIT)) {
-            for (int bit = 31; bit >= 0; --bit) {
-                if (structure_.cif2 & (1U << bit)) {
-                    context_fields_words += cif::CIF2_FIELDS[bit].size_words;
-                }
-            }
-        }
-
-        // Process CIF3 fields
-        if (structure_.cif0 & (1U << cif::CIF3_ENABLE_BIT)) {
-            for (int bit = 31; bit >= 0; --bit) {
-                if (structure_.cif3 & (1U << bit)) {
-                    context_fields_words += cif::CIF3_FIELDS[bit].size_words;
-                }
-            }
+        if (auto err = detail::parse_cif_fields(buffer_, buffer_size_, cifs);
+            err != ValidationError::none) {
+            return err;
         }
+        size_t context_fields_words = cifs.fields_words;
 
         // 9. Calculate total expected size
         // Note: Context packets do not support trailer fields (bit 26 is Reserved)
@@ -302,6 +172,69 @@ public:
         error_ = validate_internal();
     }
 
+    /**
+     * Construct runtime parser for a trusted packet without validating
+     *
+     * Decodes the header and reads the CIF words to locate the context fields; the
+     * supported-bit checks and variable-field length walk are skipped, and field offsets
+     * are computed when a field is accessed. Only the checks that keep the view inside
+     * the buffer remain: error() reports buffer_too_small if the buffer is shorter than
+     * the header's packet size, and size_field_mismatch if that size cannot hold the
+     * prologue and CIF words. Use validate() to check the packet fully. Debug builds
+     * assert that full validation passes.
+     *
+     * @param buffer Pointer to packet buffer
+     * @param buffer_size Size of buffer in bytes
+     */
+    RuntimeContextPacket(const uint8_t* buffer, size_t buffer_size, trusted_t) noexcept
+        : buffer_(buffer),
+          buffer_size_(buffer_size),
+          error_(ValidationError::none),
+          structure_{} {
+        if (!buffer_ || buffer_size_ < 4) {
+            error_ = ValidationError::buffer_too_small;
+            return;
+        }
+        structure_.header = detail::decode_header(cif::read_u32_safe(buffer_, 0));
+        structure_.has_stream_id = detail::has_stream_id_field(structure_.header.type);
+        const size_t size_words = structure_.header.size_words;
+        if (size_words * 4 > buffer_size_) {
+            error_ = ValidationError::buffer_too_small;
+            return;
+        }
+
+        size_t offset_words = 1 + (structure_.has_stream_id ? 1 : 0) +
+                              (structure_.header.has_class_id ? 2 : 0) +
+                              (structure_.header.tsi != TsiType::none ? 1 : 0) +
+                              (structure_.header.tsf != TsfType::none ? 2 : 0);
+        detail::CifBlock cifs;
+        if (!detail::read_cif_words(buffer_, size_words, offset_words, cifs)) {
+            error_ = ValidationError::size_field_mismatch;
+            return;
+        }
+        structure_.cif0 = cifs.cif0;
+        structure_.cif1 = cifs.cif1;
+        structure_.cif2 = cifs.cif2;
+        structure_.cif3 = cifs.cif3;
+        structure_.context_base_bytes = cifs.fields_offset_bytes;
+        structure_.calculated_size_words = structure_.header.size_words;
+#ifndef NDEBUG
+        RuntimeContextPacket checked(buffer, buffer_size);
+        assert(checked.is_valid() && "trusted context packet failed validation");
+        assert(checked.structure_.context_base_bytes == structure_.context_base_bytes);
+#endif
+    }
+
+    /**
+     * Run full validation (for views built with the trusted constructor)
+     * @return ValidationError::none if packet is valid; also stored for error()
+     */
+    ValidationError validate() noexcept {
+        structure_ = {};
+        error_ = validate_internal();
+        return error_;
+    }
+
     /**
      * Get validation error
      * @return ValidationError::none if packet is valid, otherwise specific error
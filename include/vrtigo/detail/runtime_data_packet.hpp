@@ -3,6 +3,7 @@
 #include <optional>
 #include <span>
 
+#include <cassert>
 #include <cstring>
 #include <vrtigo/class_id.hpp>
 #include <vrtigo/types.hpp>
@@ -86,6 +87,56 @@ public:
         error_ = validate_internal();
     }
 
+    /**
+     * Construct runtime parser for a trusted packet without validating
+     *
+     * Decodes the header and computes field offsets, skipping the packet type check. Only
+     * the checks that keep the view inside the buffer remain: error() reports
+     * buffer_too_small if the buffer is shorter than the header's packet size, and
+     * size_field_mismatch if that size cannot hold the prologue and trailer. Use
+     * validate() to check the packet fully. Debug builds assert that full validation
+     * passes.
+     *
+     * @param buffer Pointer to packet buffer
+     * @param buffer_size Size of buffer in bytes
+     */
+    RuntimeDataPacket(const uint8_t* buffer, size_t buffer_size, trusted_t) noexcept
+        : buffer_(buffer),
+          buffer_size_(buffer_size),
+          error_(ValidationError::none),
+          structure_{} {
+        if (!buffer_ || buffer_size_ < vrt_word_size) {
+            error_ = ValidationError::buffer_too_small;
+            return;
+        }
+        structure_.header = detail::decode_header(detail::read_u32(buffer_, 0));
+        structure_.has_stream_id = detail::has_stream_id_field(structure_.header.type);
+        if (size_t(structure_.header.size_words) * vrt_word_size > buffer_size_) {
+            error_ = ValidationError::buffer_too_small;
+            return;
+        }
+        size_t trailer_words = structure_.header.trailer_included ? 1 : 0;
+        if (structure_.header.size_words < compute_layout() + trailer_words) {
+            error_ = ValidationError::size_field_mismatch;
+            return;
+        }
+#ifndef NDEBUG
+        RuntimeDataPacket checked(buffer, buffer_size);
+        assert(checked.is_valid() && "trusted data packet failed validation");
+        assert(checked.structure_.payload_offset == structure_.payload_offset);
+#endif
+    }
+
+    /**
+     * Run full validation (for views built with the trusted constructor)
+     * @return ValidationError::none if packet is valid; also stored for error()
+     */
+    ValidationError validate() noexcept {
+        structure_ = {};
+        error_ = validate_internal();
+        return error_;
+    }
+
     /**
      * Get validation error
      * @return ValidationError::none if packet is valid, otherwise specific error
@@ -316,7 +367,24 @@ private:
             return ValidationError::buffer_too_small;
         }
 
-        // 7. Calculate field offsets (in bytes)
+        // 7. Calculate field offsets and payload size
+        size_t offset_words = compute_layout();
+        size_t trailer_words = structure_.header.trailer_included ? 1 : 0;
+
+        // 8. Sanity check: payload size should be non-negative
+        if (structure_.header.size_words < offset_words + trailer_words) {
+            return ValidationError::size_field_mismatch;
+        }
+
+        return ValidationError::none;
+    }
+
+    /**
+     * Compute field offsets and payload size from the decoded header
+     * @return Prologue size in words (offset of the payload)
+     */
+    size_t compute_layout() noexcept {
+        // Field offsets (in bytes)
         size_t offset_words = 1; // After header
 
         // Stream ID
@@ -346,9 +414,11 @@ private:
         // Payload starts here
         structure_.payload_offset = offset_words * vrt_word_size;
 
-        // 8. Calculate payload size
+        // Payload size
         size_t trailer_words = structure_.header.trailer_included ? 1 : 0;
-        size_t payload_words = structure_.header.size_words - offset_words - trailer_words;
+        size_t payload_words = structure_.header.size_words >= offset_words + trailer_words
+                                   ? structure_.header.size_words - offset_words - trailer_words
+                                   : 0;
         structure_.payload_size_bytes = payload_words * vrt_word_size;
 
         // Trailer offset (if present)
@@ -356,12 +426,7 @@ private:
             structure_.trailer_offset = (structure_.header.size_words - 1) * vrt_word_size;
         }
 
-        // 9. Sanity check: payload size should be non-negative
-        if (structure_.header.size_words < offset_words + trailer_words) {
-            return ValidationError::size_field_mismatch;
-        }
-
-        return ValidationError::none;
+        return offset_words;
     }
 };
 
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vrtigo/detail/field_access.hpp"
+#include "vrtigo/field_tags.hpp"
+
+namespace vrtigo {
+
+namespace detail {
+
+/// Packets gathered per block before conversion: the conversion loop then runs over a
+/// contiguous stack array with no field lookups, which the compiler can vectorize
+inline constexpr size_t field_batch_block_size = 64;
+
+/// Field type stored per packet by the batch extractors
+template <uint8_t CifWord, uint8_t Bit>
+using field_value_t = typename FieldTraits<CifWord, Bit>::value_type;
+
+/// Packet ranges the batch extractors accept: sized, with tagged field access per element
+template <typename R, uint8_t CifWord, uint8_t Bit>
+concept FieldPacketRange =
+    std::ranges::input_range<R> && std::ranges::sized_range<R> &&
+    requires(std::ranges::range_reference_t<R> pkt) { pkt[field::field_tag_t<CifWord, Bit>{}]; };
+
+/**
+ * @brief Gather one fixed-size field from a block of packets
+ *
+ * Absent fields (and malformed packets whose field does not fit) read as a zero encoding.
+ */
+template <typename It, uint8_t CifWord, uint8_t Bit>
+void gather_field_block(It& it, size_t count, field::field_tag_t<CifWord, Bit> tag,
+                        field_value_t<CifWord, Bit>* raw, uint8_t* present) noexcept {
+    for (size_t i = 0; i < count; ++i, ++it) {
+        auto proxy = (*it)[tag];
+        present[i] = proxy.has_value() ? 1 : 0;
+        raw[i] = proxy.has_value() ? proxy.encoded() : field_value_t<CifWord, Bit>{};
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Read one field from many packets into an array of encoded values
+ *
+ * @param packets Range of context packets (RuntimeContextPacket, ContextPacket, ...)
+ * @param tag Field to read (must be fixed-size)
+ * @param out One encoded value per packet; 0 where the field is absent
+ * @param present Optional presence flags (1 = field present), same row order as out
+ * @return Rows written: min(packets, out.size(), present.size() if non-empty)
+ */
+template <typename Packets, uint8_t CifWord, uint8_t Bit>
+    requires detail::FieldPacketRange<Packets, CifWord, Bit> &&
+             detail::FixedFieldTrait<detail::FieldTraits<CifWord, Bit>>
+size_t extract_encoded(const Packets& packets, field::field_tag_t<CifWord, Bit> tag,
+                       std::span<detail::field_value_t<CifWord, Bit>> out,
+                       std::span<uint8_t> present = {}) noexcept {
+    size_t rows = std::min(std::ranges::size(packets), out.size());
+    if (!present.empty()) {
+        rows = std::min(rows, present.size());
+    }
+    std::array<uint8_t, detail::field_batch_block_size> flags;
+    auto it = std::ranges::begin(packets);
+    for (size_t row = 0; row < rows; row += detail::field_batch_block_size) {
+        size_t count = std::min(detail::field_batch_block_size, rows - row);
+        detail::gather_field_block(it, count, tag, out.data() + row, flags.data());
+        if (!present.empty()) {
+            std::copy_n(flags.begin(), count, present.begin() + static_cast<ptrdiff_t>(row));
+        }
+    }
+    return rows;
+}
+
+/**
+ * @brief Convert one field from many packets into an array of integer units
+ *
+ * Batch form of FieldProxy::scaled(): e.g. bandwidth of every packet in a receive batch
+ * as millihertz, or reference level as centi-dBm. Field lookups are done per block into a
+ * stack array, then the fixed-point conversion runs as a separate tight integer loop.
+ *
+ * @param packets Range of context packets (RuntimeContextPacket, ContextPacket, ...)
+ * @param tag Field to convert (must have scaled support)
+ * @param out One scaled value per packet; 0 where the field is absent
+ * @param present Optional presence flags (1 = field present), same row order as out
+ * @return Rows written: min(packets, out.size(), present.size() if non-empty)
+ */
+template <typename Packets, uint8_t CifWord, uint8_t Bit>
+    requires detail::FieldPacketRange<Packets, CifWord, Bit> &&
+             detail::HasScaledAccess<field::field_tag_t<CifWord, Bit>>
+size_t extract_scaled(const Packets& packets, field::field_tag_t<CifWord, Bit> tag,
+                      std::span<typename detail::FieldTraits<CifWord, Bit>::scaled_type> out,
+                      std::span<uint8_t> present = {}) noexcept {
+    using Trait = detail::FieldTraits<CifWord, Bit>;
+    size_t rows = std::min(std::ranges::size(packets), out.size());
+    if (!present.empty()) {
+        rows = std::min(rows, present.size());
+    }
+    std::array<typename Trait::value_type, detail::field_batch_block_size> raw;
+    std::array<uint8_t, detail::field_batch_block_size> flags;
+    auto it = std::ranges::begin(packets);
+    for (size_t row = 0; row < rows; row += detail::field_batch_block_size) {
+        size_t count = std::min(detail::field_batch_block_size, rows - row);
+        detail::gather_field_block(it, count, tag, raw.data(), flags.data());
+        // A zero encoding converts to zero, so absent rows need no special case here
+        for (size_t i = 0; i < count; ++i) {
+            out[row + i] = Trait::to_scaled(raw[i]);
+        }
+        if (!present.empty()) {
+            std::copy_n(flags.begin(), count, present.begin() + static_cast<ptrdiff_t>(row));
+        }
+    }
+    return rows;
+}
+
+} // namespace vrtigo
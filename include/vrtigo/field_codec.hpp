@@ -0,0 +1,252 @@
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vrtigo/detail/cif.hpp"
+#include "vrtigo/detail/context_packet.hpp"
+#include "vrtigo/detail/field_access.hpp"
+#include "vrtigo/detail/field_mask.hpp"
+#include "vrtigo/detail/field_traits.hpp"
+#include "vrtigo/field_tags.hpp"
+
+namespace vrtigo {
+
+namespace detail {
+
+/// Traits of a field tag value
+template <auto Field>
+using codec_traits_t = FieldTraits<decltype(Field)::cif, decltype(Field)::bit>;
+
+/// Fields a FieldCodec can hold by value: fixed size with a scalar wire type
+template <auto Field>
+concept CodecField = FixedFieldTrait<codec_traits_t<Field>> &&
+                     std::is_arithmetic_v<typename codec_traits_t<Field>::value_type>;
+
+/// Position of a tag type in a field list (sizeof...(Fields) if absent)
+template <typename Tag, auto... Fields>
+constexpr size_t field_position() noexcept {
+    constexpr bool matches[] = {std::is_same_v<Tag, std::remove_cv_t<decltype(Fields)>>..., false};
+    for (size_t i = 0; i < sizeof...(Fields); ++i) {
+        if (matches[i]) {
+            return i;
+        }
+    }
+    return sizeof...(Fields);
+}
+
+/// True if every tag type in the list is distinct
+template <auto... Fields>
+constexpr bool fields_unique() noexcept {
+    constexpr size_t positions[] = {
+        field_position<std::remove_cv_t<decltype(Fields)>, Fields...>()..., 0};
+    for (size_t i = 0; i < sizeof...(Fields); ++i) {
+        if (positions[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * @brief Compile-time codec for a fixed set of context fields
+ *
+ * For streams whose context packets always carry the same fields, FieldCodec turns the
+ * field list into a record (one encoded value per field) and unrolled decode/encode
+ * functions that read and write every field at an offset folded to a constant. There is
+ * no per-field CIF walk, presence check or offset calculation.
+ *
+ * The record holds the on-wire encodings, like FieldProxy::encoded(); value() and
+ * set_value() convert fields with interpreted support (Hz, dB, ...). Only fixed-size
+ * fields with scalar encodings are supported; multi-word structured fields (e.g.
+ * ephemeris) and variable-length fields are rejected at compile time.
+ *
+ * Example:
+ * @code
+ * using namespace vrtigo::field;
+ * using Tuning = FieldCodec<sample_rate, bandwidth, rf_reference_frequency>;
+ *
+ * Tuning::record_type rec;
+ * if (Tuning::decode(runtime_ctx, rec)) {   // false unless the CIF words match exactly
+ *     double fs = rec.value(sample_rate);
+ * }
+ *
+ * Tuning::packet_type<UtcRealTimestamp> out(buffer);
+ * Tuning::encode(out, rec);
+ * @endcode
+ *
+ * @tparam Fields Field tags (e.g. field::bandwidth), in any order, each at most once
+ */
+template <auto... Fields>
+    requires(sizeof...(Fields) > 0 && (detail::CodecField<Fields> && ...))
+class FieldCodec {
+    static_assert(detail::fields_unique<Fields...>(), "FieldCodec fields must be distinct");
+
+    using mask = detail::FieldMask<Fields...>;
+
+public:
+    /// CIF words of a packet carrying exactly these fields (CIF0 includes enable bits)
+    static constexpr uint32_t cif0 = mask::cif0 |
+                                     (mask::cif1 != 0 ? (1U << cif::CIF1_ENABLE_BIT) : 0) |
+                                     (mask::cif2 != 0 ? (1U << cif::CIF2_ENABLE_BIT) : 0) |
+                                     (mask::cif3 != 0 ? (1U << cif::CIF3_ENABLE_BIT) : 0);
+    static constexpr uint32_t cif1 = mask::cif1;
+    static constexpr uint32_t cif2 = mask::cif2;
+    static constexpr uint32_t cif3 = mask::cif3;
+
+    /// Bytes occupied by the fields (after the CIF words)
+    static constexpr size_t fields_size_bytes =
+        cif::calculate_context_size_ct<mask::cif0, mask::cif1, mask::cif2, mask::cif3>() * 4;
+
+    /// Compile-time context packet with the same field layout
+    template <typename TimestampType = NoTimestamp, typename ClassIdType = NoClassId>
+    using packet_type = ContextPacket<TimestampType, ClassIdType, Fields...>;
+
+    /**
+     * @brief Byte offset of a field from the start of the context fields
+     */
+    template <uint8_t CifWord, uint8_t Bit>
+    static constexpr size_t offset_of(field::field_tag_t<CifWord, Bit>) noexcept {
+        return cif::calculate_field_offset_ct<cif0, cif1, cif2, cif3, CifWord, Bit>();
+    }
+
+    /**
+     * @brief Encoded values of every field, in template-argument order
+     */
+    struct record_type {
+        std::tuple<typename detail::codec_traits_t<Fields>::value_type...> values{};
+
+        /// Encoded value of a field
+        template <uint8_t CifWord, uint8_t Bit>
+        auto& operator[](field::field_tag_t<CifWord, Bit>) noexcept {
+            return std::get<index_of<field::field_tag_t<CifWord, Bit>>()>(values);
+        }
+
+        template <uint8_t CifWord, uint8_t Bit>
+        const auto& operator[](field::field_tag_t<CifWord, Bit>) const noexcept {
+            return std::get<index_of<field::field_tag_t<CifWord, Bit>>()>(values);
+        }
+
+        /// Interpreted value of a field (Hz, dB, ...)
+        template <uint8_t CifWord, uint8_t Bit>
+            requires detail::HasInterpretedAccess<field::field_tag_t<CifWord, Bit>>
+        auto value(field::field_tag_t<CifWord, Bit> tag) const noexcept {
+            return detail::FieldTraits<CifWord, Bit>::to_interpreted((*this)[tag]);
+        }
+
+        /// Set a field from its interpreted value
+        template <uint8_t CifWord, uint8_t Bit>
+            requires detail::HasInterpretedAccess<field::field_tag_t<CifWord, Bit>>
+        void set_value(
+            field::field_tag_t<CifWord, Bit> tag,
+            typename detail::FieldTraits<CifWord, Bit>::interpreted_type value) noexcept {
+            (*this)[tag] = detail::FieldTraits<CifWord, Bit>::from_interpreted(value);
+        }
+
+        bool operator==(const record_type&) const = default;
+    };
+
+    /**
+     * @brief Read every field from the start of the context fields
+     *
+     * @param fields Pointer to the first byte after the CIF words; must hold
+     *        fields_size_bytes bytes
+     * @param out Receives the encoded values
+     */
+    static void decode_fields(const uint8_t* fields, record_type& out) noexcept {
+        decode_all(fields, out, std::index_sequence_for<decltype(Fields)...>{});
+    }
+
+    /**
+     * @brief Write every field at the start of the context fields
+     *
+     * @param fields Pointer to the first byte after the CIF words; must hold
+     *        fields_size_bytes bytes
+     * @param in Encoded values to write
+     */
+    static void encode_fields(uint8_t* fields, const record_type& in) noexcept {
+        encode_all(fields, in, std::index_sequence_for<decltype(Fields)...>{});
+    }
+
+    /**
+     * @brief Check that a packet carries exactly this field set
+     */
+    template <typename Packet>
+        requires detail::CifPacketBase<Packet>
+    static bool matches(const Packet& packet) noexcept {
+        return packet.cif0() == cif0 && packet.cif1() == cif1 && packet.cif2() == cif2 &&
+               packet.cif3() == cif3;
+    }
+
+    /**
+     * @brief Decode all fields of a packet with this field set
+     *
+     * @param packet Context packet (RuntimeContextPacket, ContextPacket, ...)
+     * @param out Receives the encoded values
+     * @return false (out untouched) if the packet is an invalid runtime view, its CIF words
+     *         differ from this codec's, or its buffer is too short
+     */
+    template <typename Packet>
+        requires detail::CifPacketBase<Packet>
+    static bool decode(const Packet& packet, record_type& out) noexcept {
+        if constexpr (requires { packet.is_valid(); }) {
+            if (!packet.is_valid()) {
+                return false;
+            }
+        }
+        if (!matches(packet) ||
+            packet.buffer_size() < packet.context_base_offset() + fields_size_bytes) {
+            return false;
+        }
+        decode_fields(packet.context_buffer() + packet.context_base_offset(), out);
+        return true;
+    }
+
+    /**
+     * @brief Encode all fields into a packet with this field set
+     *
+     * @param packet Mutable context packet, typically packet_type<...>
+     * @param in Encoded values to write
+     * @return false (packet untouched) if the packet's CIF words differ from this codec's
+     */
+    template <typename Packet>
+        requires detail::MutableCifPacket<Packet>
+    static bool encode(Packet& packet, const record_type& in) noexcept {
+        if (!matches(packet)) {
+            return false;
+        }
+        encode_fields(packet.mutable_context_buffer() + packet.context_base_offset(), in);
+        return true;
+    }
+
+private:
+    template <typename Tag>
+    static constexpr size_t index_of() noexcept {
+        constexpr size_t index = detail::field_position<Tag, Fields...>();
+        static_assert(index < sizeof...(Fields), "Field is not part of this FieldCodec");
+        return index;
+    }
+
+    template <size_t... I>
+    static void decode_all(const uint8_t* fields, record_type& out,
+                           std::index_sequence<I...>) noexcept {
+        ((std::get<I>(out.values) =
+              detail::codec_traits_t<Fields>::read(fields, offset_of(Fields))),
+         ...);
+    }
+
+    template <size_t... I>
+    static void encode_all(uint8_t* fields, const record_type& in,
+                           std::index_sequence<I...>) noexcept {
+        (detail::codec_traits_t<Fields>::write(fields, offset_of(Fields), std::get<I>(in.values)),
+         ...);
+    }
+};
+
+} // namespace vrtigo
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vrtigo/class_id.hpp"
+#include "vrtigo/detail/buffer_io.hpp"
+#include "vrtigo/detail/header_decode.hpp"
+#include "vrtigo/detail/packet_header_accessor.hpp"
+#include "vrtigo/detail/packet_parser.hpp"
+#include "vrtigo/detail/packet_variant.hpp"
+#include "vrtigo/detail/runtime_command_packet.hpp"
+#include "vrtigo/detail/runtime_context_packet.hpp"
+#include "vrtigo/detail/runtime_data_packet.hpp"
+#include "vrtigo/types.hpp"
+
+namespace vrtigo {
+
+/**
+ * @brief Packet family held by a PacketHandle
+ */
+enum class PacketKind : uint8_t {
+    invalid, ///< Validation failed (see PacketHandle::error())
+    data,    ///< Signal or extension data (types 0-3)
+    context, ///< Context or extension context (types 4-5)
+    command  ///< Command or extension command (types 6-7)
+};
+
+/**
+ * @brief Compact, trivially copyable handle to a validated packet
+ *
+ * Holds what PacketVariant derives eagerly in a fraction of the space: the buffer
+ * pointer, packet size, host-order header word, the byte offset where the prologue ends,
+ * and the validation result. Prologue fields (stream ID, timestamps, class ID) and the
+ * data payload are read from the buffer on demand; the full runtime views are rebuilt
+ * with as_data(), as_context() or as_command() when field access is needed (data and
+ * context views in trusted mode, since the handle has already been validated).
+ *
+ * PacketHandle::parse() applies the same validation as parse_packet(), so a valid handle
+ * carries the same guarantees as a valid PacketVariant. Use it for queues, batches and
+ * other hot paths where packets are copied more often than inspected.
+ *
+ * Like the runtime views, a handle references the packet buffer and is only valid while
+ * that buffer is.
+ *
+ * Example:
+ * @code
+ * std::vector<PacketHandle> pending;
+ * pending.push_back(PacketHandle::parse(bytes));
+ *
+ * for (const auto& handle : pending) {
+ *     if (auto ctx = handle.as_context()) {
+ *         apply(*ctx);
+ *     } else if (handle.kind() == PacketKind::data) {
+ *         process(handle.stream_id(), handle.payload());
+ *     }
+ * }
+ * @endcode
+ */
+class PacketHandle {
+public:
+    /**
+     * @brief Empty handle (invalid, no bytes)
+     */
+    constexpr PacketHandle() noexcept = default;
+
+    /**
+     * @brief Parse and validate a packet
+     *
+     * @param bytes Raw packet bytes (must remain valid while using the handle)
+     * @return Handle; check is_valid() or kind()
+     */
+    static PacketHandle parse(std::span<const uint8_t> bytes) noexcept {
+        PacketHandle handle;
+        handle.data_ = bytes.data();
+        handle.size_bytes_ = static_cast<uint32_t>(bytes.size());
+        if (bytes.size() < vrt_word_size) {
+            handle.error_ = ValidationError::buffer_too_small;
+            return handle;
+        }
+        handle.header_ = detail::read_u32(bytes.data(), 0);
+        auto decoded = detail::decode_header(handle.header_);
+
+        // Full validation with the runtime parsers; only the verdict is kept
+        ValidationError error = ValidationError::invalid_packet_type;
+        PacketKind kind = PacketKind::invalid;
+        uint8_t type = static_cast<uint8_t>(decoded.type);
+        if (type <= 3) {
+            error = RuntimeDataPacket(bytes.data(), bytes.size()).error();
+            kind = PacketKind::data;
+        } else if (type <= 5) {
+            error = RuntimeContextPacket(bytes.data(), bytes.size()).error();
+            kind = PacketKind::context;
+        } else if (type <= 7) {
+            error = RuntimeCommandPacket(bytes.data(), bytes.size()).error();
+            kind = PacketKind::command;
+        }
+
+        handle.error_ = error;
+        if (error != ValidationError::none) {
+            return handle;
+        }
+        handle.kind_ = kind;
+        handle.size_bytes_ = static_cast<uint32_t>(decoded.size_words) * vrt_word_size;
+        handle.prologue_bytes_ = static_cast<uint16_t>(prologue_words(decoded) * vrt_word_size);
+        return handle;
+    }
+
+    // Validation result
+
+    bool is_valid() const noexcept { return kind_ != PacketKind::invalid; }
+
+    ValidationError error() const noexcept { return error_; }
+
+    PacketKind kind() const noexcept { return kind_; }
+
+    /**
+     * @brief Packet type from the header (meaningful when at least 4 bytes were given)
+     */
+    PacketType type() const noexcept { return detail::decode_header(header_).type; }
+
+    /**
+     * @brief Header accessor (references this handle)
+     */
+    HeaderView header() const noexcept { return HeaderView{&header_}; }
+
+    // Buffer access
+
+    /**
+     * @brief Packet bytes (declared packet size when valid, the whole input otherwise)
+     */
+    std::span<const uint8_t> bytes() const noexcept { return {data_, size_bytes_}; }
+
+    /**
+     * @brief Packet bytes if valid, otherwise an empty span (matches the runtime views)
+     */
+    std::span<const uint8_t> as_bytes() const noexcept {
+        return is_valid() ? bytes() : std::span<const uint8_t>{};
+    }
+
+    size_t packet_size_bytes() const noexcept { return is_valid() ? size_bytes_ : 0; }
+
+    // Prologue fields, read on demand
+
+    uint8_t packet_count() const noexcept { return header().packet_count(); }
+
+    TsiType tsi_kind() const noexcept { return header().tsi_kind(); }
+
+    TsfType tsf_kind() const noexcept { return header().tsf_kind(); }
+
+    /**
+     * @brief Stream ID, if the packet type carries one
+     */
+    std::optional<uint32_t> stream_id() const noexcept {
+        if (!is_valid() || !detail::has_stream_id_field(type())) {
+            return std::nullopt;
+        }
+        return detail::read_u32(data_, vrt_word_size);
+    }
+
+    /**
+     * @brief Class ID, if present
+     */
+    std::optional<ClassIdValue> class_id() const noexcept {
+        if (!is_valid() || !header().has_class_id()) {
+            return std::nullopt;
+        }
+        size_t offset = class_id_offset();
+        return ClassIdValue::fromWords(detail::read_u32(data_, offset),
+                                       detail::read_u32(data_, offset + vrt_word_size));
+    }
+
+    /**
+     * @brief Integer timestamp, if present
+     */
+    std::optional<uint32_t> timestamp_integer() const noexcept {
+        if (!is_valid() || tsi_kind() == TsiType::none) {
+            return std::nullopt;
+        }
+        return detail::read_u32(data_, timestamp_offset());
+    }
+
+    /**
+     * @brief Fractional timestamp, if present
+     */
+    std::optional<uint64_t> timestamp_fractional() const noexcept {
+        if (!is_valid() || tsf_kind() == TsfType::none) {
+            return std::nullopt;
+        }
+        size_t offset = timestamp_offset() + (tsi_kind() != TsiType::none ? vrt_word_size : 0);
+        return detail::read_u64(data_, offset);
+    }
+
+    /**
+     * @brief Data packet payload (empty for other kinds)
+     */
+    std::span<const uint8_t> payload() const noexcept {
+        if (kind_ != PacketKind::data) {
+            return {};
+        }
+        size_t end = size_bytes_ - (header().has_trailer() ? vrt_word_size : 0);
+        return {data_ + prologue_bytes_, end - prologue_bytes_};
+    }
+
+    // Full views, rebuilt from the buffer without revalidating (see trusted_t)
+
+    std::optional<RuntimeDataPacket> as_data() const noexcept {
+        if (kind_ != PacketKind::data) {
+            return std::nullopt;
+        }
+        return RuntimeDataPacket(data_, size_bytes_, trusted);
+    }
+
+    std::optional<RuntimeContextPacket> as_context() const noexcept {
+        if (kind_ != PacketKind::context) {
+            return std::nullopt;
+        }
+        return RuntimeContextPacket(data_, size_bytes_, trusted);
+    }
+
+    std::optional<RuntimeCommandPacket> as_command() const noexcept {
+        if (kind_ != PacketKind::command) {
+            return std::nullopt;
+        }
+        return RuntimeCommandPacket(data_, size_bytes_);
+    }
+
+    /**
+     * @brief Expand to the equivalent PacketVariant
+     */
+    PacketVariant to_variant() const noexcept {
+        if (data_ == nullptr) {
+            return InvalidPacket{error_, PacketType::signal_data_no_id, detail::DecodedHeader{},
+                                 {}};
+        }
+        return detail::parse_packet(bytes());
+    }
+
+private:
+    static size_t prologue_words(const detail::DecodedHeader& decoded) noexcept {
+        return 1 + (detail::has_stream_id_field(decoded.type) ? 1 : 0) +
+               (decoded.has_class_id ? 2 : 0) + (decoded.tsi != TsiType::none ? 1 : 0) +
+               (decoded.tsf != TsfType::none ? 2 : 0);
+    }
+
+    size_t class_id_offset() const noexcept {
+        return vrt_word_size * (detail::has_stream_id_field(type()) ? 2 : 1);
+    }
+
+    size_t timestamp_offset() const noexcept {
+        return class_id_offset() + (header().has_class_id() ? 2 * vrt_word_size : 0);
+    }
+
+    const uint8_t* data_ = nullptr;
+    uint32_t size_bytes_ = 0;
+    uint32_t header_ = 0;        ///< Header word in host byte order
+    uint16_t prologue_bytes_ = 0; ///< Payload (data), CIF0 (context) or CAM (command) offset
+    ValidationError error_ = ValidationError::buffer_too_small;
+    PacketKind kind_ = PacketKind::invalid;
+};
+
+static_assert(std::is_trivially_copyable_v<PacketHandle>,
+              "PacketHandle must be trivially copyable");
+static_assert(sizeof(PacketHandle) <= 32, "PacketHandle must stay within half a cache line");
+
+} // namespace vrtigo
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vrtigo/detail/buffer_io.hpp"
+#include "vrtigo/detail/header.hpp"
+#include "vrtigo/types.hpp"
+
+namespace vrtigo {
+
+/**
+ * @brief Per-row status bits written by the metadata extractors
+ */
+namespace metadata_status {
+inline constexpr uint8_t valid = 0x01;         ///< Header and prologue fit in the packet
+inline constexpr uint8_t has_stream_id = 0x02; ///< stream_id column holds a stream ID
+inline constexpr uint8_t has_tsi = 0x04;       ///< tsi column holds an integer timestamp
+inline constexpr uint8_t has_tsf = 0x08;       ///< tsf column holds a fractional timestamp
+} // namespace metadata_status
+
+/**
+ * @brief Caller-provided structure-of-arrays output for metadata extraction
+ *
+ * Each non-empty column receives one element per packet, at the same row index in every
+ * column. Empty columns are skipped, so a scan only pays for the fields it needs. Fields a
+ * packet does not carry (or that do not fit in a malformed packet) are written as 0; the
+ * status column tells them apart from genuine zeros.
+ *
+ * The raw header column (host byte order) carries everything else: packet type, TSI/TSF
+ * kinds, and packet size, decodable with the header bit helpers.
+ */
+struct MetadataColumns {
+    std::span<uint32_t> tsi{};         ///< Integer timestamp
+    std::span<uint64_t> tsf{};         ///< Fractional timestamp
+    std::span<uint32_t> stream_id{};   ///< Stream identifier
+    std::span<uint8_t> packet_count{}; ///< 4-bit packet count
+    std::span<uint32_t> header{};      ///< Raw header word
+    std::span<uint8_t> status{};       ///< metadata_status bits
+
+    /**
+     * @brief Rows that fit in every non-empty column (0 if all are empty)
+     */
+    size_t capacity() const noexcept {
+        size_t rows = SIZE_MAX;
+        auto limit = [&rows](size_t size) {
+            if (size != 0) {
+                rows = std::min(rows, size);
+            }
+        };
+        limit(tsi.size());
+        limit(tsf.size());
+        limit(stream_id.size());
+        limit(packet_count.size());
+        limit(header.size());
+        limit(status.size());
+        return rows == SIZE_MAX ? 0 : rows;
+    }
+};
+
+/**
+ * @brief Progress of a scan over back-to-back packets
+ */
+struct MetadataScanResult {
+    size_t rows = 0;           ///< Rows written (packets scanned)
+    size_t bytes_consumed = 0; ///< Bytes of input covered by those packets
+};
+
+namespace detail {
+
+/// Packets decoded per block: large enough for the decode pass to vectorize, small enough
+/// to keep the per-block scratch on the stack
+inline constexpr size_t metadata_block_size = 64;
+
+/**
+ * @brief Decode and store metadata for a block of packets
+ *
+ * Three passes over the block: load header words, decode field presence and offsets with
+ * straight-line integer arithmetic (no per-field branches, so the compiler can vectorize
+ * it), then gather the few prologue words each column needs. Payload bytes are never
+ * touched.
+ */
+inline void extract_metadata_block(const uint8_t* const* packets, const size_t* sizes,
+                                   size_t count, const MetadataColumns& columns,
+                                   size_t row) noexcept {
+    std::array<uint32_t, metadata_block_size> headers;
+    std::array<uint32_t, metadata_block_size> tsi_offset;
+    std::array<uint32_t, metadata_block_size> tsf_offset;
+    std::array<uint8_t, metadata_block_size> status;
+
+    for (size_t i = 0; i < count; ++i) {
+        headers[i] = sizes[i] >= vrt_word_size ? read_u32(packets[i], 0) : 0;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t h = headers[i];
+        uint32_t type = (h >> header::packet_type_shift) & header::packet_type_mask;
+        uint32_t class_id = (h >> header::class_id_shift) & header::class_id_mask;
+        uint32_t tsi_present = ((h >> header::tsi_shift) & header::tsi_mask) != 0;
+        uint32_t tsf_present = ((h >> header::tsf_shift) & header::tsf_mask) != 0;
+        uint32_t size_words = (h >> header::size_shift) & header::size_mask;
+        // Types 0 and 2 lack a stream ID; types 8-15 are reserved
+        uint32_t stream_present = (type & 1) | (type >= 4);
+
+        uint32_t tsi_word = 1 + stream_present + 2 * class_id;
+        uint32_t tsf_word = tsi_word + tsi_present;
+        uint32_t prologue_words = tsf_word + 2 * tsf_present;
+        uint32_t available_words = static_cast<uint32_t>(
+            std::min<size_t>(sizes[i] / vrt_word_size, header::size_mask));
+
+        uint32_t ok = (type <= 7) & (size_words >= prologue_words) &
+                      (size_words <= available_words);
+        status[i] = static_cast<uint8_t>(ok * (metadata_status::valid |
+                                               stream_present * metadata_status::has_stream_id |
+                                               tsi_present * metadata_status::has_tsi |
+                                               tsf_present * metadata_status::has_tsf));
+        tsi_offset[i] = tsi_word * vrt_word_size;
+        tsf_offset[i] = tsf_word * vrt_word_size;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* p = packets[i];
+        uint8_t s = status[i];
+        if (!columns.header.empty()) {
+            columns.header[row + i] = headers[i];
+        }
+        if (!columns.status.empty()) {
+            columns.status[row + i] = s;
+        }
+        if (!columns.packet_count.empty()) {
+            columns.packet_count[row + i] = static_cast<uint8_t>(
+                (headers[i] >> header::packet_count_shift) & header::packet_count_mask);
+        }
+        if (!columns.stream_id.empty()) {
+            columns.stream_id[row + i] =
+                (s & metadata_status::has_stream_id) ? read_u32(p, vrt_word_size) : 0;
+        }
+        if (!columns.tsi.empty()) {
+            columns.tsi[row + i] = (s & metadata_status::has_tsi) ? read_u32(p, tsi_offset[i]) : 0;
+        }
+        if (!columns.tsf.empty()) {
+            columns.tsf[row + i] = (s & metadata_status::has_tsf) ? read_u64(p, tsf_offset[i]) : 0;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Extract timestamps, stream IDs and packet counts from a batch of packets
+ *
+ * Reads only the header and prologue words of each packet; no PacketVariant is built and
+ * payloads are skipped. Validation is limited to what the extracted fields depend on
+ * (packet type, declared size vs. buffer size, prologue fits): use parse_packet() for full
+ * validation.
+ *
+ * @param packets One span per packet (e.g. from a receive batch)
+ * @param columns Output columns
+ * @return Rows written: min(packets.size(), columns.capacity())
+ */
+inline size_t extract_packet_metadata(std::span<const std::span<const uint8_t>> packets,
+                                      const MetadataColumns& columns) noexcept {
+    size_t rows = std::min(packets.size(), columns.capacity());
+    std::array<const uint8_t*, detail::metadata_block_size> pointers;
+    std::array<size_t, detail::metadata_block_size> sizes;
+
+    for (size_t row = 0; row < rows; row += detail::metadata_block_size) {
+        size_t count = std::min(detail::metadata_block_size, rows - row);
+        for (size_t i = 0; i < count; ++i) {
+            pointers[i] = packets[row + i].data();
+            sizes[i] = packets[row + i].size();
+        }
+        detail::extract_metadata_block(pointers.data(), sizes.data(), count, columns, row);
+    }
+    return rows;
+}
+
+/**
+ * @brief Extract metadata from back-to-back packets in one buffer
+ *
+ * Walks a contiguous VRT stream (a mapped file, a file chunk, a TCP receive buffer) using
+ * each header's size word, and stops at the first incomplete packet, at a zero-size header
+ * (which cannot be stepped over), or when the columns are full. Call again with the
+ * remaining bytes and fresh columns to continue.
+ *
+ * @param bytes Concatenated VRT packets
+ * @param columns Output columns
+ * @return Rows written and bytes consumed
+ */
+inline MetadataScanResult scan_packet_metadata(std::span<const uint8_t> bytes,
+                                               const MetadataColumns& columns) noexcept {
+    MetadataScanResult result;
+    size_t capacity = columns.capacity();
+    std::array<const uint8_t*, detail::metadata_block_size> pointers;
+    std::array<size_t, detail::metadata_block_size> sizes;
+
+    while (result.rows < capacity) {
+        size_t count = 0;
+        size_t limit = std::min(detail::metadata_block_size, capacity - result.rows);
+        while (count < limit && bytes.size() - result.bytes_consumed >= vrt_word_size) {
+            const uint8_t* p = bytes.data() + result.bytes_consumed;
+            size_t packet_bytes =
+                size_t((detail::read_u32(p, 0) >> header::size_shift) & header::size_mask) *
+                vrt_word_size;
+            if (packet_bytes == 0 || packet_bytes > bytes.size() - result.bytes_consumed) {
+                break;
+            }
+            pointers[count] = p;
+            sizes[count] = packet_bytes;
+            result.bytes_consumed += packet_bytes;
+            ++count;
+        }
+        if (count == 0) {
+            break;
+        }
+        detail::extract_metadata_block(pointers.data(), sizes.data(), count, columns,
+                                       result.rows);
+        result.rows += count;
+    }
+    return result;
+}
+
+} // namespace vrtigo
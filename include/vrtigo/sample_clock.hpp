@@ -0,0 +1,401 @@
+#pragma once
+
+#include "vrtigo/timestamp.hpp"
+#include "vrtigo/types.hpp"
+
+#include <cstdint>
+
+namespace vrtigo {
+
+namespace detail {
+
+// 128-bit intermediates keep every conversion exact (GCC/Clang only, like the rest of the
+// library). __extension__ silences -Wpedantic for the non-standard type.
+__extension__ using uint128_t = unsigned __int128;
+
+constexpr uint64_t saturate_u64(uint128_t value) noexcept {
+    return value > UINT64_MAX ? UINT64_MAX : static_cast<uint64_t>(value);
+}
+
+} // namespace detail
+
+/**
+ * @brief Rational sample rate in samples per second (numerator / denominator)
+ *
+ * Rates that are not whole numbers of samples per second (e.g. 1 GHz / 3) are expressed
+ * exactly, so conversions never accumulate floating-point error.
+ *
+ * All arithmetic uses 128-bit intermediates; results are exact for numerators below 2^56
+ * and denominators below 2^32.
+ */
+struct SampleRate {
+    uint64_t numerator{0};   ///< Samples
+    uint64_t denominator{1}; ///< Per this many seconds
+
+    /**
+     * @brief Check that the rate is non-zero and finite
+     */
+    constexpr bool is_valid() const noexcept { return numerator != 0 && denominator != 0; }
+
+    /**
+     * @brief Check if every second holds the same whole number of samples
+     */
+    constexpr bool is_integer() const noexcept {
+        return is_valid() && numerator % denominator == 0;
+    }
+
+    /**
+     * @brief Approximate rate in Hz (for display only)
+     */
+    constexpr double hz() const noexcept {
+        return is_valid() ? static_cast<double>(numerator) / static_cast<double>(denominator)
+                          : 0.0;
+    }
+};
+
+/**
+ * @brief Sample-rate-aware timestamp arithmetic
+ *
+ * Maps between sample indices and time for a fixed SampleRate using integer math only:
+ * - Sample index <-> elapsed picoseconds
+ * - Advancing sample_count and real_time timestamps by N samples
+ * - Converting sample_count TSF timestamps to real_time TSF and back
+ * - Timestamp of any sample within a payload
+ *
+ * For TSF=sample_count with an integer timestamp, the fractional field counts samples since
+ * the start of the current integer second and rolls over at the second boundary (VITA 49.2).
+ * For non-integer rates the first sample of second s is the first sample at or after s,
+ * i.e. ceil(s * rate). With TSI=none the sample count is a free-running counter.
+ *
+ * Real-time results are floored to whole picoseconds. To iterate over a stream without
+ * accumulating that rounding, advance from a fixed anchor (see SampleClock).
+ *
+ * Operations on an invalid rate (is_valid() == false) return zero values.
+ *
+ * Example:
+ * @code
+ * using UtcSampleTimestamp = Timestamp<TsiType::utc, TsfType::sample_count>;
+ * constexpr SampleTimebase tb(SampleRate{30'720'000});
+ * constexpr auto next = tb.advance(UtcSampleTimestamp(1700000000, 30'719'000), 2048);
+ * static_assert(next.tsi() == 1700000001 && next.tsf() == 1048);
+ * auto t = tb.to_real_time(next); // UTC real_time timestamp of that sample
+ * @endcode
+ */
+class SampleTimebase {
+public:
+    constexpr explicit SampleTimebase(SampleRate rate) noexcept : rate_(rate) {}
+
+    constexpr SampleRate rate() const noexcept { return rate_; }
+
+    constexpr bool is_valid() const noexcept { return rate_.is_valid(); }
+
+    // ========================================================================
+    // Sample index <-> elapsed time
+    // ========================================================================
+
+    /**
+     * @brief Elapsed time from sample 0 to a sample index
+     *
+     * @return Picoseconds (floored, saturating at UINT64_MAX)
+     */
+    constexpr uint64_t picoseconds_at(uint64_t sample_index) const noexcept {
+        if (!is_valid()) {
+            return 0;
+        }
+        auto [seconds, picoseconds] = split(sample_index);
+        if (seconds > UINT64_MAX / picoseconds_per_second) {
+            return UINT64_MAX;
+        }
+        return detail::saturate_u64(seconds * picoseconds_per_second + picoseconds);
+    }
+
+    /**
+     * @brief Index of the last sample at or before an elapsed time
+     *
+     * @return Sample index (floored, saturating at UINT64_MAX)
+     */
+    constexpr uint64_t sample_at(uint64_t picoseconds) const noexcept {
+        if (!is_valid()) {
+            return 0;
+        }
+        return detail::saturate_u64(static_cast<detail::uint128_t>(picoseconds) *
+                                    rate_.numerator / picosecond_denominator());
+    }
+
+    /**
+     * @brief Index of the first sample at or after an elapsed time
+     *
+     * @return Sample index (ceiled, saturating at UINT64_MAX)
+     */
+    constexpr uint64_t sample_at_or_after(uint64_t picoseconds) const noexcept {
+        if (!is_valid()) {
+            return 0;
+        }
+        return detail::saturate_u64(ceil_div(
+            static_cast<detail::uint128_t>(picoseconds) * rate_.numerator,
+            picosecond_denominator()));
+    }
+
+    // ========================================================================
+    // Timestamp arithmetic
+    // ========================================================================
+
+    /**
+     * @brief Advance a sample-count timestamp by N samples
+     *
+     * Exact: carries into the integer seconds at the rate's second boundaries. Seconds
+     * saturate at UINT32_MAX.
+     */
+    template <TsiType TSI>
+    constexpr Timestamp<TSI, TsfType::sample_count>
+    advance(Timestamp<TSI, TsfType::sample_count> ts, uint64_t samples) const noexcept {
+        if constexpr (TSI == TsiType::none) {
+            return Timestamp<TSI, TsfType::sample_count>(0, ts.tsf() + samples);
+        } else {
+            if (!is_valid()) {
+                return {};
+            }
+            return from_absolute_sample<TSI>(absolute_sample(ts) + samples);
+        }
+    }
+
+    /**
+     * @brief Advance a real-time timestamp by N samples
+     *
+     * The offset is computed in one step and floored to whole picoseconds, so advancing
+     * by N once is exact to 1 ps. Repeatedly advancing the result accumulates that
+     * rounding; use SampleClock to step from a fixed anchor instead.
+     */
+    template <TsiType TSI>
+    constexpr Timestamp<TSI, TsfType::real_time>
+    advance(Timestamp<TSI, TsfType::real_time> ts, uint64_t samples) const noexcept {
+        if (!is_valid()) {
+            return {};
+        }
+        auto [seconds, picoseconds] = split(samples);
+        detail::uint128_t total_ps = static_cast<detail::uint128_t>(ts.tsf()) + picoseconds;
+        detail::uint128_t total_seconds = ts.tsi() + seconds + total_ps / picoseconds_per_second;
+        if (total_seconds > UINT32_MAX) {
+            return Timestamp<TSI, TsfType::real_time>(UINT32_MAX, picoseconds_per_second - 1);
+        }
+        return Timestamp<TSI, TsfType::real_time>(
+            static_cast<uint32_t>(total_seconds),
+            static_cast<uint64_t>(total_ps % picoseconds_per_second));
+    }
+
+    /**
+     * @brief Timestamp of a sample within a payload
+     *
+     * @param first_sample Timestamp of the payload's first sample (the packet timestamp)
+     * @param index Sample index within the payload
+     */
+    template <TsiType TSI, TsfType TSF>
+        requires(TSF == TsfType::sample_count || TSF == TsfType::real_time)
+    constexpr Timestamp<TSI, TSF> sample_timestamp(Timestamp<TSI, TSF> first_sample,
+                                                   uint64_t index) const noexcept {
+        return advance(first_sample, index);
+    }
+
+    /**
+     * @brief Signed number of samples from one sample-count timestamp to another
+     *
+     * Useful for detecting gaps: the expected value between consecutive packets is the
+     * previous packet's sample count.
+     */
+    template <TsiType TSI>
+    constexpr int64_t samples_between(Timestamp<TSI, TsfType::sample_count> from,
+                                      Timestamp<TSI, TsfType::sample_count> to) const noexcept {
+        if constexpr (TSI == TsiType::none) {
+            return static_cast<int64_t>(to.tsf() - from.tsf());
+        } else {
+            if (!is_valid()) {
+                return 0;
+            }
+            return static_cast<int64_t>(absolute_sample(to) - absolute_sample(from));
+        }
+    }
+
+    // ========================================================================
+    // TSF conversions
+    // ========================================================================
+
+    /**
+     * @brief Convert a sample-count timestamp to real-time picoseconds
+     *
+     * @return Time of the sample, floored to whole picoseconds
+     */
+    template <TsiType TSI>
+        requires(TSI != TsiType::none)
+    constexpr Timestamp<TSI, TsfType::real_time>
+    to_real_time(Timestamp<TSI, TsfType::sample_count> ts) const noexcept {
+        if (!is_valid()) {
+            return {};
+        }
+        detail::uint128_t scaled = absolute_sample(ts) * rate_.denominator;
+        detail::uint128_t seconds = scaled / rate_.numerator;
+        if (seconds > UINT32_MAX) {
+            return Timestamp<TSI, TsfType::real_time>(UINT32_MAX,
+                                                      picoseconds_per_second - 1);
+        }
+        auto picoseconds =
+            (scaled % rate_.numerator) * picoseconds_per_second / rate_.numerator;
+        return Timestamp<TSI, TsfType::real_time>(static_cast<uint32_t>(seconds),
+                                                  static_cast<uint64_t>(picoseconds));
+    }
+
+    /**
+     * @brief Convert a real-time timestamp to the first sample at or after it
+     *
+     * Round-trips with to_real_time() for any rate below 1 THz.
+     */
+    template <TsiType TSI>
+        requires(TSI != TsiType::none)
+    constexpr Timestamp<TSI, TsfType::sample_count>
+    to_sample_count(Timestamp<TSI, TsfType::real_time> ts) const noexcept {
+        if (!is_valid()) {
+            return {};
+        }
+        detail::uint128_t picoseconds =
+            static_cast<detail::uint128_t>(ts.tsi()) * picoseconds_per_second + ts.tsf();
+        return from_absolute_sample<TSI>(
+            ceil_div(picoseconds * rate_.numerator, picosecond_denominator()));
+    }
+
+    /**
+     * @brief Index of the first sample in an integer second
+     *
+     * Equal to ceil(second * rate), counted from the TSI epoch.
+     */
+    constexpr detail::uint128_t first_sample_of_second(uint32_t second) const noexcept {
+        if (!is_valid()) {
+            return 0;
+        }
+        return ceil_div(static_cast<detail::uint128_t>(second) * rate_.numerator,
+                        rate_.denominator);
+    }
+
+private:
+    struct SplitOffset {
+        detail::uint128_t seconds;
+        uint64_t picoseconds;
+    };
+
+    static constexpr detail::uint128_t ceil_div(detail::uint128_t num,
+                                                detail::uint128_t den) noexcept {
+        return num / den + (num % den != 0 ? 1 : 0);
+    }
+
+    constexpr detail::uint128_t picosecond_denominator() const noexcept {
+        return static_cast<detail::uint128_t>(rate_.denominator) * picoseconds_per_second;
+    }
+
+    /// Duration of N samples as whole seconds plus floored picoseconds (no overflow)
+    constexpr SplitOffset split(uint64_t samples) const noexcept {
+        detail::uint128_t scaled = static_cast<detail::uint128_t>(samples) * rate_.denominator;
+        auto remainder = scaled % rate_.numerator;
+        return {scaled / rate_.numerator, static_cast<uint64_t>(remainder *
+                                                                picoseconds_per_second /
+                                                                rate_.numerator)};
+    }
+
+    template <TsiType TSI>
+    constexpr detail::uint128_t
+    absolute_sample(Timestamp<TSI, TsfType::sample_count> ts) const noexcept {
+        return first_sample_of_second(ts.tsi()) + ts.tsf();
+    }
+
+    template <TsiType TSI>
+    constexpr Timestamp<TSI, TsfType::sample_count>
+    from_absolute_sample(detail::uint128_t sample) const noexcept {
+        // Largest s with ceil(s * rate) <= sample
+        detail::uint128_t second = sample * rate_.denominator / rate_.numerator;
+        uint32_t clamped = second > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(second);
+        return Timestamp<TSI, TsfType::sample_count>(
+            clamped, detail::saturate_u64(sample - first_sample_of_second(clamped)));
+    }
+
+    SampleRate rate_;
+};
+
+/**
+ * @brief Drift-free sample position tracker anchored at a timestamp
+ *
+ * Keeps the anchor timestamp and a running sample count, and derives every timestamp from
+ * the anchor in one step, so stepping packet by packet never accumulates rounding. Intended
+ * for packetizers (stamping outgoing packets) and loss detectors (predicting the next
+ * packet's timestamp).
+ *
+ * Example:
+ * @code
+ * SampleClock<UtcRealTimestamp> clock(SampleTimebase(SampleRate{1'000'000'000, 3}),
+ *                                     UtcRealTimestamp::now());
+ * for (auto& pkt : packets) {
+ *     pkt.set_timestamp(clock.timestamp());
+ *     clock.advance(samples_per_packet);
+ * }
+ * @endcode
+ *
+ * @tparam TimestampType Timestamp<TSI, TSF> with TSF sample_count or real_time
+ */
+template <typename TimestampType>
+class SampleClock;
+
+template <TsiType TSI, TsfType TSF>
+class SampleClock<Timestamp<TSI, TSF>> {
+    static_assert(TSF == TsfType::sample_count || TSF == TsfType::real_time,
+                  "SampleClock requires a sample_count or real_time fractional timestamp");
+
+public:
+    using timestamp_type = Timestamp<TSI, TSF>;
+
+    constexpr SampleClock(SampleTimebase timebase, timestamp_type anchor,
+                          uint64_t position = 0) noexcept
+        : timebase_(timebase),
+          anchor_(anchor),
+          position_(position) {}
+
+    /**
+     * @brief Move forward by N samples
+     */
+    constexpr void advance(uint64_t samples) noexcept { position_ += samples; }
+
+    /**
+     * @brief Re-anchor (e.g. after a discontinuity in the stream)
+     */
+    constexpr void reset(timestamp_type anchor, uint64_t position = 0) noexcept {
+        anchor_ = anchor;
+        position_ = position;
+    }
+
+    /**
+     * @brief Samples elapsed since the anchor
+     */
+    constexpr uint64_t position() const noexcept { return position_; }
+
+    constexpr timestamp_type anchor() const noexcept { return anchor_; }
+
+    constexpr const SampleTimebase& timebase() const noexcept { return timebase_; }
+
+    /**
+     * @brief Timestamp of the current sample
+     */
+    constexpr timestamp_type timestamp() const noexcept {
+        return timebase_.advance(anchor_, position_);
+    }
+
+    /**
+     * @brief Timestamp of the sample at an offset from the current position
+     *
+     * @param offset Samples after the current position (e.g. index within the payload)
+     */
+    constexpr timestamp_type timestamp_of(uint64_t offset) const noexcept {
+        return timebase_.advance(anchor_, position_ + offset);
+    }
+
+private:
+    SampleTimebase timebase_;
+    timestamp_type anchor_;
+    uint64_t position_;
+};
+
+} // namespace vrtigo
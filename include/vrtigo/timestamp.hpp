@@ -1,5 +1,6 @@
 #pragma once
 
+#include "vrtigo/detail/leap_seconds.hpp"
 #include "vrtigo/types.hpp"
 
 #include <chrono>
@@ -18,6 +19,9 @@ template <TsiType TSI, TsfType TSF>
 class Timestamp {
     // Helper constant for readability and maintenance
     static constexpr bool is_utc_real_time = (TSI == TsiType::utc && TSF == TsfType::real_time);
+    static constexpr bool is_gps_real_time = (TSI == TsiType::gps && TSF == TsfType::real_time);
+    // Real-time TSF anchored to a continuous epoch: duration arithmetic is well defined
+    static constexpr bool is_epoch_real_time = is_utc_real_time || is_gps_real_time;
 
 public:
     // Constants (always available, compiler optimizes away if unused)
@@ -127,9 +131,86 @@ public:
         return static_cast<std::time_t>(seconds_);
     }
 
-    // UTC-specific arithmetic operations
-    Timestamp& operator+=(std::chrono::nanoseconds duration) noexcept
+    Timestamp<TsiType::gps, TSF> to_gps() const noexcept
         requires(is_utc_real_time)
+    {
+        return Timestamp<TsiType::gps, TSF>::from_utc(*this);
+    }
+
+    // GPS-specific factory methods (TSI counts seconds since 1980-01-06 00:00:00 UTC,
+    // without leap seconds; see leap_second_table())
+    static Timestamp now() noexcept
+        requires(is_gps_real_time)
+    {
+        return from_chrono(std::chrono::system_clock::now());
+    }
+
+    static Timestamp from_chrono(std::chrono::system_clock::time_point tp) noexcept
+        requires(is_gps_real_time)
+    {
+        return from_utc(Timestamp<TsiType::utc, TSF>::from_chrono(tp));
+    }
+
+    static Timestamp from_utc(const Timestamp<TsiType::utc, TSF>& utc) noexcept
+        requires(is_gps_real_time)
+    {
+        // Pre-GPS-epoch time - clamp to zero
+        if (utc.tsi() < gps_epoch_unix_seconds) {
+            return Timestamp(0, 0);
+        }
+        int64_t gps_seconds =
+            static_cast<int64_t>(utc.tsi()) - gps_epoch_unix_seconds +
+            detail::thread_leap_second_cache().gps_minus_utc_at_utc(utc.tsi());
+        if (gps_seconds < 0) {
+            return Timestamp(0, 0);
+        }
+        return Timestamp(static_cast<uint32_t>(gps_seconds), utc.tsf());
+    }
+
+    static constexpr Timestamp from_gps_week(uint32_t week, uint32_t seconds_of_week,
+                                             uint64_t frac = 0) noexcept
+        requires(TSI == TsiType::gps)
+    {
+        uint64_t seconds = static_cast<uint64_t>(week) * gps_seconds_per_week + seconds_of_week;
+        if (seconds > UINT32_MAX) {
+            return Timestamp(UINT32_MAX, frac);
+        }
+        return Timestamp(static_cast<uint32_t>(seconds), frac);
+    }
+
+    // GPS-specific conversion methods
+    constexpr uint32_t gps_week() const noexcept
+        requires(TSI == TsiType::gps)
+    {
+        return seconds_ / gps_seconds_per_week;
+    }
+
+    constexpr uint32_t gps_seconds_of_week() const noexcept
+        requires(TSI == TsiType::gps)
+    {
+        return seconds_ % gps_seconds_per_week;
+    }
+
+    Timestamp<TsiType::utc, TSF> to_utc() const noexcept
+        requires(is_gps_real_time)
+    {
+        int64_t utc_seconds = static_cast<int64_t>(seconds_) + gps_epoch_unix_seconds -
+                              detail::thread_leap_second_cache().gps_minus_utc_at_gps(seconds_);
+        if (utc_seconds > static_cast<int64_t>(UINT32_MAX)) {
+            return Timestamp<TsiType::utc, TSF>(UINT32_MAX, MAX_FRACTIONAL);
+        }
+        return Timestamp<TsiType::utc, TSF>(static_cast<uint32_t>(utc_seconds), fractional_);
+    }
+
+    std::chrono::system_clock::time_point to_chrono() const noexcept
+        requires(is_gps_real_time)
+    {
+        return to_utc().to_chrono();
+    }
+
+    // Arithmetic operations (UTC and GPS real-time; UTC arithmetic ignores leap seconds)
+    Timestamp& operator+=(std::chrono::nanoseconds duration) noexcept
+        requires(is_epoch_real_time)
     {
         // Decompose duration into seconds and nanosecond remainder to avoid overflow
         // This handles durations up to the full range of nanoseconds (~292 years)
@@ -202,7 +283,7 @@ public:
     }
 
     Timestamp& operator-=(std::chrono::nanoseconds duration) noexcept
-        requires(is_utc_real_time)
+        requires(is_epoch_real_time)
     {
         // Guard against nanoseconds::min() which cannot be negated
         if (duration == std::chrono::nanoseconds::min()) {
@@ -218,23 +299,23 @@ public:
         return *this += -duration;
     }
 
-    // Friend operators with inline definitions (UTC-specific)
+    // Friend operators with inline definitions (UTC and GPS real-time)
     friend Timestamp operator+(Timestamp ts, std::chrono::nanoseconds duration) noexcept
-        requires(is_utc_real_time)
+        requires(is_epoch_real_time)
     {
         ts += duration;
         return ts;
     }
 
     friend Timestamp operator-(Timestamp ts, std::chrono::nanoseconds duration) noexcept
-        requires(is_utc_real_time)
+        requires(is_epoch_real_time)
     {
         ts -= duration;
         return ts;
     }
 
     friend std::chrono::nanoseconds operator-(const Timestamp& lhs, const Timestamp& rhs) noexcept
-        requires(is_utc_real_time)
+        requires(is_epoch_real_time)
     {
         int64_t sec_diff = static_cast<int64_t>(lhs.seconds_) - static_cast<int64_t>(rhs.seconds_);
         int64_t frac_diff =
@@ -286,4 +367,10 @@ using UtcTimestamp = Timestamp<TsiType::utc, TSF>;
 // Most common case - UTC with real_time TSF
 using UtcRealTimestamp = UtcTimestamp<>;
 
+// GPS time (seconds since 1980-01-06, no leap seconds)
+template <TsfType TSF = TsfType::real_time>
+using GpsTimestamp = Timestamp<TsiType::gps, TSF>;
+
+using GpsRealTimestamp = GpsTimestamp<>;
+
 } // namespace vrtigo
@@ -163,4 +163,19 @@ constexpr const char* validation_error_string(ValidationError err) noexcept {
     }
 }
 
+/**
+ * @brief Tag selecting trusted (deferred validation) parsing
+ *
+ * Passed to the RuntimeDataPacket and RuntimeContextPacket constructors and to
+ * parse_packet() for packets from a source known to produce valid packets, such as
+ * replay of our own recordings. Only the offsets needed for field access are computed;
+ * call validate() on the view to run full validation on demand. Debug builds (NDEBUG
+ * undefined) still run full validation and assert that it passes.
+ */
+struct trusted_t {
+    explicit trusted_t() = default;
+};
+
+inline constexpr trusted_t trusted{};
+
 } // namespace vrtigo
@@ -0,0 +1,581 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "../../detail/runtime_data_packet.hpp"
+#include "../../sample_clock.hpp"
+#include "../../timestamp.hpp"
+#include "../../types.hpp"
+
+namespace vrtigo::utils::align {
+
+/**
+ * @brief Outcome of StreamAligner::push()
+ */
+enum class PushResult : uint8_t {
+    /** Payload buffered */
+    accepted,
+
+    /** Payload buffered after zero-filling a gap (missing packets) */
+    gap_filled,
+
+    /** Gap too large to fill: stream buffer was dropped and restarted at this packet */
+    resynced,
+
+    /** Payload buffered, but the oldest unconsumed samples were dropped to make room */
+    overflowed,
+
+    /** Packet lies entirely before samples already buffered (late or duplicate) */
+    late,
+
+    /** Stream ID not registered with the aligner */
+    unknown_stream,
+
+    /** Packet is invalid or has no usable TSI + real_time/sample_count TSF timestamp */
+    no_timestamp,
+
+    /** Packet's TSI kind differs from the one the aligner locked onto */
+    timestamp_mismatch
+};
+
+/**
+ * @brief Convert PushResult to human-readable string
+ */
+constexpr const char* push_result_string(PushResult result) noexcept {
+    switch (result) {
+        case PushResult::accepted:
+            return "accepted";
+        case PushResult::gap_filled:
+            return "gap_filled";
+        case PushResult::resynced:
+            return "resynced";
+        case PushResult::overflowed:
+            return "overflowed";
+        case PushResult::late:
+            return "late";
+        case PushResult::unknown_stream:
+            return "unknown_stream";
+        case PushResult::no_timestamp:
+            return "no_timestamp";
+        case PushResult::timestamp_mismatch:
+            return "timestamp_mismatch";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief StreamAligner sizing and timing parameters
+ */
+struct AlignerConfig {
+    /** Sample rate shared by all streams */
+    SampleTimebase timebase{SampleRate{}};
+
+    /** Bytes per sample in the payload (e.g. 4 for complex int16) */
+    size_t bytes_per_sample = 4;
+
+    /** Per-stream buffer capacity in samples */
+    size_t capacity_samples = 1 << 16;
+
+    /** Largest block that will be requested from next_block() */
+    size_t max_block_samples = 4096;
+
+    /** Gaps up to this many samples are zero-filled; larger gaps resync the stream */
+    uint64_t max_gap_samples = 1 << 14;
+};
+
+/**
+ * @brief Per-stream counters
+ */
+struct StreamAlignerStats {
+    uint64_t packets = 0;          ///< Packets buffered
+    uint64_t late_packets = 0;     ///< Packets dropped as late/duplicate
+    uint64_t filled_samples = 0;   ///< Samples synthesized (zeros) for gaps
+    uint64_t dropped_samples = 0;  ///< Buffered samples discarded (overflow, resync, trim)
+    uint64_t resyncs = 0;          ///< Gaps too large to fill
+};
+
+/**
+ * @brief One stream's samples within an aligned block, as a gather list
+ *
+ * The samples are `first` followed by `second` (non-empty only when the block wraps around
+ * the stream's ring buffer). Views are valid until the next push() or next_block().
+ */
+struct AlignedSlice {
+    uint32_t stream_id = 0;
+    std::span<const uint8_t> first;
+    std::span<const uint8_t> second;
+    bool zero_filled = false; ///< Some samples in this slice were synthesized for a gap
+
+    /**
+     * @brief Copy the slice into contiguous storage
+     *
+     * @param dest Destination, at least first.size() + second.size() bytes
+     * @return Bytes copied (0 if dest is too small)
+     */
+    size_t copy_to(std::span<uint8_t> dest) const noexcept {
+        if (dest.size() < first.size() + second.size()) {
+            return 0;
+        }
+        std::memcpy(dest.data(), first.data(), first.size());
+        if (!second.empty()) {
+            std::memcpy(dest.data() + first.size(), second.data(), second.size());
+        }
+        return first.size() + second.size();
+    }
+};
+
+/**
+ * @brief A block of samples covering the same time interval on every stream
+ */
+struct AlignedBlock {
+    uint64_t start_sample = 0; ///< Index of the first sample on the aligner timeline
+    size_t samples = 0;        ///< Samples per stream
+    TsiType tsi_kind = TsiType::none;
+    uint32_t tsi = 0;          ///< Integer timestamp of the first sample
+    uint64_t tsf = 0;          ///< Fractional timestamp of the first sample (picoseconds)
+    std::span<const AlignedSlice> streams; ///< One slice per stream, in registration order
+};
+
+/**
+ * @brief Multi-stream sample alignment on VRT timestamps
+ *
+ * Buffers each stream's payload samples on a common sample timeline derived from the
+ * packet timestamps (TSI with real_time or sample_count TSF), and emits blocks covering the
+ * interval every stream has data for. Packet boundaries need not line up across streams.
+ *
+ * Missing packets leave a gap in a stream's timeline: gaps up to max_gap_samples are filled
+ * with zeros (and flagged on the slice), larger ones restart that stream at the new packet.
+ * Late or duplicate packets are dropped; partially overlapping ones are trimmed.
+ *
+ * All buffers are allocated once in the constructor: push() and next_block() never
+ * allocate. Payloads are copied into per-stream rings (packet views usually reference
+ * transport scratch buffers); emitted blocks reference the rings without copying.
+ *
+ * The sample timeline starts 60 s before the first packet's integer timestamp; packets
+ * older than that are reported as late.
+ *
+ * Example:
+ * @code
+ * AlignerConfig config{SampleTimebase(SampleRate{30'720'000}), 4};
+ * std::array<uint32_t, 4> ids{0x10, 0x11, 0x12, 0x13};
+ * StreamAligner aligner(config, ids);
+ *
+ * reader.for_each_data_packet([&](const RuntimeDataPacket& pkt) {
+ *     aligner.push(pkt);
+ *     while (auto block = aligner.next_block(1024)) {
+ *         beamform(*block);
+ *     }
+ *     return true;
+ * });
+ * @endcode
+ */
+class StreamAligner {
+public:
+    /**
+     * @brief Create an aligner for a fixed set of streams
+     *
+     * @param config Sample rate, sample size, and buffer sizes
+     * @param stream_ids Stream IDs to align (block slices follow this order)
+     * @throws std::invalid_argument on an invalid rate, zero sizes, a block size larger than
+     *         the capacity, or an empty/duplicate stream list
+     */
+    StreamAligner(AlignerConfig config, std::span<const uint32_t> stream_ids)
+        : config_(config) {
+        if (!config_.timebase.is_valid() || config_.bytes_per_sample == 0 ||
+            config_.capacity_samples == 0 || config_.max_block_samples == 0 ||
+            config_.max_block_samples > config_.capacity_samples) {
+            throw std::invalid_argument("Invalid StreamAligner configuration");
+        }
+        if (stream_ids.empty()) {
+            throw std::invalid_argument("StreamAligner requires at least one stream");
+        }
+
+        streams_.reserve(stream_ids.size());
+        for (uint32_t id : stream_ids) {
+            if (find_stream(id) != nullptr) {
+                throw std::invalid_argument("Duplicate stream ID " + std::to_string(id));
+            }
+            auto& stream = streams_.emplace_back();
+            stream.stream_id = id;
+            // Slack after the ring lets linearize() unwrap a block in place
+            stream.ring.resize((config_.capacity_samples + config_.max_block_samples) *
+                               config_.bytes_per_sample);
+        }
+        slices_.resize(streams_.size());
+    }
+
+    /**
+     * @brief Buffer a data packet's payload
+     *
+     * @param packet Data packet with a stream ID and timestamp
+     * @return Outcome (see PushResult)
+     */
+    PushResult push(const RuntimeDataPacket& packet) noexcept {
+        if (!packet.is_valid()) {
+            return PushResult::no_timestamp;
+        }
+        auto id = packet.stream_id();
+        StreamState* stream = id ? find_stream(*id) : nullptr;
+        if (stream == nullptr) {
+            return PushResult::unknown_stream;
+        }
+
+        PushResult result = PushResult::accepted;
+        auto start = packet_start_sample(packet, result);
+        if (!start) {
+            return result;
+        }
+
+        auto payload = packet.payload();
+        uint64_t count = payload.size() / config_.bytes_per_sample;
+        uint64_t index = *start;
+
+        if (!stream->started) {
+            stream->begin = stream->end = index;
+            stream->started = true;
+        }
+
+        // Late or overlapping: keep only samples past what is already buffered
+        if (index < stream->end) {
+            uint64_t overlap = stream->end - index;
+            if (overlap >= count) {
+                ++stream->stats.late_packets;
+                return PushResult::late;
+            }
+            payload = payload.subspan(overlap * config_.bytes_per_sample);
+            count -= overlap;
+            index = stream->end;
+        }
+
+        // Missing packets: zero-fill small gaps, resync on large ones
+        if (index > stream->end) {
+            uint64_t gap = index - stream->end;
+            if (gap > config_.max_gap_samples || gap >= config_.capacity_samples) {
+                stream->stats.dropped_samples += stream->end - stream->begin;
+                ++stream->stats.resyncs;
+                stream->begin = stream->end = index;
+                stream->fill_count = 0;
+                result = PushResult::resynced;
+            } else {
+                make_room(*stream, gap, result);
+                write_zeros(*stream, gap);
+                add_fill(*stream, stream->end, stream->end + gap);
+                stream->end += gap;
+                stream->stats.filled_samples += gap;
+                if (result == PushResult::accepted) {
+                    result = PushResult::gap_filled;
+                }
+            }
+        }
+
+        // Keep only the newest capacity_samples of an oversized payload
+        if (count > config_.capacity_samples) {
+            uint64_t skip = count - config_.capacity_samples;
+            payload = payload.subspan(skip * config_.bytes_per_sample);
+            stream->stats.dropped_samples += skip;
+            stream->begin = stream->end = stream->end + skip;
+            stream->fill_count = 0;
+            count = config_.capacity_samples;
+            result = PushResult::overflowed;
+        }
+
+        make_room(*stream, count, result);
+        write_samples(*stream, payload.first(count * config_.bytes_per_sample));
+        stream->end += count;
+        ++stream->stats.packets;
+        return result;
+    }
+
+    /**
+     * @brief Interval [begin, end) of samples buffered on every stream
+     *
+     * @return Empty interval (begin == end) until every stream overlaps
+     */
+    std::pair<uint64_t, uint64_t> window() const noexcept {
+        uint64_t begin = 0;
+        uint64_t end = UINT64_MAX;
+        for (const auto& stream : streams_) {
+            if (!stream.started) {
+                return {0, 0};
+            }
+            begin = std::max(begin, stream.begin);
+            end = std::min(end, stream.end);
+        }
+        return end > begin ? std::pair{begin, end} : std::pair{begin, begin};
+    }
+
+    /**
+     * @brief Emit and consume the next aligned block
+     *
+     * Samples before the common window are discarded (a stream that started earlier than
+     * the others cannot be aligned before the others' first sample).
+     *
+     * @param samples Samples per stream (at most max_block_samples)
+     * @return Block, or std::nullopt if fewer than `samples` aligned samples are buffered.
+     *         Views are valid until the next push() or next_block().
+     */
+    std::optional<AlignedBlock> next_block(size_t samples) noexcept {
+        if (samples == 0 || samples > config_.max_block_samples) {
+            return std::nullopt;
+        }
+        auto [begin, end] = window();
+        trim_before(begin);
+        if (end - begin < samples) {
+            return std::nullopt;
+        }
+
+        for (size_t i = 0; i < streams_.size(); ++i) {
+            auto& stream = streams_[i];
+            auto& slice = slices_[i];
+            size_t offset = ring_offset(begin);
+            size_t first_samples = std::min(samples, config_.capacity_samples - offset);
+            slice.stream_id = stream.stream_id;
+            slice.first = std::span<const uint8_t>(
+                stream.ring.data() + offset * config_.bytes_per_sample,
+                first_samples * config_.bytes_per_sample);
+            slice.second = std::span<const uint8_t>(
+                stream.ring.data(), (samples - first_samples) * config_.bytes_per_sample);
+            slice.zero_filled = overlaps_fill(stream, begin, begin + samples);
+
+            stream.begin = begin + samples;
+            prune_fills(stream);
+        }
+
+        AlignedBlock block;
+        block.start_sample = begin;
+        block.samples = samples;
+        block.tsi_kind = tsi_kind_;
+        block.streams = std::span<const AlignedSlice>(slices_.data(), slices_.size());
+        auto ts = sample_timestamp(begin);
+        block.tsi = ts.tsi();
+        block.tsf = ts.tsf();
+        return block;
+    }
+
+    /**
+     * @brief Make one stream's slice of the last block contiguous
+     *
+     * Copies the wrapped part (if any) into slack space after the ring, so the cost is
+     * paid only for blocks that straddle the ring boundary.
+     *
+     * @param stream_index Index in registration order
+     * @return Contiguous samples, valid until the next push() or next_block()
+     */
+    std::span<const uint8_t> linearize(size_t stream_index) noexcept {
+        if (stream_index >= slices_.size()) {
+            return {};
+        }
+        auto& slice = slices_[stream_index];
+        if (!slice.second.empty()) {
+            auto& ring = streams_[stream_index].ring;
+            uint8_t* slack = ring.data() + config_.capacity_samples * config_.bytes_per_sample;
+            std::memcpy(slack, slice.second.data(), slice.second.size());
+            slice.first = std::span<const uint8_t>(slice.first.data(),
+                                                   slice.first.size() + slice.second.size());
+            slice.second = {};
+        }
+        return slice.first;
+    }
+
+    /**
+     * @brief Timestamp (TSI seconds + picoseconds) of a sample on the aligner timeline
+     */
+    Timestamp<TsiType::other, TsfType::real_time> sample_timestamp(uint64_t sample) const noexcept {
+        auto count = config_.timebase.advance(
+            Timestamp<TsiType::other, TsfType::sample_count>(base_second_, 0), sample);
+        return config_.timebase.to_real_time(count);
+    }
+
+    /**
+     * @brief Counters for one stream
+     *
+     * @param stream_index Index in registration order
+     */
+    const StreamAlignerStats& stats(size_t stream_index) const noexcept {
+        return streams_[stream_index].stats;
+    }
+
+    size_t stream_count() const noexcept { return streams_.size(); }
+
+    const AlignerConfig& config() const noexcept { return config_; }
+
+    /**
+     * @brief Drop all buffered samples and forget the timeline
+     */
+    void reset() noexcept {
+        for (auto& stream : streams_) {
+            stream.begin = stream.end = 0;
+            stream.started = false;
+            stream.fill_count = 0;
+        }
+        tsi_kind_ = TsiType::none;
+        base_second_ = 0;
+    }
+
+private:
+    static constexpr size_t max_fills = 16;
+    static constexpr uint32_t timeline_margin_seconds = 60;
+
+    struct FillRange {
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    struct StreamState {
+        uint32_t stream_id = 0;
+        std::vector<uint8_t> ring;
+        uint64_t begin = 0; ///< First buffered sample index
+        uint64_t end = 0;   ///< One past the last buffered sample index
+        bool started = false;
+        std::array<FillRange, max_fills> fills{};
+        size_t fill_count = 0;
+        StreamAlignerStats stats;
+    };
+
+    StreamState* find_stream(uint32_t stream_id) noexcept {
+        for (auto& stream : streams_) {
+            if (stream.stream_id == stream_id) {
+                return &stream;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Map the packet timestamp to an index on the aligner timeline
+    std::optional<uint64_t> packet_start_sample(const RuntimeDataPacket& packet,
+                                                PushResult& result) noexcept {
+        auto tsi = packet.timestamp_integer();
+        auto tsf = packet.timestamp_fractional();
+        TsfType tsf_kind = packet.tsf_kind();
+        if (!tsi || !tsf ||
+            (tsf_kind != TsfType::real_time && tsf_kind != TsfType::sample_count)) {
+            result = PushResult::no_timestamp;
+            return std::nullopt;
+        }
+
+        if (tsi_kind_ == TsiType::none) {
+            tsi_kind_ = packet.tsi_kind();
+            base_second_ = *tsi > timeline_margin_seconds ? *tsi - timeline_margin_seconds : 0;
+        } else if (packet.tsi_kind() != tsi_kind_) {
+            result = PushResult::timestamp_mismatch;
+            return std::nullopt;
+        }
+
+        const auto& timebase = config_.timebase;
+        uint32_t second = *tsi;
+        uint64_t count = *tsf;
+        if (tsf_kind == TsfType::real_time) {
+            auto as_count = timebase.to_sample_count(
+                Timestamp<TsiType::other, TsfType::real_time>(second, count));
+            second = as_count.tsi();
+            count = as_count.tsf();
+        }
+        if (second < base_second_) {
+            result = PushResult::late;
+            return std::nullopt;
+        }
+        vrtigo::detail::uint128_t index = timebase.first_sample_of_second(second) -
+                                  timebase.first_sample_of_second(base_second_) + count;
+        if (index > UINT64_MAX) {
+            result = PushResult::no_timestamp;
+            return std::nullopt;
+        }
+        return static_cast<uint64_t>(index);
+    }
+
+    size_t ring_offset(uint64_t sample) const noexcept {
+        return static_cast<size_t>(sample % config_.capacity_samples);
+    }
+
+    /// Drop the oldest samples so `count` more fit
+    void make_room(StreamState& stream, uint64_t count, PushResult& result) noexcept {
+        uint64_t used = stream.end - stream.begin;
+        if (used + count > config_.capacity_samples) {
+            uint64_t drop = used + count - config_.capacity_samples;
+            stream.begin += drop;
+            stream.stats.dropped_samples += drop;
+            prune_fills(stream);
+            result = PushResult::overflowed;
+        }
+    }
+
+    void write_samples(StreamState& stream, std::span<const uint8_t> bytes) noexcept {
+        size_t offset = ring_offset(stream.end) * config_.bytes_per_sample;
+        size_t ring_bytes = config_.capacity_samples * config_.bytes_per_sample;
+        size_t first = std::min(bytes.size(), ring_bytes - offset);
+        std::memcpy(stream.ring.data() + offset, bytes.data(), first);
+        if (first < bytes.size()) {
+            std::memcpy(stream.ring.data(), bytes.data() + first, bytes.size() - first);
+        }
+    }
+
+    void write_zeros(StreamState& stream, uint64_t count) noexcept {
+        size_t offset = ring_offset(stream.end) * config_.bytes_per_sample;
+        size_t ring_bytes = config_.capacity_samples * config_.bytes_per_sample;
+        size_t bytes = static_cast<size_t>(count) * config_.bytes_per_sample;
+        size_t first = std::min(bytes, ring_bytes - offset);
+        std::memset(stream.ring.data() + offset, 0, first);
+        if (first < bytes) {
+            std::memset(stream.ring.data(), 0, bytes - first);
+        }
+    }
+
+    void add_fill(StreamState& stream, uint64_t begin, uint64_t end) noexcept {
+        if (stream.fill_count == max_fills) {
+            // Out of slots: merge into the newest range (over-reports zero_filled)
+            stream.fills[max_fills - 1].end = end;
+            return;
+        }
+        stream.fills[stream.fill_count++] = {begin, end};
+    }
+
+    static bool overlaps_fill(const StreamState& stream, uint64_t begin, uint64_t end) noexcept {
+        for (size_t i = 0; i < stream.fill_count; ++i) {
+            if (stream.fills[i].begin < end && stream.fills[i].end > begin) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void prune_fills(StreamState& stream) noexcept {
+        size_t kept = 0;
+        for (size_t i = 0; i < stream.fill_count; ++i) {
+            if (stream.fills[i].end > stream.begin) {
+                stream.fills[kept++] = stream.fills[i];
+            }
+        }
+        stream.fill_count = kept;
+    }
+
+    /// Discard samples no other stream can match
+    void trim_before(uint64_t sample) noexcept {
+        for (auto& stream : streams_) {
+            uint64_t target = std::min(sample, stream.end);
+            if (stream.started && stream.begin < target) {
+                stream.stats.dropped_samples += target - stream.begin;
+                stream.begin = target;
+                prune_fills(stream);
+            }
+        }
+    }
+
+    AlignerConfig config_;
+    std::vector<StreamState> streams_;
+    std::vector<AlignedSlice> slices_;
+    TsiType tsi_kind_ = TsiType::none;
+    uint32_t base_second_ = 0;
+};
+
+} // namespace vrtigo::utils::align
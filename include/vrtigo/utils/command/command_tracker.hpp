@@ -0,0 +1,566 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../command_cam.hpp"
+#include "../../detail/packet_variant.hpp"
+#include "../../detail/runtime_command_packet.hpp"
+
+namespace vrtigo::utils::command {
+
+/**
+ * @brief Final state of a tracked command
+ */
+enum class CommandStatus : uint8_t {
+    /** Every requested acknowledgement arrived without errors */
+    completed,
+
+    /** An acknowledgement reported errors (CAM Er) */
+    failed,
+
+    /** Requested acknowledgements did not arrive before the timeout */
+    timed_out,
+
+    /** Tracking was cancelled locally via CommandTracker::cancel() */
+    cancelled
+};
+
+/**
+ * @brief Convert CommandStatus to human-readable string
+ */
+constexpr const char* command_status_string(CommandStatus status) noexcept {
+    switch (status) {
+        case CommandStatus::completed:
+            return "completed";
+        case CommandStatus::failed:
+            return "failed";
+        case CommandStatus::timed_out:
+            return "timed_out";
+        case CommandStatus::cancelled:
+            return "cancelled";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief Outcome of feeding a packet to CommandTracker::on_packet()
+ */
+enum class AckMatch : uint8_t {
+    /** Acknowledgement matched an in-flight command, which is still waiting for more */
+    matched,
+
+    /** Acknowledgement matched and completed an in-flight command */
+    completed,
+
+    /** Not a valid acknowledge packet */
+    not_ack,
+
+    /** No in-flight command with this message ID (late, duplicate, or foreign) */
+    unknown,
+
+    /** Message ID matched but the controllee ID did not */
+    controllee_mismatch
+};
+
+/**
+ * @brief Result delivered once per tracked command
+ */
+struct CommandResult {
+    uint32_t message_id = 0;
+    CommandStatus status = CommandStatus::completed;
+    bool validated = false;      ///< Validation acknowledgement (CAM V) received
+    bool executed = false;       ///< Execution acknowledgement (CAM X) received
+    bool state_received = false; ///< Query-state acknowledgement (CAM S) received
+    bool warnings = false;       ///< An acknowledgement reported warnings (CAM W)
+    std::chrono::nanoseconds round_trip{0}; ///< Issue to completion (last ack or timeout)
+};
+
+/**
+ * @brief CommandTracker sizing and timing parameters
+ */
+struct TrackerConfig {
+    /** In-flight commands (rounded up to a power of two, at most 65536) */
+    size_t capacity = 1024;
+
+    /** Timer wheel resolution: timeouts fire up to one tick late */
+    std::chrono::nanoseconds tick = std::chrono::milliseconds(1);
+
+    /** Timer wheel buckets; timeouts longer than buckets * tick take extra bucket visits */
+    size_t wheel_buckets = 512;
+
+    /** Timeout used by the overloads without an explicit timeout */
+    std::chrono::nanoseconds default_timeout = std::chrono::milliseconds(100);
+};
+
+/**
+ * @brief Tracker counters
+ */
+struct TrackerStats {
+    uint64_t issued = 0;          ///< Commands accepted by track()
+    uint64_t completed = 0;       ///< Commands completed without errors
+    uint64_t failed = 0;          ///< Commands completed with errors
+    uint64_t timed_out = 0;       ///< Commands expired by poll()
+    uint64_t cancelled = 0;       ///< Commands cancelled locally
+    uint64_t rejected = 0;        ///< track() calls refused because the table was full
+    uint64_t unknown_acks = 0;    ///< Acknowledgements with no matching in-flight command
+    uint64_t mismatched_acks = 0; ///< Acknowledgements with the wrong controllee ID
+};
+
+/**
+ * @brief Correlates outgoing control packets with their acknowledgements
+ *
+ * track() reserves a slot in a preallocated table and assigns the command's message ID:
+ * the low bits index the slot and the high bits count slot reuse, so an incoming
+ * acknowledgement finds its command with a mask and one compare, and late acks for an
+ * earlier occupant of the slot are rejected. Acks must also echo the controllee ID (word
+ * or UUID) of the control packet when it had one.
+ *
+ * The acknowledgements to wait for are taken from the control packet's CAM (V, X, S).
+ * A command completes when all of them have arrived, or early as failed when one reports
+ * errors. With the not-ack-only bit (NK) set, silence until the timeout counts as success.
+ * Timeouts are kept in a hashed timer wheel, so poll() only visits the buckets for the
+ * ticks elapsed since the previous call.
+ *
+ * Each command's callback or future receives exactly one CommandResult. The slot is
+ * released before the callback runs, so callbacks may issue new commands.
+ *
+ * The table and wheel are allocated in the constructor. Tracking never allocates beyond
+ * what the callback itself requires (std::function stores small captures inline) and the
+ * shared state of futures. The tracker is not thread-safe: drive track(), on_packet() and
+ * poll() from one thread, typically the receive loop.
+ *
+ * Example:
+ * @code
+ * CommandTracker tracker;
+ * UDPVRTWriter writer("radio", 4991);
+ * UDPVRTReader<> reader(4992);
+ *
+ * ControlPacket<NoTimestamp, NoClassId, CommandId, NoCommandId, field::bandwidth> cmd(buf);
+ * cmd.set_controllee_id(radio_id);
+ * CamValue cam;
+ * cam.set_action_mode(ActionMode::execute);
+ * cam.set_execution_ack(true);
+ * cmd.set_cam(cam);
+ * cmd[field::bandwidth].set_value(20e6);
+ * if (tracker.track(cmd, [](const CommandResult& r) { report(r); })) {
+ *     writer.write_packet(cmd);
+ * }
+ *
+ * // Receive loop (reader configured with a short timeout)
+ * while (running) {
+ *     if (auto pkt = reader.read_next_packet()) {
+ *         tracker.on_packet(*pkt);
+ *     }
+ *     tracker.poll();
+ * }
+ * @endcode
+ */
+class CommandTracker {
+public:
+    using clock = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+    using Callback = std::function<void(const CommandResult&)>;
+
+    /**
+     * @brief Create a tracker with preallocated slots and timer wheel
+     *
+     * @param config Capacity and timer wheel parameters
+     * @param now Time origin of the timer wheel
+     * @throws std::invalid_argument on zero or oversized capacity, zero tick, or no buckets
+     */
+    explicit CommandTracker(TrackerConfig config = {}, time_point now = clock::now())
+        : config_(config), epoch_(now) {
+        if (config_.capacity == 0 || config_.capacity > max_capacity ||
+            config_.tick.count() <= 0 || config_.wheel_buckets == 0) {
+            throw std::invalid_argument("Invalid CommandTracker configuration");
+        }
+        while ((size_t{1} << index_bits_) < config_.capacity) {
+            ++index_bits_;
+        }
+        slots_.resize(size_t{1} << index_bits_);
+        buckets_.assign(config_.wheel_buckets, npos);
+        expired_.reserve(slots_.size());
+
+        // Free list in index order
+        for (uint32_t i = 0; i < slots_.size(); ++i) {
+            slots_[i].next = (i + 1 < slots_.size()) ? i + 1 : npos;
+        }
+        free_head_ = 0;
+    }
+
+    /**
+     * @brief Start tracking a command (low-level form)
+     *
+     * @param requested CAM of the control packet (requested acks, NK)
+     * @param controllee_id Controllee ID word the acks must echo, if any
+     * @param timeout Time to wait for the acknowledgements
+     * @param callback Invoked once with the result (may be empty)
+     * @param now Issue time
+     * @return Message ID to put in the control packet, or std::nullopt if the table is full
+     */
+    std::optional<uint32_t> track(CamValue requested, std::optional<uint32_t> controllee_id,
+                                  std::chrono::nanoseconds timeout, Callback callback,
+                                  time_point now = clock::now()) {
+        Slot* slot = acquire(requested, timeout, now);
+        if (slot == nullptr) {
+            return std::nullopt;
+        }
+        if (controllee_id) {
+            slot->controllee = *controllee_id;
+        }
+        slot->callback = std::move(callback);
+        return slot->message_id;
+    }
+
+    /**
+     * @brief Start tracking a compile-time control packet
+     *
+     * Reads the CAM and controllee ID from the packet and writes the assigned message ID
+     * into it; send the packet after this returns.
+     *
+     * @return Assigned message ID, or std::nullopt if the table is full (packet untouched)
+     */
+    template <typename Packet>
+    std::optional<uint32_t> track(Packet& packet, Callback callback,
+                                  std::chrono::nanoseconds timeout,
+                                  time_point now = clock::now()) {
+        Slot* slot = acquire(packet.cam(), timeout, now);
+        if (slot == nullptr) {
+            return std::nullopt;
+        }
+        if constexpr (requires { packet.controllee_id(); }) {
+            slot->controllee = packet.controllee_id();
+        } else if constexpr (requires { packet.controllee_uuid(); }) {
+            slot->controllee = packet.controllee_uuid();
+        }
+        slot->callback = std::move(callback);
+        packet.set_message_id(slot->message_id);
+        return slot->message_id;
+    }
+
+    template <typename Packet>
+    std::optional<uint32_t> track(Packet& packet, Callback callback) {
+        return track(packet, std::move(callback), config_.default_timeout);
+    }
+
+    /**
+     * @brief Start tracking a compile-time control packet, completing a future
+     *
+     * @return Future for the result, or std::nullopt if the table is full
+     */
+    template <typename Packet>
+    std::optional<std::future<CommandResult>>
+    track_future(Packet& packet, std::chrono::nanoseconds timeout,
+                 time_point now = clock::now()) {
+        if (!track(packet, Callback{}, timeout, now)) {
+            return std::nullopt;
+        }
+        auto& slot = slots_[packet.message_id() & index_mask()];
+        slot.promise.emplace();
+        return slot.promise->get_future();
+    }
+
+    template <typename Packet>
+    std::optional<std::future<CommandResult>> track_future(Packet& packet) {
+        return track_future(packet, config_.default_timeout);
+    }
+
+    /**
+     * @brief Feed a received acknowledge packet
+     *
+     * @param ack Parsed command packet
+     * @param now Arrival time (for the round-trip measurement)
+     */
+    AckMatch on_ack(const RuntimeCommandPacket& ack, time_point now = clock::now()) {
+        if (!ack.is_valid() || !ack.is_ack()) {
+            return AckMatch::not_ack;
+        }
+        uint32_t message_id = *ack.message_id();
+        Slot& slot = slots_[message_id & index_mask()];
+        if (!slot.active || slot.message_id != message_id) {
+            ++stats_.unknown_acks;
+            return AckMatch::unknown;
+        }
+        if (!controllee_matches(slot, ack)) {
+            ++stats_.mismatched_acks;
+            return AckMatch::controllee_mismatch;
+        }
+
+        CamValue kind = ack.cam();
+        slot.result.validated |= kind.validation_ack();
+        slot.result.executed |= kind.execution_ack();
+        slot.result.state_received |= kind.query_state_ack();
+        slot.result.warnings |= kind.warnings();
+        slot.pending &= ~(kind.word() & ack_request_mask);
+
+        if (kind.errors()) {
+            finish(slot, CommandStatus::failed, now);
+            return AckMatch::completed;
+        }
+        if (slot.pending == 0) {
+            finish(slot, CommandStatus::completed, now);
+            return AckMatch::completed;
+        }
+        return AckMatch::matched;
+    }
+
+    /**
+     * @brief Feed any received packet; non-command packets are ignored
+     */
+    AckMatch on_packet(const PacketVariant& packet, time_point now = clock::now()) {
+        if (const auto* ack = std::get_if<RuntimeCommandPacket>(&packet)) {
+            return on_ack(*ack, now);
+        }
+        return AckMatch::not_ack;
+    }
+
+    /**
+     * @brief Expire commands whose timeout has passed
+     *
+     * @param now Current time
+     * @return Number of commands expired
+     */
+    size_t poll(time_point now = clock::now()) {
+        uint64_t target = ticks_at(now);
+        if (target <= current_tick_) {
+            return 0;
+        }
+
+        // A jump past a full revolution visits each bucket once
+        uint64_t first = current_tick_ + 1;
+        if (target - current_tick_ > buckets_.size()) {
+            first = target - buckets_.size() + 1;
+        }
+        current_tick_ = target;
+
+        // Release first, notify after the scan: callbacks may track or cancel commands
+        expired_.clear();
+        for (uint64_t tick = first; tick <= target; ++tick) {
+            uint32_t index = buckets_[tick % buckets_.size()];
+            while (index != npos) {
+                Slot& slot = slots_[index];
+                uint32_t next = slot.next;
+                if (slot.deadline_tick <= target) {
+                    expired_.push_back(release(slot,
+                                               slot.not_ack_only ? CommandStatus::completed
+                                                                 : CommandStatus::timed_out,
+                                               now));
+                }
+                index = next;
+            }
+        }
+        for (auto& completion : expired_) {
+            notify(completion);
+        }
+        size_t expired = expired_.size();
+        expired_.clear();
+        return expired;
+    }
+
+    /**
+     * @brief Stop tracking a command; its callback receives CommandStatus::cancelled
+     *
+     * Only affects local tracking: send a CancellationPacket to cancel on the controllee.
+     *
+     * @return false if the message ID is not in flight
+     */
+    bool cancel(uint32_t message_id, time_point now = clock::now()) {
+        Slot& slot = slots_[message_id & index_mask()];
+        if (!slot.active || slot.message_id != message_id) {
+            return false;
+        }
+        finish(slot, CommandStatus::cancelled, now);
+        return true;
+    }
+
+    /**
+     * @brief Check whether a message ID is in flight
+     */
+    bool in_flight(uint32_t message_id) const noexcept {
+        const Slot& slot = slots_[message_id & index_mask()];
+        return slot.active && slot.message_id == message_id;
+    }
+
+    size_t in_flight_count() const noexcept { return in_flight_; }
+
+    size_t capacity() const noexcept { return slots_.size(); }
+
+    const TrackerStats& stats() const noexcept { return stats_; }
+
+private:
+    static constexpr uint32_t npos = UINT32_MAX;
+    static constexpr size_t max_capacity = size_t{1} << 16;
+
+    // CAM V, X and S: the acknowledgements a control packet requests
+    static constexpr uint32_t ack_request_mask = (1U << cam::validation_ack_shift) |
+                                                 (1U << cam::execution_ack_shift) |
+                                                 (1U << cam::query_state_ack_shift);
+
+    struct Slot {
+        uint32_t message_id = 0;
+        uint32_t generation = 0;
+        uint32_t next = npos; ///< Free list or wheel bucket list
+        uint32_t prev = npos; ///< Wheel bucket list
+        uint64_t deadline_tick = 0;
+        uint32_t pending = 0; ///< Requested ack bits still outstanding
+        bool active = false;
+        bool not_ack_only = false;
+        std::variant<std::monostate, uint32_t, CommandUuidValue> controllee;
+        time_point issued;
+        CommandResult result;
+        Callback callback;
+        std::optional<std::promise<CommandResult>> promise;
+    };
+
+    uint32_t index_mask() const noexcept { return (1U << index_bits_) - 1; }
+
+    uint64_t ticks_at(time_point t) const noexcept {
+        if (t <= epoch_) {
+            return 0;
+        }
+        return static_cast<uint64_t>((t - epoch_) / config_.tick);
+    }
+
+    Slot* acquire(CamValue requested, std::chrono::nanoseconds timeout, time_point now) {
+        if (free_head_ == npos) {
+            ++stats_.rejected;
+            return nullptr;
+        }
+        uint32_t index = free_head_;
+        Slot& slot = slots_[index];
+        free_head_ = slot.next;
+
+        slot.generation = (slot.generation + 1) & (UINT32_MAX >> index_bits_);
+        slot.message_id = (slot.generation << index_bits_) | index;
+        slot.active = true;
+        slot.pending = requested.word() & ack_request_mask;
+        slot.not_ack_only = requested.not_ack_only();
+        slot.controllee = std::monostate{};
+        slot.issued = now;
+        slot.result = CommandResult{};
+        slot.result.message_id = slot.message_id;
+
+        // Round the deadline up so a command never expires early
+        auto deadline = (now < epoch_ ? epoch_ : now) + timeout - epoch_;
+        auto rounded_up = deadline + config_.tick - std::chrono::nanoseconds(1);
+        uint64_t ticks = static_cast<uint64_t>(rounded_up / config_.tick);
+        slot.deadline_tick = std::max(ticks, current_tick_ + 1);
+        link(index);
+
+        ++in_flight_;
+        ++stats_.issued;
+        return &slot;
+    }
+
+    bool controllee_matches(const Slot& slot, const RuntimeCommandPacket& ack) const noexcept {
+        if (const auto* id = std::get_if<uint32_t>(&slot.controllee)) {
+            return ack.controllee_id() == *id;
+        }
+        if (const auto* uuid = std::get_if<CommandUuidValue>(&slot.controllee)) {
+            return ack.controllee_uuid() == *uuid;
+        }
+        return true;
+    }
+
+    void link(uint32_t index) noexcept {
+        Slot& slot = slots_[index];
+        uint32_t& head = buckets_[slot.deadline_tick % buckets_.size()];
+        slot.prev = npos;
+        slot.next = head;
+        if (head != npos) {
+            slots_[head].prev = index;
+        }
+        head = index;
+    }
+
+    void unlink(uint32_t index) noexcept {
+        Slot& slot = slots_[index];
+        if (slot.prev != npos) {
+            slots_[slot.prev].next = slot.next;
+        } else {
+            buckets_[slot.deadline_tick % buckets_.size()] = slot.next;
+        }
+        if (slot.next != npos) {
+            slots_[slot.next].prev = slot.prev;
+        }
+    }
+
+    // Result and notification targets of a released slot
+    struct Completion {
+        CommandResult result;
+        Callback callback;
+        std::optional<std::promise<CommandResult>> promise;
+    };
+
+    Completion release(Slot& slot, CommandStatus status, time_point now) {
+        uint32_t index = slot.message_id & index_mask();
+        unlink(index);
+        slot.active = false;
+        slot.next = free_head_;
+        free_head_ = index;
+        --in_flight_;
+
+        switch (status) {
+            case CommandStatus::completed:
+                ++stats_.completed;
+                break;
+            case CommandStatus::failed:
+                ++stats_.failed;
+                break;
+            case CommandStatus::timed_out:
+                ++stats_.timed_out;
+                break;
+            case CommandStatus::cancelled:
+                ++stats_.cancelled;
+                break;
+        }
+
+        Completion completion{slot.result, std::move(slot.callback), std::move(slot.promise)};
+        completion.result.status = status;
+        completion.result.round_trip =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - slot.issued);
+        slot.callback = nullptr;
+        slot.promise.reset();
+        return completion;
+    }
+
+    static void notify(Completion& completion) {
+        if (completion.callback) {
+            completion.callback(completion.result);
+        }
+        if (completion.promise) {
+            completion.promise->set_value(completion.result);
+        }
+    }
+
+    // The slot is free before notification: callbacks may track new commands
+    void finish(Slot& slot, CommandStatus status, time_point now) {
+        Completion completion = release(slot, status, now);
+        notify(completion);
+    }
+
+    TrackerConfig config_;
+    time_point epoch_;
+    uint32_t index_bits_ = 0;
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> buckets_;
+    std::vector<Completion> expired_; ///< poll() scratch, reserved to capacity
+    uint32_t free_head_ = npos;
+    uint64_t current_tick_ = 0;
+    size_t in_flight_ = 0;
+    TrackerStats stats_;
+};
+
+} // namespace vrtigo::utils::command
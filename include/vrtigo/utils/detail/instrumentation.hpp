@@ -0,0 +1,431 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../detail/packet_variant.hpp"
+#include "../../packet_handle.hpp"
+#include "../../types.hpp"
+
+/**
+ * @brief Compile-time switch for reader/writer instrumentation
+ *
+ * Define VRTIGO_ENABLE_INSTRUMENTATION=1 before including any vrtigo utils header (or pass
+ * -DVRTIGO_ENABLE_INSTRUMENTATION=1) to enable counters and latency histograms. When disabled
+ * (the default), readers and writers hold an empty NullInstrumentation member and every
+ * recording call compiles to nothing, including the clock reads.
+ */
+#ifndef VRTIGO_ENABLE_INSTRUMENTATION
+    #define VRTIGO_ENABLE_INSTRUMENTATION 0
+#endif
+
+namespace vrtigo::utils::detail {
+
+inline constexpr bool instrumentation_enabled = VRTIGO_ENABLE_INSTRUMENTATION != 0;
+
+/**
+ * @brief Point-in-time copy of a LatencyHistogram
+ *
+ * Plain values, safe to keep, compare, and aggregate after the source has moved on.
+ */
+struct LatencyHistogramSnapshot {
+    /// Sub-buckets per power of two (16 -> ~6% relative precision)
+    static constexpr unsigned sub_bucket_bits = 4;
+    static constexpr uint64_t sub_bucket_count = uint64_t{1} << sub_bucket_bits;
+    /// Values at or above 2^max_value_bits ns (~68 s) land in the last bucket
+    static constexpr unsigned max_value_bits = 36;
+    static constexpr size_t bucket_count =
+        (max_value_bits - sub_bucket_bits + 1) * sub_bucket_count;
+
+    std::array<uint64_t, bucket_count> counts{};
+    uint64_t total_count = 0;
+    uint64_t total_ns = 0;
+
+    /**
+     * @brief Bucket index for a latency value (log-linear, HDR-style)
+     */
+    static constexpr size_t bucket_index(uint64_t ns) noexcept {
+        if (ns < 2 * sub_bucket_count) {
+            return static_cast<size_t>(ns);
+        }
+        const unsigned msb = static_cast<unsigned>(std::bit_width(ns)) - 1;
+        if (msb >= max_value_bits) {
+            return bucket_count - 1;
+        }
+        const unsigned exponent = msb - sub_bucket_bits;
+        return static_cast<size_t>(exponent * sub_bucket_count + (ns >> exponent));
+    }
+
+    /**
+     * @brief Smallest value mapped to the given bucket
+     */
+    static constexpr uint64_t bucket_lower_bound(size_t index) noexcept {
+        if (index < 2 * sub_bucket_count) {
+            return index;
+        }
+        const uint64_t exponent = index / sub_bucket_count - 1;
+        const uint64_t mantissa = index % sub_bucket_count + sub_bucket_count;
+        return mantissa << exponent;
+    }
+
+    /**
+     * @brief Largest value mapped to the given bucket
+     */
+    static constexpr uint64_t bucket_upper_bound(size_t index) noexcept {
+        return index + 1 < bucket_count ? bucket_lower_bound(index + 1) - 1 : UINT64_MAX;
+    }
+
+    /**
+     * @brief Latency at the given percentile, reported as the bucket upper bound
+     *
+     * @param percentile Value in [0, 100]
+     * @return Latency in nanoseconds, or 0 if no samples were recorded
+     */
+    uint64_t value_at_percentile(double percentile) const noexcept {
+        if (total_count == 0) {
+            return 0;
+        }
+        const double rank = percentile / 100.0 * static_cast<double>(total_count);
+        auto target = static_cast<uint64_t>(rank);
+        target = target == 0 ? 1 : (target > total_count ? total_count : target);
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucket_count; ++i) {
+            seen += counts[i];
+            if (seen >= target) {
+                return bucket_upper_bound(i);
+            }
+        }
+        return bucket_upper_bound(bucket_count - 1);
+    }
+
+    /**
+     * @brief Mean latency in nanoseconds (exact, not bucketed)
+     */
+    double mean() const noexcept {
+        return total_count == 0 ? 0.0
+                                : static_cast<double>(total_ns) / static_cast<double>(total_count);
+    }
+};
+
+/**
+ * @brief Fixed-bucket latency histogram with lock-free recording
+ *
+ * Single-writer: only the owning reader/writer thread records, using relaxed load/store
+ * pairs rather than read-modify-write so the hot path carries no locked instructions.
+ * Any number of monitoring threads may call snapshot() concurrently; each bucket is read
+ * atomically, so a snapshot taken mid-update is off by at most the in-flight sample.
+ */
+class LatencyHistogram {
+public:
+    using Snapshot = LatencyHistogramSnapshot;
+
+    LatencyHistogram() noexcept = default;
+
+    // Atomics are not movable; transfer current values (owner-thread only)
+    LatencyHistogram(LatencyHistogram&& other) noexcept { copy_from(other); }
+    LatencyHistogram& operator=(LatencyHistogram&& other) noexcept {
+        if (this != &other) {
+            copy_from(other);
+        }
+        return *this;
+    }
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(uint64_t ns) noexcept {
+        bump(counts_[Snapshot::bucket_index(ns)], 1);
+        bump(total_count_, 1);
+        bump(total_ns_, ns);
+    }
+
+    Snapshot snapshot() const noexcept {
+        Snapshot snap;
+        for (size_t i = 0; i < Snapshot::bucket_count; ++i) {
+            snap.counts[i] = counts_[i].load(std::memory_order_relaxed);
+        }
+        snap.total_count = total_count_.load(std::memory_order_relaxed);
+        snap.total_ns = total_ns_.load(std::memory_order_relaxed);
+        return snap;
+    }
+
+private:
+    static void bump(std::atomic<uint64_t>& counter, uint64_t delta) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    void copy_from(const LatencyHistogram& other) noexcept {
+        for (size_t i = 0; i < Snapshot::bucket_count; ++i) {
+            counts_[i].store(other.counts_[i].load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+        }
+        total_count_.store(other.total_count_.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+        total_ns_.store(other.total_ns_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, Snapshot::bucket_count> counts_{};
+    std::atomic<uint64_t> total_count_{0};
+    std::atomic<uint64_t> total_ns_{0};
+};
+
+/**
+ * @brief Point-in-time copy of a reader's or writer's counters
+ */
+struct InstrumentationSnapshot {
+    /// Slots for ValidationError values (headroom beyond the current enumerators)
+    static constexpr size_t error_slots = 16;
+
+    std::array<uint64_t, 8> packets_by_type{}; ///< Indexed by PacketType
+    std::array<uint64_t, error_slots> errors_by_validation{};
+    uint64_t truncations = 0;  ///< Datagrams/records larger than the receive buffer
+    uint64_t kernel_drops = 0; ///< Datagrams dropped by the kernel (SO_RXQ_OVFL), cumulative
+    uint64_t timeouts = 0;     ///< EAGAIN/EWOULDBLOCK (receive or send timeout)
+    uint64_t io_errors = 0;    ///< Fatal socket/file errors
+    uint64_t bytes = 0;        ///< Bytes of successfully received/sent packets
+    LatencyHistogramSnapshot receive_to_parse;  ///< Datagram/record in hand -> parsed
+    LatencyHistogramSnapshot build_to_send;     ///< Built packet handed to writer -> sent
+    LatencyHistogramSnapshot arrival_to_wakeup; ///< Kernel arrival stamp -> recvmsg() return
+
+    uint64_t packets(PacketType type) const noexcept {
+        return packets_by_type[static_cast<size_t>(type) & 0x7];
+    }
+
+    uint64_t errors(ValidationError error) const noexcept {
+        const auto index = static_cast<size_t>(error);
+        return errors_by_validation[index < error_slots ? index : error_slots - 1];
+    }
+
+    uint64_t total_packets() const noexcept {
+        uint64_t total = 0;
+        for (auto count : packets_by_type) {
+            total += count;
+        }
+        return total;
+    }
+
+    uint64_t total_errors() const noexcept {
+        uint64_t total = 0;
+        for (auto count : errors_by_validation) {
+            total += count;
+        }
+        return total;
+    }
+};
+
+/**
+ * @brief Per-reader/per-writer counters and latency histograms
+ *
+ * Owned by a single reader or writer and updated only from the thread driving it. A
+ * monitoring thread may call snapshot() at any time through a const reference; all
+ * fields are relaxed atomics, so scraping never blocks or slows the hot path.
+ *
+ * Readers and writers only hold this type when VRTIGO_ENABLE_INSTRUMENTATION is non-zero;
+ * otherwise they hold NullInstrumentation.
+ */
+class TransportInstrumentation {
+public:
+    using clock = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    TransportInstrumentation() noexcept = default;
+    TransportInstrumentation(TransportInstrumentation&& other) noexcept
+        : receive_to_parse_(std::move(other.receive_to_parse_)),
+          build_to_send_(std::move(other.build_to_send_)),
+          arrival_to_wakeup_(std::move(other.arrival_to_wakeup_)) {
+        copy_counters_from(other);
+    }
+    TransportInstrumentation& operator=(TransportInstrumentation&& other) noexcept {
+        if (this != &other) {
+            receive_to_parse_ = std::move(other.receive_to_parse_);
+            build_to_send_ = std::move(other.build_to_send_);
+            arrival_to_wakeup_ = std::move(other.arrival_to_wakeup_);
+            copy_counters_from(other);
+        }
+        return *this;
+    }
+    TransportInstrumentation(const TransportInstrumentation&) = delete;
+    TransportInstrumentation& operator=(const TransportInstrumentation&) = delete;
+
+    static time_point now() noexcept { return clock::now(); }
+
+    /**
+     * @brief Record a parsed packet and its receive-to-parse latency
+     *
+     * @param packet Parse result (valid packets count by type, invalid by ValidationError)
+     * @param size_bytes Packet size in bytes
+     * @param received Time the raw bytes became available
+     */
+    void record_received(const PacketVariant& packet, size_t size_bytes,
+                         time_point received) noexcept {
+        if (const auto* invalid = std::get_if<InvalidPacket>(&packet)) {
+            record_error(invalid->error);
+        } else {
+            bump(packets_by_type_[static_cast<size_t>(vrtigo::packet_type(packet)) & 0x7]);
+            bump(bytes_, size_bytes);
+        }
+        receive_to_parse_.record(elapsed_ns(received));
+    }
+
+    /**
+     * @brief Record a parsed packet handle and its receive-to-parse latency
+     */
+    void record_received(const PacketHandle& packet, size_t size_bytes,
+                         time_point received) noexcept {
+        if (!packet.is_valid()) {
+            record_error(packet.error());
+        } else {
+            bump(packets_by_type_[static_cast<size_t>(packet.type()) & 0x7]);
+            bump(bytes_, size_bytes);
+        }
+        receive_to_parse_.record(elapsed_ns(received));
+    }
+
+    /**
+     * @brief Record a packet accepted by the transport and its build-to-send latency
+     *
+     * @param bytes Packet bytes (type is taken from the header word)
+     * @param handed_off Time the built packet was handed to the writer
+     */
+    void record_sent(std::span<const uint8_t> bytes, time_point handed_off) noexcept {
+        if (!bytes.empty()) {
+            bump(packets_by_type_[(bytes[0] >> 4) & 0x7]);
+        }
+        bump(bytes_, bytes.size());
+        build_to_send_.record(elapsed_ns(handed_off));
+    }
+
+    void record_error(ValidationError error) noexcept {
+        const auto index = static_cast<size_t>(error);
+        bump(errors_by_validation_[index < InstrumentationSnapshot::error_slots
+                                       ? index
+                                       : InstrumentationSnapshot::error_slots - 1]);
+    }
+
+    void record_truncation() noexcept {
+        bump(truncations_);
+        record_error(ValidationError::buffer_too_small);
+    }
+
+    /**
+     * @brief Record the socket's cumulative kernel drop counter
+     */
+    void record_kernel_drops(uint64_t total) noexcept {
+        kernel_drops_.store(total, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record the delay between a datagram's kernel arrival and the reader getting it
+     */
+    void record_wakeup_latency(std::chrono::nanoseconds latency) noexcept {
+        arrival_to_wakeup_.record(latency.count() > 0 ? static_cast<uint64_t>(latency.count())
+                                                      : 0);
+    }
+
+    void record_timeout() noexcept { bump(timeouts_); }
+
+    void record_io_error() noexcept { bump(io_errors_); }
+
+    /**
+     * @brief Copy all counters and histograms (safe from any thread)
+     */
+    InstrumentationSnapshot snapshot() const noexcept {
+        InstrumentationSnapshot snap;
+        for (size_t i = 0; i < snap.packets_by_type.size(); ++i) {
+            snap.packets_by_type[i] = packets_by_type_[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < snap.errors_by_validation.size(); ++i) {
+            snap.errors_by_validation[i] =
+                errors_by_validation_[i].load(std::memory_order_relaxed);
+        }
+        snap.truncations = truncations_.load(std::memory_order_relaxed);
+        snap.kernel_drops = kernel_drops_.load(std::memory_order_relaxed);
+        snap.timeouts = timeouts_.load(std::memory_order_relaxed);
+        snap.io_errors = io_errors_.load(std::memory_order_relaxed);
+        snap.bytes = bytes_.load(std::memory_order_relaxed);
+        snap.receive_to_parse = receive_to_parse_.snapshot();
+        snap.build_to_send = build_to_send_.snapshot();
+        snap.arrival_to_wakeup = arrival_to_wakeup_.snapshot();
+        return snap;
+    }
+
+private:
+    using Counter = std::atomic<uint64_t>;
+
+    // Single-writer update: relaxed load + store avoids a locked RMW on the hot path
+    static void bump(Counter& counter, uint64_t delta = 1) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static uint64_t elapsed_ns(time_point since) noexcept {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now() - since).count();
+        return ns > 0 ? static_cast<uint64_t>(ns) : 0;
+    }
+
+    static void copy(Counter& dst, const Counter& src) noexcept {
+        dst.store(src.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    void copy_counters_from(const TransportInstrumentation& other) noexcept {
+        for (size_t i = 0; i < packets_by_type_.size(); ++i) {
+            copy(packets_by_type_[i], other.packets_by_type_[i]);
+        }
+        for (size_t i = 0; i < errors_by_validation_.size(); ++i) {
+            copy(errors_by_validation_[i], other.errors_by_validation_[i]);
+        }
+        copy(truncations_, other.truncations_);
+        copy(kernel_drops_, other.kernel_drops_);
+        copy(timeouts_, other.timeouts_);
+        copy(io_errors_, other.io_errors_);
+        copy(bytes_, other.bytes_);
+    }
+
+    std::array<Counter, 8> packets_by_type_{};
+    std::array<Counter, InstrumentationSnapshot::error_slots> errors_by_validation_{};
+    Counter truncations_{0};
+    Counter kernel_drops_{0};
+    Counter timeouts_{0};
+    Counter io_errors_{0};
+    Counter bytes_{0};
+    LatencyHistogram receive_to_parse_;
+    LatencyHistogram build_to_send_;
+    LatencyHistogram arrival_to_wakeup_;
+};
+
+/**
+ * @brief No-op stand-in used when instrumentation is compiled out
+ *
+ * Same interface as TransportInstrumentation; every call is empty and now() does not
+ * read the clock, so the optimizer removes the instrumentation entirely.
+ */
+class NullInstrumentation {
+public:
+    using time_point = TransportInstrumentation::time_point;
+
+    static constexpr time_point now() noexcept { return {}; }
+    constexpr void record_received(const PacketVariant&, size_t, time_point) noexcept {}
+    constexpr void record_received(const PacketHandle&, size_t, time_point) noexcept {}
+    constexpr void record_sent(std::span<const uint8_t>, time_point) noexcept {}
+    constexpr void record_error(ValidationError) noexcept {}
+    constexpr void record_truncation() noexcept {}
+    constexpr void record_kernel_drops(uint64_t) noexcept {}
+    constexpr void record_wakeup_latency(std::chrono::nanoseconds) noexcept {}
+    constexpr void record_timeout() noexcept {}
+    constexpr void record_io_error() noexcept {}
+    InstrumentationSnapshot snapshot() const noexcept { return {}; }
+};
+
+/// Instrumentation member type embedded in readers and writers
+using Instrumentation = std::conditional_t<instrumentation_enabled, TransportInstrumentation,
+                                           NullInstrumentation>;
+
+} // namespace vrtigo::utils::detail
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace vrtigo::utils::fileio {
+
+/**
+ * @brief Read-only memory mapping of a whole file (POSIX)
+ *
+ * Gives scanners direct access to file contents without read() copies. The mapping is
+ * advised for sequential access so the kernel reads ahead aggressively.
+ *
+ * @warning Spans returned by bytes() are invalidated when the MappedFile is destroyed or
+ *          moved from.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map a file read-only
+     *
+     * @param filepath Path to the file
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const char* filepath) {
+        int fd = ::open(filepath, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error(std::string("Failed to open file: ") + filepath + ": " +
+                                     std::strerror(errno));
+        }
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            int err = errno;
+            ::close(fd);
+            throw std::runtime_error(std::string("Failed to stat file: ") + filepath + ": " +
+                                     std::strerror(err));
+        }
+        size_ = static_cast<size_t>(st.st_size);
+
+        // mmap rejects zero-length mappings; an empty file maps to an empty span
+        if (size_ > 0) {
+            void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                int err = errno;
+                ::close(fd);
+                throw std::runtime_error(std::string("Failed to map file: ") + filepath + ": " +
+                                         std::strerror(err));
+            }
+            data_ = static_cast<const uint8_t*>(addr);
+            ::madvise(addr, size_, MADV_SEQUENTIAL);
+        }
+        ::close(fd);
+    }
+
+    explicit MappedFile(const std::string& filepath) : MappedFile(filepath.c_str()) {}
+
+    ~MappedFile() noexcept { unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = other.data_;
+            size_ = other.size_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief File contents
+     */
+    std::span<const uint8_t> bytes() const noexcept { return {data_, size_}; }
+
+    size_t size() const noexcept { return size_; }
+
+private:
+    void unmap() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+            data_ = nullptr;
+        }
+    }
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace vrtigo::utils::fileio
@@ -7,6 +7,7 @@
 
 #include "../../detail/packet_parser.hpp"
 #include "../../detail/packet_variant.hpp"
+#include "../detail/instrumentation.hpp"
 #include "../detail/iteration_helpers.hpp"
 #include "raw_vrt_file_reader.hpp"
 
@@ -32,7 +33,7 @@ namespace vrtigo::utils::fileio {
  * - Signal Data (0-1) -> RuntimeDataPacket
  * - Extension Data (2-3) -> RuntimeDataPacket
  * - Context (4-5) -> RuntimeContextPacket
- * - Command (6-7) -> InvalidPacket (not yet implemented)
+ * - Command (6-7) -> RuntimeCommandPacket
  *
  * @tparam MaxPacketWords Maximum packet size in 32-bit words (default: 65535)
  *
@@ -86,6 +87,19 @@ public:
      */
     explicit VRTFileReader(const std::string& filepath) : reader_(filepath.c_str()) {}
 
+    /**
+     * @brief Open a trusted VRT file (such as our own recording) for fast replay
+     *
+     * Packets are parsed with parse_packet(bytes, trusted): data and context views skip
+     * validation, and framing errors are still reported as InvalidPacket.
+     *
+     * @param filepath Path to VRT binary file
+     * @throws std::runtime_error if file cannot be opened
+     */
+    VRTFileReader(const std::string& filepath, trusted_t)
+        : reader_(filepath.c_str()),
+          trusted_(true) {}
+
     // Non-copyable (underlying reader is non-copyable)
     VRTFileReader(const VRTFileReader&) = delete;
     VRTFileReader& operator=(const VRTFileReader&) = delete;
@@ -122,6 +136,7 @@ public:
         // Check for I/O error (not EOF) - convert to InvalidPacket
         if (bytes.empty()) {
             const auto& err = reader_.last_error();
+            instrumentation_.record_error(err.error);
             auto decoded = vrtigo::detail::decode_header(err.header);
             return vrtigo::PacketVariant{vrtigo::InvalidPacket{
                 err.error, err.type, decoded,
@@ -130,7 +145,11 @@ public:
         }
 
         // Parse and validate the packet
-        return vrtigo::detail::parse_packet(bytes);
+        const auto received = instrumentation_.now();
+        auto packet = trusted_ ? vrtigo::detail::parse_packet(bytes, trusted)
+                               : vrtigo::detail::parse_packet(bytes);
+        instrumentation_.record_received(packet, bytes.size(), received);
+        return packet;
     }
 
     /**
@@ -257,6 +276,16 @@ public:
      */
     bool is_open() const noexcept { return reader_.is_open(); }
 
+    /**
+     * @brief Get reader counters and latency histograms
+     *
+     * snapshot() on the result is safe to call from a monitoring thread. Empty unless built
+     * with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     *
+     * @return Instrumentation owned by this reader
+     */
+    const detail::Instrumentation& instrumentation() const noexcept { return instrumentation_; }
+
     /**
      * @brief Access underlying RawVRTFileReader for advanced use
      *
@@ -275,6 +304,8 @@ public:
 
 private:
     RawVRTFileReader<MaxPacketWords> reader_; ///< Underlying low-level reader
+    bool trusted_ = false;                    ///< Parse with parse_packet(bytes, trusted)
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
 };
 
 } // namespace vrtigo::utils::fileio
@@ -5,6 +5,7 @@
 
 #include "vrtigo/detail/packet_concepts.hpp"
 #include "vrtigo/detail/packet_variant.hpp"
+#include "vrtigo/utils/detail/instrumentation.hpp"
 #include "vrtigo/utils/detail/writer_concepts.hpp"
 #include "vrtigo/utils/fileio/raw_vrt_file_writer.hpp"
 #include "vrtigo/utils/fileio/writer_status.hpp"
@@ -80,8 +81,9 @@ public:
      */
     bool write_packet(const PacketVariant& packet) noexcept {
         // Check if variant holds InvalidPacket
-        if (std::holds_alternative<InvalidPacket>(packet)) {
+        if (const auto* invalid = std::get_if<InvalidPacket>(&packet)) {
             high_level_status_ = WriterStatus::invalid_packet;
+            instrumentation_.record_error(invalid->error);
             return false;
         }
 
@@ -98,7 +100,9 @@ public:
                 } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
                     // RuntimeContextPacket uses context_buffer() instead of as_bytes()
                     std::span<const uint8_t> bytes{pkt.context_buffer(), pkt.packet_size_bytes()};
-                    return this->raw_writer_.write_packet(bytes);
+                    return this->write_bytes(bytes);
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    return this->write_bytes(pkt.as_bytes());
                 } else {
                     return false; // Unknown type
                 }
@@ -136,7 +140,7 @@ public:
     bool write_packet(const vrtigo::RuntimeContextPacket& packet) noexcept {
         // RuntimeContextPacket uses context_buffer() instead of as_bytes()
         std::span<const uint8_t> bytes{packet.context_buffer(), packet.packet_size_bytes()};
-        bool result = raw_writer_.write_packet(bytes);
+        bool result = write_bytes(bytes);
         if (result) {
             high_level_status_ = WriterStatus::ready;
         }
@@ -157,7 +161,7 @@ public:
         requires vrtigo::CompileTimePacket<PacketType>
     bool write_packet(const PacketType& packet) noexcept {
         auto bytes = packet.as_bytes();
-        bool result = raw_writer_.write_packet(bytes);
+        bool result = write_bytes(bytes);
         if (result) {
             high_level_status_ = WriterStatus::ready;
         }
@@ -254,6 +258,18 @@ public:
      */
     [[nodiscard]] bool is_open() const noexcept { return raw_writer_.is_open(); }
 
+    /**
+     * @brief Get writer counters and latency histograms
+     *
+     * snapshot() on the result is safe to call from a monitoring thread. Empty unless built
+     * with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     *
+     * @return Instrumentation owned by this writer
+     */
+    [[nodiscard]] const detail::Instrumentation& instrumentation() const noexcept {
+        return instrumentation_;
+    }
+
     /**
      * @brief Clear error state
      *
@@ -272,8 +288,20 @@ private:
      */
     template <typename PacketView>
     bool write_packet_impl(const PacketView& packet) noexcept {
-        auto bytes = packet.as_bytes();
-        return raw_writer_.write_packet(bytes);
+        return write_bytes(packet.as_bytes());
+    }
+
+    /**
+     * @brief Write packet bytes through the raw writer, updating instrumentation
+     */
+    bool write_bytes(std::span<const uint8_t> bytes) noexcept {
+        const auto handed_off = instrumentation_.now();
+        if (!raw_writer_.write_packet(bytes)) {
+            instrumentation_.record_io_error();
+            return false;
+        }
+        instrumentation_.record_sent(bytes, handed_off);
+        return true;
     }
 
     /**
@@ -298,6 +326,7 @@ private:
 
     RawVRTFileWriter<MaxPacketWords> raw_writer_; ///< Underlying raw writer
     WriterStatus high_level_status_;              ///< High-level validation status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
 };
 
 } // namespace vrtigo::utils::fileio
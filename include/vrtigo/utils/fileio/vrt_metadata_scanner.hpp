@@ -0,0 +1,88 @@
+#pragma once
+
+#include <span>
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../packet_metadata.hpp"
+#include "mapped_file.hpp"
+
+namespace vrtigo::utils::fileio {
+
+/**
+ * @brief Metadata-only scan of a raw VRT file
+ *
+ * Maps the file and extracts timestamps, stream IDs and packet counts into caller-provided
+ * columns with scan_packet_metadata(), never parsing payloads or building packet views.
+ * Suited to whole-file analysis (arrival jitter, gap detection) at memory bandwidth.
+ *
+ * Example:
+ * @code
+ * VRTMetadataScanner scanner("capture.vrt");
+ * std::vector<uint32_t> tsi(4096);
+ * std::vector<uint64_t> tsf(4096);
+ * std::vector<uint8_t> status(4096);
+ * MetadataColumns columns{.tsi = tsi, .tsf = tsf, .status = status};
+ * while (size_t rows = scanner.next(columns)) {
+ *     plot(std::span(tsi).first(rows), std::span(tsf).first(rows));
+ * }
+ * @endcode
+ */
+class VRTMetadataScanner {
+public:
+    /**
+     * @brief Map a VRT file for scanning
+     *
+     * @param filepath Path to VRT binary file
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit VRTMetadataScanner(const char* filepath) : file_(filepath) {}
+
+    explicit VRTMetadataScanner(const std::string& filepath) : file_(filepath) {}
+
+    /**
+     * @brief Fill the columns with the next packets' metadata
+     *
+     * @param columns Output columns (rows start at index 0)
+     * @return Rows written; 0 at end of file or at a malformed (zero-size or truncated) packet
+     */
+    size_t next(const MetadataColumns& columns) noexcept {
+        auto result = scan_packet_metadata(file_.bytes().subspan(offset_), columns);
+        offset_ += result.bytes_consumed;
+        packets_scanned_ += result.rows;
+        return result.rows;
+    }
+
+    /**
+     * @brief Restart from the beginning of the file
+     */
+    void rewind() noexcept {
+        offset_ = 0;
+        packets_scanned_ = 0;
+    }
+
+    /**
+     * @brief Byte offset of the next packet to scan
+     */
+    size_t tell() const noexcept { return offset_; }
+
+    /**
+     * @brief True once every byte has been scanned
+     *
+     * If next() returns 0 while this is false, the file ends in a malformed packet.
+     */
+    bool at_end() const noexcept { return offset_ >= file_.size(); }
+
+    size_t size() const noexcept { return file_.size(); }
+
+    size_t packets_scanned() const noexcept { return packets_scanned_; }
+
+private:
+    MappedFile file_;
+    size_t offset_ = 0;
+    size_t packets_scanned_ = 0;
+};
+
+} // namespace vrtigo::utils::fileio
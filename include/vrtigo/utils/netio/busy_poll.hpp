@@ -0,0 +1,106 @@
+#pragma once
+
+#include <chrono>
+
+#include <cerrno>
+#include <cstdint>
+
+// Linux/POSIX socket headers
+#include <sys/socket.h>
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief How a socket reader waits for the next datagram
+ */
+enum class ReceiveMode : uint8_t {
+    /** Sleep in recvmsg() until a datagram arrives (default) */
+    blocking,
+
+    /**
+     * Poll with non-blocking recvmsg() and never sleep. Occupies a core; the reader's
+     * timeout (try_set_timeout()) still bounds the wait.
+     */
+    spin,
+
+    /** Spin for the spin budget, then fall back to a blocking recvmsg() */
+    spin_then_block
+};
+
+/**
+ * @brief Kernel busy-polling options (SO_BUSY_POLL, SO_PREFER_BUSY_POLL)
+ *
+ * With busy polling, a receive on an empty socket polls the NIC queue directly for up to
+ * poll_time instead of waiting for the interrupt and softirq path. This only helps for
+ * NIC drivers with NAPI busy-poll support and does nothing on loopback. Raising
+ * poll_time above net.core.busy_read and enabling prefer_busy_poll need CAP_NET_ADMIN.
+ */
+struct BusyPollOptions {
+    std::chrono::microseconds poll_time{50}; ///< SO_BUSY_POLL (0 disables busy polling)
+    bool prefer_busy_poll = true;            ///< SO_PREFER_BUSY_POLL (Linux 5.11+)
+    uint16_t budget = 0;                     ///< SO_BUSY_POLL_BUDGET packets (0 = default)
+};
+
+} // namespace vrtigo::utils::netio
+
+namespace vrtigo::utils::detail {
+
+/**
+ * @brief Apply busy-polling options to a socket
+ *
+ * @return 0 on success, otherwise the errno of the first rejected option (ENOPROTOOPT if
+ *         an option does not exist on this platform)
+ */
+inline int set_busy_poll(int socket_fd, const netio::BusyPollOptions& options) noexcept {
+#if defined(SO_BUSY_POLL)
+    int usec = static_cast<int>(options.poll_time.count());
+    if (setsockopt(socket_fd, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec)) < 0) {
+        return errno;
+    }
+#else
+    (void)socket_fd;
+    if (options.poll_time.count() != 0) {
+        return ENOPROTOOPT;
+    }
+#endif
+
+    // Disabling must always succeed, so only a requested option can fail
+    const bool prefer = options.prefer_busy_poll && options.poll_time.count() != 0;
+#if defined(SO_PREFER_BUSY_POLL)
+    int value = prefer ? 1 : 0;
+    if (setsockopt(socket_fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &value, sizeof(value)) < 0 &&
+        prefer) {
+        return errno;
+    }
+#else
+    if (prefer) {
+        return ENOPROTOOPT;
+    }
+#endif
+
+    if (options.budget != 0) {
+#if defined(SO_BUSY_POLL_BUDGET)
+        int budget = options.budget;
+        if (setsockopt(socket_fd, SOL_SOCKET, SO_BUSY_POLL_BUDGET, &budget, sizeof(budget)) <
+            0) {
+            return errno;
+        }
+#else
+        return ENOPROTOOPT;
+#endif
+    }
+    return 0;
+}
+
+/**
+ * @brief Hint to the CPU that the caller is spinning
+ */
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+} // namespace vrtigo::utils::detail
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// Linux/POSIX socket headers
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief IPv4 multicast membership: group, receiving interface, and optional source
+ *
+ * A membership with source == INADDR_ANY is any-source multicast (IP_ADD_MEMBERSHIP).
+ * A specific source makes it source-specific multicast (IP_ADD_SOURCE_MEMBERSHIP), where
+ * only datagrams from that sender are delivered for the group. interface_addr selects
+ * the local interface by one of its IPv4 addresses; INADDR_ANY lets the routing table
+ * choose. All addresses are stored in network byte order, ready for setsockopt().
+ *
+ * Example usage:
+ * @code
+ * auto any_source = MulticastGroup::parse("239.10.0.1");
+ * auto ssm = MulticastGroup::parse("232.1.1.1", "10.0.0.5", "10.0.0.99");
+ * reader.try_join_group(ssm);
+ * @endcode
+ */
+struct MulticastGroup {
+    in_addr group{};          ///< Multicast group address
+    in_addr interface_addr{}; ///< Local interface address (INADDR_ANY = default route)
+    in_addr source{};         ///< Sender address for SSM (INADDR_ANY = any source)
+
+    /**
+     * @brief Build a membership from dotted-quad strings
+     *
+     * @param group Multicast group (224.0.0.0/4)
+     * @param interface_addr Local interface address, empty for the default
+     * @param source Sender address for source-specific multicast, empty for any source
+     * @throws std::invalid_argument if an address does not parse or group is not multicast
+     */
+    static MulticastGroup parse(const std::string& group, const std::string& interface_addr = "",
+                                const std::string& source = "") {
+        MulticastGroup result;
+        result.interface_addr.s_addr = htonl(INADDR_ANY);
+        result.source.s_addr = htonl(INADDR_ANY);
+        if (inet_pton(AF_INET, group.c_str(), &result.group) != 1) {
+            throw std::invalid_argument("Invalid multicast group address: " + group);
+        }
+        if (!IN_MULTICAST(ntohl(result.group.s_addr))) {
+            throw std::invalid_argument("Not a multicast address: " + group);
+        }
+        if (!interface_addr.empty() &&
+            inet_pton(AF_INET, interface_addr.c_str(), &result.interface_addr) != 1) {
+            throw std::invalid_argument("Invalid interface address: " + interface_addr);
+        }
+        if (!source.empty() && inet_pton(AF_INET, source.c_str(), &result.source) != 1) {
+            throw std::invalid_argument("Invalid multicast source address: " + source);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Check whether the membership is source-specific
+     */
+    bool is_source_specific() const noexcept { return source.s_addr != htonl(INADDR_ANY); }
+};
+
+/**
+ * @brief IPv6 multicast membership: group, receiving interface, and optional source
+ *
+ * IPv6 selects interfaces by index rather than by address; parse() accepts an interface
+ * name ("eth0") or a numeric index. A source other than :: makes the membership
+ * source-specific (MCAST_JOIN_SOURCE_GROUP); SSM groups live in ff3x::/32.
+ */
+struct MulticastGroupV6 {
+    in6_addr group{};                 ///< Multicast group address (ff00::/8)
+    unsigned int interface_index = 0; ///< Interface index (0 = default route)
+    in6_addr source{};                ///< Sender address for SSM (:: = any source)
+
+    /**
+     * @brief Build a membership from strings
+     *
+     * @param group IPv6 multicast group
+     * @param interface Interface name or index, empty for the default
+     * @param source Sender address for source-specific multicast, empty for any source
+     * @throws std::invalid_argument if an address or interface is not valid
+     */
+    static MulticastGroupV6 parse(const std::string& group, const std::string& interface = "",
+                                  const std::string& source = "") {
+        MulticastGroupV6 result;
+        if (inet_pton(AF_INET6, group.c_str(), &result.group) != 1) {
+            throw std::invalid_argument("Invalid multicast group address: " + group);
+        }
+        if (!IN6_IS_ADDR_MULTICAST(&result.group)) {
+            throw std::invalid_argument("Not a multicast address: " + group);
+        }
+        if (!interface.empty()) {
+            result.interface_index = lookup_interface(interface);
+            if (result.interface_index == 0) {
+                throw std::invalid_argument("Unknown interface: " + interface);
+            }
+        }
+        if (!source.empty() && inet_pton(AF_INET6, source.c_str(), &result.source) != 1) {
+            throw std::invalid_argument("Invalid multicast source address: " + source);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Check whether the membership is source-specific
+     */
+    bool is_source_specific() const noexcept { return !IN6_IS_ADDR_UNSPECIFIED(&source); }
+
+    /**
+     * @brief Look up an interface by name ("eth0") or decimal index
+     *
+     * @return Interface index, or 0 if the interface is unknown
+     */
+    static unsigned int lookup_interface(const std::string& interface) noexcept {
+        unsigned int index = if_nametoindex(interface.c_str());
+        if (index == 0) {
+            char* end = nullptr;
+            unsigned long number = std::strtoul(interface.c_str(), &end, 10);
+            if (end != interface.c_str() && *end == '\0' && number <= UINT_MAX) {
+                index = static_cast<unsigned int>(number);
+            }
+        }
+        return index;
+    }
+};
+
+} // namespace vrtigo::utils::netio
+
+namespace vrtigo::utils::detail {
+
+/**
+ * @brief Join or leave a multicast membership on a socket
+ *
+ * @return 0 on success, otherwise the errno from setsockopt()
+ */
+inline int change_multicast_membership(int socket_fd, const netio::MulticastGroup& membership,
+                                       bool join) noexcept {
+    int result;
+    if (membership.is_source_specific()) {
+        struct ip_mreq_source mreq {};
+        mreq.imr_multiaddr = membership.group;
+        mreq.imr_interface = membership.interface_addr;
+        mreq.imr_sourceaddr = membership.source;
+        result = setsockopt(socket_fd, IPPROTO_IP,
+                            join ? IP_ADD_SOURCE_MEMBERSHIP : IP_DROP_SOURCE_MEMBERSHIP, &mreq,
+                            sizeof(mreq));
+    } else {
+        struct ip_mreq mreq {};
+        mreq.imr_multiaddr = membership.group;
+        mreq.imr_interface = membership.interface_addr;
+        result = setsockopt(socket_fd, IPPROTO_IP, join ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP,
+                            &mreq, sizeof(mreq));
+    }
+    return result < 0 ? errno : 0;
+}
+
+/**
+ * @brief Join or leave an IPv6 multicast membership on a socket
+ *
+ * @return 0 on success, otherwise the errno from setsockopt()
+ */
+inline int change_multicast_membership(int socket_fd, const netio::MulticastGroupV6& membership,
+                                       bool join) noexcept {
+    int result;
+    if (membership.is_source_specific()) {
+#if defined(MCAST_JOIN_SOURCE_GROUP)
+        struct group_source_req req {};
+        req.gsr_interface = membership.interface_index;
+        auto* group = reinterpret_cast<sockaddr_in6*>(&req.gsr_group);
+        group->sin6_family = AF_INET6;
+        group->sin6_addr = membership.group;
+        auto* source = reinterpret_cast<sockaddr_in6*>(&req.gsr_source);
+        source->sin6_family = AF_INET6;
+        source->sin6_addr = membership.source;
+        result = setsockopt(socket_fd, IPPROTO_IPV6,
+                            join ? MCAST_JOIN_SOURCE_GROUP : MCAST_LEAVE_SOURCE_GROUP, &req,
+                            sizeof(req));
+#else
+        (void)socket_fd;
+        (void)join;
+        return ENOPROTOOPT;
+#endif
+    } else {
+        struct ipv6_mreq mreq {};
+        mreq.ipv6mr_multiaddr = membership.group;
+        mreq.ipv6mr_interface = membership.interface_index;
+        result = setsockopt(socket_fd, IPPROTO_IPV6, join ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP,
+                            &mreq, sizeof(mreq));
+    }
+    return result < 0 ? errno : 0;
+}
+
+/**
+ * @brief Restrict a socket to its own memberships (Linux IP_MULTICAST_ALL)
+ *
+ * Linux delivers datagrams for every group joined by any socket on the host to all
+ * sockets bound to INADDR_ANY on the same port unless this is turned off.
+ *
+ * @return true on success or on platforms without the option (which never leak)
+ */
+inline bool restrict_to_own_memberships(int socket_fd) noexcept {
+#if defined(IP_MULTICAST_ALL)
+    int all = 0;
+    return setsockopt(socket_fd, IPPROTO_IP, IP_MULTICAST_ALL, &all, sizeof(all)) >= 0;
+#else
+    (void)socket_fd;
+    return true;
+#endif
+}
+
+} // namespace vrtigo::utils::detail
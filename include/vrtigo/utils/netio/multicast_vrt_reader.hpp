@@ -0,0 +1,419 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// Linux/POSIX socket headers
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include "../../detail/packet_variant.hpp"
+#include "../detail/iteration_helpers.hpp"
+#include "multicast.hpp"
+#include "udp_transport_status.hpp"
+#include "udp_vrt_reader.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Packet received by MulticastVRTReader, tagged with its group
+ */
+struct MulticastPacket {
+    vrtigo::PacketVariant packet; ///< Validated packet view (valid until the next read)
+    size_t group;                 ///< Group index from join(), or MulticastVRTReader::no_group
+};
+
+/**
+ * @brief Per-group receive counters
+ */
+struct MulticastGroupStats {
+    uint64_t packets = 0; ///< Datagrams received for the group
+    uint64_t bytes = 0;   ///< Datagram bytes received for the group
+};
+
+/**
+ * @brief Blocking reader for many multicast groups on one UDP socket (Linux/POSIX)
+ *
+ * Binds one socket to INADDR_ANY on the shared port, joins each group on it, and
+ * demultiplexes datagrams by their destination address (IP_PKTINFO) into the group index
+ * returned by join(). One process can subscribe to hundreds of streams with a single
+ * socket, one receive buffer, and one recvmsg() loop instead of a socket per stream.
+ *
+ * Reading, truncation, timestamps, and validation are those of UDPVRTReader, which this
+ * class wraps; read_next_packet() keeps it usable with the shared iteration helpers.
+ *
+ * **Limits**
+ *
+ * All groups must be sent to the same UDP port. Linux caps memberships per socket at
+ * net.ipv4.igmp_max_memberships (default 20) and join() fails with ENOBUFS beyond that;
+ * raise the sysctl for large subscriptions. On Linux the socket is restricted to its own
+ * memberships (IP_MULTICAST_ALL off), so groups joined by other sockets on the host are
+ * not delivered here.
+ *
+ * Example usage:
+ * @code
+ * MulticastVRTReader<> reader(50000);
+ * size_t wideband = reader.join(MulticastGroup::parse("239.1.0.1", "10.0.0.5"));
+ * size_t narrow = reader.join(MulticastGroup::parse("239.1.0.2", "10.0.0.5"));
+ *
+ * reader.for_each_group_packet([&](size_t group, const vrtigo::PacketVariant& pkt) {
+ *     if (group == wideband) { ... } else if (group == narrow) { ... }
+ *     return true;
+ * });
+ * @endcode
+ *
+ * @tparam MaxPacketWords Maximum packet size in 32-bit words (default: 65535)
+ */
+template <uint16_t MaxPacketWords = 65535>
+class MulticastVRTReader {
+public:
+    /// Group index for datagrams whose destination is not a joined group (e.g. unicast)
+    static constexpr size_t no_group = SIZE_MAX;
+
+    /**
+     * @brief Create a reader on the port shared by the groups
+     *
+     * No group is joined yet; call join() for each.
+     *
+     * @param port UDP port the groups are sent to (0 = ephemeral, see socket_port())
+     * @throws std::runtime_error if the socket cannot be created, configured, or bound
+     */
+    explicit MulticastVRTReader(uint16_t port) : reader_(open_socket(port), true) {
+        if (!reader_.try_enable_destination_info()) {
+            throw std::runtime_error("Failed to enable IP_PKTINFO on multicast socket");
+        }
+    }
+
+    /**
+     * @brief Join a group (or add a source to a joined group) and return its index
+     *
+     * Indices are dense and stable: the first join of a group address gets the next index,
+     * later joins of the same address (further SSM sources, another interface) reuse it,
+     * and a group keeps its index after leave() and a subsequent rejoin.
+     *
+     * @param membership Group, interface, and optional source
+     * @return Group index used by read_next_group_packet() and group_stats()
+     * @throws std::runtime_error if the kernel rejects the membership
+     */
+    size_t join(const MulticastGroup& membership) {
+        uint32_t address = ntohl(membership.group.s_addr);
+        auto found = by_address_.find(address);
+        if (found != by_address_.end()) {
+            auto& entry = groups_[found->second];
+            for (const auto& existing : entry.memberships) {
+                if (same_membership(existing, membership)) {
+                    return found->second;
+                }
+            }
+        }
+
+        if (int err = detail::change_multicast_membership(reader_.socket_fd(), membership, true);
+            err != 0) {
+            std::string message = "Failed to join multicast group: ";
+            message += std::strerror(err);
+            if (err == ENOBUFS) {
+                message += " (membership limit reached, see net.ipv4.igmp_max_memberships)";
+            }
+            throw std::runtime_error(message);
+        }
+
+        if (found != by_address_.end()) {
+            groups_[found->second].memberships.push_back(membership);
+            return found->second;
+        }
+        size_t index = groups_.size();
+        groups_.push_back(GroupEntry{membership.group, {membership}, {}});
+        by_address_.emplace(address, index);
+        return index;
+    }
+
+    /**
+     * @brief Leave every membership of a group
+     *
+     * Datagrams for the group still queued in the socket are reported with no_group.
+     *
+     * @param group Index returned by join()
+     * @return true if all memberships were dropped; false for an unknown index or if the
+     *         kernel rejected a drop
+     */
+    bool leave(size_t group) noexcept {
+        if (group >= groups_.size()) {
+            return false;
+        }
+        bool ok = true;
+        for (const auto& membership : groups_[group].memberships) {
+            ok &= detail::change_multicast_membership(reader_.socket_fd(), membership, false) == 0;
+        }
+        groups_[group].memberships.clear();
+        return ok;
+    }
+
+    /**
+     * @brief Read the next packet and the group it was sent to
+     *
+     * Same blocking, timeout, and truncation semantics as UDPVRTReader::read_next_packet().
+     *
+     * @return Packet with group index, or std::nullopt on timeout, closure, or fatal error
+     */
+    std::optional<MulticastPacket> read_next_group_packet() noexcept {
+        auto packet = read_next_packet();
+        if (!packet) {
+            return std::nullopt;
+        }
+        return MulticastPacket{std::move(*packet), last_group_};
+    }
+
+    /**
+     * @brief Read the next packet (PacketReader interface)
+     *
+     * The group of the returned packet is available from last_group().
+     */
+    std::optional<vrtigo::PacketVariant> read_next_packet() noexcept {
+        auto packet = reader_.read_next_packet();
+        last_group_ = no_group;
+        if (!packet) {
+            return std::nullopt;
+        }
+
+        const auto& status = reader_.transport_status();
+        auto found = by_address_.find(status.destination_address);
+        if (found != by_address_.end() && !groups_[found->second].memberships.empty()) {
+            last_group_ = found->second;
+            auto& stats = groups_[last_group_].stats;
+            ++stats.packets;
+            stats.bytes += status.bytes_received;
+        } else {
+            ++unmatched_packets_;
+        }
+        return packet;
+    }
+
+    /**
+     * @brief Iterate over packets with their group index
+     *
+     * @tparam Callback Function type with signature: bool(size_t group, const PacketVariant&)
+     * @param callback Function called for each packet. Return false to stop iteration.
+     * @return Number of packets processed
+     */
+    template <typename Callback>
+    size_t for_each_group_packet(Callback&& callback) noexcept {
+        size_t count = 0;
+        while (auto pkt = read_next_packet()) {
+            ++count;
+            if (!callback(last_group_, *pkt)) {
+                break;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Iterate over all packets with automatic validation (see UDPVRTReader)
+     */
+    template <typename Callback>
+    size_t for_each_validated_packet(Callback&& callback) noexcept {
+        return detail::for_each_validated_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over data packets only (see UDPVRTReader)
+     */
+    template <typename Callback>
+    size_t for_each_data_packet(Callback&& callback) noexcept {
+        return detail::for_each_data_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over context packets only (see UDPVRTReader)
+     */
+    template <typename Callback>
+    size_t for_each_context_packet(Callback&& callback) noexcept {
+        return detail::for_each_context_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Group index of the packet returned by the last read, or no_group
+     */
+    size_t last_group() const noexcept { return last_group_; }
+
+    /**
+     * @brief Number of group indices handed out by join()
+     */
+    size_t group_count() const noexcept { return groups_.size(); }
+
+    /**
+     * @brief Group address for an index (network byte order)
+     */
+    in_addr group_address(size_t group) const { return groups_.at(group).address; }
+
+    /**
+     * @brief Check whether a group currently has at least one membership
+     */
+    bool is_joined(size_t group) const noexcept {
+        return group < groups_.size() && !groups_[group].memberships.empty();
+    }
+
+    /**
+     * @brief Receive counters for a group
+     */
+    const MulticastGroupStats& group_stats(size_t group) const { return groups_.at(group).stats; }
+
+    /**
+     * @brief Datagrams that did not match a joined group
+     */
+    uint64_t unmatched_packets() const noexcept { return unmatched_packets_; }
+
+    /**
+     * @brief Status of the last receive operation (see UDPVRTReader)
+     */
+    const UDPTransportStatus& transport_status() const noexcept {
+        return reader_.transport_status();
+    }
+
+    /**
+     * @brief Reader counters and latency histograms (see UDPVRTReader)
+     */
+    const detail::Instrumentation& instrumentation() const noexcept {
+        return reader_.instrumentation();
+    }
+
+    /**
+     * @brief Set receive timeout (see UDPVRTReader::try_set_timeout())
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        return reader_.try_set_timeout(timeout);
+    }
+
+    /**
+     * @brief Set socket receive buffer size; size it for the aggregate rate of all groups
+     */
+    bool try_set_receive_buffer_size(size_t bytes) noexcept {
+        return reader_.try_set_receive_buffer_size(bytes);
+    }
+
+    /**
+     * @brief Report kernel drops (see UDPVRTReader::try_enable_drop_accounting())
+     */
+    bool try_enable_drop_accounting(bool enable = true) noexcept {
+        return reader_.try_enable_drop_accounting(enable);
+    }
+
+    /**
+     * @brief Choose how the reader waits for datagrams (see UDPVRTReader)
+     */
+    void set_receive_mode(ReceiveMode mode, std::chrono::nanoseconds spin_budget =
+                                                std::chrono::microseconds(50)) noexcept {
+        reader_.set_receive_mode(mode, spin_budget);
+    }
+
+    /**
+     * @brief Enable kernel busy polling (see UDPVRTReader::try_enable_busy_poll())
+     */
+    bool try_enable_busy_poll(const BusyPollOptions& options = {}) noexcept {
+        return reader_.try_enable_busy_poll(options);
+    }
+
+    /**
+     * @brief Grow the receive buffer on drops (see UDPVRTReader)
+     */
+    bool try_enable_adaptive_receive_buffer(ReceiveBufferPolicy policy = {}) noexcept {
+        return reader_.try_enable_adaptive_receive_buffer(policy);
+    }
+
+    /**
+     * @brief Controller installed by try_enable_adaptive_receive_buffer()
+     */
+    const std::optional<ReceiveBufferController>& receive_buffer_controller() const noexcept {
+        return reader_.receive_buffer_controller();
+    }
+
+    /**
+     * @brief Enable kernel receive timestamps (see UDPVRTReader)
+     */
+    bool try_enable_receive_timestamps(
+        ReceiveTimestampMode mode = ReceiveTimestampMode::software) noexcept {
+        return reader_.try_enable_receive_timestamps(mode);
+    }
+
+    /**
+     * @brief Filter packets in the kernel (see UDPVRTReader::try_set_packet_filter())
+     *
+     * One filter covers every joined group; it sees the datagram from the UDP header on.
+     */
+    bool try_set_packet_filter(const PacketFilter& filter) {
+        return reader_.try_set_packet_filter(filter);
+    }
+
+    /**
+     * @brief Check if socket is still valid
+     */
+    bool is_open() const noexcept { return reader_.is_open(); }
+
+    /**
+     * @brief Get underlying socket file descriptor
+     */
+    int socket_fd() const noexcept { return reader_.socket_fd(); }
+
+    /**
+     * @brief Get the port the socket is bound to
+     */
+    uint16_t socket_port() const noexcept { return reader_.socket_port(); }
+
+private:
+    struct GroupEntry {
+        in_addr address;                         ///< Group address (network byte order)
+        std::vector<MulticastGroup> memberships; ///< Active memberships (empty after leave)
+        MulticastGroupStats stats;               ///< Receive counters
+    };
+
+    static bool same_membership(const MulticastGroup& a, const MulticastGroup& b) noexcept {
+        return a.group.s_addr == b.group.s_addr &&
+               a.interface_addr.s_addr == b.interface_addr.s_addr &&
+               a.source.s_addr == b.source.s_addr;
+    }
+
+    static int open_socket(uint16_t port) {
+        int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to create UDP socket");
+        }
+
+        int reuse = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (!detail::restrict_to_own_memberships(fd)) {
+            ::close(fd);
+            throw std::runtime_error("Failed to disable IP_MULTICAST_ALL");
+        }
+
+        struct sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (::bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to bind UDP socket to port " + std::to_string(port));
+        }
+        return fd;
+    }
+
+    UDPVRTReader<MaxPacketWords> reader_;                ///< Socket and receive path
+    std::vector<GroupEntry> groups_;                     ///< Indexed by group index
+    std::unordered_map<uint32_t, size_t> by_address_;    ///< Host-order address -> index
+    size_t last_group_ = no_group;                       ///< Group of the last packet
+    uint64_t unmatched_packets_ = 0;                     ///< Datagrams for no joined group
+};
+
+} // namespace vrtigo::utils::netio
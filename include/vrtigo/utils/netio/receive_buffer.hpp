@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+// Linux/POSIX socket headers
+#include <sys/socket.h>
+
+namespace vrtigo::utils::detail {
+
+/**
+ * @brief Current socket receive buffer size as reported by the kernel
+ *
+ * Linux reports twice the requested size (the extra half covers bookkeeping overhead).
+ *
+ * @return Size in bytes, or 0 on failure
+ */
+inline size_t receive_buffer_size(int socket_fd) noexcept {
+    int size = 0;
+    socklen_t len = sizeof(size);
+    if (getsockopt(socket_fd, SOL_SOCKET, SO_RCVBUF, &size, &len) < 0 || size < 0) {
+        return 0;
+    }
+    return static_cast<size_t>(size);
+}
+
+/**
+ * @brief Request a socket receive buffer size
+ *
+ * With force, SO_RCVBUFFORCE is tried first: it ignores net.core.rmem_max but needs
+ * CAP_NET_ADMIN. SO_RCVBUF (silently capped at rmem_max) is the fallback.
+ *
+ * @return true if either option was accepted
+ */
+inline bool request_receive_buffer_size(int socket_fd, size_t bytes, bool force) noexcept {
+    int size = static_cast<int>(std::min<size_t>(bytes, INT_MAX));
+#if defined(SO_RCVBUFFORCE)
+    if (force && setsockopt(socket_fd, SOL_SOCKET, SO_RCVBUFFORCE, &size, sizeof(size)) >= 0) {
+        return true;
+    }
+#else
+    (void)force;
+#endif
+    return setsockopt(socket_fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)) >= 0;
+}
+
+} // namespace vrtigo::utils::detail
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Growth policy for ReceiveBufferController
+ *
+ * Sizes are kernel-reported (getsockopt) sizes, which on Linux are twice the requested
+ * size.
+ */
+struct ReceiveBufferPolicy {
+    size_t max_bytes = size_t{64} << 20;         ///< Never grow beyond this
+    double growth_factor = 2.0;                  ///< Multiplier applied per resize
+    std::chrono::milliseconds min_interval{100}; ///< Minimum time between resizes
+    bool force = true;                           ///< Try SO_RCVBUFFORCE before SO_RCVBUF
+};
+
+/**
+ * @brief Grows a socket's receive buffer when the kernel reports drops
+ *
+ * Feed it the cumulative kernel drop counter (SO_RXQ_OVFL, see
+ * UDPVRTReader::try_enable_drop_accounting()); each time the counter moves, the buffer is
+ * multiplied by the policy's growth factor, at most once per min_interval and up to
+ * max_bytes. Drops observed during the interval are attributed to the buffer just set.
+ *
+ * Without CAP_NET_ADMIN the buffer cannot exceed net.core.rmem_max. When a resize no
+ * longer changes the size the kernel reports, the controller marks itself at_limit() and
+ * stops issuing setsockopt() calls.
+ *
+ * The kernel also counts datagrams rejected by a socket filter (try_set_packet_filter())
+ * as drops, so do not combine adaptive sizing with a filter that rejects traffic.
+ *
+ * Readers own one after try_enable_adaptive_receive_buffer(); it can also drive any other
+ * socket whose drops are counted elsewhere.
+ */
+class ReceiveBufferController {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Control the receive buffer of a socket
+     *
+     * @param socket_fd Socket to resize (not owned)
+     * @param policy Growth policy
+     */
+    explicit ReceiveBufferController(int socket_fd, ReceiveBufferPolicy policy = {}) noexcept
+        : socket_(socket_fd),
+          policy_(policy),
+          size_bytes_(detail::receive_buffer_size(socket_fd)) {}
+
+    /**
+     * @brief Report the cumulative drop counter; grows the buffer if it moved
+     *
+     * @param total_drops Datagrams dropped by the kernel so far
+     * @param now Current time
+     * @return true if the buffer was grown
+     */
+    bool observe(uint64_t total_drops, clock::time_point now = clock::now()) noexcept {
+        if (total_drops <= drops_seen_) {
+            return false;
+        }
+        drops_seen_ = total_drops;
+        if (at_limit_ || (resizes_ > 0 && now - last_resize_ < policy_.min_interval)) {
+            return false;
+        }
+
+        const size_t current = detail::receive_buffer_size(socket_);
+        const double grown = static_cast<double>(current) * policy_.growth_factor;
+        const size_t target = std::min(static_cast<size_t>(grown), policy_.max_bytes);
+        if (target <= current) {
+            at_limit_ = true;
+            return false;
+        }
+
+#if defined(__linux__)
+        const size_t request = target / 2; // The kernel doubles the requested size
+#else
+        const size_t request = target;
+#endif
+        detail::request_receive_buffer_size(socket_, request, policy_.force);
+        size_bytes_ = detail::receive_buffer_size(socket_);
+        if (size_bytes_ <= current) {
+            at_limit_ = true;
+            return false;
+        }
+        ++resizes_;
+        last_resize_ = now;
+        return true;
+    }
+
+    /// Kernel-reported receive buffer size after the last resize
+    size_t size_bytes() const noexcept { return size_bytes_; }
+
+    /// Number of successful resizes
+    size_t resizes() const noexcept { return resizes_; }
+
+    /// Drops reported by the last observe() call
+    uint64_t drops_seen() const noexcept { return drops_seen_; }
+
+    /// True once the buffer can no longer grow (max_bytes or rmem_max reached)
+    bool at_limit() const noexcept { return at_limit_; }
+
+    const ReceiveBufferPolicy& policy() const noexcept { return policy_; }
+
+private:
+    int socket_;                      ///< Controlled socket (not owned)
+    ReceiveBufferPolicy policy_;      ///< Growth policy
+    size_t size_bytes_;               ///< Kernel-reported size after the last resize
+    size_t resizes_ = 0;              ///< Successful resizes
+    uint64_t drops_seen_ = 0;         ///< Last cumulative drop count observed
+    bool at_limit_ = false;           ///< Growth stopped
+    clock::time_point last_resize_{}; ///< Time of the last resize
+};
+
+} // namespace vrtigo::utils::netio
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+#include <cstdint>
+
+#include "../../detail/packet_variant.hpp"
+#include "../../timestamp.hpp"
+#include "../../types.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Kernel receive timestamping mode for UDP readers
+ */
+enum class ReceiveTimestampMode : uint8_t {
+    /** No receive timestamps (default, no control-message overhead) */
+    none,
+
+    /** SO_TIMESTAMPNS: kernel software timestamp with nanosecond resolution */
+    software,
+
+    /**
+     * SO_TIMESTAMPING: software RX timestamps plus raw hardware timestamps when the NIC
+     * has been configured for them (SIOCSHWTSTAMP). Linux only.
+     */
+    timestamping
+};
+
+/**
+ * @brief Origin of a receive timestamp
+ */
+enum class ReceiveTimestampSource : uint8_t {
+    /** No timestamp was delivered with the datagram */
+    none,
+
+    /** Kernel software timestamp (taken in the network stack on arrival) */
+    software,
+
+    /** NIC hardware timestamp (raw PHC time, assumed disciplined to UTC) */
+    hardware
+};
+
+/**
+ * @brief Arrival time of a datagram as reported by the kernel
+ *
+ * Expressed on the system (UTC) clock so it can be compared directly against VRT UTC
+ * timestamps.
+ */
+struct ReceiveTimestamp {
+    /** Arrival time (epoch-based, UTC) */
+    std::chrono::system_clock::time_point time{};
+
+    /** Where the timestamp came from */
+    ReceiveTimestampSource source{ReceiveTimestampSource::none};
+
+    /**
+     * @brief Check if a timestamp was delivered
+     *
+     * @return true if source is software or hardware
+     */
+    constexpr bool has_value() const noexcept { return source != ReceiveTimestampSource::none; }
+};
+
+/**
+ * @brief Packet paired with its kernel receive timestamp
+ */
+struct TimestampedPacket {
+    PacketVariant packet;          ///< Parsed packet (views reference the reader's buffer)
+    ReceiveTimestamp receive_time; ///< Arrival time of the carrying datagram
+};
+
+/**
+ * @brief Latency from a packet's VRT timestamp to its network arrival
+ *
+ * Computes arrival - VRT time. Requires a UTC or GPS integer timestamp (GPS is converted
+ * with the active leap-second table); a real-time fractional timestamp adds sub-second
+ * precision, other TSF kinds are ignored (whole seconds only).
+ *
+ * @tparam Packet RuntimeDataPacket or RuntimeContextPacket
+ * @param packet Validated packet carrying the VRT timestamp
+ * @param arrival Receive timestamp of the datagram
+ * @return Latency (negative if the packet arrived "before" its timestamp), or std::nullopt
+ *         if there is no arrival time or the packet has no UTC/GPS timestamp
+ */
+template <typename Packet>
+std::optional<std::chrono::nanoseconds> vrt_to_arrival_latency(const Packet& packet,
+                                                               ReceiveTimestamp arrival) noexcept {
+    const auto tsi = packet.tsi_kind();
+    if (!arrival.has_value() || (tsi != TsiType::utc && tsi != TsiType::gps)) {
+        return std::nullopt;
+    }
+    auto seconds = packet.timestamp_integer();
+    if (!seconds) {
+        return std::nullopt;
+    }
+
+    uint64_t picoseconds = 0;
+    if (packet.tsf_kind() == TsfType::real_time) {
+        picoseconds = packet.timestamp_fractional().value_or(0);
+    }
+
+    auto vrt_time = (tsi == TsiType::gps) ? GpsRealTimestamp(*seconds, picoseconds).to_chrono()
+                                          : UtcRealTimestamp(*seconds, picoseconds).to_chrono();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(arrival.time - vrt_time);
+}
+
+/**
+ * @brief Latency from a parsed packet's VRT timestamp to its network arrival
+ *
+ * @return Latency, or std::nullopt for invalid packets and packets without a UTC/GPS
+ *         timestamp
+ */
+inline std::optional<std::chrono::nanoseconds>
+vrt_to_arrival_latency(const PacketVariant& packet, ReceiveTimestamp arrival) noexcept {
+    return std::visit(
+        [&](const auto& p) -> std::optional<std::chrono::nanoseconds> {
+            if constexpr (std::is_same_v<std::decay_t<decltype(p)>, InvalidPacket>) {
+                return std::nullopt;
+            } else {
+                return vrt_to_arrival_latency(p, arrival);
+            }
+        },
+        packet);
+}
+
+/**
+ * @brief Latency from a packet's VRT timestamp to its network arrival
+ *
+ * @return Latency, or std::nullopt if unavailable (see overloads above)
+ */
+inline std::optional<std::chrono::nanoseconds>
+vrt_to_arrival_latency(const TimestampedPacket& packet) noexcept {
+    return vrt_to_arrival_latency(packet.packet, packet.receive_time);
+}
+
+} // namespace vrtigo::utils::netio
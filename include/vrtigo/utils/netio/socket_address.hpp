@@ -0,0 +1,301 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+// Linux/POSIX socket headers
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Address family selection for UDP sockets
+ */
+enum class IPFamily : uint8_t {
+    ipv4,      ///< AF_INET socket
+    ipv6,      ///< AF_INET6 socket with IPV6_V6ONLY set (IPv6 traffic only)
+    dual_stack ///< AF_INET6 socket with IPV6_V6ONLY cleared (IPv4 as v4-mapped addresses)
+};
+
+/**
+ * @brief Resolved IPv4 or IPv6 socket address (sockaddr_storage plus length)
+ *
+ * Resolve a destination once with resolve() and pass the result to every send; the
+ * writer hands the stored sockaddr straight to sendto(), so the per-packet path does no
+ * name lookup or address conversion.
+ *
+ * Example usage:
+ * @code
+ * auto dest = SocketAddress::resolve("fd00::10", 50000);
+ * for (...) {
+ *     writer.write_packet(packet, dest);
+ * }
+ * @endcode
+ */
+class SocketAddress {
+public:
+    /// Empty address (family AF_UNSPEC)
+    SocketAddress() noexcept = default;
+
+    /// IPv4 address
+    SocketAddress(const sockaddr_in& addr) noexcept { assign(&addr, sizeof(addr)); }
+
+    /// IPv6 address
+    SocketAddress(const sockaddr_in6& addr) noexcept { assign(&addr, sizeof(addr)); }
+
+    /**
+     * @brief Copy an address returned by the socket API (recvmsg, getsockname, ...)
+     *
+     * @return Empty address if the family is neither AF_INET nor AF_INET6
+     */
+    static SocketAddress from_sockaddr(const sockaddr* addr, socklen_t length) noexcept {
+        SocketAddress result;
+        if (addr != nullptr &&
+            ((addr->sa_family == AF_INET && length >= sizeof(sockaddr_in)) ||
+             (addr->sa_family == AF_INET6 && length >= sizeof(sockaddr_in6)))) {
+            result.assign(addr, addr->sa_family == AF_INET ? sizeof(sockaddr_in)
+                                                           : sizeof(sockaddr_in6));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Resolve a host name or numeric address
+     *
+     * IPv6 literals may carry a zone ("fe80::1%eth0"). With family AF_UNSPEC the first
+     * result of getaddrinfo() is used, which follows the system's address selection
+     * policy.
+     *
+     * @param host Host name, IPv4 dotted quad, or IPv6 literal
+     * @param port Port number
+     * @param family AF_UNSPEC, AF_INET, or AF_INET6
+     * @throws std::runtime_error if the name does not resolve
+     */
+    static SocketAddress resolve(const std::string& host, uint16_t port,
+                                 int family = AF_UNSPEC) {
+        struct addrinfo hints {};
+        hints.ai_family = family;
+        hints.ai_socktype = SOCK_DGRAM;
+
+        struct addrinfo* result = nullptr;
+        int ret = ::getaddrinfo(host.c_str(), nullptr, &hints, &result);
+        if (ret != 0 || result == nullptr) {
+            throw std::runtime_error("Failed to resolve address: " + host);
+        }
+        auto address = from_sockaddr(result->ai_addr, result->ai_addrlen);
+        ::freeaddrinfo(result);
+        if (address.empty()) {
+            throw std::runtime_error("Unsupported address family for: " + host);
+        }
+        address.set_port(port);
+        return address;
+    }
+
+    /**
+     * @brief Resolve a host for a socket of the given IPFamily
+     *
+     * ipv4 and ipv6 resolve only that family. dual_stack prefers an IPv4 address and falls
+     * back to IPv6, so names like "localhost" keep reaching IPv4 peers; the result is not
+     * v4-mapped (see to_v4_mapped()).
+     *
+     * @throws std::runtime_error if the name does not resolve for the family
+     */
+    static SocketAddress resolve(const std::string& host, uint16_t port, IPFamily family) {
+        if (family == IPFamily::ipv6) {
+            return resolve(host, port, AF_INET6);
+        }
+        if (family == IPFamily::ipv4) {
+            return resolve(host, port, AF_INET);
+        }
+        try {
+            return resolve(host, port, AF_INET);
+        } catch (const std::runtime_error&) {
+            return resolve(host, port, AF_INET6);
+        }
+    }
+
+    /**
+     * @brief Wildcard (any) address of a family
+     */
+    static SocketAddress any(int family, uint16_t port) noexcept {
+        if (family == AF_INET6) {
+            sockaddr_in6 addr{};
+            addr.sin6_family = AF_INET6;
+            addr.sin6_addr = in6addr_any;
+            addr.sin6_port = htons(port);
+            return SocketAddress(addr);
+        }
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+        return SocketAddress(addr);
+    }
+
+    /**
+     * @brief Same address as seen through a dual-stack IPv6 socket
+     *
+     * IPv4 addresses become v4-mapped IPv6 (::ffff:a.b.c.d); others are returned unchanged.
+     */
+    SocketAddress to_v4_mapped() const noexcept {
+        if (family() != AF_INET) {
+            return *this;
+        }
+        const auto& in = *reinterpret_cast<const sockaddr_in*>(&storage_);
+        sockaddr_in6 mapped{};
+        mapped.sin6_family = AF_INET6;
+        mapped.sin6_port = in.sin_port;
+        mapped.sin6_addr.s6_addr[10] = 0xFF;
+        mapped.sin6_addr.s6_addr[11] = 0xFF;
+        std::memcpy(&mapped.sin6_addr.s6_addr[12], &in.sin_addr, 4);
+        return SocketAddress(mapped);
+    }
+
+    /// Pointer for bind/connect/sendto
+    const sockaddr* get() const noexcept { return reinterpret_cast<const sockaddr*>(&storage_); }
+
+    /// Length for bind/connect/sendto (0 when empty)
+    socklen_t length() const noexcept { return length_; }
+
+    /// AF_INET, AF_INET6, or AF_UNSPEC when empty
+    int family() const noexcept { return length_ == 0 ? AF_UNSPEC : storage_.ss_family; }
+
+    /// Check whether no address is stored
+    bool empty() const noexcept { return length_ == 0; }
+
+    /// Port in host byte order (0 when empty)
+    uint16_t port() const noexcept {
+        if (family() == AF_INET) {
+            return ntohs(reinterpret_cast<const sockaddr_in*>(&storage_)->sin_port);
+        }
+        if (family() == AF_INET6) {
+            return ntohs(reinterpret_cast<const sockaddr_in6*>(&storage_)->sin6_port);
+        }
+        return 0;
+    }
+
+    /// Replace the port (no effect when empty)
+    void set_port(uint16_t port) noexcept {
+        if (family() == AF_INET) {
+            reinterpret_cast<sockaddr_in*>(&storage_)->sin_port = htons(port);
+        } else if (family() == AF_INET6) {
+            reinterpret_cast<sockaddr_in6*>(&storage_)->sin6_port = htons(port);
+        }
+    }
+
+    /// Check for an IPv4 (224.0.0.0/4) or IPv6 (ff00::/8) multicast address
+    bool is_multicast() const noexcept {
+        if (family() == AF_INET) {
+            const auto* in = reinterpret_cast<const sockaddr_in*>(&storage_);
+            return IN_MULTICAST(ntohl(in->sin_addr.s_addr));
+        }
+        if (family() == AF_INET6) {
+            const auto* in6 = reinterpret_cast<const sockaddr_in6*>(&storage_);
+            return IN6_IS_ADDR_MULTICAST(&in6->sin6_addr);
+        }
+        return false;
+    }
+
+    /// Numeric form: "a.b.c.d:port" or "[v6]:port"
+    std::string to_string() const {
+        char text[INET6_ADDRSTRLEN] = {};
+        if (family() == AF_INET) {
+            inet_ntop(AF_INET, &reinterpret_cast<const sockaddr_in*>(&storage_)->sin_addr, text,
+                      sizeof(text));
+            std::string result = text;
+            result += ':';
+            result += std::to_string(port());
+            return result;
+        }
+        if (family() == AF_INET6) {
+            inet_ntop(AF_INET6, &reinterpret_cast<const sockaddr_in6*>(&storage_)->sin6_addr,
+                      text, sizeof(text));
+            std::string result = "[";
+            result += text;
+            result += "]:";
+            result += std::to_string(port());
+            return result;
+        }
+        return {};
+    }
+
+    bool operator==(const SocketAddress& other) const noexcept {
+        return length_ == other.length_ && std::memcmp(&storage_, &other.storage_, length_) == 0;
+    }
+
+private:
+    void assign(const void* addr, size_t length) noexcept {
+        std::memcpy(&storage_, addr, length);
+        length_ = static_cast<socklen_t>(length);
+    }
+
+    sockaddr_storage storage_{}; ///< Address bytes
+    socklen_t length_ = 0;       ///< Valid length of storage_
+};
+
+} // namespace vrtigo::utils::netio
+
+namespace vrtigo::utils::detail {
+
+/**
+ * @brief Create a UDP socket of the requested family
+ *
+ * IPv6 sockets get IPV6_V6ONLY set explicitly for both IPv6 modes instead of relying on
+ * the net.ipv6.bindv6only default.
+ *
+ * @return Socket descriptor, or -1 on failure (errno set)
+ */
+inline int open_udp_socket(netio::IPFamily family) noexcept {
+    int domain = family == netio::IPFamily::ipv4 ? AF_INET : AF_INET6;
+    int fd = ::socket(domain, SOCK_DGRAM, 0);
+    if (fd >= 0 && domain == AF_INET6) {
+        int v6_only = family == netio::IPFamily::ipv6 ? 1 : 0;
+        if (::setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &v6_only, sizeof(v6_only)) < 0) {
+            ::close(fd);
+            return -1;
+        }
+    }
+    return fd;
+}
+
+/**
+ * @brief Create a TCP socket and connect it to an address
+ *
+ * @return Connected socket descriptor, or -1 on failure (errno set)
+ */
+inline int connect_tcp_socket(const netio::SocketAddress& address) noexcept {
+    int fd = ::socket(address.family(), SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (::connect(fd, address.get(), address.length()) < 0) {
+        int err = errno;
+        ::close(fd);
+        errno = err;
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Local address a socket is bound to (empty on failure)
+ */
+inline netio::SocketAddress local_address(int socket_fd) noexcept {
+    sockaddr_storage addr{};
+    socklen_t length = sizeof(addr);
+    if (::getsockname(socket_fd, reinterpret_cast<sockaddr*>(&addr), &length) < 0) {
+        return {};
+    }
+    return netio::SocketAddress::from_sockaddr(reinterpret_cast<sockaddr*>(&addr), length);
+}
+
+} // namespace vrtigo::utils::detail
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/socket.h>
+
+#if defined(__linux__)
+    #include <linux/filter.h>
+#endif
+
+#include "vrtigo/types.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Kernel-side packet filter for socket readers
+ *
+ * Describes which VRT packets a socket should deliver. Socket readers compile it into a
+ * classic BPF program attached with SO_ATTACH_FILTER, so unwanted datagrams are dropped
+ * in the kernel before they are queued, copied or parsed. No privileges are needed.
+ *
+ * The filter matches the VRT header word and, when stream_ids is non-empty, the stream
+ * ID word. Sizes are VRT packet (datagram payload) sizes in bytes. Datagrams too short to
+ * hold the words examined are dropped.
+ *
+ * Example:
+ * @code
+ * PacketFilter filter;
+ * filter.stream_ids = {0x1000, 0x1001};
+ * filter.accept_only({PacketType::signal_data, PacketType::context});
+ * reader.try_set_packet_filter(filter);
+ * @endcode
+ */
+struct PacketFilter {
+    std::vector<uint32_t> stream_ids; ///< Stream IDs to accept (empty = any, incl. none)
+    uint16_t packet_types = 0xFFFF;   ///< Bit n set accepts packet type n
+    size_t min_size = 0;              ///< Smallest packet accepted, in bytes
+    size_t max_size = 65535 * 4;      ///< Largest packet accepted, in bytes
+
+    /// Most stream IDs a filter can hold (two BPF instructions each, 4096 in total)
+    static constexpr size_t max_stream_ids = 2000;
+
+    /**
+     * @brief Accept only the given packet types
+     */
+    PacketFilter& accept_only(std::initializer_list<PacketType> types) noexcept {
+        packet_types = 0;
+        for (auto type : types) {
+            packet_types |= static_cast<uint16_t>(1U << (static_cast<unsigned>(type) & 0xF));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief True if the filter accepts everything (no program needed)
+     */
+    bool accepts_all() const noexcept {
+        return stream_ids.empty() && packet_types == 0xFFFF && min_size == 0 &&
+               max_size >= 65535 * 4;
+    }
+};
+
+#if defined(__linux__)
+
+/**
+ * @brief Compile a PacketFilter into a classic BPF program
+ *
+ * The program checks the datagram length, then the packet type from the header word
+ * (shifted into a bit test against packet_types), then compares the stream ID word with
+ * each accepted ID. Packet types without a stream ID (0 and 2) are rejected when
+ * stream_ids is non-empty. Every check jumps over a local drop instruction, so jump
+ * distances stay within the 8-bit BPF limit for any number of IDs.
+ *
+ * @param filter Filter to compile
+ * @param header_offset Byte offset of the VRT header in the filtered buffer (8 for UDP
+ *        sockets, where the buffer starts at the UDP header; 0 for Unix sockets)
+ * @return BPF instructions, ready for SO_ATTACH_FILTER
+ * @throws std::invalid_argument if the filter holds more than max_stream_ids IDs or
+ *         min_size exceeds max_size
+ */
+inline std::vector<struct sock_filter> compile_packet_filter(const PacketFilter& filter,
+                                                             uint32_t header_offset) {
+    if (filter.stream_ids.size() > PacketFilter::max_stream_ids) {
+        throw std::invalid_argument("PacketFilter holds too many stream IDs");
+    }
+    if (filter.min_size > filter.max_size) {
+        throw std::invalid_argument("PacketFilter min_size exceeds max_size");
+    }
+
+    constexpr uint32_t accept = 0xFFFFFFFFU; // Keep the whole datagram
+    std::vector<struct sock_filter> program;
+    auto emit = [&](uint16_t code, uint8_t jt, uint8_t jf, uint32_t k) {
+        program.push_back(BPF_JUMP(code, k, jt, jf));
+    };
+    auto drop = [&] { emit(BPF_RET | BPF_K, 0, 0, 0); };
+
+    // Length checks (the buffer length includes header_offset bytes)
+    if (filter.min_size > 0 || filter.max_size < 65535 * 4) {
+        emit(BPF_LD | BPF_W | BPF_LEN, 0, 0, 0);
+        if (filter.min_size > 0) {
+            emit(BPF_JMP | BPF_JGE | BPF_K, 1, 0,
+                 static_cast<uint32_t>(filter.min_size) + header_offset);
+            drop();
+        }
+        if (filter.max_size < 65535 * 4) {
+            emit(BPF_JMP | BPF_JGT | BPF_K, 0, 1,
+                 static_cast<uint32_t>(filter.max_size) + header_offset);
+            drop();
+        }
+    }
+
+    // Packet type: X = type, then A = packet_types >> X, accept if bit 0 is set
+    if (filter.packet_types != 0xFFFF || !filter.stream_ids.empty()) {
+        emit(BPF_LD | BPF_W | BPF_ABS, 0, 0, header_offset);
+        emit(BPF_ALU | BPF_RSH | BPF_K, 0, 0, 28);
+        emit(BPF_MISC | BPF_TAX, 0, 0, 0);
+    }
+    if (filter.packet_types != 0xFFFF) {
+        emit(BPF_LD | BPF_IMM, 0, 0, filter.packet_types);
+        emit(BPF_ALU | BPF_RSH | BPF_X, 0, 0, 0);
+        emit(BPF_JMP | BPF_JSET | BPF_K, 1, 0, 1);
+        drop();
+    }
+
+    // Stream IDs: types 0 and 2 carry none
+    if (!filter.stream_ids.empty()) {
+        emit(BPF_MISC | BPF_TXA, 0, 0, 0);
+        emit(BPF_JMP | BPF_JSET | BPF_K, 0, 1, 1); // Odd types carry a stream ID
+        emit(BPF_JMP | BPF_JA, 0, 0, 2);
+        emit(BPF_JMP | BPF_JGE | BPF_K, 1, 0, 4); // Types 4 and up always do
+        drop();
+        emit(BPF_LD | BPF_W | BPF_ABS, 0, 0, header_offset + 4);
+        for (uint32_t id : filter.stream_ids) {
+            emit(BPF_JMP | BPF_JEQ | BPF_K, 0, 1, id);
+            emit(BPF_RET | BPF_K, 0, 0, accept);
+        }
+        drop();
+        return program;
+    }
+
+    emit(BPF_RET | BPF_K, 0, 0, accept);
+    return program;
+}
+
+#endif
+
+/**
+ * @brief Attach (or atomically replace) a packet filter on a socket
+ *
+ * SO_ATTACH_FILTER swaps the socket's program in one step, so no datagram is delivered
+ * unfiltered while a filter is replaced. Datagrams already queued are not re-examined.
+ * A filter that accepts everything detaches the current program instead.
+ *
+ * @param socket_fd Socket to filter
+ * @param filter Filter to attach
+ * @param header_offset Byte offset of the VRT header (see compile_packet_filter())
+ * @return true on success; false with errno set on failure (ENOSYS off Linux)
+ * @throws std::invalid_argument if the filter cannot be compiled
+ */
+inline bool attach_packet_filter(int socket_fd, const PacketFilter& filter,
+                                 uint32_t header_offset) {
+#if defined(__linux__)
+    if (filter.accepts_all()) {
+        int unused = 0;
+        if (setsockopt(socket_fd, SOL_SOCKET, SO_DETACH_FILTER, &unused, sizeof(unused)) < 0) {
+            return errno == ENOENT; // Nothing attached
+        }
+        return true;
+    }
+    auto program = compile_packet_filter(filter, header_offset);
+    struct sock_fprog fprog {};
+    fprog.len = static_cast<unsigned short>(program.size());
+    fprog.filter = program.data();
+    return setsockopt(socket_fd, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) >= 0;
+#else
+    (void)socket_fd;
+    (void)header_offset;
+    if (filter.accepts_all()) {
+        return true;
+    }
+    errno = ENOSYS;
+    return false;
+#endif
+}
+
+} // namespace vrtigo::utils::netio
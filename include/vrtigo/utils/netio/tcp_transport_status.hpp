@@ -0,0 +1,104 @@
+#pragma once
+
+#include "vrtigo/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Status information for TCP stream transport
+ *
+ * Tracks the state of the last TCP read or write. Unlike UDP, a TCP stream carries no
+ * packet boundaries: packets are framed by the VRT header size field, so a corrupt size
+ * word loses synchronization and is reported as framing_error.
+ */
+struct TCPTransportStatus {
+    /**
+     * @brief State of the last TCP operation
+     */
+    enum class State : uint8_t {
+        /** Packet successfully framed and ready for parsing (or written) */
+        packet_ready,
+
+        /** Peer closed the connection (orderly shutdown) */
+        socket_closed,
+
+        /** Fatal socket error occurred */
+        socket_error,
+
+        /** Header size field of 0: stream synchronization lost */
+        framing_error,
+
+        /** Packet larger than the reader's MaxPacketWords; it is skipped */
+        packet_oversized,
+
+        /** Receive or send timeout (SO_RCVTIMEO/SO_SNDTIMEO expired) - non-terminal */
+        timeout,
+
+        /** Operation interrupted by signal (EINTR) - non-terminal */
+        interrupted
+    };
+
+    /** Current state */
+    State state{State::packet_ready};
+
+    /** Size of the last framed packet in bytes (from its header) */
+    size_t packet_size{0};
+
+    /**
+     * Bytes received but not yet returned as packets
+     *
+     * After socket_closed, a non-zero value is a partial packet cut off by the peer.
+     */
+    size_t buffered_bytes{0};
+
+    /** VRT header of the last framed packet in host byte order */
+    uint32_t header{0};
+
+    /** Packet type decoded from header */
+    PacketType packet_type{PacketType::signal_data_no_id};
+
+    /** Platform errno value for socket_error and timeout states */
+    int errno_value{0};
+
+    /**
+     * @brief Check if the stream is in a terminal state
+     *
+     * @return true if the connection is closed, failed, or out of sync
+     */
+    bool is_terminal() const noexcept {
+        return state == State::socket_closed || state == State::socket_error ||
+               state == State::framing_error;
+    }
+};
+
+/**
+ * @brief Convert TCPTransportStatus::State to human-readable string
+ *
+ * @param state The transport state to convert
+ * @return String representation of the state
+ */
+constexpr const char* transport_state_string(TCPTransportStatus::State state) noexcept {
+    switch (state) {
+        case TCPTransportStatus::State::packet_ready:
+            return "packet_ready";
+        case TCPTransportStatus::State::socket_closed:
+            return "socket_closed";
+        case TCPTransportStatus::State::socket_error:
+            return "socket_error";
+        case TCPTransportStatus::State::framing_error:
+            return "framing_error";
+        case TCPTransportStatus::State::packet_oversized:
+            return "packet_oversized";
+        case TCPTransportStatus::State::timeout:
+            return "timeout";
+        case TCPTransportStatus::State::interrupted:
+            return "interrupted";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace vrtigo::utils::netio
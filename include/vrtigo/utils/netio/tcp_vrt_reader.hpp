@@ -0,0 +1,463 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// Linux/POSIX socket headers
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "../../detail/endian.hpp"
+#include "../../detail/header_decode.hpp"
+#include "../../detail/packet_parser.hpp"
+#include "../../detail/packet_variant.hpp"
+#include "../../types.hpp"
+#include "../detail/instrumentation.hpp"
+#include "../detail/iteration_helpers.hpp"
+#include "socket_address.hpp"
+#include "tcp_transport_status.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief TCP VRT packet reader with zero-copy framing (Linux/POSIX)
+ *
+ * Reads VRT packets from a TCP byte stream, where packet boundaries come from the header
+ * size field instead of datagram boundaries. Implements the PacketReader concept, so the
+ * iteration helpers (for_each_validated_packet, for_each_data_packet, ...) work as they do
+ * for the file and UDP readers.
+ *
+ * **Ring Buffer**
+ *
+ * Received bytes go into a power-of-two ring buffer with readv(), filling both free
+ * segments in one call, so a single syscall usually delivers many packets. Each packet is
+ * returned as a view directly into the ring. Only a packet that straddles the wrap point
+ * is copied, into a MaxPacketWords scratch buffer; wrapped_packets() counts these copies.
+ * Packets always start on a word boundary of the ring, so the header word itself never
+ * straddles.
+ *
+ * **Framing Errors**
+ *
+ * A packet larger than MaxPacketWords is returned as InvalidPacket (buffer_too_small,
+ * state packet_oversized) and its bytes are skipped as they arrive, so iteration
+ * continues. A size field of 0 cannot be skipped: the stream is out of sync, the state
+ * becomes framing_error, and the reader stops.
+ *
+ * @tparam MaxPacketWords Maximum packet size in 32-bit words (default: 65535)
+ *
+ * @warning This class is MOVE-ONLY. Returned views are valid until the next read.
+ *
+ * Example usage:
+ * @code
+ * TCPVRTReader<> reader("10.0.0.5", 50000);
+ * reader.for_each_data_packet([](const vrtigo::RuntimeDataPacket& pkt) {
+ *     auto payload = pkt.payload();
+ *     return true;
+ * });
+ * @endcode
+ */
+template <uint16_t MaxPacketWords = 65535>
+class TCPVRTReader {
+    static_assert(MaxPacketWords > 0, "MaxPacketWords must be positive");
+    static_assert(MaxPacketWords <= max_packet_words,
+                  "MaxPacketWords exceeds VRT specification maximum (65535)");
+
+public:
+    static constexpr size_t max_packet_bytes = size_t(MaxPacketWords) * vrt_word_size;
+    static constexpr size_t default_ring_bytes = 1024 * 1024; ///< Default ring capacity
+
+    /**
+     * @brief Connect to a TCP server
+     *
+     * @param host Server hostname or IP address (IPv4 or IPv6)
+     * @param port Server TCP port
+     * @param ring_bytes Ring buffer capacity, rounded up to a power of two of at least
+     *        max_packet_bytes
+     * @throws std::runtime_error if resolution or connect fails
+     */
+    TCPVRTReader(const std::string& host, uint16_t port, size_t ring_bytes = default_ring_bytes)
+        : TCPVRTReader(connect(host, port), true, ring_bytes) {}
+
+    /**
+     * @brief Create TCP reader on a connected (or accepted) stream socket
+     *
+     * The socket MUST be in blocking mode.
+     *
+     * @param socket_fd Connected stream socket
+     * @param take_ownership If true, socket will be closed in destructor
+     * @param ring_bytes Ring buffer capacity (see above)
+     * @throws std::runtime_error if the descriptor is invalid
+     */
+    explicit TCPVRTReader(int socket_fd, bool take_ownership = false,
+                          size_t ring_bytes = default_ring_bytes)
+        : socket_(socket_fd),
+          owns_socket_(take_ownership),
+          capacity_(ring_capacity_for(ring_bytes)),
+          ring_(std::make_unique<uint32_t[]>(capacity_ / vrt_word_size)),
+          straddle_(std::make_unique<uint32_t[]>(MaxPacketWords)) {
+        if (socket_ < 0) {
+            throw std::runtime_error("Invalid socket file descriptor");
+        }
+    }
+
+    /**
+     * @brief Destructor - closes socket if owned
+     */
+    ~TCPVRTReader() noexcept {
+        if (owns_socket_ && socket_ >= 0) {
+            ::close(socket_);
+        }
+    }
+
+    // Non-copyable (due to socket and ring buffer)
+    TCPVRTReader(const TCPVRTReader&) = delete;
+    TCPVRTReader& operator=(const TCPVRTReader&) = delete;
+
+    // Move-only semantics
+    TCPVRTReader(TCPVRTReader&& other) noexcept
+        : socket_(std::exchange(other.socket_, -1)),
+          owns_socket_(std::exchange(other.owns_socket_, false)),
+          capacity_(other.capacity_),
+          ring_(std::move(other.ring_)),
+          straddle_(std::move(other.straddle_)),
+          head_(other.head_),
+          tail_(other.tail_),
+          consume_(other.consume_),
+          skip_(other.skip_),
+          wrapped_packets_(other.wrapped_packets_),
+          status_(other.status_),
+          instrumentation_(std::move(other.instrumentation_)) {}
+
+    TCPVRTReader& operator=(TCPVRTReader&& other) noexcept {
+        if (this != &other) {
+            if (owns_socket_ && socket_ >= 0) {
+                ::close(socket_);
+            }
+            socket_ = std::exchange(other.socket_, -1);
+            owns_socket_ = std::exchange(other.owns_socket_, false);
+            capacity_ = other.capacity_;
+            ring_ = std::move(other.ring_);
+            straddle_ = std::move(other.straddle_);
+            head_ = other.head_;
+            tail_ = other.tail_;
+            consume_ = other.consume_;
+            skip_ = other.skip_;
+            wrapped_packets_ = other.wrapped_packets_;
+            status_ = other.status_;
+            instrumentation_ = std::move(other.instrumentation_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Read next packet as validated view
+     *
+     * Blocks until a whole packet is buffered, validates it, and returns a type-safe
+     * variant viewing the ring buffer (or the wrap scratch buffer).
+     *
+     * @return PacketVariant (RuntimeDataPacket, RuntimeContextPacket, or InvalidPacket),
+     *         or std::nullopt on closure, framing error, fatal error, or timeout
+     *
+     * @note After a timeout or interruption, buffered bytes are kept and the next call
+     *       resumes where this one stopped.
+     * @note The returned view is valid until the next read operation.
+     */
+    std::optional<vrtigo::PacketVariant> read_next_packet() noexcept {
+        if (socket_ < 0 || status_.is_terminal()) {
+            return std::nullopt;
+        }
+
+        // Release the packet returned by the previous call
+        head_ += consume_;
+        consume_ = 0;
+
+        while (true) {
+            size_t available = tail_ - head_;
+
+            // Discard the remainder of an oversized packet
+            if (skip_ > 0) {
+                size_t dropped = std::min(skip_, available);
+                head_ += dropped;
+                skip_ -= dropped;
+                available -= dropped;
+                if (skip_ > 0) {
+                    if (!fill()) {
+                        return std::nullopt;
+                    }
+                    continue;
+                }
+            }
+
+            if (available >= vrt_word_size) {
+                uint32_t header = vrtigo::detail::network_to_host32(ring_[offset(head_) / 4]);
+                auto decoded = vrtigo::detail::decode_header(header);
+                size_t size = size_t(decoded.size_words) * vrt_word_size;
+                status_.header = header;
+                status_.packet_type = decoded.type;
+                status_.packet_size = size;
+
+                if (size == 0) {
+                    status_.state = TCPTransportStatus::State::framing_error;
+                    status_.buffered_bytes = available;
+                    instrumentation_.record_error(ValidationError::size_field_mismatch);
+                    return std::nullopt;
+                }
+
+                if (decoded.size_words > MaxPacketWords) {
+                    // Report the header and skip the body as it arrives
+                    instrumentation_.record_truncation();
+                    std::span<const uint8_t> header_bytes(bytes_at(head_), vrt_word_size);
+                    skip_ = size;
+                    status_.state = TCPTransportStatus::State::packet_oversized;
+                    status_.buffered_bytes = available;
+                    return vrtigo::PacketVariant{vrtigo::InvalidPacket{
+                        ValidationError::buffer_too_small, decoded.type, decoded, header_bytes}};
+                }
+
+                if (available >= size) {
+                    consume_ = size;
+                    status_.state = TCPTransportStatus::State::packet_ready;
+                    status_.buffered_bytes = available - size;
+                    status_.errno_value = 0;
+
+                    const auto received = instrumentation_.now();
+                    auto packet = vrtigo::detail::parse_packet(packet_bytes(size));
+                    instrumentation_.record_received(packet, size, received);
+                    return packet;
+                }
+            }
+
+            if (!fill()) {
+                return std::nullopt;
+            }
+        }
+    }
+
+    /**
+     * @brief Iterate over all packets with automatic validation
+     *
+     * @tparam Callback Function type with signature: bool(const PacketVariant&)
+     * @param callback Function called for each packet. Return false to stop iteration.
+     * @return Number of packets processed
+     */
+    template <typename Callback>
+    size_t for_each_validated_packet(Callback&& callback) noexcept {
+        return detail::for_each_validated_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over data packets only (signal/extension data)
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::RuntimeDataPacket&)
+     * @param callback Function called for each data packet. Return false to stop.
+     * @return Number of data packets processed
+     */
+    template <typename Callback>
+    size_t for_each_data_packet(Callback&& callback) noexcept {
+        return detail::for_each_data_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over context packets only (context/extension context)
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::RuntimeContextPacket&)
+     * @param callback Function called for each context packet. Return false to stop.
+     * @return Number of context packets processed
+     */
+    template <typename Callback>
+    size_t for_each_context_packet(Callback&& callback) noexcept {
+        return detail::for_each_context_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over packets with a specific stream ID
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::PacketVariant&)
+     * @param stream_id_filter The stream ID to filter by
+     * @param callback Function called for each matching packet. Return false to stop.
+     * @return Number of matching packets processed
+     */
+    template <typename Callback>
+    size_t for_each_packet_with_stream_id(uint32_t stream_id_filter,
+                                          Callback&& callback) noexcept {
+        return detail::for_each_packet_with_stream_id(*this, stream_id_filter,
+                                                      std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Get transport status
+     *
+     * @return Status of the last read
+     */
+    const TCPTransportStatus& transport_status() const noexcept { return status_; }
+
+    /**
+     * @brief Get reader counters and latency histograms
+     *
+     * Oversized packets count as truncations. Empty unless built with
+     * VRTIGO_ENABLE_INSTRUMENTATION=1.
+     *
+     * @return Instrumentation owned by this reader
+     */
+    const detail::Instrumentation& instrumentation() const noexcept { return instrumentation_; }
+
+    /**
+     * @brief Set receive timeout
+     *
+     * @param timeout Timeout duration (0 = no timeout)
+     * @return true on success, false on failure
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        struct timeval tv {};
+        tv.tv_sec = timeout.count() / 1000;
+        tv.tv_usec = (timeout.count() % 1000) * 1000;
+
+        return ::setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) >= 0;
+    }
+
+    /**
+     * @brief Set socket receive buffer size (SO_RCVBUF)
+     *
+     * @param bytes Requested buffer size in bytes
+     * @return true on success, false on failure
+     */
+    bool try_set_receive_buffer_size(size_t bytes) noexcept {
+        int size = static_cast<int>(bytes);
+        return ::setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)) >= 0;
+    }
+
+    /**
+     * @brief Ring buffer capacity in bytes (a power of two)
+     */
+    size_t ring_capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Number of packets copied because they straddled the ring's wrap point
+     */
+    uint64_t wrapped_packets() const noexcept { return wrapped_packets_; }
+
+    /**
+     * @brief Check if socket is still valid
+     *
+     * @return true if socket is open and not in a terminal state
+     */
+    bool is_open() const noexcept { return socket_ >= 0 && !status_.is_terminal(); }
+
+    /**
+     * @brief Get underlying socket file descriptor
+     *
+     * @return Socket file descriptor
+     */
+    int socket_fd() const noexcept { return socket_; }
+
+private:
+    static int connect(const std::string& host, uint16_t port) {
+        int fd = detail::connect_tcp_socket(SocketAddress::resolve(host, port));
+        if (fd < 0) {
+            throw std::runtime_error("Failed to connect TCP socket to " + host + ":" +
+                                     std::to_string(port) + ": " + std::strerror(errno));
+        }
+        return fd;
+    }
+
+    static size_t ring_capacity_for(size_t requested) noexcept {
+        size_t capacity = vrt_word_size;
+        while (capacity < std::max(requested, max_packet_bytes)) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    size_t offset(uint64_t position) const noexcept {
+        return static_cast<size_t>(position) & (capacity_ - 1);
+    }
+
+    uint8_t* bytes_at(uint64_t position) const noexcept {
+        return reinterpret_cast<uint8_t*>(ring_.get()) + offset(position);
+    }
+
+    /**
+     * @brief Bytes of the packet at head_, copied into the scratch buffer if it wraps
+     */
+    std::span<const uint8_t> packet_bytes(size_t size) noexcept {
+        size_t start = offset(head_);
+        if (start + size <= capacity_) {
+            return {bytes_at(head_), size};
+        }
+        auto* scratch = reinterpret_cast<uint8_t*>(straddle_.get());
+        size_t first = capacity_ - start;
+        std::memcpy(scratch, bytes_at(head_), first);
+        std::memcpy(scratch + first, ring_.get(), size - first);
+        ++wrapped_packets_;
+        return {scratch, size};
+    }
+
+    /**
+     * @brief Receive into the free part of the ring (up to two segments, one readv())
+     *
+     * @return true if bytes were added; false with status_ updated otherwise
+     */
+    bool fill() noexcept {
+        size_t used = tail_ - head_;
+        size_t free_bytes = capacity_ - used;
+        size_t start = offset(tail_);
+        size_t first = std::min(free_bytes, capacity_ - start);
+
+        struct iovec iov[2] = {{bytes_at(tail_), first},
+                               {ring_.get(), free_bytes - first}};
+        ssize_t received = ::readv(socket_, iov, free_bytes > first ? 2 : 1);
+
+        status_.buffered_bytes = used;
+        if (received > 0) {
+            tail_ += static_cast<uint64_t>(received);
+            return true;
+        }
+        if (received == 0) {
+            status_.state = TCPTransportStatus::State::socket_closed;
+            status_.errno_value = 0;
+            return false;
+        }
+
+        int err = errno;
+        status_.errno_value = err;
+        if (err == EAGAIN || err == EWOULDBLOCK) {
+            status_.state = TCPTransportStatus::State::timeout;
+            instrumentation_.record_timeout();
+        } else if (err == EINTR) {
+            status_.state = TCPTransportStatus::State::interrupted;
+        } else {
+            status_.state = TCPTransportStatus::State::socket_error;
+            instrumentation_.record_io_error();
+        }
+        return false;
+    }
+
+    int socket_;                           ///< Socket file descriptor
+    bool owns_socket_;                     ///< Close socket in destructor
+    size_t capacity_;                      ///< Ring capacity in bytes (power of two)
+    std::unique_ptr<uint32_t[]> ring_;     ///< Receive ring (word-aligned)
+    std::unique_ptr<uint32_t[]> straddle_; ///< Scratch for packets crossing the wrap point
+    uint64_t head_ = 0;                    ///< Stream offset of the next unread byte
+    uint64_t tail_ = 0;                    ///< Stream offset one past the last received byte
+    size_t consume_ = 0;                   ///< Size of the packet returned last (released next)
+    size_t skip_ = 0;                      ///< Bytes of an oversized packet still to discard
+    uint64_t wrapped_packets_ = 0;         ///< Packets copied at the wrap point
+    TCPTransportStatus status_{};          ///< Transport status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
+};
+
+} // namespace vrtigo::utils::netio
@@ -0,0 +1,501 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// Linux/POSIX socket headers
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "vrtigo/detail/packet_concepts.hpp"
+#include "vrtigo/detail/packet_variant.hpp"
+#include "vrtigo/packet_handle.hpp"
+#include "vrtigo/utils/detail/instrumentation.hpp"
+#include "vrtigo/utils/detail/writer_concepts.hpp"
+#include "vrtigo/utils/netio/socket_address.hpp"
+#include "vrtigo/utils/netio/tcp_transport_status.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief TCP VRT packet writer with gather-write coalescing (Linux/POSIX)
+ *
+ * Writes VRT packets back to back on a TCP stream; the receiver frames them by the header
+ * size field (see TCPVRTReader).
+ *
+ * Coalescing:
+ * - write_packet() copies packets into a staging buffer until the next packet would
+ *   exceed coalesce_bytes(); staged bytes and that packet then go out together in one
+ *   gather write, so the packet itself is not copied
+ * - write_packets() sends a whole range with gather writes pointing at the packet bytes
+ *   (up to IOV_MAX packets per syscall, no copies)
+ * - flush() sends whatever is staged; the destructor flushes best effort
+ * - set_coalesce_bytes(0) sends every packet immediately
+ *
+ * Gather writes use sendmsg() with MSG_NOSIGNAL (writev() semantics without SIGPIPE).
+ * Partial writes are resumed. If a send fails or times out, the call returns false but
+ * the packet is still accepted: its unsent bytes stay staged, so a later flush()
+ * continues the stream without tearing or repeating a packet. Do not write it again.
+ *
+ * Satisfies the FlushableWriter concept.
+ *
+ * Example usage:
+ * @code
+ * TCPVRTWriter writer("10.0.0.5", 50000);
+ * for (...) {
+ *     writer.write_packet(packet); // staged, sent in batches
+ * }
+ * writer.flush();
+ * @endcode
+ */
+class TCPVRTWriter {
+public:
+    static constexpr size_t default_coalesce_bytes = 64 * 1024; ///< Default staging limit
+
+    /**
+     * @brief Connect to a TCP server
+     *
+     * @param host Server hostname or IP address (IPv4 or IPv6)
+     * @param port Server TCP port
+     * @throws std::runtime_error if resolution or connect fails
+     */
+    TCPVRTWriter(const std::string& host, uint16_t port)
+        : TCPVRTWriter(connect(host, port), true) {}
+
+    /**
+     * @brief Create writer on a connected (or accepted) stream socket
+     *
+     * @param socket_fd Connected stream socket
+     * @param take_ownership If true, socket will be closed in destructor
+     * @throws std::runtime_error if the descriptor is invalid
+     */
+    explicit TCPVRTWriter(int socket_fd, bool take_ownership = false)
+        : socket_(socket_fd),
+          owns_socket_(take_ownership) {
+        if (socket_ < 0) {
+            throw std::runtime_error("Invalid socket file descriptor");
+        }
+        staging_.reserve(coalesce_bytes_);
+    }
+
+    /**
+     * @brief Destructor - flushes staged packets (best effort) and closes owned socket
+     */
+    ~TCPVRTWriter() noexcept {
+        if (socket_ >= 0) {
+            flush();
+            if (owns_socket_) {
+                ::close(socket_);
+            }
+        }
+    }
+
+    // Non-copyable
+    TCPVRTWriter(const TCPVRTWriter&) = delete;
+    TCPVRTWriter& operator=(const TCPVRTWriter&) = delete;
+
+    // Move-only semantics
+    TCPVRTWriter(TCPVRTWriter&& other) noexcept
+        : socket_(std::exchange(other.socket_, -1)),
+          owns_socket_(std::exchange(other.owns_socket_, false)),
+          coalesce_bytes_(other.coalesce_bytes_),
+          staging_(std::move(other.staging_)),
+          packets_written_(other.packets_written_),
+          bytes_written_(other.bytes_written_),
+          syscalls_(other.syscalls_),
+          status_(other.status_),
+          instrumentation_(std::move(other.instrumentation_)) {}
+
+    TCPVRTWriter& operator=(TCPVRTWriter&& other) noexcept {
+        if (this != &other) {
+            if (socket_ >= 0) {
+                flush();
+                if (owns_socket_) {
+                    ::close(socket_);
+                }
+            }
+            socket_ = std::exchange(other.socket_, -1);
+            owns_socket_ = std::exchange(other.owns_socket_, false);
+            coalesce_bytes_ = other.coalesce_bytes_;
+            staging_ = std::move(other.staging_);
+            packets_written_ = other.packets_written_;
+            bytes_written_ = other.bytes_written_;
+            syscalls_ = other.syscalls_;
+            status_ = other.status_;
+            instrumentation_ = std::move(other.instrumentation_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Write packet from variant
+     *
+     * @param packet The packet variant to write
+     * @return true on success (staged or sent), false on error or invalid packet
+     */
+    bool write_packet(const vrtigo::PacketVariant& packet) noexcept {
+        auto bytes = packet_bytes(packet);
+        if (bytes.empty()) {
+            status_.state = TCPTransportStatus::State::socket_error;
+            status_.errno_value = EINVAL;
+            return false;
+        }
+        return write_bytes(bytes);
+    }
+
+    /**
+     * @brief Write RuntimeDataPacket
+     */
+    bool write_packet(const vrtigo::RuntimeDataPacket& packet) noexcept {
+        return write_bytes(packet.as_bytes());
+    }
+
+    /**
+     * @brief Write RuntimeContextPacket
+     */
+    bool write_packet(const vrtigo::RuntimeContextPacket& packet) noexcept {
+        return write_bytes({packet.context_buffer(), packet.packet_size_bytes()});
+    }
+
+    /**
+     * @brief Write compile-time packet
+     *
+     * @tparam PacketType Type satisfying CompileTimePacket concept
+     */
+    template <typename PacketType>
+        requires vrtigo::CompileTimePacket<PacketType>
+    bool write_packet(const PacketType& packet) noexcept {
+        return write_bytes(packet.as_bytes());
+    }
+
+    /**
+     * @brief Write a batch of packets with zero-copy gather writes
+     *
+     * Sends any staged bytes followed by every packet in the range, IOV_MAX buffers per
+     * syscall, pointing directly at the packet bytes. The packets need only stay valid
+     * for the duration of the call. InvalidPacket entries stop the batch.
+     *
+     * @param packets Packets to write, in order
+     * @return Number of packets accepted; less than packets.size() only if an InvalidPacket
+     *         stopped the batch. On a send failure the unsent bytes stay staged and
+     *         transport_status() reports the error.
+     */
+    size_t write_packets(std::span<const vrtigo::PacketVariant> packets) noexcept {
+        return write_batch(packets);
+    }
+
+    /**
+     * @brief Write a batch of packet handles
+     *
+     * Same semantics as the PacketVariant overload; invalid handles stop the batch.
+     */
+    size_t write_packets(std::span<const vrtigo::PacketHandle> packets) noexcept {
+        return write_batch(packets);
+    }
+
+    /**
+     * @brief Send all staged packets
+     *
+     * @return true if nothing remains staged, false on error or timeout
+     */
+    bool flush() noexcept {
+        if (staging_.empty()) {
+            return true;
+        }
+        struct iovec iov {staging_.data(), staging_.size()};
+        return send_all(&iov, 1);
+    }
+
+    /**
+     * @brief Set the staging limit for write_packet()
+     *
+     * @param bytes Bytes to accumulate before sending (0 = send every packet immediately)
+     */
+    void set_coalesce_bytes(size_t bytes) noexcept { coalesce_bytes_ = bytes; }
+
+    /**
+     * @brief Get the staging limit for write_packet()
+     */
+    [[nodiscard]] size_t coalesce_bytes() const noexcept { return coalesce_bytes_; }
+
+    /**
+     * @brief Bytes accepted but not yet sent
+     */
+    [[nodiscard]] size_t staged_bytes() const noexcept { return staging_.size(); }
+
+    /**
+     * @brief Disable or enable Nagle's algorithm (TCP_NODELAY)
+     *
+     * The writer batches on its own, so disabling Nagle usually lowers latency without
+     * adding small segments.
+     *
+     * @param enable true to set TCP_NODELAY
+     * @return true on success, false on failure
+     */
+    bool try_set_no_delay(bool enable = true) noexcept {
+        int value = enable ? 1 : 0;
+        return ::setsockopt(socket_, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value)) >= 0;
+    }
+
+    /**
+     * @brief Set send timeout (SO_SNDTIMEO)
+     *
+     * @param timeout Timeout duration (0 = no timeout)
+     * @return true on success, false on failure
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        struct timeval tv {};
+        tv.tv_sec = timeout.count() / 1000;
+        tv.tv_usec = (timeout.count() % 1000) * 1000;
+
+        return ::setsockopt(socket_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) >= 0;
+    }
+
+    /**
+     * @brief Set socket send buffer size (SO_SNDBUF)
+     *
+     * @param bytes Requested buffer size in bytes
+     * @return true on success, false on failure
+     */
+    bool try_set_send_buffer_size(size_t bytes) noexcept {
+        int size = static_cast<int>(bytes);
+        return ::setsockopt(socket_, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)) >= 0;
+    }
+
+    /**
+     * @brief Get number of packets written (including staged ones)
+     */
+    [[nodiscard]] size_t packets_written() const noexcept { return packets_written_; }
+
+    /**
+     * @brief Get number of bytes written (including staged ones)
+     */
+    [[nodiscard]] size_t bytes_written() const noexcept { return bytes_written_; }
+
+    /**
+     * @brief Get number of send syscalls issued
+     *
+     * Compare with packets_written() to see how well packets coalesce.
+     */
+    [[nodiscard]] size_t send_calls() const noexcept { return syscalls_; }
+
+    /**
+     * @brief Get transport status
+     */
+    [[nodiscard]] const TCPTransportStatus& transport_status() const noexcept { return status_; }
+
+    /**
+     * @brief Get writer counters and latency histograms
+     *
+     * Packets are counted when accepted; the build-to-send histogram measures up to the
+     * syscall that sent (or staged) them. Empty unless built with
+     * VRTIGO_ENABLE_INSTRUMENTATION=1.
+     */
+    [[nodiscard]] const detail::Instrumentation& instrumentation() const noexcept {
+        return instrumentation_;
+    }
+
+    /**
+     * @brief Check if socket is still valid
+     */
+    [[nodiscard]] bool is_open() const noexcept { return socket_ >= 0 && !status_.is_terminal(); }
+
+    /**
+     * @brief Get underlying socket file descriptor
+     */
+    [[nodiscard]] int socket_fd() const noexcept { return socket_; }
+
+private:
+    static int connect(const std::string& host, uint16_t port) {
+        int fd = detail::connect_tcp_socket(SocketAddress::resolve(host, port));
+        if (fd < 0) {
+            throw std::runtime_error("Failed to connect TCP socket to " + host + ":" +
+                                     std::to_string(port) + ": " + std::strerror(errno));
+        }
+        return fd;
+    }
+
+    /**
+     * @brief Bytes of a runtime packet (empty for InvalidPacket)
+     */
+    static std::span<const uint8_t> packet_bytes(const vrtigo::PacketVariant& packet) noexcept {
+        return std::visit(
+            [](auto&& pkt) -> std::span<const uint8_t> {
+                using T = std::decay_t<decltype(pkt)>;
+
+                if constexpr (std::is_same_v<T, vrtigo::RuntimeDataPacket>) {
+                    return pkt.as_bytes();
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
+                    // RuntimeContextPacket uses context_buffer() instead of as_bytes()
+                    return {pkt.context_buffer(), pkt.packet_size_bytes()};
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    return pkt.as_bytes();
+                } else {
+                    return {};
+                }
+            },
+            packet);
+    }
+
+    static std::span<const uint8_t> packet_bytes(const vrtigo::PacketHandle& packet) noexcept {
+        return packet.as_bytes();
+    }
+
+    /**
+     * @brief Shared body of the write_packets() overloads
+     */
+    template <typename Packet>
+    size_t write_batch(std::span<const Packet> packets) noexcept {
+        iovecs_.clear();
+        size_t staged = staging_.size();
+        if (staged > 0) {
+            iovecs_.push_back({staging_.data(), staged});
+        }
+
+        size_t accepted = 0;
+        for (const auto& packet : packets) {
+            auto bytes = packet_bytes(packet);
+            if (bytes.empty()) {
+                status_.state = TCPTransportStatus::State::socket_error;
+                status_.errno_value = EINVAL;
+                break;
+            }
+            iovecs_.push_back({const_cast<uint8_t*>(bytes.data()), bytes.size()});
+            ++accepted;
+        }
+
+        const auto handed_off = instrumentation_.now();
+        if (send_all(iovecs_.data(), iovecs_.size()) && accepted < packets.size()) {
+            // Report the InvalidPacket that stopped the batch
+            status_.state = TCPTransportStatus::State::socket_error;
+            status_.errno_value = EINVAL;
+        }
+        for (size_t i = 0; i < accepted; ++i) {
+            auto bytes = packet_bytes(packets[i]);
+            ++packets_written_;
+            bytes_written_ += bytes.size();
+            instrumentation_.record_sent(bytes, handed_off);
+        }
+        return accepted;
+    }
+
+    /**
+     * @brief Stage a packet, or send staged bytes plus the packet in one gather write
+     */
+    bool write_bytes(std::span<const uint8_t> bytes) noexcept {
+        const auto handed_off = instrumentation_.now();
+        bool sent = true;
+        if (staging_.size() + bytes.size() <= coalesce_bytes_) {
+            staging_.insert(staging_.end(), bytes.begin(), bytes.end());
+            status_.state = TCPTransportStatus::State::packet_ready;
+        } else {
+            struct iovec iov[2] = {{staging_.data(), staging_.size()},
+                                   {const_cast<uint8_t*>(bytes.data()), bytes.size()}};
+            bool has_staged = !staging_.empty();
+            sent = send_all(has_staged ? iov : iov + 1, has_staged ? 2 : 1);
+        }
+        ++packets_written_;
+        bytes_written_ += bytes.size();
+        instrumentation_.record_sent(bytes, handed_off);
+        return sent;
+    }
+
+    /**
+     * @brief Send every buffer, resuming partial writes
+     *
+     * The buffers may include staging_ (as the first entry). On success staging_ is
+     * empty; on failure it holds exactly the bytes that were not sent.
+     */
+    bool send_all(struct iovec* iov, size_t count) noexcept {
+        bool failed = false;
+        while (count > 0) {
+            struct msghdr msg {};
+            msg.msg_iov = iov;
+            msg.msg_iovlen = std::min<size_t>(count, IOV_MAX);
+            ssize_t sent = ::sendmsg(socket_, &msg, MSG_NOSIGNAL);
+            ++syscalls_;
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                record_send_error(errno);
+                failed = true;
+                break;
+            }
+
+            // Advance past fully sent buffers, then into a partially sent one
+            auto remaining = static_cast<size_t>(sent);
+            while (count > 0 && remaining >= iov->iov_len) {
+                remaining -= iov->iov_len;
+                ++iov;
+                --count;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<uint8_t*>(iov->iov_base) + remaining;
+                iov->iov_len -= remaining;
+            }
+        }
+
+        if (!failed) {
+            staging_.clear();
+            status_.state = TCPTransportStatus::State::packet_ready;
+            status_.errno_value = 0;
+            return true;
+        }
+
+        // Keep unsent bytes staged so the stream can resume without a torn packet
+        std::vector<uint8_t> unsent;
+        unsent.reserve(coalesce_bytes_);
+        for (size_t i = 0; i < count; ++i) {
+            const auto* base = static_cast<const uint8_t*>(iov[i].iov_base);
+            unsent.insert(unsent.end(), base, base + iov[i].iov_len);
+        }
+        staging_.swap(unsent);
+        return false;
+    }
+
+    void record_send_error(int err) noexcept {
+        status_.errno_value = err;
+        if (err == EAGAIN || err == EWOULDBLOCK) {
+            status_.state = TCPTransportStatus::State::timeout;
+            instrumentation_.record_timeout();
+        } else if (err == EPIPE || err == ECONNRESET) {
+            status_.state = TCPTransportStatus::State::socket_closed;
+            instrumentation_.record_io_error();
+        } else {
+            status_.state = TCPTransportStatus::State::socket_error;
+            instrumentation_.record_io_error();
+        }
+    }
+
+    int socket_;                                     ///< Socket file descriptor
+    bool owns_socket_;                               ///< Close socket in destructor
+    size_t coalesce_bytes_ = default_coalesce_bytes; ///< Staging limit for write_packet()
+    std::vector<uint8_t> staging_;                   ///< Packets accepted but not yet sent
+    std::vector<struct iovec> iovecs_;               ///< Gather list for write_packets()
+    size_t packets_written_ = 0;                     ///< Packets accepted
+    size_t bytes_written_ = 0;                       ///< Bytes accepted
+    size_t syscalls_ = 0;                            ///< sendmsg() calls issued
+    TCPTransportStatus status_{};                    ///< Transport status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
+};
+
+static_assert(detail::FlushableWriter<TCPVRTWriter>);
+
+} // namespace vrtigo::utils::netio
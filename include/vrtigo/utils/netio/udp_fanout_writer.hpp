@@ -0,0 +1,757 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// Linux socket headers (sendmmsg, IP_RECVERR error queue)
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "vrtigo/detail/packet_concepts.hpp"
+#include "vrtigo/detail/packet_variant.hpp"
+#include "vrtigo/packet_handle.hpp"
+#include "vrtigo/utils/detail/instrumentation.hpp"
+#include "vrtigo/utils/detail/writer_concepts.hpp"
+#include "vrtigo/utils/netio/socket_address.hpp"
+#include "vrtigo/utils/netio/udp_transport_status.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Back-off applied to a subscriber after failed sends
+ *
+ * After the n-th consecutive failure the subscriber is skipped for
+ * min(initial * 2^(n-1), max); the first send after that is a probe. ICMP errors arrive
+ * after the send, so a delivered datagram clears the failure count only if no error for
+ * it has been reported by the start of the next write.
+ */
+struct FanoutBackoff {
+    std::chrono::milliseconds initial{10}; ///< Skip time after the first failure (0 = never skip)
+    std::chrono::milliseconds max{5000};   ///< Upper bound on the skip time
+};
+
+/**
+ * @brief Destination of a UDPFanoutWriter and its delivery counters
+ */
+struct FanoutSubscriber {
+    uint32_t id = 0;                   ///< Handle returned by add_subscriber()
+    SocketAddress address;             ///< Destination (v4-mapped on dual-stack writers)
+    uint64_t packets_sent = 0;         ///< Datagrams accepted by the kernel
+    uint64_t bytes_sent = 0;           ///< Bytes accepted by the kernel
+    uint64_t packets_skipped = 0;      ///< Packets not sent while backing off or after a stall
+    uint64_t errors = 0;               ///< Failed sends, including ICMP errors reported later
+    uint32_t consecutive_failures = 0; ///< Failures since the last confirmed delivery
+    int last_errno = 0;                ///< errno of the most recent failure
+
+    /// End of the current back-off (sends resume at or after this time)
+    std::chrono::steady_clock::time_point retry_after{};
+
+    /// True while sends to this subscriber are suspended
+    bool backing_off(std::chrono::steady_clock::time_point now) const noexcept {
+        return now < retry_after;
+    }
+};
+
+/**
+ * @brief UDP writer distributing each packet to a table of subscribers (Linux)
+ *
+ * Sending one stream to N receivers with UDPVRTWriter takes N sendto() calls per packet.
+ * This writer builds one mmsghdr per (packet, subscriber) pair and hands a whole batch to
+ * the kernel with sendmmsg(), up to 1024 datagrams per syscall. All entries for a packet
+ * share one iovec pointing at the packet bytes, so nothing is copied in user space.
+ *
+ * Per-subscriber errors:
+ * - Synchronous failures (no route, rejected address, ...) are charged to the entry's
+ *   subscriber and the rest of the batch continues
+ * - IP_RECVERR is enabled, so ICMP errors such as port unreachable are queued with the
+ *   original destination; the writer drains that queue on every call and charges the
+ *   subscriber it names instead of whichever send happened to surface the error
+ * - A failing subscriber is skipped for a growing back-off (FanoutBackoff), so a dead
+ *   receiver costs one probe per back-off period instead of a failed send per packet
+ * - transport_status() only reports conditions affecting every subscriber: rejected
+ *   packets and a full send buffer or SO_SNDTIMEO expiry (the rest of that batch is
+ *   dropped and counted in packets_skipped)
+ *
+ * Datagrams are ordered packet by packet, so each subscriber sees the batch in order.
+ * Packets exceeding the MTU (default 1500) are rejected.
+ *
+ * Satisfies the FlushableWriter concept (flush() is a no-op).
+ *
+ * Thread Safety:
+ * - Not thread-safe: single thread should own this instance
+ * - Safe to move between threads (move-only)
+ *
+ * Example usage:
+ * @code
+ * UDPFanoutWriter writer;
+ * for (const auto& host : subscribers) {
+ *     writer.add_subscriber(host, 50000);
+ * }
+ * writer.write_packets(batch); // one sendmmsg() for batch.size() * subscribers datagrams
+ * @endcode
+ */
+class UDPFanoutWriter {
+public:
+    static constexpr size_t default_mtu = 1500; ///< Default MTU in bytes
+
+    /// Datagrams per sendmmsg() call (the kernel's UIO_MAXIOV limit)
+    static constexpr size_t max_messages_per_call = 1024;
+
+    /**
+     * @brief Create a fan-out writer bound to a local port
+     *
+     * @param local_port Local port to bind (0 = any port)
+     * @param family Socket family (IPv4, IPv6 only, or dual stack)
+     * @throws std::runtime_error if socket creation or binding fails
+     */
+    explicit UDPFanoutWriter(uint16_t local_port = 0, IPFamily family = IPFamily::ipv4)
+        : socket_(detail::open_udp_socket(family)),
+          family_(family == IPFamily::ipv4 ? AF_INET : AF_INET6),
+          dual_stack_(family == IPFamily::dual_stack) {
+        if (socket_ < 0) {
+            throw std::runtime_error("Failed to create UDP socket");
+        }
+
+        auto addr = SocketAddress::any(family_, local_port);
+        if (::bind(socket_, addr.get(), addr.length()) < 0) {
+            ::close(socket_);
+            throw std::runtime_error("Failed to bind UDP socket to port " +
+                                     std::to_string(local_port));
+        }
+
+        // Without IP_RECVERR an unconnected socket ignores ICMP errors entirely
+        int on = 1;
+        if (family_ == AF_INET6) {
+            if (dual_stack_) {
+                ::setsockopt(socket_, IPPROTO_IP, IP_RECVERR, &on, sizeof(on));
+            }
+            error_queue_ =
+                ::setsockopt(socket_, IPPROTO_IPV6, IPV6_RECVERR, &on, sizeof(on)) == 0;
+        } else {
+            error_queue_ = ::setsockopt(socket_, IPPROTO_IP, IP_RECVERR, &on, sizeof(on)) == 0;
+        }
+    }
+
+    ~UDPFanoutWriter() noexcept {
+        if (socket_ >= 0) {
+            ::close(socket_);
+        }
+    }
+
+    // Move-only (socket ownership)
+    UDPFanoutWriter(const UDPFanoutWriter&) = delete;
+    UDPFanoutWriter& operator=(const UDPFanoutWriter&) = delete;
+
+    UDPFanoutWriter(UDPFanoutWriter&& other) noexcept
+        : socket_(std::exchange(other.socket_, -1)),
+          family_(other.family_),
+          dual_stack_(other.dual_stack_),
+          error_queue_(other.error_queue_),
+          mtu_(other.mtu_),
+          backoff_(other.backoff_),
+          subscribers_(std::move(other.subscribers_)),
+          next_id_(other.next_id_),
+          iovecs_(std::move(other.iovecs_)),
+          messages_(std::move(other.messages_)),
+          targets_(std::move(other.targets_)),
+          delivered_(std::move(other.delivered_)),
+          packets_written_(other.packets_written_),
+          datagrams_sent_(other.datagrams_sent_),
+          bytes_sent_(other.bytes_sent_),
+          subscriber_errors_(other.subscriber_errors_),
+          syscalls_(other.syscalls_),
+          status_(other.status_),
+          instrumentation_(std::move(other.instrumentation_)) {}
+
+    UDPFanoutWriter& operator=(UDPFanoutWriter&& other) noexcept {
+        if (this != &other) {
+            if (socket_ >= 0) {
+                ::close(socket_);
+            }
+            socket_ = std::exchange(other.socket_, -1);
+            family_ = other.family_;
+            dual_stack_ = other.dual_stack_;
+            error_queue_ = other.error_queue_;
+            mtu_ = other.mtu_;
+            backoff_ = other.backoff_;
+            subscribers_ = std::move(other.subscribers_);
+            next_id_ = other.next_id_;
+            iovecs_ = std::move(other.iovecs_);
+            messages_ = std::move(other.messages_);
+            targets_ = std::move(other.targets_);
+            delivered_ = std::move(other.delivered_);
+            packets_written_ = other.packets_written_;
+            datagrams_sent_ = other.datagrams_sent_;
+            bytes_sent_ = other.bytes_sent_;
+            subscriber_errors_ = other.subscriber_errors_;
+            syscalls_ = other.syscalls_;
+            status_ = other.status_;
+            instrumentation_ = std::move(other.instrumentation_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Add a destination
+     *
+     * IPv4 addresses are stored v4-mapped on dual-stack writers. Adding an address that is
+     * already subscribed returns the existing id.
+     *
+     * @param address Destination address and port
+     * @return Subscriber id for find_subscriber() and remove_subscriber()
+     * @throws std::runtime_error if the address is empty or its family cannot be reached
+     *         from this socket
+     */
+    uint32_t add_subscriber(const SocketAddress& address) {
+        if (address.empty()) {
+            throw std::runtime_error("Empty subscriber address");
+        }
+        SocketAddress target = dual_stack_ ? address.to_v4_mapped() : address;
+        if (target.family() != family_) {
+            throw std::runtime_error("Subscriber " + address.to_string() +
+                                     " does not match the socket family");
+        }
+        for (const auto& subscriber : subscribers_) {
+            if (subscriber.address == target) {
+                return subscriber.id;
+            }
+        }
+
+        FanoutSubscriber subscriber;
+        subscriber.id = next_id_++;
+        subscriber.address = target;
+        subscribers_.push_back(subscriber);
+        delivered_.push_back(false);
+        return subscriber.id;
+    }
+
+    /**
+     * @brief Resolve and add a destination
+     *
+     * Dual-stack writers prefer the name's IPv4 address and fall back to IPv6.
+     *
+     * @throws std::runtime_error if the name does not resolve for the socket family
+     */
+    uint32_t add_subscriber(const std::string& host, uint16_t port) {
+        const IPFamily family = family_ == AF_INET ? IPFamily::ipv4
+                                : dual_stack_      ? IPFamily::dual_stack
+                                                   : IPFamily::ipv6;
+        return add_subscriber(SocketAddress::resolve(host, port, family));
+    }
+
+    /**
+     * @brief Remove a destination
+     *
+     * @return false if no subscriber has this id
+     */
+    bool remove_subscriber(uint32_t id) noexcept {
+        auto it = std::find_if(subscribers_.begin(), subscribers_.end(),
+                               [id](const FanoutSubscriber& s) { return s.id == id; });
+        if (it == subscribers_.end()) {
+            return false;
+        }
+        delivered_.erase(delivered_.begin() + (it - subscribers_.begin()));
+        subscribers_.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Look up a subscriber's counters
+     *
+     * @return Pointer valid until the subscriber table changes, or nullptr if unknown
+     */
+    [[nodiscard]] const FanoutSubscriber* find_subscriber(uint32_t id) const noexcept {
+        for (const auto& subscriber : subscribers_) {
+            if (subscriber.id == id) {
+                return &subscriber;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief All subscribers in the order they were added
+     */
+    [[nodiscard]] std::span<const FanoutSubscriber> subscribers() const noexcept {
+        return subscribers_;
+    }
+
+    /**
+     * @brief Write one packet to every subscriber
+     *
+     * @param packet The packet variant to write
+     * @return true if every subscriber not backing off got the datagram
+     */
+    bool write_packet(const vrtigo::PacketVariant& packet) noexcept {
+        return write_one(std::span<const vrtigo::PacketVariant>(&packet, 1));
+    }
+
+    /**
+     * @brief Write a data packet view to every subscriber
+     */
+    bool write_packet(const vrtigo::RuntimeDataPacket& packet) noexcept {
+        vrtigo::PacketVariant variant = packet;
+        return write_packet(variant);
+    }
+
+    /**
+     * @brief Write a context packet view to every subscriber
+     */
+    bool write_packet(const vrtigo::RuntimeContextPacket& packet) noexcept {
+        vrtigo::PacketVariant variant = packet;
+        return write_packet(variant);
+    }
+
+    /**
+     * @brief Write a compile-time packet to every subscriber
+     *
+     * @tparam PacketType Type satisfying CompileTimePacket concept
+     */
+    template <typename PacketType>
+        requires vrtigo::CompileTimePacket<PacketType>
+    bool write_packet(const PacketType& packet) noexcept {
+        auto handle = vrtigo::PacketHandle::parse(packet.as_bytes());
+        return write_one(std::span<const vrtigo::PacketHandle>(&handle, 1));
+    }
+
+    /**
+     * @brief Write a batch of packets to every subscriber
+     *
+     * Sends packets.size() * subscribers datagrams with as few sendmmsg() calls as the
+     * kernel allows. The packets need only stay valid for the duration of the call. An
+     * InvalidPacket or a packet above the MTU stops the batch; the packets before it are
+     * still sent.
+     *
+     * @param packets Packets to write, in order
+     * @return Number of packets accepted; per-subscriber delivery is in subscribers()
+     */
+    size_t write_packets(std::span<const vrtigo::PacketVariant> packets) noexcept {
+        return write_batch(packets);
+    }
+
+    /**
+     * @brief Write a batch of packet handles
+     *
+     * Same semantics as the PacketVariant overload; invalid handles stop the batch.
+     */
+    size_t write_packets(std::span<const vrtigo::PacketHandle> packets) noexcept {
+        return write_batch(packets);
+    }
+
+    /**
+     * @brief Set the back-off for failing subscribers
+     *
+     * Applies from the next failure; current back-offs run out unchanged.
+     */
+    void set_backoff(const FanoutBackoff& backoff) noexcept { backoff_ = backoff; }
+
+    /**
+     * @brief Get the back-off for failing subscribers
+     */
+    [[nodiscard]] const FanoutBackoff& backoff() const noexcept { return backoff_; }
+
+    /**
+     * @brief Set maximum transmission unit
+     *
+     * @param mtu Maximum packet size in bytes
+     */
+    void set_mtu(size_t mtu) noexcept { mtu_ = mtu; }
+
+    /**
+     * @brief Set send timeout (SO_SNDTIMEO)
+     *
+     * Bounds how long a batch may wait for send buffer space; on expiry the rest of the
+     * batch is dropped.
+     *
+     * @param timeout Timeout duration (0 = no timeout)
+     * @return true on success, false on failure
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        struct timeval tv {};
+        tv.tv_sec = timeout.count() / 1000;
+        tv.tv_usec = (timeout.count() % 1000) * 1000;
+
+        return ::setsockopt(socket_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) >= 0;
+    }
+
+    /**
+     * @brief Set socket send buffer size (SO_SNDBUF)
+     *
+     * A batch queues packets * subscribers datagrams at once; size the buffer for it.
+     *
+     * @param bytes Requested buffer size in bytes
+     * @return true on success, false on failure
+     */
+    bool try_set_send_buffer_size(size_t bytes) noexcept {
+        int size = static_cast<int>(bytes);
+        return ::setsockopt(socket_, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)) >= 0;
+    }
+
+    /**
+     * @brief Get number of packets accepted (each counted once, not per subscriber)
+     */
+    [[nodiscard]] size_t packets_written() const noexcept { return packets_written_; }
+
+    /**
+     * @brief Get number of datagrams sent across all subscribers
+     */
+    [[nodiscard]] size_t datagrams_sent() const noexcept { return datagrams_sent_; }
+
+    /**
+     * @brief Get number of bytes sent across all subscribers
+     */
+    [[nodiscard]] size_t bytes_sent() const noexcept { return bytes_sent_; }
+
+    /**
+     * @brief Get number of subscriber send failures (sum of FanoutSubscriber::errors)
+     */
+    [[nodiscard]] size_t subscriber_errors() const noexcept { return subscriber_errors_; }
+
+    /**
+     * @brief Get number of sendmmsg() calls issued
+     *
+     * Compare with datagrams_sent() to see how well datagrams batch.
+     */
+    [[nodiscard]] size_t send_calls() const noexcept { return syscalls_; }
+
+    /**
+     * @brief Get transport status (conditions affecting every subscriber)
+     */
+    [[nodiscard]] const UDPTransportStatus& transport_status() const noexcept { return status_; }
+
+    /**
+     * @brief Get writer counters and latency histograms
+     *
+     * Every delivered datagram is counted as a sent packet; each subscriber failure counts
+     * as a socket error. Empty unless built with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     */
+    [[nodiscard]] const detail::Instrumentation& instrumentation() const noexcept {
+        return instrumentation_;
+    }
+
+    /**
+     * @brief Flush operation (no-op: every call sends its datagrams)
+     *
+     * @return Always true
+     */
+    bool flush() noexcept { return true; }
+
+    /**
+     * @brief Get underlying socket file descriptor
+     */
+    [[nodiscard]] int socket_fd() const noexcept { return socket_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Bytes of a runtime packet (empty for InvalidPacket)
+     */
+    static std::span<const uint8_t> packet_bytes(const vrtigo::PacketVariant& packet) noexcept {
+        return std::visit(
+            [](auto&& pkt) -> std::span<const uint8_t> {
+                using T = std::decay_t<decltype(pkt)>;
+
+                if constexpr (std::is_same_v<T, vrtigo::RuntimeDataPacket>) {
+                    return pkt.as_bytes();
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
+                    // RuntimeContextPacket uses context_buffer() instead of as_bytes()
+                    return {pkt.context_buffer(), pkt.packet_size_bytes()};
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    return pkt.as_bytes();
+                } else {
+                    return {};
+                }
+            },
+            packet);
+    }
+
+    static std::span<const uint8_t> packet_bytes(const vrtigo::PacketHandle& packet) noexcept {
+        return packet.as_bytes();
+    }
+
+    /**
+     * @brief Single-packet body of write_packet()
+     */
+    template <typename Packet>
+    bool write_one(std::span<const Packet> packet) noexcept {
+        const size_t errors_before = subscriber_errors_;
+        return write_batch(packet) == 1 && subscriber_errors_ == errors_before &&
+               status_.state == UDPTransportStatus::State::packet_ready;
+    }
+
+    /**
+     * @brief Shared body of the write_packets() overloads
+     */
+    template <typename Packet>
+    size_t write_batch(std::span<const Packet> packets) noexcept {
+        const auto handed_off = instrumentation_.now();
+        const auto now = Clock::now();
+        status_.state = UDPTransportStatus::State::packet_ready;
+        status_.errno_value = 0;
+
+        // Deliveries of the previous write that drew no error since are confirmed
+        drain_error_queue(now);
+        for (size_t s = 0; s < subscribers_.size(); ++s) {
+            if (delivered_[s]) {
+                subscribers_[s].consecutive_failures = 0;
+                delivered_[s] = false;
+            }
+        }
+
+        // One iovec per packet, shared by the entries of every subscriber
+        iovecs_.clear();
+        int rejected = 0;
+        for (const auto& packet : packets) {
+            auto bytes = packet_bytes(packet);
+            if (bytes.empty() || bytes.size() > mtu_) {
+                rejected = bytes.empty() ? EINVAL : EMSGSIZE;
+                break;
+            }
+            iovecs_.push_back({const_cast<uint8_t*>(bytes.data()), bytes.size()});
+        }
+        const size_t accepted = iovecs_.size();
+
+        messages_.clear();
+        targets_.clear();
+        for (size_t p = 0; p < accepted; ++p) {
+            for (size_t s = 0; s < subscribers_.size(); ++s) {
+                auto& subscriber = subscribers_[s];
+                if (subscriber.backing_off(now)) {
+                    ++subscriber.packets_skipped;
+                    continue;
+                }
+                struct mmsghdr message {};
+                message.msg_hdr.msg_name = const_cast<sockaddr*>(subscriber.address.get());
+                message.msg_hdr.msg_namelen = subscriber.address.length();
+                message.msg_hdr.msg_iov = &iovecs_[p];
+                message.msg_hdr.msg_iovlen = 1;
+                messages_.push_back(message);
+                targets_.push_back(s);
+            }
+        }
+
+        send_messages(now, handed_off);
+
+        packets_written_ += accepted;
+        if (rejected != 0) {
+            status_.state = UDPTransportStatus::State::socket_error;
+            status_.errno_value = rejected;
+        }
+        return accepted;
+    }
+
+    /**
+     * @brief Send messages_, charging failed entries to their subscribers
+     */
+    void send_messages(Clock::time_point now,
+                       detail::Instrumentation::time_point handed_off) noexcept {
+        size_t next = 0;
+        size_t retried = messages_.size(); // Entry already retried after draining errors
+        while (next < messages_.size()) {
+            const size_t count = std::min(messages_.size() - next, max_messages_per_call);
+            int sent =
+                ::sendmmsg(socket_, &messages_[next], static_cast<unsigned int>(count), 0);
+            ++syscalls_;
+            if (sent > 0) {
+                for (size_t i = next; i < next + static_cast<size_t>(sent); ++i) {
+                    record_delivery(i, handed_off);
+                }
+                next += static_cast<size_t>(sent);
+                // A short count means an entry hit an error the kernel did not report; an
+                // ICMP error for an earlier datagram is the usual cause
+                if (static_cast<size_t>(sent) < count && drain_error_queue(now) > 0) {
+                    skip_backed_off(next, now);
+                }
+                continue;
+            }
+
+            const int err = errno;
+            if (err == EINTR) {
+                continue;
+            }
+            if (err == EAGAIN || err == EWOULDBLOCK || err == ENOBUFS) {
+                // Send buffer full or SO_SNDTIMEO expired: no subscriber is at fault
+                status_.state = err == ENOBUFS ? UDPTransportStatus::State::socket_error
+                                               : UDPTransportStatus::State::timeout;
+                status_.errno_value = err;
+                if (err == ENOBUFS) {
+                    instrumentation_.record_io_error();
+                } else {
+                    instrumentation_.record_timeout();
+                }
+                for (size_t i = next; i < messages_.size(); ++i) {
+                    ++subscribers_[targets_[i]].packets_skipped;
+                }
+                break;
+            }
+
+            // A pending ICMP error surfaces on whichever send comes next; retry the entry
+            // once after charging the error to the subscriber the error queue names
+            if (retried != next && drain_error_queue(now) > 0) {
+                retried = next;
+                skip_backed_off(next, now);
+                continue;
+            }
+            record_failure(targets_[next], err, now);
+            ++next;
+            skip_backed_off(next, now);
+        }
+        drain_error_queue(now);
+    }
+
+    void record_delivery(size_t entry, detail::Instrumentation::time_point handed_off) noexcept {
+        auto& subscriber = subscribers_[targets_[entry]];
+        const auto& iov = *messages_[entry].msg_hdr.msg_iov;
+        ++subscriber.packets_sent;
+        subscriber.bytes_sent += iov.iov_len;
+        delivered_[targets_[entry]] = true;
+        ++datagrams_sent_;
+        bytes_sent_ += iov.iov_len;
+        instrumentation_.record_sent({static_cast<const uint8_t*>(iov.iov_base), iov.iov_len},
+                                     handed_off);
+    }
+
+    void record_failure(size_t index, int err, Clock::time_point now) noexcept {
+        auto& subscriber = subscribers_[index];
+        delivered_[index] = false;
+        ++subscriber.errors;
+        ++subscriber_errors_;
+        subscriber.last_errno = err;
+        ++subscriber.consecutive_failures;
+        instrumentation_.record_io_error();
+
+        const unsigned shift = std::min<uint32_t>(subscriber.consecutive_failures - 1, 30);
+        auto delay = backoff_.initial * (int64_t{1} << shift);
+        subscriber.retry_after = now + std::min(delay, std::max(backoff_.max, backoff_.initial));
+    }
+
+    /**
+     * @brief Drop the unsent entries [from, end) of subscribers now backing off
+     */
+    void skip_backed_off(size_t from, Clock::time_point now) noexcept {
+        size_t out = from;
+        for (size_t i = from; i < messages_.size(); ++i) {
+            auto& subscriber = subscribers_[targets_[i]];
+            if (subscriber.backing_off(now)) {
+                ++subscriber.packets_skipped;
+                continue;
+            }
+            messages_[out] = messages_[i];
+            targets_[out] = targets_[i];
+            ++out;
+        }
+        messages_.resize(out);
+        targets_.resize(out);
+    }
+
+    /**
+     * @brief Charge queued ICMP and local errors to the subscribers they name
+     *
+     * @return Number of error queue entries read
+     */
+    size_t drain_error_queue(Clock::time_point now) noexcept {
+        if (!error_queue_) {
+            return 0;
+        }
+        size_t drained = 0;
+        while (true) {
+            struct sockaddr_storage offender {};
+            uint8_t data[64];
+            alignas(struct cmsghdr) uint8_t
+                control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(sockaddr_in6))];
+            struct iovec iov {data, sizeof(data)};
+            struct msghdr msg {};
+            msg.msg_name = &offender;
+            msg.msg_namelen = sizeof(offender);
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+            if (::recvmsg(socket_, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+                break;
+            }
+            ++drained;
+
+            int err = 0;
+            for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+                 cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+                if ((cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                    (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)) {
+                    struct sock_extended_err ee {};
+                    std::memcpy(&ee, CMSG_DATA(cmsg), sizeof(ee));
+                    err = static_cast<int>(ee.ee_errno);
+                }
+            }
+
+            // msg_name holds the destination of the datagram that failed
+            auto destination = SocketAddress::from_sockaddr(
+                reinterpret_cast<const sockaddr*>(&offender), msg.msg_namelen);
+            if (err == 0 || destination.empty()) {
+                continue;
+            }
+            for (size_t s = 0; s < subscribers_.size(); ++s) {
+                if (same_endpoint(subscribers_[s].address, destination)) {
+                    record_failure(s, err, now);
+                    break;
+                }
+            }
+        }
+        return drained;
+    }
+
+    /**
+     * @brief Compare family, address, and port (ignores flow info and padding)
+     */
+    static bool same_endpoint(const SocketAddress& a, const SocketAddress& b) noexcept {
+        if (a.family() != b.family() || a.port() != b.port()) {
+            return false;
+        }
+        if (a.family() == AF_INET) {
+            return reinterpret_cast<const sockaddr_in*>(a.get())->sin_addr.s_addr ==
+                   reinterpret_cast<const sockaddr_in*>(b.get())->sin_addr.s_addr;
+        }
+        return std::memcmp(&reinterpret_cast<const sockaddr_in6*>(a.get())->sin6_addr,
+                           &reinterpret_cast<const sockaddr_in6*>(b.get())->sin6_addr,
+                           sizeof(in6_addr)) == 0;
+    }
+
+    int socket_;                                ///< Socket file descriptor
+    int family_;                                ///< Socket family (AF_INET or AF_INET6)
+    bool dual_stack_;                           ///< AF_INET6 socket accepting v4-mapped addresses
+    bool error_queue_ = false;                  ///< IP_RECVERR/IPV6_RECVERR enabled
+    size_t mtu_ = default_mtu;                  ///< Maximum transmission unit
+    FanoutBackoff backoff_{};                   ///< Back-off for failing subscribers
+    std::vector<FanoutSubscriber> subscribers_; ///< Subscriber table
+    uint32_t next_id_ = 1;                      ///< Id for the next subscriber
+    std::vector<struct iovec> iovecs_;          ///< One entry per packet in the batch
+    std::vector<struct mmsghdr> messages_;      ///< One entry per (packet, subscriber)
+    std::vector<size_t> targets_;               ///< Subscriber index of each messages_ entry
+    std::vector<bool> delivered_;               ///< Sent to since the last error, per subscriber
+    size_t packets_written_ = 0;                ///< Packets accepted
+    size_t datagrams_sent_ = 0;                 ///< Datagrams delivered to the kernel
+    size_t bytes_sent_ = 0;                     ///< Bytes delivered to the kernel
+    size_t subscriber_errors_ = 0;              ///< Subscriber send failures
+    size_t syscalls_ = 0;                       ///< sendmmsg() calls issued
+    UDPTransportStatus status_{};               ///< Transport status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
+};
+
+static_assert(detail::FlushableWriter<UDPFanoutWriter>);
+
+} // namespace vrtigo::utils::netio
@@ -2,9 +2,14 @@
 
 #include "vrtigo/types.hpp"
 
+#include <chrono>
+#include <optional>
+
 #include <cstddef>
 #include <cstdint>
 
+#include "receive_timestamp.hpp"
+
 namespace vrtigo::utils::netio {
 
 /**
@@ -73,6 +78,57 @@ struct UDPTransportStatus {
     /** Platform errno value for socket_error state */
     int errno_value{0};
 
+    /**
+     * Kernel arrival time of the last datagram
+     *
+     * Only populated when receive timestamps are enabled on the reader
+     * (try_enable_receive_timestamps()), otherwise source is none.
+     */
+    ReceiveTimestamp receive_time{};
+
+    /**
+     * IPv4 destination address of the last datagram, in host byte order
+     *
+     * The multicast group for multicast traffic. Only populated when destination info is
+     * enabled on the reader (try_enable_destination_info()), otherwise 0.
+     */
+    uint32_t destination_address{0};
+
+    /**
+     * Datagrams the kernel dropped on this socket (receive queue full or filter), cumulative
+     *
+     * Updated from the SO_RXQ_OVFL counter attached to each datagram when drop accounting
+     * is enabled on the reader (try_enable_drop_accounting()), otherwise 0. Unlike the
+     * other fields it is not reset between receives.
+     */
+    uint64_t kernel_drops{0};
+
+    /**
+     * Time recvmsg() returned the last datagram (system clock)
+     *
+     * Only populated when receive timestamps are enabled, so it can be compared against
+     * receive_time (see wakeup_latency()).
+     */
+    std::chrono::system_clock::time_point wakeup_time{};
+
+    /**
+     * @brief Delay between the datagram's kernel arrival and the reader getting it
+     *
+     * Covers the interrupt/softirq path, the scheduler wakeup of a blocked reader or the
+     * spin loop's polling interval. Hardware arrival stamps include the NIC clock's offset
+     * from the system clock.
+     *
+     * @return Latency, or nullopt if receive timestamps are not enabled
+     */
+    std::optional<std::chrono::nanoseconds> wakeup_latency() const noexcept {
+        if (!receive_time.has_value() ||
+            wakeup_time == std::chrono::system_clock::time_point{}) {
+            return std::nullopt;
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(wakeup_time -
+                                                                    receive_time.time);
+    }
+
     /**
      * @brief Check if the socket is in a terminal error state
      *
@@ -18,6 +18,10 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 
+#if defined(__linux__)
+    #include <linux/net_tstamp.h>
+#endif
+
 #include "../../detail/endian.hpp"
 #include "../../detail/header_decode.hpp"
 #include "../../detail/packet_parser.hpp"
@@ -25,7 +29,14 @@
 #include "../../detail/runtime_context_packet.hpp"
 #include "../../detail/runtime_data_packet.hpp"
 #include "../../types.hpp"
+#include "../detail/instrumentation.hpp"
 #include "../detail/iteration_helpers.hpp"
+#include "busy_poll.hpp"
+#include "multicast.hpp"
+#include "receive_buffer.hpp"
+#include "receive_timestamp.hpp"
+#include "socket_address.hpp"
+#include "socket_filter.hpp"
 #include "udp_transport_status.hpp"
 
 namespace vrtigo::utils::netio {
@@ -59,6 +70,55 @@ namespace vrtigo::utils::netio {
  * returned as an InvalidPacket. The actual datagram size is available in
  * transport_status().actual_size, allowing you to reallocate with a larger buffer if needed.
  *
+ * **Receive Timestamps**
+ *
+ * try_enable_receive_timestamps() asks the kernel to attach the arrival time to each
+ * datagram (SO_TIMESTAMPNS or SO_TIMESTAMPING). The control message is received into a
+ * preallocated buffer, so the only per-packet cost is the extra recvmsg() payload. Use
+ * read_next_timestamped_packet() or transport_status().receive_time to get it, and
+ * vrt_to_arrival_latency() to compare it against the packet's VRT timestamp.
+ *
+ * **Multicast**
+ *
+ * The multicast constructor binds to the group address with SO_REUSEADDR, so several
+ * processes can receive the same group, and joins it. try_join_group()/try_leave_group()
+ * manage additional any-source or source-specific memberships on any reader. To receive
+ * many groups on one socket and tell them apart, use MulticastVRTReader.
+ *
+ * **Low-Latency Receive**
+ *
+ * A blocked recvmsg() costs a scheduler wakeup per datagram. set_receive_mode() can make
+ * the reader spin on non-blocking recvmsg() instead (ReceiveMode::spin), or spin for a
+ * bounded budget before blocking (ReceiveMode::spin_then_block). try_enable_busy_poll()
+ * additionally lets the kernel poll the NIC queue from the receive call
+ * (SO_BUSY_POLL/SO_PREFER_BUSY_POLL). With receive timestamps enabled,
+ * transport_status().wakeup_latency() (and the arrival_to_wakeup histogram) measure the
+ * delay from kernel arrival to the reader holding the datagram, so the modes can be
+ * compared on real traffic.
+ *
+ * **Kernel Drops**
+ *
+ * try_enable_drop_accounting() turns on SO_RXQ_OVFL: the kernel attaches its cumulative
+ * drop counter to each datagram, and transport_status().kernel_drops (and the
+ * instrumentation snapshot, next to truncations) reports it. Drops happen while the
+ * reader is behind, so the count is current as of the next datagram received.
+ * try_enable_adaptive_receive_buffer() additionally grows SO_RCVBUF whenever the counter
+ * moves (see ReceiveBufferController).
+ *
+ * **Kernel Filtering**
+ *
+ * try_set_packet_filter() attaches a classic BPF program that drops datagrams by stream
+ * ID, packet type and size in the kernel, so a reader on a busy multicast group only
+ * wakes up for the streams it wants.
+ *
+ * **IPv6**
+ *
+ * Pass an IPFamily to listen on an IPv6 socket: IPFamily::ipv6 receives IPv6 only,
+ * IPFamily::dual_stack also receives IPv4 senders as v4-mapped addresses. IPV6_V6ONLY is
+ * always set explicitly, so behaviour does not depend on net.ipv6.bindv6only. IPv6
+ * multicast uses MulticastGroupV6. The receive path is the same recvmsg() for every
+ * family. Destination info (IP_PKTINFO) and MulticastVRTReader remain IPv4-only.
+ *
  * @tparam MaxPacketWords Maximum packet size in 32-bit words (default: 65535)
  *
  * @warning This class is MOVE-ONLY due to the large internal scratch buffer.
@@ -127,6 +187,116 @@ public:
         // Socket is blocking by default - no need to change flags
     }
 
+    /**
+     * @brief Create UDP reader listening on a port with a chosen address family
+     *
+     * Binds the wildcard address of the family (INADDR_ANY or in6addr_any).
+     *
+     * @param port UDP port to listen on
+     * @param family IPv4, IPv6 only, or dual stack
+     * @throws std::runtime_error if socket creation or binding fails
+     */
+    UDPVRTReader(uint16_t port, IPFamily family)
+        : socket_(-1),
+          owns_socket_(true),
+          scratch_buffer_{},
+          status_{} {
+        socket_ = detail::open_udp_socket(family);
+        if (socket_ < 0) {
+            throw std::runtime_error("Failed to create UDP socket");
+        }
+
+        auto addr = SocketAddress::any(family == IPFamily::ipv4 ? AF_INET : AF_INET6, port);
+        if (bind(socket_, addr.get(), addr.length()) < 0) {
+            close(socket_);
+            throw std::runtime_error("Failed to bind UDP socket to port " + std::to_string(port));
+        }
+    }
+
+    /**
+     * @brief Create UDP reader receiving a multicast group
+     *
+     * Creates a UDP socket with SO_REUSEADDR, binds it to the group address on the given
+     * port (so datagrams for other groups on the same port are not delivered), and joins
+     * the group on the membership's interface.
+     *
+     * @param port UDP port the group is sent to
+     * @param membership Group, interface, and optional source (source-specific multicast)
+     * @throws std::runtime_error if socket creation, binding, or the join fails
+     */
+    UDPVRTReader(uint16_t port, const MulticastGroup& membership)
+        : socket_(-1),
+          owns_socket_(true),
+          scratch_buffer_{},
+          status_{} {
+        socket_ = socket(AF_INET, SOCK_DGRAM, 0);
+        if (socket_ < 0) {
+            throw std::runtime_error("Failed to create UDP socket");
+        }
+
+        int reuse = 1;
+        setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        struct sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr = membership.group;
+
+        if (bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close(socket_);
+            throw std::runtime_error("Failed to bind UDP socket to port " + std::to_string(port));
+        }
+
+        if (int err = detail::change_multicast_membership(socket_, membership, true); err != 0) {
+            close(socket_);
+            throw std::runtime_error(std::string("Failed to join multicast group: ") +
+                                     std::strerror(err));
+        }
+    }
+
+    /**
+     * @brief Create UDP reader receiving an IPv6 multicast group
+     *
+     * IPv6-only socket with SO_REUSEADDR, bound to [group]:port and joined on the
+     * membership's interface.
+     *
+     * @param port UDP port the group is sent to
+     * @param membership Group, interface index, and optional source
+     * @throws std::runtime_error if socket creation, binding, or the join fails
+     */
+    UDPVRTReader(uint16_t port, const MulticastGroupV6& membership)
+        : socket_(-1),
+          owns_socket_(true),
+          scratch_buffer_{},
+          status_{} {
+        socket_ = detail::open_udp_socket(IPFamily::ipv6);
+        if (socket_ < 0) {
+            throw std::runtime_error("Failed to create UDP socket");
+        }
+
+        int reuse = 1;
+        setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        struct sockaddr_in6 addr {};
+        addr.sin6_family = AF_INET6;
+        addr.sin6_port = htons(port);
+        addr.sin6_addr = membership.group;
+        if (IN6_IS_ADDR_MC_LINKLOCAL(&membership.group)) {
+            addr.sin6_scope_id = membership.interface_index;
+        }
+
+        if (bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close(socket_);
+            throw std::runtime_error("Failed to bind UDP socket to port " + std::to_string(port));
+        }
+
+        if (int err = detail::change_multicast_membership(socket_, membership, true); err != 0) {
+            close(socket_);
+            throw std::runtime_error(std::string("Failed to join multicast group: ") +
+                                     std::strerror(err));
+        }
+    }
+
     /**
      * @brief Create UDP reader using existing socket
      *
@@ -166,7 +336,16 @@ public:
         : socket_(other.socket_),
           owns_socket_(other.owns_socket_),
           scratch_buffer_(std::move(other.scratch_buffer_)),
-          status_(other.status_) {
+          status_(other.status_),
+          timestamp_mode_(other.timestamp_mode_),
+          destination_info_(other.destination_info_),
+          receive_mode_(other.receive_mode_),
+          spin_budget_(other.spin_budget_),
+          timeout_(other.timeout_),
+          drop_accounting_(other.drop_accounting_),
+          last_drop_counter_(other.last_drop_counter_),
+          buffer_controller_(other.buffer_controller_),
+          instrumentation_(std::move(other.instrumentation_)) {
         other.socket_ = -1;
         other.owns_socket_ = false;
     }
@@ -180,6 +359,15 @@ public:
             owns_socket_ = other.owns_socket_;
             scratch_buffer_ = std::move(other.scratch_buffer_);
             status_ = other.status_;
+            timestamp_mode_ = other.timestamp_mode_;
+            destination_info_ = other.destination_info_;
+            receive_mode_ = other.receive_mode_;
+            spin_budget_ = other.spin_budget_;
+            timeout_ = other.timeout_;
+            drop_accounting_ = other.drop_accounting_;
+            last_drop_counter_ = other.last_drop_counter_;
+            buffer_controller_ = other.buffer_controller_;
+            instrumentation_ = std::move(other.instrumentation_);
             other.socket_ = -1;
             other.owns_socket_ = false;
         }
@@ -248,6 +436,7 @@ public:
         // Validate minimum packet size
         if (bytes.size() < 4) {
             // Malformed datagram - return InvalidPacket so iteration continues
+            instrumentation_.record_error(ValidationError::buffer_too_small);
             vrtigo::detail::DecodedHeader dummy{};
             dummy.type = PacketType::signal_data_no_id;
             dummy.size_words = static_cast<uint16_t>(bytes.size() / 4);
@@ -259,7 +448,52 @@ public:
         }
 
         // Parse and validate the packet
-        return vrtigo::detail::parse_packet(bytes);
+        const auto received = instrumentation_.now();
+        auto packet = vrtigo::detail::parse_packet(bytes);
+        instrumentation_.record_received(packet, bytes.size(), received);
+        return packet;
+    }
+
+    /**
+     * @brief Read next packet as a compact PacketHandle
+     *
+     * Same validation and terminal conditions as read_next_packet(), but returns a 24-byte
+     * trivially copyable handle instead of a PacketVariant. Truncated datagrams yield an
+     * invalid handle with ValidationError::buffer_too_small.
+     *
+     * @return PacketHandle, or std::nullopt on timeout, socket closure or fatal error
+     * @note The handle references the internal scratch buffer and is valid until the next
+     *       read operation.
+     */
+    std::optional<vrtigo::PacketHandle> read_next_handle() noexcept {
+        auto bytes = read_next_datagram();
+        if (bytes.empty()) {
+            if (status_.is_truncated()) {
+                return vrtigo::PacketHandle{};
+            }
+            return std::nullopt;
+        }
+
+        const auto received = instrumentation_.now();
+        auto handle = vrtigo::PacketHandle::parse(bytes);
+        instrumentation_.record_received(handle, bytes.size(), received);
+        return handle;
+    }
+
+    /**
+     * @brief Read next packet together with its kernel receive timestamp
+     *
+     * Same semantics as read_next_packet(). The receive time has source none unless
+     * receive timestamps were enabled with try_enable_receive_timestamps().
+     *
+     * @return Packet and arrival time, or std::nullopt on timeout, closure, or fatal error
+     */
+    std::optional<TimestampedPacket> read_next_timestamped_packet() noexcept {
+        auto packet = read_next_packet();
+        if (!packet) {
+            return std::nullopt;
+        }
+        return TimestampedPacket{std::move(*packet), status_.receive_time};
     }
 
     /**
@@ -340,6 +574,17 @@ public:
      */
     const UDPTransportStatus& transport_status() const noexcept { return status_; }
 
+    /**
+     * @brief Get reader counters and latency histograms
+     *
+     * Counts packets by type, validation errors, truncations, timeouts, and bytes, plus a
+     * receive-to-parse latency histogram. snapshot() on the result is safe to call from a
+     * monitoring thread. Empty unless built with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     *
+     * @return Instrumentation owned by this reader
+     */
+    const detail::Instrumentation& instrumentation() const noexcept { return instrumentation_; }
+
     /**
      * @brief Set receive timeout for blocking operations
      *
@@ -354,7 +599,165 @@ public:
         tv.tv_sec = timeout.count() / 1000;
         tv.tv_usec = (timeout.count() % 1000) * 1000;
 
-        return setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) >= 0;
+        if (setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) < 0) {
+            return false;
+        }
+        timeout_ = timeout;
+        return true;
+    }
+
+    /**
+     * @brief Choose how the reader waits for datagrams
+     *
+     * In spin mode the reader never sleeps; a timeout set with try_set_timeout() ends the
+     * spin with the usual timeout status. In spin_then_block mode the reader spins for
+     * spin_budget, then blocks in recvmsg() (where the timeout applies afresh).
+     *
+     * @param mode Wait strategy
+     * @param spin_budget How long spin_then_block spins before blocking
+     */
+    void set_receive_mode(ReceiveMode mode, std::chrono::nanoseconds spin_budget =
+                                                std::chrono::microseconds(50)) noexcept {
+        receive_mode_ = mode;
+        spin_budget_ = spin_budget;
+    }
+
+    /**
+     * @brief Get the wait strategy set by set_receive_mode()
+     */
+    ReceiveMode receive_mode() const noexcept { return receive_mode_; }
+
+    /**
+     * @brief Enable (or, with poll_time 0, disable) kernel busy polling on this socket
+     *
+     * @param options SO_BUSY_POLL time, SO_PREFER_BUSY_POLL and SO_BUSY_POLL_BUDGET
+     * @return true on success; false if an option is rejected, typically EPERM without
+     *         CAP_NET_ADMIN (errno in transport_status().errno_value)
+     */
+    bool try_enable_busy_poll(const BusyPollOptions& options = {}) noexcept {
+        status_.errno_value = detail::set_busy_poll(socket_, options);
+        return status_.errno_value == 0;
+    }
+
+    /**
+     * @brief Enable kernel receive timestamps
+     *
+     * software uses SO_TIMESTAMPNS. timestamping uses SO_TIMESTAMPING and reports raw
+     * hardware timestamps when the NIC delivers them, falling back to the software
+     * timestamp otherwise; hardware stamping must be enabled on the interface separately
+     * (SIOCSHWTSTAMP). Passing none disables timestamps.
+     *
+     * @param mode Timestamping mode
+     * @return true on success, false if the option is rejected or unsupported on this
+     *         platform
+     */
+    bool try_enable_receive_timestamps(
+        ReceiveTimestampMode mode = ReceiveTimestampMode::software) noexcept {
+        // SO_TIMESTAMPNS stays on in timestamping mode: the kernel only guarantees a
+        // software stamp for it, SO_TIMESTAMPING RX stamps can be missing while the
+        // global timestamping static key is still being enabled
+        int enable_ns = (mode != ReceiveTimestampMode::none) ? 1 : 0;
+#if defined(__linux__)
+        int flags = 0;
+        if (mode == ReceiveTimestampMode::timestamping) {
+            flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+                    SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+        }
+        if (setsockopt(socket_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) < 0 &&
+            flags != 0) {
+            return false;
+        }
+#else
+        if (mode == ReceiveTimestampMode::timestamping) {
+            return false;
+        }
+#endif
+        if (setsockopt(socket_, SOL_SOCKET, SO_TIMESTAMPNS, &enable_ns, sizeof(enable_ns)) < 0) {
+            return false;
+        }
+
+        timestamp_mode_ = mode;
+        return true;
+    }
+
+    /**
+     * @brief Get the active receive timestamping mode
+     *
+     * @return Mode set by the last successful try_enable_receive_timestamps() call
+     */
+    ReceiveTimestampMode receive_timestamp_mode() const noexcept { return timestamp_mode_; }
+
+    /**
+     * @brief Report each datagram's destination address (IP_PKTINFO)
+     *
+     * When enabled, transport_status().destination_address holds the address the datagram
+     * was sent to, which for multicast traffic is the group. MulticastVRTReader uses this
+     * to demultiplex groups sharing one socket.
+     *
+     * @param enable true to enable, false to disable
+     * @return true on success, false if the option is rejected or unsupported
+     */
+    bool try_enable_destination_info(bool enable = true) noexcept {
+#if defined(IP_PKTINFO)
+        int value = enable ? 1 : 0;
+        if (setsockopt(socket_, IPPROTO_IP, IP_PKTINFO, &value, sizeof(value)) < 0) {
+            return false;
+        }
+        destination_info_ = enable;
+        return true;
+#else
+        return !enable;
+#endif
+    }
+
+    /**
+     * @brief Join a multicast group on this socket
+     *
+     * Any-source (IP_ADD_MEMBERSHIP) or source-specific (IP_ADD_SOURCE_MEMBERSHIP)
+     * depending on membership.source. The socket only receives the group's datagrams if it
+     * is bound to the group's port (and to INADDR_ANY or the group address).
+     *
+     * @param membership Group, interface, and optional source
+     * @return true on success; false on failure (errno in transport_status().errno_value)
+     */
+    bool try_join_group(const MulticastGroup& membership) noexcept {
+        status_.errno_value = detail::change_multicast_membership(socket_, membership, true);
+        return status_.errno_value == 0;
+    }
+
+    /**
+     * @brief Leave a multicast group joined with try_join_group()
+     *
+     * @param membership The same membership that was joined
+     * @return true on success; false on failure (errno in transport_status().errno_value)
+     */
+    bool try_leave_group(const MulticastGroup& membership) noexcept {
+        status_.errno_value = detail::change_multicast_membership(socket_, membership, false);
+        return status_.errno_value == 0;
+    }
+
+    /**
+     * @brief Join an IPv6 multicast group on this (IPv6) socket
+     *
+     * IPV6_JOIN_GROUP, or MCAST_JOIN_SOURCE_GROUP when membership.source is set.
+     *
+     * @param membership Group, interface index, and optional source
+     * @return true on success; false on failure (errno in transport_status().errno_value)
+     */
+    bool try_join_group(const MulticastGroupV6& membership) noexcept {
+        status_.errno_value = detail::change_multicast_membership(socket_, membership, true);
+        return status_.errno_value == 0;
+    }
+
+    /**
+     * @brief Leave an IPv6 multicast group joined with try_join_group()
+     *
+     * @param membership The same membership that was joined
+     * @return true on success; false on failure (errno in transport_status().errno_value)
+     */
+    bool try_leave_group(const MulticastGroupV6& membership) noexcept {
+        status_.errno_value = detail::change_multicast_membership(socket_, membership, false);
+        return status_.errno_value == 0;
     }
 
     /**
@@ -371,6 +774,70 @@ public:
         return setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)) >= 0;
     }
 
+    /**
+     * @brief Report kernel drops on this socket (SO_RXQ_OVFL)
+     *
+     * The cumulative count since the socket was created is available in
+     * transport_status().kernel_drops after each receive. Linux only.
+     *
+     * @param enable true to enable, false to disable
+     * @return true on success, false if the option is rejected or unsupported
+     */
+    bool try_enable_drop_accounting(bool enable = true) noexcept {
+#if defined(SO_RXQ_OVFL)
+        int value = enable ? 1 : 0;
+        if (setsockopt(socket_, SOL_SOCKET, SO_RXQ_OVFL, &value, sizeof(value)) < 0) {
+            return false;
+        }
+        drop_accounting_ = enable;
+        return true;
+#else
+        return !enable;
+#endif
+    }
+
+    /**
+     * @brief Grow the receive buffer whenever the kernel reports drops
+     *
+     * Enables drop accounting and hands the counter to a ReceiveBufferController after
+     * every receive in which it moved. Calling again replaces the policy.
+     *
+     * @param policy Growth policy
+     * @return true on success, false if drop accounting is unsupported
+     */
+    bool try_enable_adaptive_receive_buffer(ReceiveBufferPolicy policy = {}) noexcept {
+        if (!try_enable_drop_accounting()) {
+            return false;
+        }
+        buffer_controller_.emplace(socket_, policy);
+        return true;
+    }
+
+    /**
+     * @brief Controller installed by try_enable_adaptive_receive_buffer()
+     *
+     * @return The controller (resize count, current size), or nullopt if not enabled
+     */
+    const std::optional<ReceiveBufferController>& receive_buffer_controller() const noexcept {
+        return buffer_controller_;
+    }
+
+    /**
+     * @brief Filter packets in the kernel with a classic BPF program
+     *
+     * Unwanted datagrams (other stream IDs or packet types, or outside the size range) are
+     * dropped before reaching the socket queue. Calling again replaces the filter
+     * atomically; PacketFilter{} (accept everything) removes it. Linux only.
+     *
+     * @param filter Packets to deliver
+     * @return true on success, false on failure (errno set; ENOSYS off Linux)
+     * @throws std::invalid_argument if the filter cannot be compiled (see PacketFilter)
+     */
+    bool try_set_packet_filter(const PacketFilter& filter) {
+        // Socket filters on UDP sockets see the datagram from the UDP header on
+        return attach_packet_filter(socket_, filter, udp_header_size);
+    }
+
     /**
      * @brief Check if socket is still valid
      *
@@ -394,16 +861,7 @@ public:
      *
      * @return Port number, or 0 on error
      */
-    uint16_t socket_port() const noexcept {
-        struct sockaddr_in addr {};
-        socklen_t addr_len = sizeof(addr);
-
-        if (getsockname(socket_, reinterpret_cast<struct sockaddr*>(&addr), &addr_len) < 0) {
-            return 0;
-        }
-
-        return ntohs(addr.sin_port);
-    }
+    uint16_t socket_port() const noexcept { return detail::local_address(socket_).port(); }
 
 private:
     /**
@@ -421,6 +879,9 @@ private:
         status_.bytes_received = 0;
         status_.actual_size = 0;
         status_.errno_value = 0;
+        status_.receive_time = {};
+        status_.destination_address = 0;
+        status_.wakeup_time = {};
 
         // Set up msghdr for recvmsg (to detect MSG_TRUNC)
         struct iovec iov {};
@@ -430,12 +891,25 @@ private:
         struct msghdr msg {};
         msg.msg_iov = &iov;
         msg.msg_iovlen = 1;
+        if (timestamp_mode_ != ReceiveTimestampMode::none || destination_info_ ||
+            drop_accounting_) {
+            msg.msg_control = control_buffer_.data();
+            msg.msg_controllen = control_buffer_.size();
+        }
 
         // Blocking receive with MSG_TRUNC to detect truncation
         // MSG_TRUNC makes recvmsg return the actual datagram size even if truncated
+        // Spinning modes poll with MSG_DONTWAIT until a datagram arrives or the spin ends
+        int flags = MSG_TRUNC;
+        std::chrono::steady_clock::time_point spin_start{};
+        if (receive_mode_ != ReceiveMode::blocking) {
+            flags |= MSG_DONTWAIT;
+            spin_start = std::chrono::steady_clock::now();
+        }
+
         ssize_t bytes;
         while (true) {
-            bytes = recvmsg(socket_, &msg, MSG_TRUNC);
+            bytes = recvmsg(socket_, &msg, flags);
 
             if (bytes >= 0) {
                 break; // Success
@@ -449,17 +923,50 @@ private:
                 continue;
             }
 
+            // Queue empty while spinning: keep polling until the budget or timeout runs out
+            if ((flags & MSG_DONTWAIT) && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                const auto spun = std::chrono::steady_clock::now() - spin_start;
+                if (receive_mode_ == ReceiveMode::spin_then_block && spun >= spin_budget_) {
+                    flags &= ~MSG_DONTWAIT;
+                } else if (receive_mode_ == ReceiveMode::spin && timeout_.count() > 0 &&
+                           spun >= timeout_) {
+                    status_.state = UDPTransportStatus::State::timeout;
+                    instrumentation_.record_timeout();
+                    return {};
+                }
+                detail::cpu_relax();
+                continue;
+            }
+
             // EAGAIN/EWOULDBLOCK: timeout or would block - non-terminal
             if (errno == EAGAIN || errno == EWOULDBLOCK) {
                 status_.state = UDPTransportStatus::State::timeout;
+                instrumentation_.record_timeout();
                 return {};
             }
 
             // All other errors are fatal
             status_.state = UDPTransportStatus::State::socket_error;
+            instrumentation_.record_io_error();
             return {};
         }
 
+        if (msg.msg_controllen > 0) {
+            if (timestamp_mode_ != ReceiveTimestampMode::none) {
+                status_.wakeup_time = std::chrono::system_clock::now();
+            }
+            status_.receive_time = parse_receive_timestamp(msg);
+            if (auto latency = status_.wakeup_latency()) {
+                instrumentation_.record_wakeup_latency(*latency);
+            }
+            if (destination_info_) {
+                status_.destination_address = parse_destination_address(msg);
+            }
+            if (drop_accounting_) {
+                update_kernel_drops(msg);
+            }
+        }
+
         if (bytes == 0) {
             // Socket closed (shouldn't happen with UDP, but handle it)
             status_.state = UDPTransportStatus::State::socket_closed;
@@ -470,6 +977,7 @@ private:
         if (msg.msg_flags & MSG_TRUNC) {
             status_.state = UDPTransportStatus::State::datagram_truncated;
             status_.actual_size = static_cast<size_t>(bytes);
+            instrumentation_.record_truncation();
             // bytes_received is what actually fit in the buffer
             status_.bytes_received = std::min(scratch_buffer_.size(), static_cast<size_t>(bytes));
 
@@ -505,10 +1013,124 @@ private:
         return std::span<const uint8_t>(scratch_buffer_.data(), static_cast<size_t>(bytes));
     }
 
+    /**
+     * @brief Extract the arrival time from recvmsg() control messages
+     *
+     * A raw hardware stamp (SCM_TIMESTAMPING ts[2]) is preferred when non-zero, otherwise
+     * the software stamp (SCM_TIMESTAMPNS or SCM_TIMESTAMPING ts[0]) is used.
+     */
+    static ReceiveTimestamp parse_receive_timestamp(struct msghdr& msg) noexcept {
+        ReceiveTimestamp result{};
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level != SOL_SOCKET) {
+                continue;
+            }
+#if defined(__linux__)
+            if (cmsg->cmsg_type == SCM_TIMESTAMPING) {
+                struct timespec stamps[3];
+                std::memcpy(stamps, CMSG_DATA(cmsg), sizeof(stamps));
+                if (stamps[2].tv_sec != 0 || stamps[2].tv_nsec != 0) {
+                    return {to_time_point(stamps[2]), ReceiveTimestampSource::hardware};
+                }
+                if (stamps[0].tv_sec != 0 || stamps[0].tv_nsec != 0) {
+                    result = {to_time_point(stamps[0]), ReceiveTimestampSource::software};
+                }
+                continue;
+            }
+#endif
+            if (cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+                struct timespec stamp;
+                std::memcpy(&stamp, CMSG_DATA(cmsg), sizeof(stamp));
+                result = {to_time_point(stamp), ReceiveTimestampSource::software};
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Extract the datagram's destination address (host byte order) from IP_PKTINFO
+     */
+    static uint32_t parse_destination_address(struct msghdr& msg) noexcept {
+#if defined(IP_PKTINFO)
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO) {
+                struct in_pktinfo info;
+                std::memcpy(&info, CMSG_DATA(cmsg), sizeof(info));
+                return ntohl(info.ipi_addr.s_addr);
+            }
+        }
+#else
+        (void)msg;
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief Fold the SO_RXQ_OVFL counter into status_.kernel_drops
+     *
+     * The kernel only attaches the 32-bit counter once it is non-zero; the difference to
+     * the last value seen is accumulated so wrap-around is harmless.
+     */
+    void update_kernel_drops(struct msghdr& msg) noexcept {
+#if defined(SO_RXQ_OVFL)
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+                uint32_t counter;
+                std::memcpy(&counter, CMSG_DATA(cmsg), sizeof(counter));
+                const uint32_t delta = counter - last_drop_counter_;
+                if (delta == 0) {
+                    return;
+                }
+                last_drop_counter_ = counter;
+                status_.kernel_drops += delta;
+                instrumentation_.record_kernel_drops(status_.kernel_drops);
+                if (buffer_controller_) {
+                    buffer_controller_->observe(status_.kernel_drops);
+                }
+                return;
+            }
+        }
+#else
+        (void)msg;
+#endif
+    }
+
+    static std::chrono::system_clock::time_point to_time_point(const timespec& ts) noexcept {
+        auto since_epoch = std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(since_epoch));
+    }
+
+#if defined(IP_PKTINFO)
+    static constexpr size_t pktinfo_space = CMSG_SPACE(sizeof(struct in_pktinfo));
+#else
+    static constexpr size_t pktinfo_space = 0;
+#endif
+
+    /// Room for SCM_TIMESTAMPING (3 timespecs), SCM_TIMESTAMPNS, IP_PKTINFO and SO_RXQ_OVFL
+    static constexpr size_t control_buffer_size = CMSG_SPACE(3 * sizeof(struct timespec)) +
+                                                  CMSG_SPACE(sizeof(struct timespec)) +
+                                                  pktinfo_space + CMSG_SPACE(sizeof(uint32_t));
+
+    static constexpr uint32_t udp_header_size = 8; ///< VRT header offset seen by socket filters
+
     int socket_;       ///< UDP socket file descriptor
     bool owns_socket_; ///< Whether to close socket in destructor
     std::array<uint8_t, MaxPacketWords * 4> scratch_buffer_; ///< Internal datagram buffer
     UDPTransportStatus status_;                              ///< Status of last receive operation
+    ReceiveTimestampMode timestamp_mode_ = ReceiveTimestampMode::none; ///< Kernel timestamping
+    bool destination_info_ = false;  ///< IP_PKTINFO requested
+    ReceiveMode receive_mode_ = ReceiveMode::blocking; ///< Wait strategy
+    std::chrono::nanoseconds spin_budget_{0};         ///< spin_then_block spin time
+    std::chrono::milliseconds timeout_{0};            ///< SO_RCVTIMEO (0 = none)
+    bool drop_accounting_ = false;   ///< SO_RXQ_OVFL requested
+    uint32_t last_drop_counter_ = 0; ///< Last SO_RXQ_OVFL value seen
+    std::optional<ReceiveBufferController> buffer_controller_; ///< Adaptive SO_RCVBUF
+    alignas(struct cmsghdr) std::array<uint8_t, control_buffer_size> control_buffer_{};
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
 };
 
 } // namespace vrtigo::utils::netio
@@ -18,10 +18,14 @@
 // Linux/POSIX socket headers
 #include "vrtigo/detail/packet_concepts.hpp"
 #include "vrtigo/detail/packet_variant.hpp"
+#include "vrtigo/utils/detail/instrumentation.hpp"
 #include "vrtigo/utils/detail/writer_concepts.hpp"
+#include "vrtigo/utils/netio/multicast.hpp"
+#include "vrtigo/utils/netio/socket_address.hpp"
 #include "vrtigo/utils/netio/udp_transport_status.hpp"
 
 #include <arpa/inet.h>
+#include <net/if.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
@@ -39,6 +43,14 @@ namespace vrtigo::utils::netio {
  * - Bound mode: Connect to single endpoint, use send()
  * - Unbound mode: Specify destination per packet with sendto()
  *
+ * Address Families:
+ * - Bound mode follows the resolved destination; host names resolve to IPv4 unless
+ *   IPFamily::ipv6 or IPFamily::dual_stack is passed
+ * - Unbound mode is IPv4 by default; pass IPFamily::ipv6 or IPFamily::dual_stack for an
+ *   IPv6 socket (dual stack reaches IPv4 destinations through v4-mapped addresses)
+ * - Resolve per-packet destinations once with resolve_destination() and reuse the
+ *   SocketAddress; sends then pass it to sendto() unchanged
+ *
  * Supported Packet Types:
  * - PacketVariant (runtime packets)
  * - RuntimeDataPacket (runtime data packets)
@@ -57,6 +69,12 @@ namespace vrtigo::utils::netio {
  * - Configurable via set_mtu()
  * - Returns false for oversized packets
  *
+ * Multicast:
+ * - Send to a group address like any other destination
+ * - try_set_multicast_ttl() (default 1: stays on the local subnet),
+ *   try_set_multicast_loopback() and try_set_multicast_interface() control delivery;
+ *   they set the IPv6 options (hop limit, ...) on IPv6 sockets
+ *
  * Blocking Mode:
  * - Always uses blocking sockets (consistent with UDPVRTReader)
  * - SO_SNDTIMEO can be set for timeout support
@@ -98,6 +116,13 @@ namespace vrtigo::utils::netio {
  *
  * multi_writer.write_packet(variant, dest1);
  * multi_writer.write_packet(variant, dest2);
+ *
+ * // Dual stack - one IPv6 socket for IPv4 and IPv6 destinations, resolved once
+ * UDPVRTWriter any_writer(0, IPFamily::dual_stack);
+ * auto v6_dest = any_writer.resolve_destination("fd00::10", 12345);
+ * auto v4_dest = any_writer.resolve_destination("192.168.1.100", 12345);
+ * any_writer.write_packet(variant, v6_dest);
+ * any_writer.write_packet(variant, v4_dest);
  * @endcode
  */
 class UDPVRTWriter {
@@ -108,38 +133,51 @@ public:
      * @brief Create writer in bound mode (single destination)
      *
      * Connects to a single UDP endpoint. All packets are sent to this destination.
+     * Names resolve to IPv4 by default; pass IPFamily::ipv6 for IPv6, or
+     * IPFamily::dual_stack to take IPv4 if the name has it and IPv6 otherwise.
      *
      * @param host Destination hostname or IP address
      * @param port Destination UDP port
+     * @param family Address family to resolve
      * @throws std::runtime_error if socket creation or DNS resolution fails
      */
-    explicit UDPVRTWriter(const std::string& host, uint16_t port)
+    explicit UDPVRTWriter(const std::string& host, uint16_t port,
+                          IPFamily family = IPFamily::ipv4)
+        : UDPVRTWriter(SocketAddress::resolve(host, port, family)) {}
+
+    /**
+     * @brief Create writer in bound mode for an already resolved destination
+     *
+     * The socket family (IPv4 or IPv6) follows the destination.
+     *
+     * @param destination Destination address and port
+     * @throws std::runtime_error if socket creation or connect fails
+     */
+    explicit UDPVRTWriter(const SocketAddress& destination)
         : socket_(-1),
           bound_mode_(true),
+          family_(destination.family()),
           mtu_(default_mtu),
           packets_sent_(0),
           bytes_sent_(0) {
+        if (destination.empty()) {
+            throw std::runtime_error("Empty destination address");
+        }
+
         // Create UDP socket
-        socket_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        socket_ = ::socket(family_, SOCK_DGRAM, 0);
         if (socket_ < 0) {
             throw std::runtime_error("Failed to create UDP socket");
         }
 
-        // Resolve destination address
-        struct sockaddr_in addr {};
-        if (!resolve_address(host, port, addr)) {
-            ::close(socket_);
-            throw std::runtime_error("Failed to resolve address: " + host);
-        }
-
         // Connect socket to destination (bound mode)
-        if (::connect(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+        if (::connect(socket_, destination.get(), destination.length()) < 0) {
             ::close(socket_);
-            throw std::runtime_error("Failed to connect UDP socket to " + host + ":" +
-                                     std::to_string(port));
+            throw std::runtime_error("Failed to connect UDP socket to " +
+                                     destination.to_string());
         }
 
-        dest_addr_ = addr;
+        dest_addr_ = destination;
         status_.state = UDPTransportStatus::State::packet_ready;
     }
 
@@ -150,27 +188,26 @@ public:
      * Caller must specify destination for each write_packet() call.
      *
      * @param local_port Local port to bind (0 = any port)
+     * @param family Socket family (IPv4, IPv6 only, or dual stack)
      * @throws std::runtime_error if socket creation or binding fails
      */
-    explicit UDPVRTWriter(uint16_t local_port = 0)
+    explicit UDPVRTWriter(uint16_t local_port = 0, IPFamily family = IPFamily::ipv4)
         : socket_(-1),
           bound_mode_(false),
+          family_(family == IPFamily::ipv4 ? AF_INET : AF_INET6),
+          dual_stack_(family == IPFamily::dual_stack),
           mtu_(default_mtu),
           packets_sent_(0),
           bytes_sent_(0) {
         // Create UDP socket
-        socket_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        socket_ = detail::open_udp_socket(family);
         if (socket_ < 0) {
             throw std::runtime_error("Failed to create UDP socket");
         }
 
         // Bind to local port
-        struct sockaddr_in addr {};
-        addr.sin_family = AF_INET;
-        addr.sin_port = htons(local_port);
-        addr.sin_addr.s_addr = INADDR_ANY;
-
-        if (::bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+        auto addr = SocketAddress::any(family_, local_port);
+        if (::bind(socket_, addr.get(), addr.length()) < 0) {
             ::close(socket_);
             throw std::runtime_error("Failed to bind UDP socket to port " +
                                      std::to_string(local_port));
@@ -195,11 +232,14 @@ public:
     UDPVRTWriter(UDPVRTWriter&& other) noexcept
         : socket_(other.socket_),
           bound_mode_(other.bound_mode_),
+          family_(other.family_),
+          dual_stack_(other.dual_stack_),
           dest_addr_(other.dest_addr_),
           mtu_(other.mtu_),
           packets_sent_(other.packets_sent_),
           bytes_sent_(other.bytes_sent_),
-          status_(other.status_) {
+          status_(other.status_),
+          instrumentation_(std::move(other.instrumentation_)) {
         other.socket_ = -1;
         other.packets_sent_ = 0;
         other.bytes_sent_ = 0;
@@ -215,11 +255,14 @@ public:
             // Move from other
             socket_ = other.socket_;
             bound_mode_ = other.bound_mode_;
+            family_ = other.family_;
+            dual_stack_ = other.dual_stack_;
             dest_addr_ = other.dest_addr_;
             mtu_ = other.mtu_;
             packets_sent_ = other.packets_sent_;
             bytes_sent_ = other.bytes_sent_;
             status_ = other.status_;
+            instrumentation_ = std::move(other.instrumentation_);
 
             // Reset other
             other.socket_ = -1;
@@ -259,6 +302,8 @@ public:
                     // RuntimeContextPacket uses context_buffer() instead of as_bytes()
                     std::span<const uint8_t> bytes{pkt.context_buffer(), pkt.packet_size_bytes()};
                     return this->write_packet_impl(bytes);
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    return this->write_packet_impl(pkt.as_bytes());
                 } else {
                     return false; // Unknown type
                 }
@@ -306,7 +351,9 @@ public:
      *
      * Sends packet to specified destination. Can be used in both bound
      * and unbound modes, but typically used in unbound mode for
-     * per-packet destination control.
+     * per-packet destination control. On an IPv6 socket the IPv4 address is
+     * converted to its v4-mapped form on each call; prefer the SocketAddress
+     * overload for repeated sends.
      *
      * @param packet The packet variant to write
      * @param dest Destination address
@@ -314,33 +361,54 @@ public:
      */
     bool write_packet(const vrtigo::PacketVariant& packet,
                       const struct sockaddr_in& dest) noexcept {
-        // Check if variant holds InvalidPacket
-        if (std::holds_alternative<vrtigo::InvalidPacket>(packet)) {
-            status_.state = UDPTransportStatus::State::socket_error;
-            status_.errno_value = EINVAL;
-            return false;
+        if (family_ == AF_INET6) {
+            auto mapped = SocketAddress(dest).to_v4_mapped();
+            return write_variant_to(packet, mapped.get(), mapped.length());
         }
+        return write_variant_to(packet, reinterpret_cast<const struct sockaddr*>(&dest),
+                                sizeof(dest));
+    }
 
-        // Write the packet using visitor pattern
-        return std::visit(
-            [this, &dest](auto&& pkt) -> bool {
-                using T = std::decay_t<decltype(pkt)>;
+    /**
+     * @brief Write packet to a resolved destination (unbound mode)
+     *
+     * The address is passed to sendto() as is; its family must match the socket
+     * (use resolve_destination() to get a matching address).
+     *
+     * @param packet The packet variant to write
+     * @param dest Destination address
+     * @return true on success, false on error or invalid packet
+     */
+    bool write_packet(const vrtigo::PacketVariant& packet, const SocketAddress& dest) noexcept {
+        return write_variant_to(packet, dest.get(), dest.length());
+    }
 
-                if constexpr (std::is_same_v<T, vrtigo::InvalidPacket>) {
-                    return false; // Should never reach here
-                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeDataPacket>) {
-                    return this->write_packet_to(pkt.as_bytes(), dest);
-                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
-                    // RuntimeContextPacket uses context_buffer() instead of as_bytes()
-                    std::span<const uint8_t> bytes{pkt.context_buffer(), pkt.packet_size_bytes()};
-                    return this->write_packet_to(bytes, dest);
-                } else {
-                    return false; // Unknown type
-                }
-            },
-            packet);
+    /**
+     * @brief Resolve a destination for this writer's socket family
+     *
+     * IPv4 sockets resolve IPv4 addresses and IPv6-only sockets IPv6 addresses.
+     * Dual-stack sockets prefer IPv4 and fall back to IPv6, with IPv4 results returned
+     * v4-mapped. Call once per destination and reuse the result.
+     *
+     * @param host Hostname or IP address
+     * @param port Destination UDP port
+     * @throws std::runtime_error if the name does not resolve for the family
+     */
+    SocketAddress resolve_destination(const std::string& host, uint16_t port) const {
+        if (family_ == AF_INET) {
+            return SocketAddress::resolve(host, port, AF_INET);
+        }
+        if (!dual_stack_) {
+            return SocketAddress::resolve(host, port, AF_INET6);
+        }
+        return SocketAddress::resolve(host, port, IPFamily::dual_stack).to_v4_mapped();
     }
 
+    /**
+     * @brief Get the destination of a bound-mode writer (empty in unbound mode)
+     */
+    [[nodiscard]] const SocketAddress& destination() const noexcept { return dest_addr_; }
+
     /**
      * @brief Set maximum transmission unit
      *
@@ -366,6 +434,77 @@ public:
         ::setsockopt(socket_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
     }
 
+    /**
+     * @brief Set the multicast time-to-live (IP_MULTICAST_TTL / IPV6_MULTICAST_HOPS)
+     *
+     * The kernel default of 1 keeps multicast on the local subnet; raise it for routed
+     * distribution.
+     *
+     * @param ttl Hop limit for outgoing multicast datagrams
+     * @return true on success, false on failure (errno in transport_status().errno_value)
+     */
+    bool try_set_multicast_ttl(uint8_t ttl) noexcept {
+        if (family_ == AF_INET6) {
+            int hops = ttl;
+            set_ipv4_option_for_dual_stack(IP_MULTICAST_TTL, ttl);
+            return set_option(IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops));
+        }
+        unsigned char value = ttl;
+        return set_option(IPPROTO_IP, IP_MULTICAST_TTL, &value, sizeof(value));
+    }
+
+    /**
+     * @brief Enable or disable local loopback of sent multicast
+     *
+     * When enabled (the kernel default), receivers on this host that joined the group also
+     * get the datagrams. Sets IP_MULTICAST_LOOP or IPV6_MULTICAST_LOOP.
+     *
+     * @param enable true to loop back, false to suppress
+     * @return true on success, false on failure (errno in transport_status().errno_value)
+     */
+    bool try_set_multicast_loopback(bool enable) noexcept {
+        if (family_ == AF_INET6) {
+            unsigned int loop = enable ? 1 : 0;
+            set_ipv4_option_for_dual_stack(IP_MULTICAST_LOOP, enable ? 1 : 0);
+            return set_option(IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &loop, sizeof(loop));
+        }
+        unsigned char value = enable ? 1 : 0;
+        return set_option(IPPROTO_IP, IP_MULTICAST_LOOP, &value, sizeof(value));
+    }
+
+    /**
+     * @brief Select the outgoing interface for multicast
+     *
+     * IPv4 sockets take the interface's IPv4 address (IP_MULTICAST_IF). IPv6 sockets take
+     * an interface name or index (IPV6_MULTICAST_IF); a dual-stack socket also accepts an
+     * IPv4 address, which selects the interface for IPv4 groups.
+     *
+     * @param interface_addr Interface address, name, or index; empty for the default route
+     * @return true on success, false if the interface does not parse or the option fails
+     */
+    bool try_set_multicast_interface(const std::string& interface_addr) noexcept {
+        struct in_addr addr {};
+        addr.s_addr = htonl(INADDR_ANY);
+        bool is_ipv4 = !interface_addr.empty() &&
+                       ::inet_pton(AF_INET, interface_addr.c_str(), &addr) == 1;
+        if (family_ == AF_INET6 && !(dual_stack_ && is_ipv4)) {
+            unsigned int index = 0;
+            if (!interface_addr.empty()) {
+                index = MulticastGroupV6::lookup_interface(interface_addr);
+                if (index == 0) {
+                    status_.errno_value = EINVAL;
+                    return false;
+                }
+            }
+            return set_option(IPPROTO_IPV6, IPV6_MULTICAST_IF, &index, sizeof(index));
+        }
+        if (!interface_addr.empty() && !is_ipv4) {
+            status_.errno_value = EINVAL;
+            return false;
+        }
+        return set_option(IPPROTO_IP, IP_MULTICAST_IF, &addr, sizeof(addr));
+    }
+
     /**
      * @brief Get number of packets sent
      *
@@ -387,6 +526,20 @@ public:
      */
     [[nodiscard]] const UDPTransportStatus& transport_status() const noexcept { return status_; }
 
+    /**
+     * @brief Get writer counters and latency histograms
+     *
+     * Counts sent packets by type, bytes, send timeouts, and socket errors, plus a
+     * build-to-send histogram (write_packet() entry to send() completion). snapshot() on the
+     * result is safe to call from a monitoring thread. Empty unless built with
+     * VRTIGO_ENABLE_INSTRUMENTATION=1.
+     *
+     * @return Instrumentation owned by this writer
+     */
+    [[nodiscard]] const detail::Instrumentation& instrumentation() const noexcept {
+        return instrumentation_;
+    }
+
     /**
      * @brief Flush operation (no-op for UDP)
      *
@@ -406,6 +559,7 @@ private:
      * Sends to connected destination using send().
      */
     bool write_packet_impl(std::span<const uint8_t> bytes) noexcept {
+        const auto handed_off = instrumentation_.now();
         if (!bound_mode_) {
             // Bound mode required for this method
             status_.state = UDPTransportStatus::State::socket_error;
@@ -425,6 +579,7 @@ private:
         if (sent < 0) {
             status_.state = map_errno_to_state(errno);
             status_.errno_value = errno;
+            record_send_error();
             return false;
         }
 
@@ -438,15 +593,52 @@ private:
         packets_sent_++;
         bytes_sent_ += bytes.size();
         status_.state = UDPTransportStatus::State::packet_ready;
+        instrumentation_.record_sent(bytes, handed_off);
         return true;
     }
 
+    /**
+     * @brief Write a packet variant to a specific destination
+     */
+    bool write_variant_to(const vrtigo::PacketVariant& packet, const struct sockaddr* dest,
+                          socklen_t dest_length) noexcept {
+        // Check if variant holds InvalidPacket
+        if (std::holds_alternative<vrtigo::InvalidPacket>(packet)) {
+            status_.state = UDPTransportStatus::State::socket_error;
+            status_.errno_value = EINVAL;
+            return false;
+        }
+
+        // Write the packet using visitor pattern
+        return std::visit(
+            [this, dest, dest_length](auto&& pkt) -> bool {
+                using T = std::decay_t<decltype(pkt)>;
+
+                if constexpr (std::is_same_v<T, vrtigo::InvalidPacket>) {
+                    return false; // Should never reach here
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeDataPacket>) {
+                    return this->write_packet_to(pkt.as_bytes(), dest, dest_length);
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
+                    // RuntimeContextPacket uses context_buffer() instead of as_bytes()
+                    std::span<const uint8_t> bytes{pkt.context_buffer(), pkt.packet_size_bytes()};
+                    return this->write_packet_to(bytes, dest, dest_length);
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    return this->write_packet_to(pkt.as_bytes(), dest, dest_length);
+                } else {
+                    return false; // Unknown type
+                }
+            },
+            packet);
+    }
+
     /**
      * @brief Write packet bytes to specific destination
      *
      * Uses sendto() for per-packet destination control.
      */
-    bool write_packet_to(std::span<const uint8_t> bytes, const struct sockaddr_in& dest) noexcept {
+    bool write_packet_to(std::span<const uint8_t> bytes, const struct sockaddr* dest,
+                         socklen_t dest_length) noexcept {
+        const auto handed_off = instrumentation_.now();
         // Check MTU
         if (bytes.size() > mtu_) {
             status_.state = UDPTransportStatus::State::socket_error;
@@ -455,11 +647,11 @@ private:
         }
 
         // Send datagram
-        ssize_t sent = ::sendto(socket_, bytes.data(), bytes.size(), 0,
-                                reinterpret_cast<const struct sockaddr*>(&dest), sizeof(dest));
+        ssize_t sent = ::sendto(socket_, bytes.data(), bytes.size(), 0, dest, dest_length);
         if (sent < 0) {
             status_.state = map_errno_to_state(errno);
             status_.errno_value = errno;
+            record_send_error();
             return false;
         }
 
@@ -473,35 +665,39 @@ private:
         packets_sent_++;
         bytes_sent_ += bytes.size();
         status_.state = UDPTransportStatus::State::packet_ready;
+        instrumentation_.record_sent(bytes, handed_off);
         return true;
     }
 
     /**
-     * @brief Resolve hostname to sockaddr_in
-     *
-     * @param host Hostname or IP address
-     * @param port Port number
-     * @param out Output address structure
-     * @return true on success, false on failure
+     * @brief Set a socket option, recording errno on failure
      */
-    static bool resolve_address(const std::string& host, uint16_t port,
-                                struct sockaddr_in& out) noexcept {
-        struct addrinfo hints {};
-        hints.ai_family = AF_INET;
-        hints.ai_socktype = SOCK_DGRAM;
-
-        struct addrinfo* result = nullptr;
-        int ret = ::getaddrinfo(host.c_str(), nullptr, &hints, &result);
-        if (ret != 0 || result == nullptr) {
+    bool set_option(int level, int option, const void* value, socklen_t size) noexcept {
+        if (::setsockopt(socket_, level, option, value, size) < 0) {
+            status_.errno_value = errno;
             return false;
         }
+        return true;
+    }
 
-        // Use first result
-        std::memcpy(&out, result->ai_addr, sizeof(struct sockaddr_in));
-        out.sin_port = htons(port);
+    /**
+     * @brief Mirror a multicast option to the IPv4 side of a dual-stack socket (best effort)
+     */
+    void set_ipv4_option_for_dual_stack(int option, unsigned char value) noexcept {
+        if (dual_stack_) {
+            ::setsockopt(socket_, IPPROTO_IP, option, &value, sizeof(value));
+        }
+    }
 
-        ::freeaddrinfo(result);
-        return true;
+    /**
+     * @brief Count a failed send as a timeout or a socket error
+     */
+    void record_send_error() noexcept {
+        if (status_.state == UDPTransportStatus::State::timeout) {
+            instrumentation_.record_timeout();
+        } else {
+            instrumentation_.record_io_error();
+        }
     }
 
     /**
@@ -529,13 +725,16 @@ private:
         }
     }
 
-    int socket_;                   ///< Socket file descriptor
-    bool bound_mode_;              ///< True if connected to single destination
-    struct sockaddr_in dest_addr_; ///< Destination address (bound mode)
-    size_t mtu_;                   ///< Maximum transmission unit
-    size_t packets_sent_;          ///< Total packets sent
-    size_t bytes_sent_;            ///< Total bytes sent
-    UDPTransportStatus status_;    ///< Transport status
+    int socket_;                ///< Socket file descriptor
+    bool bound_mode_;           ///< True if connected to single destination
+    int family_ = AF_INET;      ///< Socket family (AF_INET or AF_INET6)
+    bool dual_stack_ = false;   ///< AF_INET6 socket accepting v4-mapped destinations
+    SocketAddress dest_addr_;   ///< Destination address (bound mode)
+    size_t mtu_;                ///< Maximum transmission unit
+    size_t packets_sent_;       ///< Total packets sent
+    size_t bytes_sent_;         ///< Total bytes sent
+    UDPTransportStatus status_; ///< Transport status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
 };
 
 } // namespace vrtigo::utils::netio
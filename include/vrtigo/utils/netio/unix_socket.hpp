@@ -0,0 +1,265 @@
+#pragma once
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// POSIX Unix domain socket headers
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Unix domain socket type used for local VRT transport
+ *
+ * Both preserve message boundaries, so each message carries exactly one VRT packet.
+ */
+enum class UnixSocketType : uint8_t {
+    datagram, ///< SOCK_DGRAM: connectionless; the reader binds a path, writers send to it
+    seqpacket ///< SOCK_SEQPACKET: connected; a UnixSeqpacketListener accepts each peer
+};
+
+} // namespace vrtigo::utils::netio
+
+namespace vrtigo::utils::detail {
+
+/**
+ * @brief sockaddr_un for a socket path
+ *
+ * A leading '@' selects the Linux abstract namespace (no file is created).
+ */
+struct UnixAddress {
+    sockaddr_un addr{}; ///< Address bytes
+    socklen_t length{}; ///< Valid length of addr
+
+    /**
+     * @throws std::invalid_argument if the path is empty or too long
+     */
+    explicit UnixAddress(const std::string& path) {
+        if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+            throw std::invalid_argument("Invalid Unix socket path: " + path);
+        }
+        addr.sun_family = AF_UNIX;
+        std::memcpy(addr.sun_path, path.data(), path.size());
+        if (is_abstract(path)) {
+            addr.sun_path[0] = '\0';
+        }
+        length = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path.size() +
+                                         (is_abstract(path) ? 0 : 1));
+    }
+
+    const sockaddr* get() const noexcept { return reinterpret_cast<const sockaddr*>(&addr); }
+
+    static bool is_abstract(const std::string& path) noexcept {
+        return !path.empty() && path[0] == '@';
+    }
+};
+
+/**
+ * @brief Map a UnixSocketType to the socket(2) type
+ */
+inline int unix_socket_type(netio::UnixSocketType type) noexcept {
+    return type == netio::UnixSocketType::seqpacket ? SOCK_SEQPACKET : SOCK_DGRAM;
+}
+
+/**
+ * @brief Remove a socket file at the path if no process is bound to it any more
+ *
+ * The path is probed with connect() from a non-blocking datagram socket, whatever the
+ * type of the socket about to be bound: only ECONNREFUSED proves the file stale. A live
+ * datagram socket accepts the connect without receiving anything, and a live seqpacket
+ * socket (listening or not) answers EPROTOTYPE, so no connection lands in a listener's
+ * accept queue. Paths that are not sockets are left for bind() to reject.
+ *
+ * @return false with errno = EADDRINUSE if a live socket owns the path
+ */
+inline bool remove_stale_unix_socket(const UnixAddress& address) noexcept {
+    struct stat info {};
+    if (address.addr.sun_path[0] == '\0' || ::lstat(address.addr.sun_path, &info) != 0 ||
+        !S_ISSOCK(info.st_mode)) {
+        return true;
+    }
+    int probe = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    if (probe < 0) {
+        return false;
+    }
+    int err = ::connect(probe, address.get(), address.length) < 0 ? errno : 0;
+    ::close(probe);
+    if (err == ECONNREFUSED) {
+        ::unlink(address.addr.sun_path);
+        return true;
+    }
+    errno = EADDRINUSE;
+    return false;
+}
+
+/**
+ * @brief Create a Unix domain socket and bind it to a path
+ *
+ * A stale socket file left at the path by a previous process is removed first (see
+ * remove_stale_unix_socket()); a path another process is still bound to, or any other
+ * kind of file, is left alone and the bind fails.
+ *
+ * @return Bound socket descriptor, or -1 on failure (errno set)
+ */
+inline int bind_unix_socket(const UnixAddress& address, int type) noexcept {
+    if (!remove_stale_unix_socket(address)) {
+        return -1;
+    }
+    int fd = ::socket(AF_UNIX, type, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (::bind(fd, address.get(), address.length) < 0) {
+        int err = errno;
+        ::close(fd);
+        errno = err;
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Create a Unix domain socket and connect it to a path
+ *
+ * @return Connected socket descriptor, or -1 on failure (errno set)
+ */
+inline int connect_unix_socket(const UnixAddress& address, int type) noexcept {
+    int fd = ::socket(AF_UNIX, type, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (::connect(fd, address.get(), address.length) < 0) {
+        int err = errno;
+        ::close(fd);
+        errno = err;
+        return -1;
+    }
+    return fd;
+}
+
+} // namespace vrtigo::utils::detail
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Listening SOCK_SEQPACKET socket that hands out one connection per peer
+ *
+ * The producing side of a seqpacket link listens; each consumer connects with
+ * UnixVRTReader(path, UnixSocketType::seqpacket) and the producer wraps the accepted
+ * descriptor in a UnixVRTWriter. The socket file is removed when the listener is
+ * destroyed.
+ *
+ * Example usage:
+ * @code
+ * UnixSeqpacketListener listener("/run/radio0.sock");
+ * UnixVRTWriter writer(listener.accept(), true);
+ * @endcode
+ */
+class UnixSeqpacketListener {
+public:
+    /**
+     * @brief Bind and listen on a path ('@name' for the abstract namespace)
+     *
+     * @param path Socket path
+     * @param backlog Pending connection limit
+     * @throws std::invalid_argument if the path is invalid
+     * @throws std::runtime_error if binding or listening fails
+     */
+    explicit UnixSeqpacketListener(const std::string& path, int backlog = 16) : path_(path) {
+        detail::UnixAddress address(path);
+        socket_ = detail::bind_unix_socket(address, SOCK_SEQPACKET);
+        if (socket_ < 0 || ::listen(socket_, backlog) < 0) {
+            std::string reason = std::strerror(errno);
+            close();
+            throw std::runtime_error("Failed to listen on Unix socket " + path + ": " + reason);
+        }
+    }
+
+    /**
+     * @brief Destructor - closes the socket and removes the socket file
+     */
+    ~UnixSeqpacketListener() noexcept { close(); }
+
+    // Non-copyable
+    UnixSeqpacketListener(const UnixSeqpacketListener&) = delete;
+    UnixSeqpacketListener& operator=(const UnixSeqpacketListener&) = delete;
+
+    // Move-only semantics
+    UnixSeqpacketListener(UnixSeqpacketListener&& other) noexcept
+        : socket_(std::exchange(other.socket_, -1)),
+          path_(std::exchange(other.path_, {})) {}
+
+    UnixSeqpacketListener& operator=(UnixSeqpacketListener&& other) noexcept {
+        if (this != &other) {
+            close();
+            socket_ = std::exchange(other.socket_, -1);
+            path_ = std::exchange(other.path_, {});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Wait for the next peer
+     *
+     * @return Connected descriptor (caller owns it), or -1 on timeout or error (errno set)
+     */
+    [[nodiscard]] int accept() noexcept {
+        while (true) {
+            int fd = ::accept(socket_, nullptr, nullptr);
+            if (fd >= 0 || errno != EINTR) {
+                return fd;
+            }
+        }
+    }
+
+    /**
+     * @brief Limit how long accept() waits (SO_RCVTIMEO; 0 = no limit)
+     *
+     * @return true on success, false on failure
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        struct timeval tv {};
+        tv.tv_sec = timeout.count() / 1000;
+        tv.tv_usec = (timeout.count() % 1000) * 1000;
+
+        return ::setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) >= 0;
+    }
+
+    /**
+     * @brief Get the listening socket descriptor (for poll/epoll)
+     */
+    [[nodiscard]] int socket_fd() const noexcept { return socket_; }
+
+    /**
+     * @brief Get the path the listener is bound to
+     */
+    [[nodiscard]] const std::string& path() const noexcept { return path_; }
+
+private:
+    void close() noexcept {
+        if (socket_ >= 0) {
+            ::close(socket_);
+            socket_ = -1;
+            if (!detail::UnixAddress::is_abstract(path_)) {
+                ::unlink(path_.c_str());
+            }
+        }
+        path_.clear();
+    }
+
+    int socket_ = -1;  ///< Listening socket descriptor
+    std::string path_; ///< Bound path
+};
+
+} // namespace vrtigo::utils::netio
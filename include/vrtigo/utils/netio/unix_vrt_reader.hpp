@@ -0,0 +1,278 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// POSIX Unix domain socket headers
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+
+#include "../../detail/packet_variant.hpp"
+#include "../detail/iteration_helpers.hpp"
+#include "udp_transport_status.hpp"
+#include "udp_vrt_reader.hpp"
+#include "unix_socket.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Blocking Unix domain socket VRT packet reader (Linux/POSIX)
+ *
+ * Local alternative to UDPVRTReader that skips the IP stack: each SOCK_DGRAM or
+ * SOCK_SEQPACKET message carries one VRT packet. Reading, truncation detection (MSG_TRUNC),
+ * timeouts, timestamps, and validation are those of UDPVRTReader, which this class wraps,
+ * so the shared iteration helpers work unchanged.
+ *
+ * **Socket Types**
+ *
+ * - UnixSocketType::datagram binds the path; any number of UnixVRTWriter instances send
+ *   to it. Unlike UDP, a full receive queue blocks the sender instead of dropping.
+ * - UnixSocketType::seqpacket connects to a UnixSeqpacketListener at the path. When the
+ *   producer closes the connection, reads return std::nullopt with state socket_closed.
+ *
+ * Paths starting with '@' use the Linux abstract namespace. A bound datagram path is
+ * removed when the reader is destroyed.
+ *
+ * @tparam MaxPacketWords Maximum packet size in 32-bit words (default: 65535)
+ *
+ * @warning This class is MOVE-ONLY due to the large internal scratch buffer.
+ *
+ * Example usage:
+ * @code
+ * UnixVRTReader<> reader("/run/vrt/analysis0.sock");
+ * reader.for_each_data_packet([](const vrtigo::RuntimeDataPacket& pkt) {
+ *     // Process data packet
+ *     return true;
+ * });
+ * @endcode
+ */
+template <uint16_t MaxPacketWords = 65535>
+class UnixVRTReader {
+public:
+    /**
+     * @brief Create reader on a socket path
+     *
+     * @param path Socket path ('@name' for the abstract namespace)
+     * @param type datagram binds the path; seqpacket connects to a listener there
+     * @throws std::invalid_argument if the path is invalid
+     * @throws std::runtime_error if the socket cannot be bound or connected
+     */
+    explicit UnixVRTReader(const std::string& path,
+                           UnixSocketType type = UnixSocketType::datagram)
+        : reader_(open_socket(path, type), true) {
+        if (type == UnixSocketType::datagram && !detail::UnixAddress::is_abstract(path)) {
+            bound_path_ = path;
+        }
+    }
+
+    /**
+     * @brief Create reader using an existing Unix socket (socketpair, accepted peer)
+     *
+     * @param socket_fd Existing SOCK_DGRAM or SOCK_SEQPACKET socket in blocking mode
+     * @param take_ownership If true, socket will be closed in destructor
+     * @throws std::runtime_error if the descriptor is invalid
+     */
+    explicit UnixVRTReader(int socket_fd, bool take_ownership = false)
+        : reader_(socket_fd, take_ownership) {}
+
+    /**
+     * @brief Destructor - closes the socket and removes a bound datagram path
+     */
+    ~UnixVRTReader() noexcept { remove_bound_path(); }
+
+    // Non-copyable (due to socket and large buffer)
+    UnixVRTReader(const UnixVRTReader&) = delete;
+    UnixVRTReader& operator=(const UnixVRTReader&) = delete;
+
+    // Move-only semantics
+    UnixVRTReader(UnixVRTReader&& other) noexcept
+        : reader_(std::move(other.reader_)),
+          bound_path_(std::exchange(other.bound_path_, {})) {}
+
+    UnixVRTReader& operator=(UnixVRTReader&& other) noexcept {
+        if (this != &other) {
+            remove_bound_path();
+            reader_ = std::move(other.reader_);
+            bound_path_ = std::exchange(other.bound_path_, {});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Read next packet as validated view (see UDPVRTReader::read_next_packet())
+     *
+     * @return PacketVariant, or std::nullopt on timeout, peer closure, or fatal error
+     *
+     * @note The returned view is valid until the next read operation.
+     */
+    std::optional<vrtigo::PacketVariant> read_next_packet() noexcept {
+        return reader_.read_next_packet();
+    }
+
+    /**
+     * @brief Read next packet together with its kernel receive timestamp
+     */
+    std::optional<TimestampedPacket> read_next_timestamped_packet() noexcept {
+        return reader_.read_next_timestamped_packet();
+    }
+
+    /**
+     * @brief Iterate over all packets with automatic validation (see UDPVRTReader)
+     */
+    template <typename Callback>
+    size_t for_each_validated_packet(Callback&& callback) noexcept {
+        return detail::for_each_validated_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over data packets only (see UDPVRTReader)
+     */
+    template <typename Callback>
+    size_t for_each_data_packet(Callback&& callback) noexcept {
+        return detail::for_each_data_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over context packets only (see UDPVRTReader)
+     */
+    template <typename Callback>
+    size_t for_each_context_packet(Callback&& callback) noexcept {
+        return detail::for_each_context_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over packets with a specific stream ID (see UDPVRTReader)
+     */
+    template <typename Callback>
+    size_t for_each_packet_with_stream_id(uint32_t stream_id_filter, Callback&& callback) noexcept {
+        return detail::for_each_packet_with_stream_id(*this, stream_id_filter,
+                                                      std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Status of the last receive operation (see UDPVRTReader)
+     */
+    const UDPTransportStatus& transport_status() const noexcept {
+        return reader_.transport_status();
+    }
+
+    /**
+     * @brief Reader counters and latency histograms (see UDPVRTReader)
+     */
+    const detail::Instrumentation& instrumentation() const noexcept {
+        return reader_.instrumentation();
+    }
+
+    /**
+     * @brief Set receive timeout (see UDPVRTReader::try_set_timeout())
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        return reader_.try_set_timeout(timeout);
+    }
+
+    /**
+     * @brief Set socket receive buffer size (bounds the queued bytes per socket)
+     */
+    bool try_set_receive_buffer_size(size_t bytes) noexcept {
+        return reader_.try_set_receive_buffer_size(bytes);
+    }
+
+    /**
+     * @brief Report kernel drops (see UDPVRTReader::try_enable_drop_accounting())
+     */
+    bool try_enable_drop_accounting(bool enable = true) noexcept {
+        return reader_.try_enable_drop_accounting(enable);
+    }
+
+    /**
+     * @brief Choose how the reader waits for datagrams (see UDPVRTReader)
+     */
+    void set_receive_mode(ReceiveMode mode, std::chrono::nanoseconds spin_budget =
+                                                std::chrono::microseconds(50)) noexcept {
+        reader_.set_receive_mode(mode, spin_budget);
+    }
+
+    /**
+     * @brief Grow the receive buffer on drops (see UDPVRTReader)
+     */
+    bool try_enable_adaptive_receive_buffer(ReceiveBufferPolicy policy = {}) noexcept {
+        return reader_.try_enable_adaptive_receive_buffer(policy);
+    }
+
+    /**
+     * @brief Controller installed by try_enable_adaptive_receive_buffer()
+     */
+    const std::optional<ReceiveBufferController>& receive_buffer_controller() const noexcept {
+        return reader_.receive_buffer_controller();
+    }
+
+    /**
+     * @brief Enable kernel receive timestamps (software only on Unix sockets)
+     */
+    bool try_enable_receive_timestamps(
+        ReceiveTimestampMode mode = ReceiveTimestampMode::software) noexcept {
+        return reader_.try_enable_receive_timestamps(mode);
+    }
+
+    /**
+     * @brief Filter packets in the kernel (see UDPVRTReader::try_set_packet_filter())
+     *
+     * Unix socket filters see the message from the VRT header on.
+     */
+    bool try_set_packet_filter(const PacketFilter& filter) {
+        return attach_packet_filter(reader_.socket_fd(), filter, 0);
+    }
+
+    /**
+     * @brief Check if socket is still valid
+     */
+    bool is_open() const noexcept { return reader_.is_open(); }
+
+    /**
+     * @brief Get underlying socket file descriptor
+     */
+    int socket_fd() const noexcept { return reader_.socket_fd(); }
+
+    /**
+     * @brief Get the bound datagram path (empty for seqpacket, abstract, or adopted sockets)
+     */
+    const std::string& bound_path() const noexcept { return bound_path_; }
+
+private:
+    static int open_socket(const std::string& path, UnixSocketType type) {
+        detail::UnixAddress address(path);
+        int socket_type = detail::unix_socket_type(type);
+        int fd = type == UnixSocketType::datagram
+                     ? detail::bind_unix_socket(address, socket_type)
+                     : detail::connect_unix_socket(address, socket_type);
+        if (fd < 0) {
+            throw std::runtime_error(
+                std::string(type == UnixSocketType::datagram ? "Failed to bind" :
+                                                               "Failed to connect") +
+                " Unix socket " + path + ": " + std::strerror(errno));
+        }
+        return fd;
+    }
+
+    void remove_bound_path() noexcept {
+        if (!bound_path_.empty()) {
+            ::unlink(bound_path_.c_str());
+            bound_path_.clear();
+        }
+    }
+
+    UDPVRTReader<MaxPacketWords> reader_; ///< Socket and receive path
+    std::string bound_path_;              ///< Datagram path to remove on destruction
+};
+
+} // namespace vrtigo::utils::netio
@@ -0,0 +1,459 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// POSIX Unix domain socket headers
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+
+#include "vrtigo/detail/packet_concepts.hpp"
+#include "vrtigo/detail/packet_variant.hpp"
+#include "vrtigo/packet_handle.hpp"
+#include "vrtigo/utils/detail/instrumentation.hpp"
+#include "vrtigo/utils/detail/writer_concepts.hpp"
+#include "vrtigo/utils/netio/udp_transport_status.hpp"
+#include "vrtigo/utils/netio/unix_socket.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Unix domain socket VRT packet writer (Linux/POSIX)
+ *
+ * Sends each VRT packet as one SOCK_DGRAM or SOCK_SEQPACKET message to a local reader
+ * (UnixVRTReader), avoiding the IP stack used by loopback UDP.
+ *
+ * Socket Types:
+ * - UnixSocketType::datagram connects to the path a UnixVRTReader bound
+ * - UnixSocketType::seqpacket connects to a UnixSeqpacketListener; the producer usually
+ *   listens instead and wraps each accepted descriptor with the socket constructor
+ *
+ * Flow Control:
+ * - A full reader queue blocks the send (no silent drops as with UDP); set a send timeout
+ *   with try_set_timeout() to bound it, after which the state is timeout
+ * - A reader that went away fails the send with ECONNREFUSED (datagram) or EPIPE
+ *   (seqpacket); the state is socket_closed
+ * - Message size is limited by the send buffer (see try_set_send_buffer_size()), not an MTU
+ *
+ * Batching:
+ * - write_packets() sends a span of packets with one sendmmsg() call per 1024 packets on
+ *   Linux, each message pointing directly at the packet bytes
+ *
+ * Satisfies the FlushableWriter concept.
+ *
+ * Example usage:
+ * @code
+ * UnixVRTWriter writer("/run/vrt/analysis0.sock");
+ * writer.write_packet(packet);
+ * writer.write_packets(batch); // std::span<const PacketVariant>
+ * @endcode
+ */
+class UnixVRTWriter {
+public:
+    /// Messages per sendmmsg() call (the kernel's UIO_MAXIOV limit)
+    static constexpr size_t max_batch_messages = 1024;
+
+    /**
+     * @brief Connect to a reader (datagram) or listener (seqpacket) at a path
+     *
+     * @param path Socket path ('@name' for the abstract namespace)
+     * @param type Socket type of the peer
+     * @throws std::invalid_argument if the path is invalid
+     * @throws std::runtime_error if the socket cannot be connected
+     */
+    explicit UnixVRTWriter(const std::string& path, UnixSocketType type = UnixSocketType::datagram)
+        : UnixVRTWriter(connect(path, type), true) {}
+
+    /**
+     * @brief Create writer on a connected Unix socket (socketpair, accepted peer)
+     *
+     * @param socket_fd Connected SOCK_DGRAM or SOCK_SEQPACKET socket
+     * @param take_ownership If true, socket will be closed in destructor
+     * @throws std::runtime_error if the descriptor is invalid
+     */
+    explicit UnixVRTWriter(int socket_fd, bool take_ownership = false)
+        : socket_(socket_fd),
+          owns_socket_(take_ownership) {
+        if (socket_ < 0) {
+            throw std::runtime_error("Invalid socket file descriptor");
+        }
+    }
+
+    /**
+     * @brief Destructor - closes socket if owned
+     */
+    ~UnixVRTWriter() noexcept {
+        if (owns_socket_ && socket_ >= 0) {
+            ::close(socket_);
+        }
+    }
+
+    // Non-copyable
+    UnixVRTWriter(const UnixVRTWriter&) = delete;
+    UnixVRTWriter& operator=(const UnixVRTWriter&) = delete;
+
+    // Move-only semantics
+    UnixVRTWriter(UnixVRTWriter&& other) noexcept
+        : socket_(std::exchange(other.socket_, -1)),
+          owns_socket_(std::exchange(other.owns_socket_, false)),
+          messages_(std::move(other.messages_)),
+          iovecs_(std::move(other.iovecs_)),
+          packets_written_(other.packets_written_),
+          bytes_written_(other.bytes_written_),
+          syscalls_(other.syscalls_),
+          status_(other.status_),
+          instrumentation_(std::move(other.instrumentation_)) {}
+
+    UnixVRTWriter& operator=(UnixVRTWriter&& other) noexcept {
+        if (this != &other) {
+            if (owns_socket_ && socket_ >= 0) {
+                ::close(socket_);
+            }
+            socket_ = std::exchange(other.socket_, -1);
+            owns_socket_ = std::exchange(other.owns_socket_, false);
+            messages_ = std::move(other.messages_);
+            iovecs_ = std::move(other.iovecs_);
+            packets_written_ = other.packets_written_;
+            bytes_written_ = other.bytes_written_;
+            syscalls_ = other.syscalls_;
+            status_ = other.status_;
+            instrumentation_ = std::move(other.instrumentation_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Write packet from variant
+     *
+     * @param packet The packet variant to write
+     * @return true on success, false on error or invalid packet
+     */
+    bool write_packet(const vrtigo::PacketVariant& packet) noexcept {
+        auto bytes = packet_bytes(packet);
+        if (bytes.empty()) {
+            status_.state = UDPTransportStatus::State::socket_error;
+            status_.errno_value = EINVAL;
+            return false;
+        }
+        return write_bytes(bytes);
+    }
+
+    /**
+     * @brief Write data packet view
+     */
+    bool write_packet(const vrtigo::RuntimeDataPacket& packet) noexcept {
+        return write_bytes(packet.as_bytes());
+    }
+
+    /**
+     * @brief Write context packet view
+     */
+    bool write_packet(const vrtigo::RuntimeContextPacket& packet) noexcept {
+        // RuntimeContextPacket uses context_buffer() instead of as_bytes()
+        return write_bytes({packet.context_buffer(), packet.packet_size_bytes()});
+    }
+
+    /**
+     * @brief Write compile-time packet
+     *
+     * @tparam PacketType Type satisfying CompileTimePacket concept
+     */
+    template <typename PacketType>
+        requires vrtigo::CompileTimePacket<PacketType>
+    bool write_packet(const PacketType& packet) noexcept {
+        return write_bytes(packet.as_bytes());
+    }
+
+    /**
+     * @brief Write a batch of packets, one message each, with as few syscalls as possible
+     *
+     * Uses sendmmsg() on Linux (one message per packet, no copies) and a send() loop
+     * elsewhere. InvalidPacket entries stop the batch.
+     *
+     * @param packets Packets to write, in order
+     * @return Number of packets sent; less than packets.size() if a send failed or an
+     *         InvalidPacket stopped the batch (see transport_status())
+     */
+    size_t write_packets(std::span<const vrtigo::PacketVariant> packets) noexcept {
+        return write_batch(packets);
+    }
+
+    /**
+     * @brief Write a batch of packet handles
+     *
+     * Same semantics as the PacketVariant overload; invalid handles stop the batch.
+     */
+    size_t write_packets(std::span<const vrtigo::PacketHandle> packets) noexcept {
+        return write_batch(packets);
+    }
+
+    /**
+     * @brief Flush operation (no-op: every message is sent immediately)
+     *
+     * @return Always true
+     */
+    bool flush() noexcept { return true; }
+
+    /**
+     * @brief Set send timeout (SO_SNDTIMEO)
+     *
+     * @param timeout Timeout duration (0 = no timeout)
+     * @return true on success, false on failure
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        struct timeval tv {};
+        tv.tv_sec = timeout.count() / 1000;
+        tv.tv_usec = (timeout.count() % 1000) * 1000;
+
+        return ::setsockopt(socket_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) >= 0;
+    }
+
+    /**
+     * @brief Set socket send buffer size (SO_SNDBUF)
+     *
+     * For Unix datagram sockets this is also the largest message that can be sent.
+     *
+     * @param bytes Requested buffer size in bytes
+     * @return true on success, false on failure
+     */
+    bool try_set_send_buffer_size(size_t bytes) noexcept {
+        int size = static_cast<int>(bytes);
+        return ::setsockopt(socket_, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)) >= 0;
+    }
+
+    /**
+     * @brief Get number of packets written
+     */
+    [[nodiscard]] size_t packets_written() const noexcept { return packets_written_; }
+
+    /**
+     * @brief Get number of bytes written
+     */
+    [[nodiscard]] size_t bytes_written() const noexcept { return bytes_written_; }
+
+    /**
+     * @brief Get number of send syscalls issued
+     */
+    [[nodiscard]] size_t send_calls() const noexcept { return syscalls_; }
+
+    /**
+     * @brief Get transport status
+     */
+    [[nodiscard]] const UDPTransportStatus& transport_status() const noexcept { return status_; }
+
+    /**
+     * @brief Get writer counters and latency histograms
+     *
+     * Empty unless built with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     */
+    [[nodiscard]] const detail::Instrumentation& instrumentation() const noexcept {
+        return instrumentation_;
+    }
+
+    /**
+     * @brief Check if socket is still valid
+     */
+    [[nodiscard]] bool is_open() const noexcept { return socket_ >= 0 && !status_.is_terminal(); }
+
+    /**
+     * @brief Get underlying socket file descriptor
+     */
+    [[nodiscard]] int socket_fd() const noexcept { return socket_; }
+
+private:
+    static int connect(const std::string& path, UnixSocketType type) {
+        int fd = detail::connect_unix_socket(detail::UnixAddress(path),
+                                             detail::unix_socket_type(type));
+        if (fd < 0) {
+            throw std::runtime_error("Failed to connect Unix socket " + path + ": " +
+                                     std::strerror(errno));
+        }
+        return fd;
+    }
+
+    /**
+     * @brief Bytes of a runtime packet (empty for InvalidPacket)
+     */
+    static std::span<const uint8_t> packet_bytes(const vrtigo::PacketVariant& packet) noexcept {
+        return std::visit(
+            [](auto&& pkt) -> std::span<const uint8_t> {
+                using T = std::decay_t<decltype(pkt)>;
+
+                if constexpr (std::is_same_v<T, vrtigo::RuntimeDataPacket>) {
+                    return pkt.as_bytes();
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
+                    // RuntimeContextPacket uses context_buffer() instead of as_bytes()
+                    return {pkt.context_buffer(), pkt.packet_size_bytes()};
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    return pkt.as_bytes();
+                } else {
+                    return {};
+                }
+            },
+            packet);
+    }
+
+    static std::span<const uint8_t> packet_bytes(const vrtigo::PacketHandle& packet) noexcept {
+        return packet.as_bytes();
+    }
+
+    /**
+     * @brief Shared body of the write_packets() overloads
+     */
+    template <typename Packet>
+    size_t write_batch(std::span<const Packet> packets) noexcept {
+        size_t valid = 0;
+        while (valid < packets.size() && !packet_bytes(packets[valid]).empty()) {
+            ++valid;
+        }
+
+        const auto handed_off = instrumentation_.now();
+        size_t sent = 0;
+        bool failed = false;
+        while (sent < valid && !failed) {
+            size_t count = std::min(valid - sent, max_batch_messages);
+            size_t done = send_batch(packets.subspan(sent, count));
+            failed = done < count;
+            for (size_t i = sent; i < sent + done; ++i) {
+                auto bytes = packet_bytes(packets[i]);
+                ++packets_written_;
+                bytes_written_ += bytes.size();
+                instrumentation_.record_sent(bytes, handed_off);
+            }
+            sent += done;
+        }
+
+        if (!failed) {
+            status_.state = UDPTransportStatus::State::packet_ready;
+            status_.errno_value = 0;
+            if (valid < packets.size()) {
+                // Report the InvalidPacket that stopped the batch
+                status_.state = UDPTransportStatus::State::socket_error;
+                status_.errno_value = EINVAL;
+            }
+        }
+        return sent;
+    }
+
+    /**
+     * @brief Send one packet as one message
+     */
+    bool write_bytes(std::span<const uint8_t> bytes) noexcept {
+        const auto handed_off = instrumentation_.now();
+        ssize_t sent;
+        do {
+            sent = ::send(socket_, bytes.data(), bytes.size(), MSG_NOSIGNAL);
+            ++syscalls_;
+        } while (sent < 0 && errno == EINTR);
+
+        if (sent < 0) {
+            record_send_error(errno);
+            return false;
+        }
+
+        ++packets_written_;
+        bytes_written_ += bytes.size();
+        status_.state = UDPTransportStatus::State::packet_ready;
+        status_.errno_value = 0;
+        instrumentation_.record_sent(bytes, handed_off);
+        return true;
+    }
+
+    /**
+     * @brief Send up to max_batch_messages valid packets
+     *
+     * @return Number of packets sent; fewer than requested only on error (status set)
+     */
+    template <typename Packet>
+    size_t send_batch(std::span<const Packet> packets) noexcept {
+#if defined(__linux__)
+        messages_.resize(packets.size());
+        iovecs_.resize(packets.size());
+        for (size_t i = 0; i < packets.size(); ++i) {
+            auto bytes = packet_bytes(packets[i]);
+            iovecs_[i] = {const_cast<uint8_t*>(bytes.data()), bytes.size()};
+            messages_[i] = {};
+            messages_[i].msg_hdr.msg_iov = &iovecs_[i];
+            messages_[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        size_t done = 0;
+        while (done < packets.size()) {
+            int sent = ::sendmmsg(socket_, messages_.data() + done,
+                                  static_cast<unsigned int>(packets.size() - done), MSG_NOSIGNAL);
+            ++syscalls_;
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                record_send_error(errno);
+                break;
+            }
+            done += static_cast<size_t>(sent);
+        }
+        return done;
+#else
+        size_t done = 0;
+        for (const auto& packet : packets) {
+            auto bytes = packet_bytes(packet);
+            ssize_t sent;
+            do {
+                sent = ::send(socket_, bytes.data(), bytes.size(), MSG_NOSIGNAL);
+                ++syscalls_;
+            } while (sent < 0 && errno == EINTR);
+            if (sent < 0) {
+                record_send_error(errno);
+                break;
+            }
+            ++done;
+        }
+        return done;
+#endif
+    }
+
+    void record_send_error(int err) noexcept {
+        status_.errno_value = err;
+        if (err == EAGAIN || err == EWOULDBLOCK) {
+            status_.state = UDPTransportStatus::State::timeout;
+            instrumentation_.record_timeout();
+        } else if (err == EPIPE || err == ECONNREFUSED || err == ECONNRESET) {
+            status_.state = UDPTransportStatus::State::socket_closed;
+            instrumentation_.record_io_error();
+        } else {
+            status_.state = UDPTransportStatus::State::socket_error;
+            instrumentation_.record_io_error();
+        }
+    }
+
+    int socket_;       ///< Socket file descriptor
+    bool owns_socket_; ///< Close socket in destructor
+#if defined(__linux__)
+    std::vector<struct mmsghdr> messages_; ///< Message headers for write_packets()
+#else
+    std::vector<struct msghdr> messages_; ///< Unused off Linux (keeps one layout)
+#endif
+    std::vector<struct iovec> iovecs_; ///< One buffer per message for write_packets()
+    size_t packets_written_ = 0;       ///< Packets sent
+    size_t bytes_written_ = 0;         ///< Bytes sent
+    size_t syscalls_ = 0;              ///< send()/sendmmsg() calls issued
+    UDPTransportStatus status_{};      ///< Transport status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
+};
+
+static_assert(detail::FlushableWriter<UnixVRTWriter>);
+
+} // namespace vrtigo::utils::netio
@@ -0,0 +1,271 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Linux eBPF/XDP headers
+#include <arpa/inet.h>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief Where the XDP hook runs and how frames reach the UMEM
+ */
+enum class XDPMode : uint8_t {
+    /**
+     * Generic (SKB) mode: the hook runs after the kernel built an skb and the frame is
+     * copied into the UMEM. Works on every interface, including veth pairs.
+     */
+    generic,
+
+    /** Driver (native) mode with copying into the UMEM; needs driver XDP support */
+    native,
+
+    /** Driver mode with the NIC writing straight into the UMEM; needs driver AF_XDP ZC */
+    zero_copy
+};
+
+} // namespace vrtigo::utils::netio
+
+namespace vrtigo::utils::detail {
+
+inline long bpf_syscall(int cmd, union bpf_attr& attr) noexcept {
+    return ::syscall(__NR_bpf, cmd, &attr, sizeof(attr));
+}
+
+/**
+ * @brief Assemble the redirect program for XDPProgram
+ *
+ * Frames carrying untagged IPv4 (no options, not fragmented) UDP to the given port (any
+ * port if 0) are redirected to the AF_XDP socket registered for their receive queue in
+ * the XSKMAP; everything else, and frames on queues without a socket, go to the kernel
+ * stack (XDP_PASS).
+ */
+inline std::vector<struct bpf_insn> build_xdp_redirect_program(int xsk_map_fd, uint16_t port) {
+    std::vector<struct bpf_insn> prog;
+    std::vector<size_t> to_pass; // Jumps patched to the XDP_PASS exit
+    auto emit = [&](uint8_t code, uint8_t dst, uint8_t src, int16_t off, int32_t imm) {
+        struct bpf_insn insn {};
+        insn.code = code;
+        insn.dst_reg = dst & 0xF;
+        insn.src_reg = src & 0xF;
+        insn.off = off;
+        insn.imm = imm;
+        prog.push_back(insn);
+    };
+    auto load = [&](uint8_t size, uint8_t dst, uint8_t src, int16_t off) {
+        emit(BPF_LDX | BPF_MEM | size, dst, src, off, 0);
+    };
+    auto jump_to_pass = [&](uint8_t op, uint8_t dst, uint8_t src, int32_t imm) {
+        to_pass.push_back(prog.size());
+        emit(BPF_JMP | op | (src != 0 ? BPF_X : BPF_K), dst, src, 0, imm);
+    };
+
+    // r2 = data, r3 = data_end; need Ethernet (14) + IPv4 (20) + UDP (8) bytes
+    load(BPF_W, BPF_REG_2, BPF_REG_1, offsetof(struct xdp_md, data));
+    load(BPF_W, BPF_REG_3, BPF_REG_1, offsetof(struct xdp_md, data_end));
+    emit(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_4, BPF_REG_2, 0, 0);
+    emit(BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_4, 0, 0, 42);
+    jump_to_pass(BPF_JGT, BPF_REG_4, BPF_REG_3, 0);
+
+    // Packet loads keep network byte order, so compare against htons() constants
+    load(BPF_H, BPF_REG_4, BPF_REG_2, 12); // EtherType
+    jump_to_pass(BPF_JNE, BPF_REG_4, 0, htons(0x0800));
+    load(BPF_B, BPF_REG_4, BPF_REG_2, 14); // Version 4, IHL 5
+    jump_to_pass(BPF_JNE, BPF_REG_4, 0, 0x45);
+    load(BPF_B, BPF_REG_4, BPF_REG_2, 23); // Protocol
+    jump_to_pass(BPF_JNE, BPF_REG_4, 0, IPPROTO_UDP);
+    load(BPF_H, BPF_REG_4, BPF_REG_2, 20); // MF flag and fragment offset
+    jump_to_pass(BPF_JSET, BPF_REG_4, 0, htons(0x3FFF));
+    if (port != 0) {
+        load(BPF_H, BPF_REG_4, BPF_REG_2, 36); // UDP destination port
+        jump_to_pass(BPF_JNE, BPF_REG_4, 0, htons(port));
+    }
+
+    // return bpf_redirect_map(&xsks, ctx->rx_queue_index, XDP_PASS)
+    load(BPF_W, BPF_REG_2, BPF_REG_1, offsetof(struct xdp_md, rx_queue_index));
+    emit(BPF_LD | BPF_DW | BPF_IMM, BPF_REG_1, BPF_PSEUDO_MAP_FD, 0, xsk_map_fd);
+    emit(0, 0, 0, 0, 0); // Upper half of the 64-bit immediate
+    emit(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_3, 0, 0, XDP_PASS);
+    emit(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map);
+    emit(BPF_JMP | BPF_EXIT, 0, 0, 0, 0);
+
+    const size_t pass = prog.size();
+    emit(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_0, 0, 0, XDP_PASS);
+    emit(BPF_JMP | BPF_EXIT, 0, 0, 0, 0);
+    for (size_t index : to_pass) {
+        prog[index].off = static_cast<int16_t>(pass - index - 1);
+    }
+    return prog;
+}
+
+} // namespace vrtigo::utils::detail
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief XDP program steering VRT/UDP frames of an interface to AF_XDP sockets (Linux)
+ *
+ * Loads a small eBPF program and an XSKMAP (one slot per receive queue) and attaches it
+ * to the interface through a BPF link, so it is detached automatically when the last
+ * XDPProgram reference is released or the process exits. Matching frames (IPv4 UDP to
+ * the port) are redirected to the XDPVRTReader bound to their receive queue; all other
+ * traffic continues to the kernel stack.
+ *
+ * One program serves every queue of the interface: create it once and hand the shared
+ * pointer to one XDPVRTReader per queue (and thread).
+ *
+ * Requires Linux 5.9+ and CAP_NET_ADMIN plus CAP_BPF (or root). The interface must not
+ * have another XDP program attached.
+ *
+ * Example usage:
+ * @code
+ * auto program = XDPProgram::attach("eth1", 4991);
+ * XDPVRTReader reader(program, 0);  // queue 0
+ * @endcode
+ */
+class XDPProgram {
+public:
+    /**
+     * @brief Load the program and attach it to an interface
+     *
+     * @param interface Interface name
+     * @param port UDP destination port to capture (0 = all UDP)
+     * @param mode Attach mode (zero_copy attaches in driver mode)
+     * @param max_queues Receive queues the XSKMAP can hold
+     * @throws std::runtime_error if the interface does not exist or a BPF step fails
+     */
+    static std::shared_ptr<XDPProgram> attach(const std::string& interface, uint16_t port,
+                                              XDPMode mode = XDPMode::generic,
+                                              uint32_t max_queues = 64) {
+        return std::shared_ptr<XDPProgram>(new XDPProgram(interface, port, mode, max_queues));
+    }
+
+    ~XDPProgram() noexcept { close_all(); }
+
+    XDPProgram(const XDPProgram&) = delete;
+    XDPProgram& operator=(const XDPProgram&) = delete;
+
+    /**
+     * @brief Route a receive queue's frames to an AF_XDP socket
+     *
+     * Closing the socket removes it from the map again.
+     *
+     * @return 0 on success, otherwise the errno of the map update
+     */
+    int register_socket(uint32_t queue_id, int xsk_fd) noexcept {
+        union bpf_attr attr {};
+        attr.map_fd = static_cast<uint32_t>(map_fd_);
+        attr.key = reinterpret_cast<uint64_t>(&queue_id);
+        attr.value = reinterpret_cast<uint64_t>(&xsk_fd);
+        attr.flags = BPF_ANY;
+        return detail::bpf_syscall(BPF_MAP_UPDATE_ELEM, attr) < 0 ? errno : 0;
+    }
+
+    /// Interface index the program is attached to
+    unsigned int ifindex() const noexcept { return ifindex_; }
+
+    /// UDP destination port captured (0 = all UDP)
+    uint16_t port() const noexcept { return port_; }
+
+    /// Attach mode
+    XDPMode mode() const noexcept { return mode_; }
+
+    /// Receive queues the XSKMAP can hold
+    uint32_t max_queues() const noexcept { return max_queues_; }
+
+private:
+    XDPProgram(const std::string& interface, uint16_t port, XDPMode mode, uint32_t max_queues)
+        : ifindex_(if_nametoindex(interface.c_str())),
+          port_(port),
+          mode_(mode),
+          max_queues_(max_queues) {
+        if (ifindex_ == 0) {
+            throw std::runtime_error("Unknown network interface: " + interface);
+        }
+        try {
+            create_map();
+            load_program();
+            attach_link();
+        } catch (...) {
+            close_all();
+            throw;
+        }
+    }
+
+    void close_all() noexcept {
+        for (int* fd : {&link_fd_, &prog_fd_, &map_fd_}) {
+            if (*fd >= 0) {
+                ::close(*fd);
+                *fd = -1;
+            }
+        }
+    }
+
+    [[noreturn]] static void fail(const char* what) {
+        throw std::runtime_error(std::string(what) + ": " + std::strerror(errno));
+    }
+
+    void create_map() {
+        union bpf_attr attr {};
+        attr.map_type = BPF_MAP_TYPE_XSKMAP;
+        attr.key_size = sizeof(uint32_t);
+        attr.value_size = sizeof(int);
+        attr.max_entries = max_queues_;
+        map_fd_ = static_cast<int>(detail::bpf_syscall(BPF_MAP_CREATE, attr));
+        if (map_fd_ < 0) {
+            fail("Failed to create XSKMAP");
+        }
+    }
+
+    void load_program() {
+        auto insns = detail::build_xdp_redirect_program(map_fd_, port_);
+        static const char license[] = "Dual MIT/GPL";
+        union bpf_attr attr {};
+        attr.prog_type = BPF_PROG_TYPE_XDP;
+        attr.insns = reinterpret_cast<uint64_t>(insns.data());
+        attr.insn_cnt = static_cast<uint32_t>(insns.size());
+        attr.license = reinterpret_cast<uint64_t>(license);
+        attr.expected_attach_type = BPF_XDP;
+        prog_fd_ = static_cast<int>(detail::bpf_syscall(BPF_PROG_LOAD, attr));
+        if (prog_fd_ < 0) {
+            fail("Failed to load XDP program");
+        }
+    }
+
+    void attach_link() {
+        union bpf_attr attr {};
+        attr.link_create.prog_fd = static_cast<uint32_t>(prog_fd_);
+        attr.link_create.target_ifindex = ifindex_;
+        attr.link_create.attach_type = BPF_XDP;
+        attr.link_create.flags = mode_ == XDPMode::generic ? XDP_FLAGS_SKB_MODE
+                                                           : XDP_FLAGS_DRV_MODE;
+        link_fd_ = static_cast<int>(detail::bpf_syscall(BPF_LINK_CREATE, attr));
+        if (link_fd_ < 0) {
+            fail("Failed to attach XDP program");
+        }
+    }
+
+    unsigned int ifindex_; ///< Interface the program is attached to
+    uint16_t port_;        ///< Captured UDP port
+    XDPMode mode_;         ///< Attach mode
+    uint32_t max_queues_;  ///< XSKMAP size
+    int map_fd_ = -1;      ///< XSKMAP
+    int prog_fd_ = -1;     ///< Loaded program
+    int link_fd_ = -1;     ///< BPF link (detaches on close)
+};
+
+} // namespace vrtigo::utils::netio
@@ -0,0 +1,623 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Linux AF_XDP headers
+#include <linux/if_xdp.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "../../detail/endian.hpp"
+#include "../../detail/header_decode.hpp"
+#include "../../detail/packet_parser.hpp"
+#include "../../detail/packet_variant.hpp"
+#include "../../types.hpp"
+#include "../detail/instrumentation.hpp"
+#include "../detail/iteration_helpers.hpp"
+#include "udp_transport_status.hpp"
+#include "xdp_program.hpp"
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief UMEM and ring geometry of an XDPVRTReader
+ */
+struct XDPOptions {
+    uint32_t frame_count = 4096; ///< UMEM frames (power of two)
+    uint32_t frame_size = 2048;  ///< Bytes per frame (2048 or 4096); bounds the frame size
+    uint32_t ring_size = 2048;   ///< Fill and RX ring entries (power of two)
+    bool need_wakeup = true;     ///< XDP_USE_NEED_WAKEUP: kick the kernel only when asked
+};
+
+/**
+ * @brief Receive counters of an XDPVRTReader
+ *
+ * The kernel counters come from XDP_STATISTICS and are cumulative for the socket.
+ */
+struct XDPStatistics {
+    uint64_t rx_dropped = 0;         ///< Frames the kernel dropped (e.g. too large)
+    uint64_t rx_invalid_descs = 0;   ///< Invalid fill ring descriptors
+    uint64_t rx_ring_full = 0;       ///< Frames dropped because the RX ring was full
+    uint64_t rx_fill_ring_empty = 0; ///< Times no fill ring frame was available
+    uint64_t non_vrt_frames = 0;     ///< Redirected frames that were not IPv4 UDP to the port
+};
+
+/**
+ * @brief A VRT packet held in a UMEM frame
+ *
+ * Returned by XDPVRTReader::read_next_frame(). The bytes stay valid, and the frame stays
+ * out of the fill ring, until the frame is passed to XDPVRTReader::release().
+ */
+struct XDPFrame {
+    uint64_t addr = 0;                 ///< UMEM address of the frame
+    std::span<const uint8_t> packet{}; ///< VRT packet (UDP payload) inside the frame
+};
+
+} // namespace vrtigo::utils::netio
+
+namespace vrtigo::utils::detail {
+
+/**
+ * @brief Locate the UDP payload of an Ethernet frame
+ *
+ * Accepts untagged IPv4 frames carrying an unfragmented UDP datagram to port (any port
+ * if 0). Header checksums are not verified; that is left to the NIC and the kernel's
+ * receive path.
+ *
+ * @return The UDP payload, or an empty span if the frame does not match
+ */
+inline std::span<const uint8_t> udp_payload_of_frame(std::span<const uint8_t> frame,
+                                                     uint16_t port) noexcept {
+    constexpr size_t eth_header = 14;
+    constexpr size_t udp_header = 8;
+    if (frame.size() < eth_header + 20 + udp_header) {
+        return {};
+    }
+    const uint8_t* ip = frame.data() + eth_header;
+    const size_t ip_header = size_t(ip[0] & 0x0F) * 4;
+    if (frame[12] != 0x08 || frame[13] != 0x00 || (ip[0] >> 4) != 4 || ip_header < 20 ||
+        ip[9] != 17 || ((ip[6] & 0x3F) | ip[7]) != 0) {
+        return {};
+    }
+    if (frame.size() < eth_header + ip_header + udp_header) {
+        return {};
+    }
+    const uint8_t* udp = ip + ip_header;
+    const uint16_t dst_port = static_cast<uint16_t>((udp[2] << 8) | udp[3]);
+    const size_t udp_length = size_t((udp[4] << 8) | udp[5]);
+    const size_t available = frame.size() - eth_header - ip_header;
+    if ((port != 0 && dst_port != port) || udp_length < udp_header || udp_length > available) {
+        return {};
+    }
+    return {udp + udp_header, udp_length - udp_header};
+}
+
+} // namespace vrtigo::utils::detail
+
+namespace vrtigo::utils::netio {
+
+/**
+ * @brief AF_XDP VRT packet reader (Linux)
+ *
+ * Receives VRT/UDP datagrams through an AF_XDP socket bound to one receive queue of an
+ * interface, bypassing the kernel's IP and UDP layers. An XDPProgram on the interface
+ * redirects matching frames into this reader's UMEM (a private frame area shared with
+ * the kernel); Ethernet, IPv4 and UDP headers are parsed in user space, and packets are
+ * returned as views straight into the UMEM frame. Implements the PacketReader concept.
+ *
+ * **Frame Lifetime**
+ *
+ * read_next_packet() returns the previous frame to the fill ring before taking the next
+ * one, like the other readers' "valid until the next read" views. read_next_frame()
+ * instead hands out frames that stay valid until release(); frames held this way are
+ * unavailable to the kernel, so hold at most a fraction of XDPOptions::frame_count.
+ *
+ * **Scaling**
+ *
+ * Each reader owns its UMEM and rings and must be driven by one thread. Scale out with
+ * one reader (and thread) per receive queue, all sharing one XDPProgram; steer the
+ * traffic with RSS or ethtool flow rules.
+ *
+ * **Modes**
+ *
+ * XDPMode::generic works on any interface (including veth) at the cost of an skb and a
+ * copy per frame; native and zero_copy need driver support. Only untagged IPv4 without
+ * header options is redirected; all other traffic keeps flowing to the kernel stack.
+ *
+ * @warning This class is MOVE-ONLY. Requires CAP_NET_ADMIN and CAP_BPF (or root).
+ *
+ * Example usage:
+ * @code
+ * XDPVRTReader reader("eth1", 4991);  // queue 0, generic mode
+ * reader.try_set_timeout(std::chrono::milliseconds(100));
+ * while (auto pkt = reader.read_next_packet()) {
+ *     ...
+ * }
+ * @endcode
+ */
+class XDPVRTReader {
+public:
+    /**
+     * @brief Attach a program to the interface and receive one of its queues
+     *
+     * @param interface Interface name
+     * @param port UDP destination port to capture (0 = all UDP)
+     * @param queue_id Receive queue to bind
+     * @param mode XDP mode
+     * @param options UMEM and ring geometry
+     * @throws std::runtime_error if the program cannot be attached or the socket set up
+     */
+    XDPVRTReader(const std::string& interface, uint16_t port, uint32_t queue_id = 0,
+                 XDPMode mode = XDPMode::generic, XDPOptions options = {})
+        : XDPVRTReader(XDPProgram::attach(interface, port, mode), queue_id, options) {}
+
+    /**
+     * @brief Receive one queue of an interface that already has an XDPProgram
+     *
+     * @param program Program attached to the interface (shared by the per-queue readers)
+     * @param queue_id Receive queue to bind (below program->max_queues())
+     * @param options UMEM and ring geometry
+     * @throws std::invalid_argument if the geometry is invalid
+     * @throws std::runtime_error if the socket cannot be set up or bound
+     */
+    XDPVRTReader(std::shared_ptr<XDPProgram> program, uint32_t queue_id, XDPOptions options = {})
+        : program_(std::move(program)),
+          queue_id_(queue_id),
+          options_(options) {
+        validate_options();
+        try {
+            open_socket();
+        } catch (...) {
+            close_all();
+            throw;
+        }
+    }
+
+    ~XDPVRTReader() noexcept { close_all(); }
+
+    // Non-copyable
+    XDPVRTReader(const XDPVRTReader&) = delete;
+    XDPVRTReader& operator=(const XDPVRTReader&) = delete;
+
+    // Move-only semantics
+    XDPVRTReader(XDPVRTReader&& other) noexcept { move_from(other); }
+
+    XDPVRTReader& operator=(XDPVRTReader&& other) noexcept {
+        if (this != &other) {
+            close_all();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Read next packet as validated view into the UMEM
+     *
+     * Releases the frame returned by the previous call, then waits (up to the timeout) for
+     * the next VRT datagram. Frames that are not IPv4 UDP to the program's port are
+     * recycled and counted in statistics().non_vrt_frames.
+     *
+     * @return PacketVariant (RuntimeDataPacket, RuntimeContextPacket, or InvalidPacket),
+     *         or std::nullopt on timeout or socket error
+     *
+     * @note The returned view is valid until the next read operation.
+     */
+    std::optional<vrtigo::PacketVariant> read_next_packet() noexcept {
+        if (current_) {
+            release(*current_);
+            current_.reset();
+        }
+        current_ = read_next_frame();
+        if (!current_) {
+            return std::nullopt;
+        }
+        const auto received = instrumentation_.now();
+        auto packet = vrtigo::detail::parse_packet(current_->packet);
+        instrumentation_.record_received(packet, current_->packet.size(), received);
+        return packet;
+    }
+
+    /**
+     * @brief Take the next VRT datagram's frame without releasing earlier ones
+     *
+     * @return Frame holding the packet (pass it to release() when done), or std::nullopt
+     *         on timeout or socket error
+     */
+    std::optional<XDPFrame> read_next_frame() noexcept {
+        while (true) {
+            if (rx_.cached_cons == rx_.cached_prod) {
+                rx_.cached_prod = load_acquire(rx_.producer);
+                if (rx_.cached_cons == rx_.cached_prod && !wait_for_frames()) {
+                    return std::nullopt;
+                }
+                continue;
+            }
+
+            auto* descs = static_cast<const struct xdp_desc*>(rx_.descs);
+            const struct xdp_desc desc = descs[rx_.cached_cons & rx_.mask];
+            store_release(rx_.consumer, ++rx_.cached_cons);
+
+            std::span<const uint8_t> frame(umem_ + desc.addr, desc.len);
+            auto payload = detail::udp_payload_of_frame(frame, program_->port());
+            if (payload.size() < 4) {
+                ++non_vrt_frames_;
+                recycle(desc.addr);
+                continue;
+            }
+
+            uint32_t raw;
+            std::memcpy(&raw, payload.data(), sizeof(raw));
+            status_.state = UDPTransportStatus::State::packet_ready;
+            status_.bytes_received = payload.size();
+            status_.header = vrtigo::detail::network_to_host32(raw);
+            status_.packet_type = vrtigo::detail::decode_header(status_.header).type;
+            status_.errno_value = 0;
+            return XDPFrame{desc.addr, payload};
+        }
+    }
+
+    /**
+     * @brief Return a frame from read_next_frame() to the kernel
+     */
+    void release(const XDPFrame& frame) noexcept { recycle(frame.addr); }
+
+    /**
+     * @brief Iterate over all packets with automatic validation
+     *
+     * @tparam Callback Function type with signature: bool(const PacketVariant&)
+     * @param callback Function called for each packet. Return false to stop iteration.
+     * @return Number of packets processed
+     */
+    template <typename Callback>
+    size_t for_each_validated_packet(Callback&& callback) noexcept {
+        return detail::for_each_validated_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over data packets only (signal/extension data)
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::RuntimeDataPacket&)
+     * @param callback Function called for each data packet. Return false to stop.
+     * @return Number of data packets processed
+     */
+    template <typename Callback>
+    size_t for_each_data_packet(Callback&& callback) noexcept {
+        return detail::for_each_data_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over context packets only (context/extension context)
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::RuntimeContextPacket&)
+     * @param callback Function called for each context packet. Return false to stop.
+     * @return Number of context packets processed
+     */
+    template <typename Callback>
+    size_t for_each_context_packet(Callback&& callback) noexcept {
+        return detail::for_each_context_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Set how long reads wait for a frame (0 = no limit)
+     *
+     * @return Always true (kept for parity with the socket readers)
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        timeout_ = timeout;
+        return true;
+    }
+
+    /**
+     * @brief Kernel and user-space receive counters
+     */
+    XDPStatistics statistics() const noexcept {
+        XDPStatistics stats;
+        struct xdp_statistics kernel {};
+        socklen_t len = sizeof(kernel);
+        if (getsockopt(socket_, SOL_XDP, XDP_STATISTICS, &kernel, &len) == 0) {
+            stats.rx_dropped = kernel.rx_dropped;
+            stats.rx_invalid_descs = kernel.rx_invalid_descs;
+            stats.rx_ring_full = kernel.rx_ring_full;
+            stats.rx_fill_ring_empty = kernel.rx_fill_ring_empty_descs;
+        }
+        stats.non_vrt_frames = non_vrt_frames_;
+        return stats;
+    }
+
+    /**
+     * @brief Get transport status from last receive operation
+     */
+    const UDPTransportStatus& transport_status() const noexcept { return status_; }
+
+    /**
+     * @brief Get reader counters and latency histograms
+     *
+     * Empty unless built with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     */
+    const detail::Instrumentation& instrumentation() const noexcept { return instrumentation_; }
+
+    /**
+     * @brief True if the UMEM address lies in this reader's frame area
+     */
+    bool owns_frame(const uint8_t* ptr) const noexcept {
+        return umem_ != nullptr && ptr >= umem_ && ptr < umem_ + umem_size_;
+    }
+
+    /**
+     * @brief Check if the socket is open and not in error state
+     */
+    bool is_open() const noexcept { return socket_ >= 0 && !status_.is_terminal(); }
+
+    /**
+     * @brief Get the AF_XDP socket file descriptor (for poll/epoll integration)
+     */
+    int socket_fd() const noexcept { return socket_; }
+
+    /// Receive queue this reader is bound to
+    uint32_t queue_id() const noexcept { return queue_id_; }
+
+    /// Program steering frames to this reader
+    const std::shared_ptr<XDPProgram>& program() const noexcept { return program_; }
+
+private:
+    /// Mapped single-producer/single-consumer ring shared with the kernel
+    struct Ring {
+        uint32_t* producer = nullptr;
+        uint32_t* consumer = nullptr;
+        uint32_t* flags = nullptr;
+        void* descs = nullptr;
+        uint32_t mask = 0;
+        uint32_t cached_prod = 0;
+        uint32_t cached_cons = 0;
+        void* map = nullptr;
+        size_t map_size = 0;
+    };
+
+    static uint32_t load_acquire(const uint32_t* p) noexcept {
+        return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+    }
+
+    static void store_release(uint32_t* p, uint32_t value) noexcept {
+        __atomic_store_n(p, value, __ATOMIC_RELEASE);
+    }
+
+    static bool is_power_of_two(uint32_t v) noexcept { return v != 0 && (v & (v - 1)) == 0; }
+
+    [[noreturn]] static void fail(const char* what) {
+        throw std::runtime_error(std::string(what) + ": " + std::strerror(errno));
+    }
+
+    void validate_options() const {
+        if (!program_) {
+            throw std::invalid_argument("XDPVRTReader needs an XDPProgram");
+        }
+        if (!is_power_of_two(options_.frame_count) || !is_power_of_two(options_.ring_size) ||
+            (options_.frame_size != 2048 && options_.frame_size != 4096) ||
+            options_.ring_size > options_.frame_count) {
+            throw std::invalid_argument("Invalid XDPOptions geometry");
+        }
+        if (queue_id_ >= program_->max_queues()) {
+            throw std::invalid_argument("Queue outside the XDPProgram's XSKMAP");
+        }
+    }
+
+    void open_socket() {
+        socket_ = ::socket(AF_XDP, SOCK_RAW | SOCK_CLOEXEC, 0);
+        if (socket_ < 0) {
+            fail("Failed to create AF_XDP socket");
+        }
+
+        // UMEM: one private frame area shared with the kernel
+        umem_size_ = size_t(options_.frame_count) * options_.frame_size;
+        void* area = ::mmap(nullptr, umem_size_, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (area == MAP_FAILED) {
+            umem_size_ = 0;
+            fail("Failed to allocate UMEM");
+        }
+        umem_ = static_cast<uint8_t*>(area);
+
+        struct xdp_umem_reg reg {};
+        reg.addr = reinterpret_cast<uint64_t>(umem_);
+        reg.len = umem_size_;
+        reg.chunk_size = options_.frame_size;
+        if (setsockopt(socket_, SOL_XDP, XDP_UMEM_REG, &reg, sizeof(reg)) < 0) {
+            fail("Failed to register UMEM");
+        }
+
+        // Completion ring is required for binding even though this reader never transmits
+        int ring_size = static_cast<int>(options_.ring_size);
+        for (int opt : {XDP_UMEM_FILL_RING, XDP_UMEM_COMPLETION_RING, XDP_RX_RING}) {
+            if (setsockopt(socket_, SOL_XDP, opt, &ring_size, sizeof(ring_size)) < 0) {
+                fail("Failed to size AF_XDP rings");
+            }
+        }
+
+        struct xdp_mmap_offsets off {};
+        socklen_t len = sizeof(off);
+        if (getsockopt(socket_, SOL_XDP, XDP_MMAP_OFFSETS, &off, &len) < 0) {
+            fail("Failed to query AF_XDP ring offsets");
+        }
+        map_ring(fill_, off.fr, sizeof(uint64_t), XDP_UMEM_PGOFF_FILL_RING);
+        map_ring(rx_, off.rx, sizeof(struct xdp_desc), XDP_PGOFF_RX_RING);
+
+        // Every frame starts free; the fill ring takes as many as it holds
+        free_frames_.reserve(options_.frame_count);
+        for (uint32_t i = options_.frame_count; i-- > 0;) {
+            free_frames_.push_back(uint64_t(i) * options_.frame_size);
+        }
+        fill_.cached_cons = load_acquire(fill_.consumer) + options_.ring_size;
+        refill();
+
+        struct sockaddr_xdp addr {};
+        addr.sxdp_family = AF_XDP;
+        addr.sxdp_ifindex = program_->ifindex();
+        addr.sxdp_queue_id = queue_id_;
+        addr.sxdp_flags = program_->mode() == XDPMode::zero_copy ? XDP_ZEROCOPY : XDP_COPY;
+        if (options_.need_wakeup) {
+            addr.sxdp_flags |= XDP_USE_NEED_WAKEUP;
+        }
+        if (::bind(socket_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+            fail("Failed to bind AF_XDP socket");
+        }
+
+        if (int err = program_->register_socket(queue_id_, socket_); err != 0) {
+            errno = err;
+            fail("Failed to register AF_XDP socket in XSKMAP");
+        }
+    }
+
+    void map_ring(Ring& ring, const struct xdp_ring_offset& off, size_t desc_size,
+                  off_t pgoff) {
+        ring.map_size = off.desc + options_.ring_size * desc_size;
+        ring.map = ::mmap(nullptr, ring.map_size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, socket_, pgoff);
+        if (ring.map == MAP_FAILED) {
+            ring.map = nullptr;
+            fail("Failed to map AF_XDP ring");
+        }
+        auto* base = static_cast<uint8_t*>(ring.map);
+        ring.producer = reinterpret_cast<uint32_t*>(base + off.producer);
+        ring.consumer = reinterpret_cast<uint32_t*>(base + off.consumer);
+        ring.flags = reinterpret_cast<uint32_t*>(base + off.flags);
+        ring.descs = base + off.desc;
+        ring.mask = options_.ring_size - 1;
+        ring.cached_prod = load_acquire(ring.producer);
+        ring.cached_cons = load_acquire(ring.consumer);
+    }
+
+    /**
+     * @brief Return a frame to the fill ring (or the free list when the ring is full)
+     */
+    void recycle(uint64_t addr) noexcept {
+        free_frames_.push_back(addr - addr % options_.frame_size);
+        refill();
+    }
+
+    /**
+     * @brief Move free frames into the fill ring
+     *
+     * fill_.cached_cons holds the consumer index plus the ring size, so the free space is
+     * cached_cons - cached_prod without touching the shared consumer index every time.
+     */
+    void refill() noexcept {
+        if (free_frames_.empty()) {
+            return;
+        }
+        uint32_t space = fill_.cached_cons - fill_.cached_prod;
+        if (space < free_frames_.size()) {
+            fill_.cached_cons = load_acquire(fill_.consumer) + options_.ring_size;
+            space = fill_.cached_cons - fill_.cached_prod;
+        }
+        if (space == 0) {
+            return;
+        }
+        auto* addrs = static_cast<uint64_t*>(fill_.descs);
+        while (space-- > 0 && !free_frames_.empty()) {
+            addrs[fill_.cached_prod++ & fill_.mask] = free_frames_.back();
+            free_frames_.pop_back();
+        }
+        store_release(fill_.producer, fill_.cached_prod);
+    }
+
+    /**
+     * @brief Wait until the RX ring has frames or the timeout ends
+     *
+     * @return false on timeout or error (status_ updated)
+     */
+    bool wait_for_frames() noexcept {
+        if (options_.need_wakeup && (load_acquire(fill_.flags) & XDP_RING_NEED_WAKEUP) != 0) {
+            ::recvfrom(socket_, nullptr, 0, MSG_DONTWAIT, nullptr, nullptr);
+        }
+        struct pollfd pfd {};
+        pfd.fd = socket_;
+        pfd.events = POLLIN;
+        const int timeout_ms = timeout_.count() > 0 ? static_cast<int>(timeout_.count()) : -1;
+        while (true) {
+            int ready = ::poll(&pfd, 1, timeout_ms);
+            if (ready > 0) {
+                return true;
+            }
+            if (ready == 0) {
+                status_.state = UDPTransportStatus::State::timeout;
+                status_.errno_value = EAGAIN;
+                instrumentation_.record_timeout();
+                return false;
+            }
+            if (errno != EINTR) {
+                status_.state = UDPTransportStatus::State::socket_error;
+                status_.errno_value = errno;
+                instrumentation_.record_io_error();
+                return false;
+            }
+        }
+    }
+
+    void close_all() noexcept {
+        for (Ring* ring : {&rx_, &fill_}) {
+            if (ring->map != nullptr) {
+                ::munmap(ring->map, ring->map_size);
+            }
+            *ring = Ring{};
+        }
+        if (socket_ >= 0) {
+            ::close(socket_); // Also removes the socket from the XSKMAP
+            socket_ = -1;
+        }
+        if (umem_ != nullptr) {
+            ::munmap(umem_, umem_size_);
+            umem_ = nullptr;
+            umem_size_ = 0;
+        }
+        current_.reset();
+        free_frames_.clear();
+    }
+
+    void move_from(XDPVRTReader& other) noexcept {
+        program_ = std::move(other.program_);
+        queue_id_ = other.queue_id_;
+        options_ = other.options_;
+        socket_ = std::exchange(other.socket_, -1);
+        umem_ = std::exchange(other.umem_, nullptr);
+        umem_size_ = std::exchange(other.umem_size_, 0);
+        fill_ = std::exchange(other.fill_, Ring{});
+        rx_ = std::exchange(other.rx_, Ring{});
+        free_frames_ = std::move(other.free_frames_);
+        current_ = std::exchange(other.current_, std::nullopt);
+        timeout_ = other.timeout_;
+        non_vrt_frames_ = other.non_vrt_frames_;
+        status_ = other.status_;
+        instrumentation_ = std::move(other.instrumentation_);
+    }
+
+    std::shared_ptr<XDPProgram> program_;   ///< Program steering frames to this socket
+    uint32_t queue_id_ = 0;                 ///< Bound receive queue
+    XDPOptions options_;                    ///< UMEM and ring geometry
+    int socket_ = -1;                       ///< AF_XDP socket
+    uint8_t* umem_ = nullptr;               ///< UMEM frame area
+    size_t umem_size_ = 0;                  ///< UMEM size in bytes
+    Ring fill_;                             ///< Fill ring (frames handed to the kernel)
+    Ring rx_;                               ///< RX ring (frames received)
+    std::vector<uint64_t> free_frames_;     ///< Frames waiting for fill ring space
+    std::optional<XDPFrame> current_;       ///< Frame of the last read_next_packet()
+    std::chrono::milliseconds timeout_{0};  ///< Wait limit (0 = none)
+    uint64_t non_vrt_frames_ = 0;           ///< Frames that were not VRT/UDP
+    UDPTransportStatus status_;             ///< Status of last receive operation
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
+};
+
+} // namespace vrtigo::utils::netio
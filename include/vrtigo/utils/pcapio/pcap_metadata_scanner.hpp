@@ -0,0 +1,157 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "../../detail/endian.hpp"
+#include "../../packet_metadata.hpp"
+#include "../fileio/mapped_file.hpp"
+#include "pcap_common.hpp"
+
+namespace vrtigo::utils::pcapio {
+
+/**
+ * @brief Metadata-only scan of a PCAP capture of VRT packets
+ *
+ * Maps the capture and walks its records in place, extracting VRT timestamps, stream IDs
+ * and packet counts into caller-provided columns (see MetadataColumns) without copying
+ * packets or building packet views. The capture (arrival) time of each record can be
+ * written to a parallel column, which is what jitter analysis usually needs.
+ *
+ * Records follow the same rules as PCAPVRTReader: a fixed link-layer header is skipped,
+ * and records too short to hold a VRT header are skipped without producing a row.
+ */
+class PCAPMetadataScanner {
+public:
+    /**
+     * @brief Map a PCAP file for scanning
+     *
+     * @param filepath Path to PCAP file
+     * @param link_header_size Bytes to skip per record (default: 14 for Ethernet)
+     * @throws std::runtime_error if the file cannot be mapped or has an invalid PCAP header
+     * @throws std::invalid_argument if link_header_size exceeds MAX_LINK_HEADER_SIZE
+     */
+    explicit PCAPMetadataScanner(const char* filepath,
+                                 size_t link_header_size = DEFAULT_LINK_HEADER_SIZE)
+        : file_(filepath),
+          link_header_size_(link_header_size) {
+        if (link_header_size_ > MAX_LINK_HEADER_SIZE) {
+            throw std::invalid_argument("link_header_size (" + std::to_string(link_header_size_) +
+                                        ") exceeds maximum (" +
+                                        std::to_string(MAX_LINK_HEADER_SIZE) + ")");
+        }
+
+        PCAPGlobalHeader header;
+        if (file_.size() < sizeof(header)) {
+            throw std::runtime_error(std::string("Invalid PCAP file format: ") + filepath);
+        }
+        std::memcpy(&header, file_.bytes().data(), sizeof(header));
+        if (!is_valid_pcap_magic(header.magic)) {
+            throw std::runtime_error(std::string("Invalid PCAP file format: ") + filepath);
+        }
+        big_endian_pcap_ = is_big_endian_pcap(header.magic);
+        nanosecond_pcap_ = is_nanosecond_precision(header.magic);
+        offset_ = PCAP_GLOBAL_HEADER_SIZE;
+    }
+
+    explicit PCAPMetadataScanner(const std::string& filepath,
+                                 size_t link_header_size = DEFAULT_LINK_HEADER_SIZE)
+        : PCAPMetadataScanner(filepath.c_str(), link_header_size) {}
+
+    /**
+     * @brief Fill the columns with the next records' metadata
+     *
+     * @param columns Output columns (rows start at index 0)
+     * @param capture_ns Optional column receiving each record's capture time in nanoseconds
+     *                   since the Unix epoch (limits the rows like any other column)
+     * @return Rows written; 0 at end of file
+     */
+    size_t next(const MetadataColumns& columns, std::span<uint64_t> capture_ns = {}) noexcept {
+        size_t capacity = columns.capacity();
+        if (!capture_ns.empty()) {
+            capacity = capacity == 0 ? capture_ns.size() : std::min(capacity, capture_ns.size());
+        }
+
+        auto bytes = file_.bytes();
+        std::array<const uint8_t*, vrtigo::detail::metadata_block_size> pointers;
+        std::array<size_t, vrtigo::detail::metadata_block_size> sizes;
+        size_t rows = 0;
+
+        while (rows < capacity) {
+            size_t count = 0;
+            size_t limit = std::min(vrtigo::detail::metadata_block_size, capacity - rows);
+            while (count < limit && bytes.size() - offset_ >= PCAP_RECORD_HEADER_SIZE) {
+                PCAPRecordHeader record;
+                std::memcpy(&record, bytes.data() + offset_, sizeof(record));
+                record = normalize(record);
+
+                size_t record_start = offset_ + PCAP_RECORD_HEADER_SIZE;
+                size_t incl_len = std::min<size_t>(record.incl_len, bytes.size() - record_start);
+                offset_ = record_start + incl_len;
+                if (incl_len < link_header_size_ + vrt_word_size) {
+                    continue;
+                }
+
+                pointers[count] = bytes.data() + record_start + link_header_size_;
+                sizes[count] = incl_len - link_header_size_;
+                if (!capture_ns.empty()) {
+                    uint64_t sub = nanosecond_pcap_ ? record.ts_usec : record.ts_usec * 1000ULL;
+                    capture_ns[rows + count] = record.ts_sec * 1'000'000'000ULL + sub;
+                }
+                ++count;
+            }
+            if (count == 0) {
+                break;
+            }
+            vrtigo::detail::extract_metadata_block(pointers.data(), sizes.data(), count, columns,
+                                                   rows);
+            rows += count;
+        }
+        packets_scanned_ += rows;
+        return rows;
+    }
+
+    /**
+     * @brief Restart from the first record
+     */
+    void rewind() noexcept {
+        offset_ = PCAP_GLOBAL_HEADER_SIZE;
+        packets_scanned_ = 0;
+    }
+
+    /**
+     * @brief True once every record has been scanned
+     */
+    bool at_end() const noexcept { return file_.size() - offset_ < PCAP_RECORD_HEADER_SIZE; }
+
+    size_t packets_scanned() const noexcept { return packets_scanned_; }
+
+    size_t link_header_size() const noexcept { return link_header_size_; }
+
+private:
+    PCAPRecordHeader normalize(const PCAPRecordHeader& header) const noexcept {
+        if (!big_endian_pcap_) {
+            return header;
+        }
+        return PCAPRecordHeader{vrtigo::detail::byteswap32(header.ts_sec),
+                                vrtigo::detail::byteswap32(header.ts_usec),
+                                vrtigo::detail::byteswap32(header.incl_len),
+                                vrtigo::detail::byteswap32(header.orig_len)};
+    }
+
+    fileio::MappedFile file_;
+    size_t link_header_size_;
+    size_t offset_ = 0;
+    size_t packets_scanned_ = 0;
+    bool big_endian_pcap_ = false;
+    bool nanosecond_pcap_ = false;
+};
+
+} // namespace vrtigo::utils::pcapio
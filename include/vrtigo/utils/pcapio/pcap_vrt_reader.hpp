@@ -17,6 +17,7 @@
 #include "../../detail/packet_parser.hpp"
 #include "../../detail/packet_variant.hpp"
 #include "../../types.hpp"
+#include "../detail/instrumentation.hpp"
 #include "../detail/iteration_helpers.hpp"
 #include "pcap_common.hpp"
 
@@ -149,7 +150,8 @@ public:
           link_header_size_(other.link_header_size_),
           pcap_global_header_size_(other.pcap_global_header_size_),
           big_endian_pcap_(other.big_endian_pcap_),
-          vrt_buffer_(std::move(other.vrt_buffer_)) {
+          vrt_buffer_(std::move(other.vrt_buffer_)),
+          instrumentation_(std::move(other.instrumentation_)) {
         other.file_ = nullptr;
     }
 
@@ -166,6 +168,7 @@ public:
             pcap_global_header_size_ = other.pcap_global_header_size_;
             big_endian_pcap_ = other.big_endian_pcap_;
             vrt_buffer_ = std::move(other.vrt_buffer_);
+            instrumentation_ = std::move(other.instrumentation_);
             other.file_ = nullptr;
         }
         return *this;
@@ -227,6 +230,11 @@ public:
             // Check if VRT packet size is valid
             if (vrt_size < 4 || vrt_size > vrt_buffer_.size()) {
                 // VRT packet too small or too large - skip and try next
+                if (vrt_size < 4) {
+                    instrumentation_.record_error(ValidationError::buffer_too_small);
+                } else {
+                    instrumentation_.record_truncation();
+                }
                 std::fseek(file_, vrt_size, SEEK_CUR);
                 current_offset_ = std::ftell(file_);
                 continue;
@@ -243,7 +251,10 @@ public:
 
             // Validate and return VRT packet
             auto bytes = std::span<const uint8_t>(vrt_buffer_.data(), vrt_size);
-            return vrtigo::detail::parse_packet(bytes);
+            const auto received = instrumentation_.now();
+            auto packet = vrtigo::detail::parse_packet(bytes);
+            instrumentation_.record_received(packet, vrt_size, received);
+            return packet;
         }
     }
 
@@ -349,6 +360,16 @@ public:
      */
     size_t link_header_size() const noexcept { return link_header_size_; }
 
+    /**
+     * @brief Get reader counters and latency histograms
+     *
+     * snapshot() on the result is safe to call from a monitoring thread. Empty unless built
+     * with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     *
+     * @return Instrumentation owned by this reader
+     */
+    const detail::Instrumentation& instrumentation() const noexcept { return instrumentation_; }
+
     /**
      * @brief Set link-layer header size
      *
@@ -368,6 +389,7 @@ private:
     size_t pcap_global_header_size_; ///< Size of PCAP global header (24)
     bool big_endian_pcap_;           ///< True if PCAP file uses big-endian byte order
     std::array<uint8_t, MaxPacketWords * vrt_word_size> vrt_buffer_; ///< VRT packet buffer
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
 
     /**
      * @brief Normalize PCAP record header to host endianness
@@ -18,6 +18,7 @@
 #include "../../detail/buffer_io.hpp"
 #include "../../detail/packet_variant.hpp"
 #include "../../types.hpp"
+#include "../detail/instrumentation.hpp"
 #include "pcap_common.hpp"
 
 namespace vrtigo::utils::pcapio {
@@ -140,7 +141,8 @@ public:
           link_header_size_(other.link_header_size_),
           snaplen_(other.snaplen_),
           write_buffer_(std::move(other.write_buffer_)),
-          buffer_pos_(other.buffer_pos_) {
+          buffer_pos_(other.buffer_pos_),
+          instrumentation_(std::move(other.instrumentation_)) {
         other.fd_ = -1;
     }
 
@@ -157,6 +159,7 @@ public:
             snaplen_ = other.snaplen_;
             write_buffer_ = std::move(other.write_buffer_);
             buffer_pos_ = other.buffer_pos_;
+            instrumentation_ = std::move(other.instrumentation_);
             other.fd_ = -1;
         }
         return *this;
@@ -175,8 +178,11 @@ public:
      * @note Timestamps are generated automatically using system time
      */
     bool write_packet(const vrtigo::PacketVariant& pkt) noexcept {
+        const auto handed_off = instrumentation_.now();
+
         // Skip InvalidPacket
-        if (std::holds_alternative<vrtigo::InvalidPacket>(pkt)) {
+        if (const auto* invalid = std::get_if<vrtigo::InvalidPacket>(&pkt)) {
+            instrumentation_.record_error(invalid->error);
             return false;
         }
 
@@ -189,6 +195,8 @@ public:
                     vrt_bytes = p.as_bytes();
                 } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
                     vrt_bytes = std::span<const uint8_t>{p.context_buffer(), p.packet_size_bytes()};
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    vrt_bytes = p.as_bytes();
                 }
             },
             pkt);
@@ -220,23 +228,26 @@ public:
         // Write PCAP record header
         if (!write_to_buffer(reinterpret_cast<const uint8_t*>(&record_header),
                              sizeof(record_header))) {
+            instrumentation_.record_io_error();
             return false;
         }
 
         // Write dummy link-layer header (all zeros)
         if (link_header_size_ > 0) {
-            std::array<uint8_t, MAX_LINK_HEADER_SIZE> dummy_header{};
-            if (!write_to_buffer(dummy_header.data(), link_header_size_)) {
+            if (!write_zeros_to_buffer(link_header_size_)) {
+                instrumentation_.record_io_error();
                 return false;
             }
         }
 
         // Write VRT packet
         if (!write_to_buffer(vrt_bytes.data(), vrt_bytes.size())) {
+            instrumentation_.record_io_error();
             return false;
         }
 
         packets_written_++;
+        instrumentation_.record_sent(vrt_bytes, handed_off);
         return true;
     }
 
@@ -288,6 +299,16 @@ public:
      */
     uint32_t snaplen() const noexcept { return snaplen_; }
 
+    /**
+     * @brief Get writer counters and latency histograms
+     *
+     * snapshot() on the result is safe to call from a monitoring thread. Empty unless built
+     * with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     *
+     * @return Instrumentation owned by this writer
+     */
+    const detail::Instrumentation& instrumentation() const noexcept { return instrumentation_; }
+
 private:
     int fd_;                                  ///< File descriptor
     size_t packets_written_;                  ///< Number of packets written
@@ -296,6 +317,7 @@ private:
     uint32_t snaplen_;                        ///< Maximum packet length
     std::array<uint8_t, 65536> write_buffer_; ///< Internal write buffer
     size_t buffer_pos_;                       ///< Current position in write buffer
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
 
     /**
      * @brief Write PCAP global header (24 bytes)
@@ -351,6 +373,23 @@ private:
 
         return true;
     }
+
+    /**
+     * @brief Append zero bytes to the internal buffer, flushing if needed
+     *
+     * Used for the dummy link-layer header; size is at most MAX_LINK_HEADER_SIZE, so it
+     * always fits in the buffer.
+     */
+    bool write_zeros_to_buffer(size_t size) noexcept {
+        if (buffer_pos_ + size > write_buffer_.size()) {
+            if (!flush()) {
+                return false;
+            }
+        }
+        std::memset(write_buffer_.data() + buffer_pos_, 0, size);
+        buffer_pos_ += size;
+        return true;
+    }
 };
 
 } // namespace vrtigo::utils::pcapio
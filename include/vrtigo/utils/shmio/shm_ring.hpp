@@ -0,0 +1,241 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+// Linux shared memory and futex headers
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace vrtigo::utils::detail {
+
+/// "VRTR" - identifies a vrtigo shared-memory ring
+inline constexpr uint32_t shm_ring_magic = 0x56525452;
+
+/// Layout version; readers refuse rings with another version
+inline constexpr uint32_t shm_ring_version = 1;
+
+/// Consumer slots per ring (readers attached at the same time)
+inline constexpr size_t shm_max_consumers = 64;
+
+/// Smallest ring data capacity in bytes
+inline constexpr size_t shm_min_capacity = 4096;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+              "Shared-memory ring requires lock-free atomics");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "Futex words must be plain 32-bit integers");
+
+/**
+ * @brief Consumer slot in the ring header (one cache line each)
+ *
+ * state: 0 free, 1 being claimed, 2 active. read_pos is the consumer's cursor: the
+ * producer never overwrites bytes at or after the smallest active cursor.
+ */
+struct alignas(64) ShmConsumerSlot {
+    std::atomic<uint32_t> state;    ///< Slot state (free, claiming, active)
+    std::atomic<int32_t> pid;       ///< Owning process, for reclaiming dead consumers
+    std::atomic<uint64_t> read_pos; ///< Stream offset of the consumer's current packet
+};
+
+/**
+ * @brief Control block at the start of the shared mapping
+ *
+ * Positions are monotonic byte offsets; ring offset = position & (capacity - 1). Packets
+ * are stored back to back and never wrap: when a packet does not fit before the end of
+ * the ring, the producer writes a zero header word there (a VRT header cannot have size 0)
+ * and continues at offset 0.
+ */
+struct ShmRingHeader {
+    uint32_t magic;       ///< shm_ring_magic
+    uint32_t version;     ///< shm_ring_version
+    uint64_t capacity;    ///< Data capacity in bytes (power of two)
+    uint64_t data_offset; ///< Offset of the data area from the mapping start
+
+    alignas(64) std::atomic<uint64_t> write_pos; ///< Published end of data
+    std::atomic<uint32_t> data_seq;              ///< Futex word bumped on each publish
+    std::atomic<uint32_t> readers_waiting;       ///< Consumers sleeping on data_seq
+    std::atomic<uint32_t> closed;                ///< Producer closed the ring
+
+    alignas(64) std::atomic<uint32_t> space_seq; ///< Futex word bumped when space frees
+    std::atomic<uint32_t> writer_waiting;        ///< Producer sleeping on space_seq
+
+    ShmConsumerSlot consumers[shm_max_consumers]; ///< Consumer cursors
+};
+
+/**
+ * @brief Size of the mapping for a ring of the given data capacity
+ */
+inline size_t shm_mapping_size(size_t capacity) noexcept {
+    auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t header = (sizeof(ShmRingHeader) + page - 1) / page * page;
+    return header + capacity;
+}
+
+/**
+ * @brief Sleep until the futex word differs from expected (or timeout / wakeup)
+ *
+ * @param timeout Relative timeout; zero waits without limit
+ */
+inline void futex_wait(std::atomic<uint32_t>& word, uint32_t expected,
+                       std::chrono::milliseconds timeout) noexcept {
+    struct timespec ts {};
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+    ts.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected,
+              timeout.count() > 0 ? &ts : nullptr, nullptr, 0);
+}
+
+/**
+ * @brief Wake every process sleeping on a futex word
+ */
+inline void futex_wake_all(std::atomic<uint32_t>& word) noexcept {
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr,
+              nullptr, 0);
+}
+
+/**
+ * @brief Owned shared mapping of a ring (descriptor plus mmap)
+ */
+class ShmMapping {
+public:
+    ShmMapping() noexcept = default;
+
+    /**
+     * @brief Map an existing ring descriptor and check its header
+     *
+     * @throws std::runtime_error if the descriptor is not a compatible ring
+     */
+    ShmMapping(int fd, bool take_ownership) : fd_(fd), owns_fd_(take_ownership) {
+        struct stat info {};
+        if (fd_ < 0 || ::fstat(fd_, &info) < 0 ||
+            static_cast<size_t>(info.st_size) < sizeof(ShmRingHeader)) {
+            release();
+            throw std::runtime_error("Not a shared-memory ring descriptor");
+        }
+        map(static_cast<size_t>(info.st_size));
+        const auto* ring = header();
+        if (ring->magic != shm_ring_magic || ring->version != shm_ring_version ||
+            shm_mapping_size(ring->capacity) != size_) {
+            release();
+            throw std::runtime_error("Incompatible shared-memory ring");
+        }
+    }
+
+    /**
+     * @brief Create and initialize a ring on a fresh descriptor
+     *
+     * @throws std::runtime_error if sizing or mapping fails
+     */
+    static ShmMapping create(int fd, size_t capacity) {
+        ShmMapping mapping;
+        mapping.fd_ = fd;
+        mapping.owns_fd_ = true;
+        size_t size = shm_mapping_size(capacity);
+        if (::ftruncate(fd, static_cast<off_t>(size)) < 0) {
+            mapping.release();
+            throw std::runtime_error(std::string("Failed to size shared-memory ring: ") +
+                                     std::strerror(errno));
+        }
+        mapping.map(size);
+
+        auto* ring = new (mapping.base_) ShmRingHeader{};
+        ring->capacity = capacity;
+        ring->data_offset = size - capacity;
+        ring->version = shm_ring_version;
+        std::atomic_thread_fence(std::memory_order_release);
+        ring->magic = shm_ring_magic;
+        return mapping;
+    }
+
+    ~ShmMapping() noexcept { release(); }
+
+    ShmMapping(const ShmMapping&) = delete;
+    ShmMapping& operator=(const ShmMapping&) = delete;
+
+    ShmMapping(ShmMapping&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1)),
+          owns_fd_(std::exchange(other.owns_fd_, false)),
+          base_(std::exchange(other.base_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    ShmMapping& operator=(ShmMapping&& other) noexcept {
+        if (this != &other) {
+            release();
+            fd_ = std::exchange(other.fd_, -1);
+            owns_fd_ = std::exchange(other.owns_fd_, false);
+            base_ = std::exchange(other.base_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ShmRingHeader* header() const noexcept { return static_cast<ShmRingHeader*>(base_); }
+
+    uint8_t* data() const noexcept {
+        return static_cast<uint8_t*>(base_) + header()->data_offset;
+    }
+
+    int fd() const noexcept { return fd_; }
+
+    bool valid() const noexcept { return base_ != nullptr; }
+
+private:
+    void map(size_t size) {
+        void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (base == MAP_FAILED) {
+            int err = errno;
+            release();
+            throw std::runtime_error(std::string("Failed to map shared-memory ring: ") +
+                                     std::strerror(err));
+        }
+        base_ = base;
+        size_ = size;
+    }
+
+    void release() noexcept {
+        if (base_ != nullptr) {
+            ::munmap(base_, size_);
+            base_ = nullptr;
+            size_ = 0;
+        }
+        if (owns_fd_ && fd_ >= 0) {
+            ::close(fd_);
+        }
+        fd_ = -1;
+        owns_fd_ = false;
+    }
+
+    int fd_ = -1;          ///< Shared-memory descriptor
+    bool owns_fd_ = false; ///< Close descriptor on release
+    void* base_ = nullptr; ///< Mapping start
+    size_t size_ = 0;      ///< Mapping length
+};
+
+/**
+ * @brief Check whether the process owning a consumer slot has exited
+ */
+inline bool shm_consumer_is_dead(const ShmConsumerSlot& slot) noexcept {
+    int32_t pid = slot.pid.load(std::memory_order_relaxed);
+    return pid > 0 && ::kill(pid, 0) < 0 && errno == ESRCH;
+}
+
+} // namespace vrtigo::utils::detail
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "vrtigo/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vrtigo::utils::shmio {
+
+/**
+ * @brief Status information for the shared-memory ring transport
+ *
+ * Tracks the state of the last ring read or write.
+ */
+struct ShmTransportStatus {
+    /**
+     * @brief State of the last ring operation
+     */
+    enum class State : uint8_t {
+        /** Packet read from (or written to) the ring */
+        packet_ready,
+
+        /** Producer closed the ring and every packet has been read */
+        producer_closed,
+
+        /** Wait timed out (reader: no packet; blocking writer: no space) - non-terminal */
+        timeout,
+
+        /** Ring full for the slowest consumer; the packet was dropped - non-terminal */
+        ring_full,
+
+        /** Packet rejected (invalid or larger than half the ring) */
+        invalid_packet,
+
+        /** No free consumer slot, or the mapping is not a valid ring */
+        ring_error
+    };
+
+    /** Current state */
+    State state{State::packet_ready};
+
+    /** Size of the last packet in bytes */
+    size_t packet_size{0};
+
+    /** VRT header of the last packet in host byte order */
+    uint32_t header{0};
+
+    /** Platform errno value for error states */
+    int errno_value{0};
+
+    /**
+     * @brief Check if the ring is in a terminal state
+     *
+     * @return true if the producer is gone or the ring cannot be used
+     */
+    bool is_terminal() const noexcept {
+        return state == State::producer_closed || state == State::ring_error;
+    }
+};
+
+/**
+ * @brief Convert ShmTransportStatus::State to human-readable string
+ *
+ * @param state The transport state to convert
+ * @return String representation of the state
+ */
+constexpr const char* transport_state_string(ShmTransportStatus::State state) noexcept {
+    switch (state) {
+        case ShmTransportStatus::State::packet_ready:
+            return "packet_ready";
+        case ShmTransportStatus::State::producer_closed:
+            return "producer_closed";
+        case ShmTransportStatus::State::timeout:
+            return "timeout";
+        case ShmTransportStatus::State::ring_full:
+            return "ring_full";
+        case ShmTransportStatus::State::invalid_packet:
+            return "invalid_packet";
+        case ShmTransportStatus::State::ring_error:
+            return "ring_error";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace vrtigo::utils::shmio
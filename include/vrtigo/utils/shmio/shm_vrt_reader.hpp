@@ -0,0 +1,397 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Linux shared memory headers
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../../detail/endian.hpp"
+#include "../../detail/header_decode.hpp"
+#include "../../detail/packet_parser.hpp"
+#include "../../detail/packet_variant.hpp"
+#include "../../types.hpp"
+#include "../detail/instrumentation.hpp"
+#include "../detail/iteration_helpers.hpp"
+#include "shm_ring.hpp"
+#include "shm_transport_status.hpp"
+
+namespace vrtigo::utils::shmio {
+
+/**
+ * @brief Shared-memory ring consumer (Linux)
+ *
+ * Attaches to a ring created by ShmVRTWriter and returns each packet as a view directly
+ * into shared memory (zero copies). Implements the PacketReader concept, so the iteration
+ * helpers work as they do for the file and socket readers.
+ *
+ * Each reader claims a consumer slot and keeps its own cursor there, so any number of
+ * readers (up to 64 per ring) consume the same stream independently. A reader starts at
+ * the newest data: packets written before it attached are not delivered. The packet
+ * returned by read_next_packet() stays pinned until the next call, which releases it.
+ * Cursors are independent but space is shared: a reader that stops calling holds back
+ * the producer, so every reader of the ring sees the drops or the stall (see
+ * ShmFullPolicy).
+ *
+ * When the ring is empty the reader sleeps on a futex in the ring header; the producer
+ * only makes the wake syscall while some reader is asleep.
+ *
+ * @warning This class is MOVE-ONLY. Returned views are valid until the next read.
+ *
+ * Example usage:
+ * @code
+ * ShmVRTReader reader("/radio0");
+ * reader.try_set_timeout(std::chrono::milliseconds(100));
+ * while (auto pkt = reader.read_next_packet()) {
+ *     ...
+ * }
+ * @endcode
+ */
+class ShmVRTReader {
+public:
+    /**
+     * @brief Attach to a named ring
+     *
+     * @param name Shared-memory object name used by the writer
+     * @throws std::runtime_error if the ring does not exist, is incompatible, or has no
+     *         free consumer slot
+     */
+    explicit ShmVRTReader(const std::string& name) : ShmVRTReader(open_named(name), true) {}
+
+    /**
+     * @brief Attach to a ring by descriptor (memfd from ShmVRTWriter::fd())
+     *
+     * @param fd Shared-memory descriptor
+     * @param take_ownership If true, the descriptor is closed when the reader detaches
+     * @throws std::runtime_error if the descriptor is not a compatible ring or has no free
+     *         consumer slot
+     */
+    explicit ShmVRTReader(int fd, bool take_ownership = false) : mapping_(fd, take_ownership) {
+        ring_ = mapping_.header();
+        data_ = mapping_.data();
+        mask_ = static_cast<size_t>(ring_->capacity) - 1;
+        claim_slot();
+    }
+
+    /**
+     * @brief Destructor - releases the consumer slot
+     */
+    ~ShmVRTReader() noexcept { detach(); }
+
+    // Non-copyable
+    ShmVRTReader(const ShmVRTReader&) = delete;
+    ShmVRTReader& operator=(const ShmVRTReader&) = delete;
+
+    // Move-only semantics
+    ShmVRTReader(ShmVRTReader&& other) noexcept
+        : mapping_(std::move(other.mapping_)),
+          ring_(std::exchange(other.ring_, nullptr)),
+          data_(std::exchange(other.data_, nullptr)),
+          slot_(std::exchange(other.slot_, nullptr)),
+          mask_(other.mask_),
+          cursor_(other.cursor_),
+          pending_(other.pending_),
+          timeout_(other.timeout_),
+          status_(other.status_),
+          instrumentation_(std::move(other.instrumentation_)) {}
+
+    ShmVRTReader& operator=(ShmVRTReader&& other) noexcept {
+        if (this != &other) {
+            detach();
+            mapping_ = std::move(other.mapping_);
+            ring_ = std::exchange(other.ring_, nullptr);
+            data_ = std::exchange(other.data_, nullptr);
+            slot_ = std::exchange(other.slot_, nullptr);
+            mask_ = other.mask_;
+            cursor_ = other.cursor_;
+            pending_ = other.pending_;
+            timeout_ = other.timeout_;
+            status_ = other.status_;
+            instrumentation_ = std::move(other.instrumentation_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Read next packet as validated view into shared memory
+     *
+     * Releases the previously returned packet, then blocks (up to the timeout) until the
+     * producer publishes another one.
+     *
+     * @return PacketVariant (RuntimeDataPacket, RuntimeContextPacket, or InvalidPacket),
+     *         or std::nullopt on timeout or once the producer closed and the ring is drained
+     *
+     * @note The returned view is valid until the next read operation.
+     */
+    std::optional<vrtigo::PacketVariant> read_next_packet() noexcept {
+        if (slot_ == nullptr || status_.is_terminal()) {
+            return std::nullopt;
+        }
+
+        release_current();
+
+        while (true) {
+            uint64_t published = ring_->write_pos.load(std::memory_order_acquire);
+            if (cursor_ == published) {
+                if (ring_->closed.load(std::memory_order_acquire) != 0 &&
+                    ring_->write_pos.load(std::memory_order_acquire) == cursor_) {
+                    status_.state = ShmTransportStatus::State::producer_closed;
+                    return std::nullopt;
+                }
+                if (!wait_for_data()) {
+                    status_.state = ShmTransportStatus::State::timeout;
+                    instrumentation_.record_timeout();
+                    return std::nullopt;
+                }
+                continue;
+            }
+
+            size_t offset = static_cast<size_t>(cursor_) & mask_;
+            uint32_t raw = 0;
+            std::memcpy(&raw, data_ + offset, vrt_word_size);
+            if (raw == 0) {
+                // Padding marker: the next packet starts at the beginning of the ring
+                cursor_ += mask_ + 1 - offset;
+                continue;
+            }
+
+            uint32_t header = vrtigo::detail::network_to_host32(raw);
+            size_t size = size_t(vrtigo::detail::decode_header(header).size_words) * vrt_word_size;
+            pending_ = size;
+            status_.state = ShmTransportStatus::State::packet_ready;
+            status_.header = header;
+            status_.packet_size = size;
+
+            const auto received = instrumentation_.now();
+            auto packet =
+                vrtigo::detail::parse_packet(std::span<const uint8_t>(data_ + offset, size));
+            instrumentation_.record_received(packet, size, received);
+            return packet;
+        }
+    }
+
+    /**
+     * @brief Iterate over all packets with automatic validation
+     *
+     * @tparam Callback Function type with signature: bool(const PacketVariant&)
+     * @param callback Function called for each packet. Return false to stop iteration.
+     * @return Number of packets processed
+     */
+    template <typename Callback>
+    size_t for_each_validated_packet(Callback&& callback) noexcept {
+        return detail::for_each_validated_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over data packets only (signal/extension data)
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::RuntimeDataPacket&)
+     * @param callback Function called for each data packet. Return false to stop.
+     * @return Number of data packets processed
+     */
+    template <typename Callback>
+    size_t for_each_data_packet(Callback&& callback) noexcept {
+        return detail::for_each_data_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over context packets only (context/extension context)
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::RuntimeContextPacket&)
+     * @param callback Function called for each context packet. Return false to stop.
+     * @return Number of context packets processed
+     */
+    template <typename Callback>
+    size_t for_each_context_packet(Callback&& callback) noexcept {
+        return detail::for_each_context_packet(*this, std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Iterate over packets with a specific stream ID
+     *
+     * @tparam Callback Function type with signature: bool(const vrtigo::PacketVariant&)
+     * @param stream_id_filter The stream ID to filter by
+     * @param callback Function called for each matching packet. Return false to stop.
+     * @return Number of matching packets processed
+     */
+    template <typename Callback>
+    size_t for_each_packet_with_stream_id(uint32_t stream_id_filter,
+                                          Callback&& callback) noexcept {
+        return detail::for_each_packet_with_stream_id(*this, stream_id_filter,
+                                                      std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Set how long read_next_packet() waits for data (0 = no limit)
+     *
+     * @return Always true (kept for parity with the socket readers)
+     */
+    bool try_set_timeout(std::chrono::milliseconds timeout) noexcept {
+        timeout_ = timeout;
+        return true;
+    }
+
+    /**
+     * @brief Bytes published by the producer that this reader has not consumed yet
+     */
+    [[nodiscard]] size_t backlog_bytes() const noexcept {
+        if (ring_ == nullptr) {
+            return 0;
+        }
+        return static_cast<size_t>(ring_->write_pos.load(std::memory_order_acquire) - cursor_ -
+                                   pending_);
+    }
+
+    /**
+     * @brief Ring data capacity in bytes
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return mask_ + 1; }
+
+    /**
+     * @brief Get transport status
+     */
+    [[nodiscard]] const ShmTransportStatus& transport_status() const noexcept { return status_; }
+
+    /**
+     * @brief Get reader counters and latency histograms
+     *
+     * Empty unless built with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     */
+    [[nodiscard]] const detail::Instrumentation& instrumentation() const noexcept {
+        return instrumentation_;
+    }
+
+    /**
+     * @brief Check if the reader is attached and the ring is not closed and drained
+     */
+    [[nodiscard]] bool is_open() const noexcept {
+        return slot_ != nullptr && !status_.is_terminal();
+    }
+
+private:
+    static constexpr uint32_t slot_free = 0;
+    static constexpr uint32_t slot_claiming = 1;
+    static constexpr uint32_t slot_active = 2;
+
+    static int open_named(const std::string& name) {
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open shared-memory ring " + name + ": " +
+                                     std::strerror(errno));
+        }
+        return fd;
+    }
+
+    /**
+     * @brief Take a free consumer slot, starting at the producer's current position
+     */
+    void claim_slot() {
+        for (auto& slot : ring_->consumers) {
+            uint32_t expected = slot_free;
+            if (slot.state.compare_exchange_strong(expected, slot_claiming)) {
+                // Cursor first, then activate: the producer only reads active cursors
+                cursor_ = ring_->write_pos.load(std::memory_order_seq_cst);
+                slot.read_pos.store(cursor_, std::memory_order_seq_cst);
+                slot.pid.store(static_cast<int32_t>(::getpid()), std::memory_order_relaxed);
+                slot.state.store(slot_active, std::memory_order_seq_cst);
+
+                // The producer ignored this slot until now and may have lapped cursor_;
+                // restart from what it has published since
+                cursor_ = ring_->write_pos.load(std::memory_order_seq_cst);
+                slot.read_pos.store(cursor_, std::memory_order_seq_cst);
+                slot_ = &slot;
+                return;
+            }
+        }
+        mapping_ = detail::ShmMapping{};
+        throw std::runtime_error("No free consumer slot in shared-memory ring");
+    }
+
+    /**
+     * @brief Release the last packet: publish the cursor past it and wake a blocked producer
+     */
+    void release_current() noexcept {
+        if (pending_ == 0) {
+            return;
+        }
+        cursor_ += pending_;
+        pending_ = 0;
+        slot_->read_pos.store(cursor_, std::memory_order_seq_cst);
+        if (ring_->writer_waiting.load(std::memory_order_seq_cst) != 0) {
+            ring_->space_seq.fetch_add(1);
+            detail::futex_wake_all(ring_->space_seq);
+        }
+    }
+
+    /**
+     * @brief Sleep until the producer publishes past cursor_, closes, or the timeout ends
+     *
+     * @return false on timeout
+     */
+    bool wait_for_data() noexcept {
+        const auto deadline = std::chrono::steady_clock::now() + timeout_;
+        while (true) {
+            uint32_t seq = ring_->data_seq.load(std::memory_order_seq_cst);
+            ring_->readers_waiting.fetch_add(1, std::memory_order_seq_cst);
+            bool ready = ring_->write_pos.load(std::memory_order_seq_cst) != cursor_ ||
+                         ring_->closed.load(std::memory_order_seq_cst) != 0;
+            auto remaining = std::chrono::milliseconds{0};
+            bool expired = false;
+            if (!ready && timeout_.count() > 0) {
+                remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now());
+                expired = remaining.count() <= 0;
+            }
+            if (!ready && !expired) {
+                detail::futex_wait(ring_->data_seq, seq, remaining);
+            }
+            ring_->readers_waiting.fetch_sub(1, std::memory_order_seq_cst);
+            if (ready || ring_->write_pos.load(std::memory_order_acquire) != cursor_ ||
+                ring_->closed.load(std::memory_order_acquire) != 0) {
+                return true;
+            }
+            if (expired) {
+                return false;
+            }
+        }
+    }
+
+    void detach() noexcept {
+        if (slot_ != nullptr) {
+            slot_->state.store(slot_free, std::memory_order_release);
+            if (ring_->writer_waiting.load() != 0) {
+                ring_->space_seq.fetch_add(1);
+                detail::futex_wake_all(ring_->space_seq);
+            }
+            slot_ = nullptr;
+        }
+        ring_ = nullptr;
+        data_ = nullptr;
+        mapping_ = detail::ShmMapping{};
+    }
+
+    detail::ShmMapping mapping_;              ///< Shared mapping
+    detail::ShmRingHeader* ring_ = nullptr;   ///< Control block
+    const uint8_t* data_ = nullptr;           ///< Ring data area
+    detail::ShmConsumerSlot* slot_ = nullptr; ///< This reader's consumer slot
+    size_t mask_ = 0;                         ///< capacity - 1
+    uint64_t cursor_ = 0;                     ///< Stream offset of the current packet
+    size_t pending_ = 0;                      ///< Size of the packet returned last
+    std::chrono::milliseconds timeout_{0};    ///< Wait limit (0 = none)
+    ShmTransportStatus status_{};             ///< Transport status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
+};
+
+} // namespace vrtigo::utils::shmio
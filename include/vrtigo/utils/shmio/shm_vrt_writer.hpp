@@ -0,0 +1,478 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Linux shared memory headers
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "vrtigo/detail/endian.hpp"
+#include "vrtigo/detail/header_decode.hpp"
+#include "vrtigo/detail/packet_concepts.hpp"
+#include "vrtigo/detail/packet_variant.hpp"
+#include "vrtigo/utils/detail/instrumentation.hpp"
+#include "vrtigo/utils/detail/writer_concepts.hpp"
+#include "vrtigo/utils/shmio/shm_ring.hpp"
+#include "vrtigo/utils/shmio/shm_transport_status.hpp"
+
+namespace vrtigo::utils::shmio {
+
+/**
+ * @brief What the producer does when the slowest consumer leaves no room for a packet
+ *
+ * Either way the cost lands on every consumer of the ring, not only the slow one.
+ */
+enum class ShmFullPolicy : uint8_t {
+    drop, ///< Reject the packet (write_packet() returns false, state ring_full)
+    block ///< Wait for consumers to free space, up to the block timeout
+};
+
+/**
+ * @brief Shared-memory ring producer for same-host VRT transport (Linux)
+ *
+ * Creates a single-producer, multi-consumer ring of VRT packets in shared memory. Each
+ * write_packet() is one memcpy into the ring plus an atomic publish; consumers
+ * (ShmVRTReader) read packets in place, so no kernel copy happens in either direction.
+ * Sleeping consumers are woken with a futex on the ring header, and only when one is
+ * actually waiting.
+ *
+ * The ring is named (shm_open; readers attach with the same name) or anonymous (memfd;
+ * hand fd() to readers through fork() or SCM_RIGHTS).
+ *
+ * Flow Control:
+ * - Each attached consumer publishes its cursor in its own slot; the producer never
+ *   overwrites bytes a consumer has not released, so views stay valid
+ * - Consumers are not isolated from each other: the slowest active cursor bounds the
+ *   free space for everyone. A consumer that stalls (or holds its last view) fills the
+ *   ring, after which ShmFullPolicy::drop (default) rejects new packets for every
+ *   consumer and ShmFullPolicy::block stalls the producer until it catches up
+ * - Slots of consumer processes that exited without detaching are reclaimed when the
+ *   ring is full
+ * - Packets larger than half the ring are rejected
+ *
+ * Satisfies the FlushableWriter concept.
+ *
+ * Example usage:
+ * @code
+ * ShmVRTWriter writer("/radio0", 16 * 1024 * 1024);
+ * writer.write_packet(packet);
+ *
+ * // In another process
+ * ShmVRTReader reader("/radio0");
+ * reader.for_each_data_packet([](const vrtigo::RuntimeDataPacket& pkt) { ... });
+ * @endcode
+ */
+class ShmVRTWriter {
+public:
+    static constexpr size_t default_capacity = 4 * 1024 * 1024; ///< Default ring data size
+
+    /**
+     * @brief Create a named ring (shm_open)
+     *
+     * The name is unlinked when the writer is destroyed; attached readers keep their
+     * mapping until they detach.
+     *
+     * @param name Shared-memory object name ("/something")
+     * @param capacity Ring data size, rounded up to a power of two (minimum 4 KiB)
+     * @throws std::runtime_error if the object exists or cannot be created
+     */
+    explicit ShmVRTWriter(const std::string& name, size_t capacity = default_capacity)
+        : name_(name) {
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to create shared-memory ring " + name + ": " +
+                                     std::strerror(errno));
+        }
+        try {
+            mapping_ = detail::ShmMapping::create(fd, ring_capacity_for(capacity));
+        } catch (...) {
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+        attach();
+    }
+
+    /**
+     * @brief Create an anonymous ring (memfd)
+     *
+     * Share it with fd(): inherit it across fork() or pass it over a Unix socket, then
+     * construct ShmVRTReader from the descriptor.
+     *
+     * @param capacity Ring data size, rounded up to a power of two (minimum 4 KiB)
+     * @throws std::runtime_error if the memfd cannot be created
+     */
+    explicit ShmVRTWriter(size_t capacity = default_capacity) {
+        int fd = ::memfd_create("vrtigo-shm-ring", MFD_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error(std::string("Failed to create memfd ring: ") +
+                                     std::strerror(errno));
+        }
+        mapping_ = detail::ShmMapping::create(fd, ring_capacity_for(capacity));
+        attach();
+    }
+
+    /**
+     * @brief Destructor - closes the ring (readers drain it, then see producer_closed)
+     */
+    ~ShmVRTWriter() noexcept { close(); }
+
+    // Non-copyable
+    ShmVRTWriter(const ShmVRTWriter&) = delete;
+    ShmVRTWriter& operator=(const ShmVRTWriter&) = delete;
+
+    // Move-only semantics
+    ShmVRTWriter(ShmVRTWriter&& other) noexcept
+        : name_(std::move(other.name_)),
+          mapping_(std::move(other.mapping_)),
+          ring_(std::exchange(other.ring_, nullptr)),
+          data_(std::exchange(other.data_, nullptr)),
+          mask_(other.mask_),
+          policy_(other.policy_),
+          block_timeout_(other.block_timeout_),
+          packets_written_(other.packets_written_),
+          bytes_written_(other.bytes_written_),
+          packets_dropped_(other.packets_dropped_),
+          status_(other.status_),
+          instrumentation_(std::move(other.instrumentation_)) {
+        other.name_.clear();
+    }
+
+    ShmVRTWriter& operator=(ShmVRTWriter&& other) noexcept {
+        if (this != &other) {
+            close();
+            name_ = std::move(other.name_);
+            other.name_.clear();
+            mapping_ = std::move(other.mapping_);
+            ring_ = std::exchange(other.ring_, nullptr);
+            data_ = std::exchange(other.data_, nullptr);
+            mask_ = other.mask_;
+            policy_ = other.policy_;
+            block_timeout_ = other.block_timeout_;
+            packets_written_ = other.packets_written_;
+            bytes_written_ = other.bytes_written_;
+            packets_dropped_ = other.packets_dropped_;
+            status_ = other.status_;
+            instrumentation_ = std::move(other.instrumentation_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Write packet from variant
+     *
+     * @param packet The packet variant to write
+     * @return true if published, false if invalid, too large, or the ring is full
+     */
+    bool write_packet(const vrtigo::PacketVariant& packet) noexcept {
+        return std::visit(
+            [this](auto&& pkt) -> bool {
+                using T = std::decay_t<decltype(pkt)>;
+
+                if constexpr (std::is_same_v<T, vrtigo::RuntimeDataPacket>) {
+                    return write_bytes(pkt.as_bytes());
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeContextPacket>) {
+                    // RuntimeContextPacket uses context_buffer() instead of as_bytes()
+                    return write_bytes({pkt.context_buffer(), pkt.packet_size_bytes()});
+                } else if constexpr (std::is_same_v<T, vrtigo::RuntimeCommandPacket>) {
+                    return write_bytes(pkt.as_bytes());
+                } else {
+                    status_.state = ShmTransportStatus::State::invalid_packet;
+                    status_.errno_value = EINVAL;
+                    return false;
+                }
+            },
+            packet);
+    }
+
+    /**
+     * @brief Write RuntimeDataPacket
+     */
+    bool write_packet(const vrtigo::RuntimeDataPacket& packet) noexcept {
+        return write_bytes(packet.as_bytes());
+    }
+
+    /**
+     * @brief Write RuntimeContextPacket
+     */
+    bool write_packet(const vrtigo::RuntimeContextPacket& packet) noexcept {
+        return write_bytes({packet.context_buffer(), packet.packet_size_bytes()});
+    }
+
+    /**
+     * @brief Write compile-time packet
+     *
+     * @tparam PacketType Type satisfying CompileTimePacket concept
+     */
+    template <typename PacketType>
+        requires vrtigo::CompileTimePacket<PacketType>
+    bool write_packet(const PacketType& packet) noexcept {
+        return write_bytes(packet.as_bytes());
+    }
+
+    /**
+     * @brief Flush operation (no-op: packets are visible as soon as they are written)
+     *
+     * @return Always true
+     */
+    bool flush() noexcept { return true; }
+
+    /**
+     * @brief Mark the ring closed and wake all consumers
+     *
+     * Consumers read the remaining packets, then get std::nullopt with state
+     * producer_closed. Further writes fail. Called by the destructor.
+     */
+    void close() noexcept {
+        if (ring_ != nullptr) {
+            ring_->closed.store(1, std::memory_order_release);
+            ring_->data_seq.fetch_add(1);
+            detail::futex_wake_all(ring_->data_seq);
+            ring_ = nullptr;
+            data_ = nullptr;
+        }
+        if (!name_.empty()) {
+            ::shm_unlink(name_.c_str());
+            name_.clear();
+        }
+        mapping_ = detail::ShmMapping{};
+    }
+
+    /**
+     * @brief Choose between dropping and blocking when the slowest consumer fills the ring
+     */
+    void set_full_policy(ShmFullPolicy policy) noexcept { policy_ = policy; }
+
+    /**
+     * @brief Set how long a blocking write waits for space (0 = no limit)
+     */
+    void set_block_timeout(std::chrono::milliseconds timeout) noexcept {
+        block_timeout_ = timeout;
+    }
+
+    /**
+     * @brief Number of consumers currently attached
+     */
+    [[nodiscard]] size_t consumer_count() const noexcept {
+        if (ring_ == nullptr) {
+            return 0;
+        }
+        size_t count = 0;
+        for (const auto& slot : ring_->consumers) {
+            count += slot.state.load(std::memory_order_acquire) == slot_active ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Ring data capacity in bytes (a power of two)
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return mask_ + 1; }
+
+    /**
+     * @brief Shared-memory descriptor (pass to ShmVRTReader in another process)
+     */
+    [[nodiscard]] int fd() const noexcept { return mapping_.fd(); }
+
+    /**
+     * @brief Get number of packets written
+     */
+    [[nodiscard]] size_t packets_written() const noexcept { return packets_written_; }
+
+    /**
+     * @brief Get number of bytes written
+     */
+    [[nodiscard]] size_t bytes_written() const noexcept { return bytes_written_; }
+
+    /**
+     * @brief Get number of packets rejected because the ring was full
+     */
+    [[nodiscard]] size_t packets_dropped() const noexcept { return packets_dropped_; }
+
+    /**
+     * @brief Get transport status
+     */
+    [[nodiscard]] const ShmTransportStatus& transport_status() const noexcept { return status_; }
+
+    /**
+     * @brief Get writer counters and latency histograms
+     *
+     * Empty unless built with VRTIGO_ENABLE_INSTRUMENTATION=1.
+     */
+    [[nodiscard]] const detail::Instrumentation& instrumentation() const noexcept {
+        return instrumentation_;
+    }
+
+    /**
+     * @brief Check if the ring is open for writing
+     */
+    [[nodiscard]] bool is_open() const noexcept { return ring_ != nullptr; }
+
+private:
+    static constexpr uint32_t slot_active = 2;
+
+    static size_t ring_capacity_for(size_t requested) noexcept {
+        size_t capacity = detail::shm_min_capacity;
+        while (capacity < requested) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    void attach() noexcept {
+        ring_ = mapping_.header();
+        data_ = mapping_.data();
+        mask_ = static_cast<size_t>(ring_->capacity) - 1;
+    }
+
+    /**
+     * @brief Smallest cursor of the active consumers (pos itself if there are none)
+     */
+    uint64_t slowest_consumer(uint64_t pos) const noexcept {
+        uint64_t slowest = pos;
+        for (const auto& slot : ring_->consumers) {
+            if (slot.state.load(std::memory_order_acquire) == slot_active) {
+                slowest = std::min(slowest, slot.read_pos.load(std::memory_order_acquire));
+            }
+        }
+        return slowest;
+    }
+
+    /**
+     * @brief Free consumer slots whose process has exited
+     */
+    bool reclaim_dead_consumers() noexcept {
+        bool reclaimed = false;
+        for (auto& slot : ring_->consumers) {
+            if (slot.state.load(std::memory_order_acquire) == slot_active &&
+                detail::shm_consumer_is_dead(slot)) {
+                slot.state.store(0, std::memory_order_release);
+                reclaimed = true;
+            }
+        }
+        return reclaimed;
+    }
+
+    /**
+     * @brief Wait until the slowest consumer leaves room for need bytes
+     */
+    bool wait_for_space(uint64_t pos, size_t need) noexcept {
+        auto has_space = [&] { return pos + need - slowest_consumer(pos) <= mask_ + 1; };
+        if (has_space() || (reclaim_dead_consumers() && has_space())) {
+            return true;
+        }
+        if (policy_ == ShmFullPolicy::drop) {
+            status_.state = ShmTransportStatus::State::ring_full;
+            return false;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + block_timeout_;
+        while (true) {
+            uint32_t seq = ring_->space_seq.load();
+            ring_->writer_waiting.store(1);
+            if (has_space()) {
+                ring_->writer_waiting.store(0);
+                return true;
+            }
+            auto remaining = std::chrono::milliseconds{0};
+            if (block_timeout_.count() > 0) {
+                remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now());
+                if (remaining.count() <= 0) {
+                    ring_->writer_waiting.store(0);
+                    status_.state = ShmTransportStatus::State::timeout;
+                    return false;
+                }
+            }
+            detail::futex_wait(ring_->space_seq, seq, remaining);
+            ring_->writer_waiting.store(0);
+            if (has_space() || (reclaim_dead_consumers() && has_space())) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Copy one packet into the ring and publish it
+     */
+    bool write_bytes(std::span<const uint8_t> bytes) noexcept {
+        const auto handed_off = instrumentation_.now();
+        if (ring_ == nullptr) {
+            status_.state = ShmTransportStatus::State::ring_error;
+            status_.errno_value = EBADF;
+            return false;
+        }
+
+        size_t size = bytes.size();
+        uint32_t header = 0;
+        if (size >= vrt_word_size) {
+            std::memcpy(&header, bytes.data(), vrt_word_size);
+            header = vrtigo::detail::network_to_host32(header);
+        }
+        status_.packet_size = size;
+        status_.header = header;
+        if (size == 0 || size % vrt_word_size != 0 || size > (mask_ + 1) / 2 ||
+            size_t(vrtigo::detail::decode_header(header).size_words) * vrt_word_size != size) {
+            status_.state = ShmTransportStatus::State::invalid_packet;
+            status_.errno_value = size > (mask_ + 1) / 2 ? EMSGSIZE : EINVAL;
+            return false;
+        }
+
+        // Packets never wrap: pad to the end of the ring when this one would
+        uint64_t pos = ring_->write_pos.load(std::memory_order_relaxed);
+        size_t offset = static_cast<size_t>(pos) & mask_;
+        size_t pad = offset + size > mask_ + 1 ? mask_ + 1 - offset : 0;
+        if (!wait_for_space(pos, pad + size)) {
+            ++packets_dropped_;
+            return false;
+        }
+        if (pad > 0) {
+            std::memset(data_ + offset, 0, vrt_word_size);
+            offset = 0;
+        }
+        std::memcpy(data_ + offset, bytes.data(), size);
+
+        // Publish, then wake consumers only if one is sleeping
+        ring_->write_pos.store(pos + pad + size, std::memory_order_seq_cst);
+        ring_->data_seq.fetch_add(1, std::memory_order_seq_cst);
+        if (ring_->readers_waiting.load(std::memory_order_seq_cst) > 0) {
+            detail::futex_wake_all(ring_->data_seq);
+        }
+
+        ++packets_written_;
+        bytes_written_ += size;
+        status_.state = ShmTransportStatus::State::packet_ready;
+        status_.errno_value = 0;
+        instrumentation_.record_sent(bytes, handed_off);
+        return true;
+    }
+
+    std::string name_;                           ///< shm_open name (empty for memfd)
+    detail::ShmMapping mapping_;                 ///< Shared mapping
+    detail::ShmRingHeader* ring_ = nullptr;      ///< Control block (null when closed)
+    uint8_t* data_ = nullptr;                    ///< Ring data area
+    size_t mask_ = 0;                            ///< capacity - 1
+    ShmFullPolicy policy_ = ShmFullPolicy::drop; ///< Full-ring behaviour
+    std::chrono::milliseconds block_timeout_{0}; ///< Blocking write limit (0 = none)
+    size_t packets_written_ = 0;                 ///< Packets published
+    size_t bytes_written_ = 0;                   ///< Bytes published
+    size_t packets_dropped_ = 0;                 ///< Packets rejected on a full ring
+    ShmTransportStatus status_{};                ///< Transport status
+    [[no_unique_address]] detail::Instrumentation instrumentation_; ///< Counters (opt-in)
+};
+
+static_assert(detail::FlushableWriter<ShmVRTWriter>);
+
+} // namespace vrtigo::utils::shmio
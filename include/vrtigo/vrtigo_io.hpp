@@ -50,7 +50,7 @@ using PCAPVRTWriter = utils::pcapio::PCAPVRTWriter;
  * - Signal Data (types 0-1) → RuntimeDataPacket
  * - Extension Data (types 2-3) → RuntimeDataPacket
  * - Context (types 4-5) → RuntimeContextPacket
- * - Command (types 6-7) → InvalidPacket (not yet supported)
+ * - Command (types 6-7) → RuntimeCommandPacket
  *
  * @param bytes Raw packet bytes (must remain valid while using returned view)
  * @return PacketVariant containing validated view or error information
@@ -67,4 +67,22 @@ inline PacketVariant parse_packet(std::span<const uint8_t> bytes) noexcept {
     return detail::parse_packet(bytes);
 }
 
+/**
+ * @brief Parse a VRT packet from a trusted source without validating it
+ *
+ * For packets known to be valid, such as replay of our own recordings. Data and context
+ * views compute only the offsets needed for field access; call validate() on a view to
+ * check it on demand. Command packets are always validated. Debug builds assert that
+ * full validation passes.
+ *
+ * @param bytes Raw packet bytes (must remain valid while using returned view)
+ * @return PacketVariant containing the view
+ *
+ * @example
+ * auto pkt = vrtigo::parse_packet(bytes, vrtigo::trusted);
+ */
+inline PacketVariant parse_packet(std::span<const uint8_t> bytes, trusted_t) noexcept {
+    return detail::parse_packet(bytes, trusted);
+}
+
 } // namespace vrtigo
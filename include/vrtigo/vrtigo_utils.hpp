@@ -3,6 +3,9 @@
 // VRTIGO Utilities
 // Optional utilities that may allocate memory and use exceptions
 
+// Instrumentation (compiled out unless VRTIGO_ENABLE_INSTRUMENTATION=1)
+#include "vrtigo/utils/detail/instrumentation.hpp"
+
 // File I/O
 #include "vrtigo/utils/fileio/raw_vrt_file_writer.hpp"
 #include "vrtigo/utils/fileio/vrt_file_reader.hpp"
@@ -12,16 +15,56 @@
 #include "vrtigo/utils/pcapio/pcap_vrt_reader.hpp"
 #include "vrtigo/utils/pcapio/pcap_vrt_writer.hpp"
 
+// Multi-stream alignment
+#include "vrtigo/utils/align/stream_aligner.hpp"
+
+// Command/acknowledge correlation
+#include "vrtigo/utils/command/command_tracker.hpp"
+
 // Network I/O (Linux/POSIX)
 #if defined(__linux__) || defined(__unix__) || defined(__APPLE__)
+    #include "vrtigo/utils/fileio/mapped_file.hpp"
+    #include "vrtigo/utils/fileio/vrt_metadata_scanner.hpp"
+    #include "vrtigo/utils/netio/busy_poll.hpp"
+    #include "vrtigo/utils/netio/multicast.hpp"
+    #include "vrtigo/utils/netio/multicast_vrt_reader.hpp"
+    #include "vrtigo/utils/netio/receive_buffer.hpp"
+    #include "vrtigo/utils/netio/socket_address.hpp"
+    #include "vrtigo/utils/netio/socket_filter.hpp"
+    #include "vrtigo/utils/netio/tcp_vrt_reader.hpp"
+    #include "vrtigo/utils/netio/tcp_vrt_writer.hpp"
     #include "vrtigo/utils/netio/udp_vrt_reader.hpp"
     #include "vrtigo/utils/netio/udp_vrt_writer.hpp"
+    #include "vrtigo/utils/netio/unix_socket.hpp"
+    #include "vrtigo/utils/netio/unix_vrt_reader.hpp"
+    #include "vrtigo/utils/netio/unix_vrt_writer.hpp"
+    #include "vrtigo/utils/pcapio/pcap_metadata_scanner.hpp"
+#endif
+
+// AF_XDP receive (Linux: eBPF and XDP sockets)
+#if defined(__linux__)
+    #include "vrtigo/utils/netio/xdp_program.hpp"
+    #include "vrtigo/utils/netio/xdp_vrt_reader.hpp"
+#endif
+
+// UDP fan-out (Linux: sendmmsg and the IP_RECVERR error queue)
+#if defined(__linux__)
+    #include "vrtigo/utils/netio/udp_fanout_writer.hpp"
+#endif
+
+// Shared-memory I/O (Linux: memfd and futex)
+#if defined(__linux__)
+    #include "vrtigo/utils/shmio/shm_vrt_reader.hpp"
+    #include "vrtigo/utils/shmio/shm_vrt_writer.hpp"
 #endif
 
 #include "vrtigo.hpp"
 
 namespace vrtigo {
 // Import utilities into main namespace for convenience
+using InstrumentationSnapshot = utils::detail::InstrumentationSnapshot;
+using LatencyHistogramSnapshot = utils::detail::LatencyHistogramSnapshot;
+
 template <uint16_t MaxPacketWords = 65535>
 using VRTFileReader = utils::fileio::VRTFileReader<MaxPacketWords>;
 
@@ -36,10 +79,75 @@ using PCAPVRTReader = utils::pcapio::PCAPVRTReader<MaxPacketWords>;
 
 using PCAPVRTWriter = utils::pcapio::PCAPVRTWriter;
 
+using StreamAligner = utils::align::StreamAligner;
+using AlignerConfig = utils::align::AlignerConfig;
+using AlignedBlock = utils::align::AlignedBlock;
+using AlignedSlice = utils::align::AlignedSlice;
+
+using CommandTracker = utils::command::CommandTracker;
+using TrackerConfig = utils::command::TrackerConfig;
+using CommandResult = utils::command::CommandResult;
+using CommandStatus = utils::command::CommandStatus;
+
 #if defined(__linux__) || defined(__unix__) || defined(__APPLE__)
 template <uint16_t MaxPacketWords = 65535>
 using UDPVRTReader = utils::netio::UDPVRTReader<MaxPacketWords>;
 
 using UDPVRTWriter = utils::netio::UDPVRTWriter;
+
+template <uint16_t MaxPacketWords = 65535>
+using TCPVRTReader = utils::netio::TCPVRTReader<MaxPacketWords>;
+
+using TCPVRTWriter = utils::netio::TCPVRTWriter;
+
+template <uint16_t MaxPacketWords = 65535>
+using UnixVRTReader = utils::netio::UnixVRTReader<MaxPacketWords>;
+
+using UnixVRTWriter = utils::netio::UnixVRTWriter;
+using UnixSeqpacketListener = utils::netio::UnixSeqpacketListener;
+using UnixSocketType = utils::netio::UnixSocketType;
+
+template <uint16_t MaxPacketWords = 65535>
+using MulticastVRTReader = utils::netio::MulticastVRTReader<MaxPacketWords>;
+
+using MulticastGroup = utils::netio::MulticastGroup;
+using MulticastGroupV6 = utils::netio::MulticastGroupV6;
+using MulticastPacket = utils::netio::MulticastPacket;
+using MulticastGroupStats = utils::netio::MulticastGroupStats;
+
+using SocketAddress = utils::netio::SocketAddress;
+using PacketFilter = utils::netio::PacketFilter;
+using ReceiveBufferPolicy = utils::netio::ReceiveBufferPolicy;
+using ReceiveBufferController = utils::netio::ReceiveBufferController;
+using ReceiveMode = utils::netio::ReceiveMode;
+using BusyPollOptions = utils::netio::BusyPollOptions;
+using IPFamily = utils::netio::IPFamily;
+
+using ReceiveTimestamp = utils::netio::ReceiveTimestamp;
+using ReceiveTimestampMode = utils::netio::ReceiveTimestampMode;
+using ReceiveTimestampSource = utils::netio::ReceiveTimestampSource;
+using TimestampedPacket = utils::netio::TimestampedPacket;
+
+using MappedFile = utils::fileio::MappedFile;
+using VRTMetadataScanner = utils::fileio::VRTMetadataScanner;
+using PCAPMetadataScanner = utils::pcapio::PCAPMetadataScanner;
+using utils::netio::vrt_to_arrival_latency;
+#endif
+
+#if defined(__linux__)
+using XDPVRTReader = utils::netio::XDPVRTReader;
+using XDPProgram = utils::netio::XDPProgram;
+using XDPMode = utils::netio::XDPMode;
+using XDPOptions = utils::netio::XDPOptions;
+using XDPFrame = utils::netio::XDPFrame;
+using XDPStatistics = utils::netio::XDPStatistics;
+
+using UDPFanoutWriter = utils::netio::UDPFanoutWriter;
+using FanoutSubscriber = utils::netio::FanoutSubscriber;
+using FanoutBackoff = utils::netio::FanoutBackoff;
+
+using ShmVRTReader = utils::shmio::ShmVRTReader;
+using ShmVRTWriter = utils::shmio::ShmVRTWriter;
+using ShmFullPolicy = utils::shmio::ShmFullPolicy;
 #endif
 } // namespace vrtigo
@@ -36,7 +36,7 @@ echo "Version: $VERSION"
 echo ""
 
 # Find all C++ source files
-FILES=$(find include tests examples -type f \( -name "*.hpp" -o -name "*.h" -o -name "*.cpp" -o -name "*.cc" \) 2>/dev/null || true)
+FILES=$(find include tests examples benchmarks -type f \( -name "*.hpp" -o -name "*.h" -o -name "*.cpp" -o -name "*.cc" \) 2>/dev/null || true)
 
 if [ -z "$FILES" ]; then
     echo -e "${YELLOW}Warning: No C++ files found to check${NC}"
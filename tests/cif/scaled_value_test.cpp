@@ -0,0 +1,154 @@
+#include <array>
+#include <limits>
+#include <vector>
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+using namespace vrtigo::field;
+
+// =============================================================================
+// Scaled Value Tests - exact fixed-point ↔ integer unit conversion
+// Tests .scaled()/.set_scaled(), the FixedPointScale helper and batch extraction
+// =============================================================================
+
+class ScaledValueTest : public ::testing::Test {
+protected:
+    alignas(4) std::array<uint8_t, 256> buffer{};
+};
+
+// Conversions are usable in constant expressions
+static_assert(detail::RateMilliHz::to_scaled(4096) == 1000);
+static_assert(detail::RateMilliHz::from_scaled(1000) == 4096);
+static_assert(detail::FrequencyMilliHz::to_scaled(-4096) == -1000);
+static_assert(detail::DecibelCenti::to_scaled(int16_t(-128)) == -100);
+static_assert(detail::FieldTraits<0, 29>::to_scaled(409'600'000'000ULL) == 100'000'000'000ULL);
+
+TEST(FixedPointScaleTest, RoundsHalfUp) {
+    using Q = detail::FixedPointScale<int64_t, int64_t, 12, 1000>;
+    // 1/4096 Hz = 0.244 mHz -> 0; 2/4096 Hz = 0.488 mHz -> 0; 3/4096 = 0.732 mHz -> 1
+    EXPECT_EQ(Q::to_scaled(1), 0);
+    EXPECT_EQ(Q::to_scaled(2), 0);
+    EXPECT_EQ(Q::to_scaled(3), 1);
+    // Negative values floor the whole part and round the fraction the same way
+    EXPECT_EQ(Q::to_scaled(-1), 0);
+    EXPECT_EQ(Q::to_scaled(-3), -1);
+    // 1 mHz = 4.096 LSB -> 4; -1 mHz -> -4
+    EXPECT_EQ(Q::from_scaled(1), 4);
+    EXPECT_EQ(Q::from_scaled(-1), -4);
+    // Exact half: 0.5 dB in centi-dB with Q9.7 is 64 LSB
+    using D = detail::DecibelCenti;
+    EXPECT_EQ(D::from_scaled(50), 64);
+    EXPECT_EQ(D::to_scaled(64), 50);
+}
+
+TEST(FixedPointScaleTest, RoundTripAndSaturation) {
+    using D = detail::DecibelCenti;
+    // Q9.7 is finer than 0.01 dB, so every centi-dB value in range survives a round trip
+    for (int32_t cdb = -25'600; cdb < 25'600; ++cdb) {
+        ASSERT_EQ(D::to_scaled(D::from_scaled(cdb)), cdb) << cdb;
+    }
+    EXPECT_EQ(D::from_scaled(1'000'000), std::numeric_limits<int16_t>::max());
+    EXPECT_EQ(D::from_scaled(-1'000'000), std::numeric_limits<int16_t>::min());
+
+    using R = detail::RateMilliHz;
+    EXPECT_EQ(R::from_scaled(std::numeric_limits<uint64_t>::max()),
+              std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(R::to_scaled(std::numeric_limits<uint64_t>::max()),
+              ((uint64_t(1) << 52) - 1) * 1000 + 1000);
+}
+
+TEST_F(ScaledValueTest, BandwidthMilliHertz) {
+    using TestContext = ContextPacket<NoTimestamp, NoClassId, bandwidth, sample_rate>;
+    TestContext packet(buffer.data());
+
+    packet[bandwidth].set_scaled(100'000'000'000ULL); // 100 MHz
+    EXPECT_EQ(packet[bandwidth].encoded(), 409'600'000'000ULL);
+    EXPECT_EQ(packet[bandwidth].scaled(), 100'000'000'000ULL);
+
+    // 12.5 kHz + 1 mHz: not a multiple of the Q52.12 LSB, rounds to the nearest encoding
+    packet[sample_rate].set_scaled(12'500'001ULL);
+    EXPECT_EQ(packet[sample_rate].encoded(), 51'200'004ULL);
+    EXPECT_EQ(packet[sample_rate].scaled(), 12'500'001ULL);
+    EXPECT_DOUBLE_EQ(packet[sample_rate].value(), 51'200'004.0 / 4096.0);
+}
+
+TEST_F(ScaledValueTest, SignedFrequencies) {
+    using TestContext = ContextPacket<NoTimestamp, NoClassId, rf_reference_frequency,
+                                      rf_frequency_offset, if_band_offset>;
+    TestContext packet(buffer.data());
+
+    packet[rf_reference_frequency].set_scaled(2'400'000'000'000LL); // 2.4 GHz
+    packet[rf_frequency_offset].set_scaled(-1'250'000LL);           // -1.25 kHz
+    packet[if_band_offset].set_encoded(uint64_t(-4096));            // -1 Hz on the wire
+
+    EXPECT_EQ(packet[rf_reference_frequency].scaled(), 2'400'000'000'000LL);
+    EXPECT_EQ(packet[rf_frequency_offset].scaled(), -1'250'000LL);
+    EXPECT_EQ(int64_t(packet[rf_frequency_offset].encoded()), -1250 * 4096);
+    EXPECT_EQ(packet[if_band_offset].scaled(), -1000);
+}
+
+TEST_F(ScaledValueTest, DecibelAndTemperatureFields) {
+    using TestContext = ContextPacket<NoTimestamp, NoClassId, temperature, gain, reference_level>;
+    TestContext packet(buffer.data());
+
+    packet[reference_level].set_scaled(-1050); // -10.5 dBm
+    EXPECT_EQ(packet[reference_level].encoded(), 0xFAC0U); // -1344 in Q9.7, upper bits zero
+    EXPECT_EQ(packet[reference_level].scaled(), -1050);
+
+    packet[gain].set_scaled(GainCentiDb{.stage1 = 2000, .stage2 = -325});
+    EXPECT_EQ(packet[gain].encoded() & 0xFFFF, 2560U); // 20 dB
+    EXPECT_EQ(packet[gain].scaled(), (GainCentiDb{.stage1 = 2000, .stage2 = -325}));
+
+    packet[temperature].set_scaled(4025); // 40.25 °C = 2576 in Q10.6
+    EXPECT_EQ(packet[temperature].encoded(), 2576U);
+    EXPECT_EQ(packet[temperature].scaled(), 4025);
+}
+
+TEST(ScaledBatchTest, ExtractAcrossRuntimePackets) {
+    using WithBandwidth = ContextPacket<NoTimestamp, NoClassId, bandwidth, reference_level>;
+    using WithoutBandwidth = ContextPacket<NoTimestamp, NoClassId, reference_level>;
+
+    constexpr size_t count = 150; // spans several extraction blocks
+    std::vector<std::vector<uint8_t>> storage;
+    std::vector<RuntimeContextPacket> packets;
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 5 == 4) {
+            auto& bytes = storage.emplace_back(WithoutBandwidth::size_bytes);
+            WithoutBandwidth pkt(bytes.data());
+            pkt[reference_level].set_scaled(-int32_t(i));
+        } else {
+            auto& bytes = storage.emplace_back(WithBandwidth::size_bytes);
+            WithBandwidth pkt(bytes.data());
+            pkt[bandwidth].set_scaled(1'000'000'000ULL + i);
+            pkt[reference_level].set_scaled(-int32_t(i));
+        }
+    }
+    for (auto& bytes : storage) {
+        packets.emplace_back(bytes.data(), bytes.size());
+        ASSERT_TRUE(packets.back().is_valid());
+    }
+
+    std::vector<uint64_t> mhz(count);
+    std::vector<uint8_t> present(count);
+    ASSERT_EQ(extract_scaled(packets, bandwidth, std::span(mhz), std::span(present)), count);
+    for (size_t i = 0; i < count; ++i) {
+        bool has = i % 5 != 4;
+        EXPECT_EQ(present[i], has ? 1 : 0) << i;
+        EXPECT_EQ(mhz[i], has ? 1'000'000'000ULL + i : 0) << i;
+    }
+
+    std::vector<int32_t> level(count);
+    ASSERT_EQ(extract_scaled(packets, reference_level, std::span(level)), count);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(level[i], -int32_t(i));
+    }
+
+    // Encoded extraction, limited by the output size
+    std::vector<uint64_t> raw(10);
+    ASSERT_EQ(extract_encoded(packets, bandwidth, std::span(raw)), 10U);
+    EXPECT_EQ(raw[1], detail::RateMilliHz::from_scaled(1'000'000'001ULL));
+    EXPECT_EQ(raw[4], 0U);
+}
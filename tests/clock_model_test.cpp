@@ -0,0 +1,169 @@
+#include <chrono>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+using namespace std::chrono_literals;
+using time_point = std::chrono::system_clock::time_point;
+
+namespace {
+
+constexpr uint32_t start_second = 1'700'000'000;
+
+// Host clock runs 20 ppm fast and 3 ms behind the VRT clock, with +/-2 us of jitter
+struct SimulatedLink {
+    double drift_ppm = 20.0;
+    std::chrono::nanoseconds offset = 3ms;
+    int64_t jitter_ns = 2000;
+    uint64_t state = 12345;
+
+    time_point vrt_at(int64_t n, std::chrono::nanoseconds spacing) const {
+        return time_point(std::chrono::seconds(start_second)) + n * spacing;
+    }
+
+    time_point host_for(time_point vrt) {
+        auto since_start = (vrt - time_point(std::chrono::seconds(start_second)));
+        auto drift = std::chrono::nanoseconds(static_cast<int64_t>(
+            std::chrono::duration<double, std::nano>(since_start).count() * drift_ppm * 1e-6));
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        auto noise = std::chrono::nanoseconds(
+            static_cast<int64_t>((state >> 33) % uint64_t(2 * jitter_ns + 1)) - jitter_ns);
+        return vrt + offset + drift + noise;
+    }
+};
+
+int64_t ns(std::chrono::nanoseconds d) {
+    return d.count();
+}
+
+} // namespace
+
+TEST(ClockModelTest, NeedsTwoDistinctTimes) {
+    ClockModel<16> model;
+    EXPECT_FALSE(model.has_model());
+    EXPECT_FALSE(model.predict_host_time(time_point{}).has_value());
+
+    auto t = time_point(std::chrono::seconds(start_second));
+    auto first = model.update(t, t + 1ms);
+    EXPECT_FALSE(first.innovation.has_value());
+    model.update(t, t + 1ms); // same VRT time: still degenerate
+    EXPECT_FALSE(model.has_model());
+    EXPECT_FALSE(model.drift_ppm().has_value());
+
+    model.update(t + 1s, t + 1s + 1ms);
+    ASSERT_TRUE(model.has_model());
+    EXPECT_NEAR(*model.drift_ppm(), 0.0, 1e-6);
+    EXPECT_EQ(ns(*model.offset()), ns(1ms));
+}
+
+TEST(ClockModelTest, TracksOffsetAndDrift) {
+    SimulatedLink link;
+    ClockModel<256> model;
+    constexpr auto spacing = 1ms;
+
+    for (int64_t n = 0; n < 20'000; ++n) {
+        auto vrt = link.vrt_at(n, spacing);
+        model.update(vrt, link.host_for(vrt));
+    }
+    EXPECT_EQ(model.sample_count(), 256U);
+    // A 256 ms window with 2 us jitter pins drift to well under a ppm
+    EXPECT_NEAR(*model.drift_ppm(), 20.0, 1.0);
+    EXPECT_LT(model.residual_rms(), 2us);
+    EXPECT_GT(model.residual_rms(), 500ns);
+
+    // Offset at the newest sample: 3 ms + 20 ppm of 20 s = 3.4 ms
+    EXPECT_NEAR(static_cast<double>(ns(*model.offset())), 3.4e6, 1e3);
+
+    // Predict slightly ahead (deadline scheduling) and invert
+    auto future_vrt = link.vrt_at(20'010, spacing);
+    auto host = model.predict_host_time(future_vrt);
+    ASSERT_TRUE(host.has_value());
+    auto expected_host = future_vrt + 3ms + std::chrono::nanoseconds(400'200);
+    EXPECT_LT(std::abs(ns(*host - expected_host)), 2000);
+
+    auto back = model.predict_vrt_time(*host);
+    ASSERT_TRUE(back.has_value());
+    EXPECT_LE(std::abs(ns(*back - future_vrt)), 1);
+}
+
+TEST(ClockModelTest, StaysPreciseOverLongRuns) {
+    // Rebasing keeps precision although the references are hours in the past
+    SimulatedLink link;
+    link.jitter_ns = 0;
+    ClockModel<64> model;
+    constexpr auto spacing = 100ms;
+    for (int64_t n = 0; n < 200'000; ++n) { // ~5.5 hours
+        auto vrt = link.vrt_at(n, spacing);
+        model.update(vrt, link.host_for(vrt));
+    }
+    EXPECT_NEAR(*model.drift_ppm(), 20.0, 1e-3);
+    EXPECT_LT(model.residual_rms(), 10ns);
+
+    auto vrt = link.vrt_at(200'000, spacing);
+    auto predicted = model.predict_host_time(vrt);
+    EXPECT_LT(std::abs(ns(*predicted - link.host_for(vrt))), 10);
+}
+
+TEST(ClockModelTest, TimestampOverloads) {
+    ClockModel<32> model;
+    for (uint32_t s = 0; s < 10; ++s) {
+        auto vrt = UtcRealTimestamp(start_second + s, 0);
+        model.update(vrt, vrt.to_chrono() + 5ms);
+    }
+    auto host = model.predict_host_time(UtcRealTimestamp(start_second + 20, 0));
+    EXPECT_EQ(*host, UtcRealTimestamp(start_second + 20, 0).to_chrono() + 5ms);
+
+    auto vrt = model.predict_vrt_timestamp<UtcRealTimestamp>(*host);
+    EXPECT_EQ(*vrt, UtcRealTimestamp(start_second + 20, 0));
+
+    // GPS timestamps are mapped through UTC, so the model is the same
+    auto gps = UtcRealTimestamp(start_second + 20, 0).to_gps();
+    EXPECT_EQ(*model.predict_host_time(gps), *host);
+    EXPECT_EQ(*model.predict_vrt_timestamp<GpsRealTimestamp>(*host), gps);
+}
+
+TEST(ClockModelTest, OutliersRejectedAndStepResets) {
+    SimulatedLink link;
+    ClockModelConfig config;
+    config.outlier_sigma = 8.0;
+    config.outlier_floor = 20us;
+    config.reset_after_outliers = 4;
+    ClockModel<128> model(config);
+
+    constexpr auto spacing = 1ms;
+    int64_t n = 0;
+    for (; n < 500; ++n) {
+        auto vrt = link.vrt_at(n, spacing);
+        EXPECT_FALSE(model.update(vrt, link.host_for(vrt)).outlier);
+    }
+
+    // A single late packet (scheduling hiccup) is rejected and does not bend the fit
+    auto drift_before = *model.drift_ppm();
+    auto vrt = link.vrt_at(n++, spacing);
+    auto spike = model.update(vrt, link.host_for(vrt) + 2ms);
+    EXPECT_TRUE(spike.outlier);
+    EXPECT_NEAR(static_cast<double>(ns(*spike.innovation)), 2e6, 1e4);
+    EXPECT_DOUBLE_EQ(*model.drift_ppm(), drift_before);
+    vrt = link.vrt_at(n++, spacing);
+    EXPECT_FALSE(model.update(vrt, link.host_for(vrt)).outlier);
+
+    // A persistent 10 ms step upstream: rejected until the reset threshold, then re-learned
+    link.offset += 10ms;
+    int resets = 0;
+    for (int i = 0; i < 4; ++i, ++n) {
+        vrt = link.vrt_at(n, spacing);
+        auto update = model.update(vrt, link.host_for(vrt));
+        resets += update.reset;
+        EXPECT_EQ(update.outlier, !update.reset);
+    }
+    EXPECT_EQ(resets, 1);
+    EXPECT_EQ(model.sample_count(), 1U);
+
+    for (int i = 0; i < 200; ++i, ++n) {
+        vrt = link.vrt_at(n, spacing);
+        EXPECT_FALSE(model.update(vrt, link.host_for(vrt)).outlier);
+    }
+    EXPECT_NEAR(static_cast<double>(ns(*model.offset())), 13e6, 2e4);
+}
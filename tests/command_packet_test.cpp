@@ -0,0 +1,202 @@
+#include <array>
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+#include <vrtigo/vrtigo_io.hpp>
+
+using namespace vrtigo;
+using namespace vrtigo::field;
+
+class CommandPacketTest : public ::testing::Test {
+protected:
+    alignas(4) std::array<uint8_t, 4096> buffer{};
+
+    void SetUp() override { std::memset(buffer.data(), 0, buffer.size()); }
+};
+
+TEST_F(CommandPacketTest, ControlPacketLayout) {
+    using Tune = ControlPacket<NoTimestamp, NoClassId, CommandId, NoCommandId,
+                               rf_reference_frequency, bandwidth>;
+
+    // header + stream + CAM + message ID + controllee + CIF0 + two 64-bit fields
+    EXPECT_EQ(Tune::size_words, 1 + 1 + 1 + 1 + 1 + 1 + 2 + 2);
+
+    Tune cmd(buffer.data());
+    auto decoded = detail::decode_header(detail::read_u32(buffer.data(), 0));
+    EXPECT_EQ(decoded.type, PacketType::command);
+    EXPECT_FALSE(decoded.command_ack);
+    EXPECT_FALSE(decoded.command_cancel);
+    EXPECT_TRUE(cmd.cam().has_controllee_id());
+    EXPECT_FALSE(cmd.cam().controllee_id_is_uuid());
+    EXPECT_FALSE(cmd.cam().has_controller_id());
+    EXPECT_EQ(cmd.validate(Tune::size_bytes), ValidationError::none);
+}
+
+TEST_F(CommandPacketTest, ControlPacketRoundTrip) {
+    using Tune = ControlPacket<UtcRealTimestamp, NoClassId, CommandId, CommandUuid,
+                               sample_rate, bandwidth>;
+
+    Tune cmd(buffer.data());
+    cmd.set_stream_id(0x1000);
+    cmd.set_timestamp(UtcRealTimestamp(1'700'000'000, 0));
+    cmd.set_message_id(42);
+    cmd.set_controllee_id(0xC0FFEE);
+    CommandUuidValue uuid{};
+    for (size_t i = 0; i < uuid.size(); ++i) {
+        uuid[i] = static_cast<uint8_t>(i + 1);
+    }
+    cmd.set_controller_uuid(uuid);
+
+    CamValue cam;
+    cam.set_action_mode(ActionMode::execute);
+    cam.set_execution_ack(true);
+    cam.set_warnings(true);
+    cam.set_errors(true);
+    cmd.set_cam(cam);
+
+    cmd[sample_rate].set_value(10e6);
+    cmd[bandwidth].set_value(20e6);
+
+    RuntimeCommandPacket view(buffer.data(), Tune::size_bytes);
+    ASSERT_TRUE(view.is_valid()) << validation_error_string(view.error());
+    EXPECT_FALSE(view.is_ack());
+    EXPECT_FALSE(view.is_cancel());
+    EXPECT_EQ(view.stream_id(), 0x1000U);
+    EXPECT_EQ(view.timestamp_integer(), 1'700'000'000U);
+    EXPECT_EQ(view.message_id(), 42U);
+    EXPECT_EQ(view.controllee_id(), 0xC0FFEEU);
+    EXPECT_FALSE(view.controllee_uuid().has_value());
+    EXPECT_FALSE(view.controller_id().has_value());
+    EXPECT_EQ(view.controller_uuid(), uuid);
+
+    // set_cam keeps the ID bits fixed by the template
+    EXPECT_TRUE(view.cam().has_controllee_id());
+    EXPECT_TRUE(view.cam().controller_id_is_uuid());
+    EXPECT_EQ(view.cam().action_mode(), ActionMode::execute);
+    EXPECT_TRUE(view.cam().execution_ack());
+    EXPECT_TRUE(view.cam().warnings());
+    EXPECT_TRUE(view.cam().errors());
+
+    EXPECT_DOUBLE_EQ(view[sample_rate].value(), 10e6);
+    EXPECT_DOUBLE_EQ(view[bandwidth].value(), 20e6);
+    EXPECT_FALSE(view[rf_reference_frequency].has_value());
+}
+
+TEST_F(CommandPacketTest, CancellationPacketCarriesNoValues) {
+    using Cancel = CancellationPacket<NoTimestamp, NoClassId, NoCommandId, NoCommandId,
+                                      rf_reference_frequency, gain>;
+
+    // header + stream + CAM + message ID + CIF0 (no field values)
+    EXPECT_EQ(Cancel::size_words, 5U);
+
+    Cancel cmd(buffer.data());
+    cmd.set_message_id(7);
+    EXPECT_TRUE(detail::decode_header(detail::read_u32(buffer.data(), 0)).command_cancel);
+
+    RuntimeCommandPacket view(buffer.data(), Cancel::size_bytes);
+    ASSERT_TRUE(view.is_valid()) << validation_error_string(view.error());
+    EXPECT_TRUE(view.is_cancel());
+    EXPECT_TRUE(view.cancelled_fields().contains(rf_reference_frequency));
+    EXPECT_TRUE(view.cancelled_fields().contains(gain));
+    EXPECT_FALSE(view.cancelled_fields().contains(bandwidth));
+    EXPECT_EQ(view.cif0(), 0U);
+    EXPECT_FALSE(view[rf_reference_frequency].has_value());
+}
+
+TEST_F(CommandPacketTest, QueryStateAckCarriesCurrentValues) {
+    using State = QueryStateAckPacket<NoTimestamp, NoClassId, CommandId, CommandId, bandwidth>;
+
+    State ack(buffer.data());
+    ack.set_message_id(9);
+    ack.set_controllee_id(1);
+    ack.set_controller_id(2);
+    ack[bandwidth].set_value(5e6);
+
+    // The S bit survives set_cam since it defines the packet body
+    ack.set_cam(CamValue{});
+    EXPECT_TRUE(ack.cam().query_state_ack());
+
+    RuntimeCommandPacket view(buffer.data(), State::size_bytes);
+    ASSERT_TRUE(view.is_valid()) << validation_error_string(view.error());
+    EXPECT_TRUE(view.is_ack());
+    EXPECT_TRUE(view.cam().query_state_ack());
+    EXPECT_EQ(view.controller_id(), 2U);
+    EXPECT_DOUBLE_EQ(view[bandwidth].value(), 5e6);
+}
+
+TEST_F(CommandPacketTest, ExecutionAckResponses) {
+    using Ack = AckPacket<NoTimestamp, NoClassId, CommandId, NoCommandId, FieldSet<gain>,
+                          FieldSet<rf_reference_frequency, bandwidth, aux_gain>>;
+
+    // header + stream + CAM + message ID + controllee + WIF0 + EIF0 + EIF1 + 1 + 3 responses
+    EXPECT_EQ(Ack::size_words, 1 + 1 + 1 + 1 + 1 + 1 + 2 + 1 + 3);
+
+    Ack ack(buffer.data());
+    CamValue cam;
+    cam.set_execution_ack(true);
+    ack.set_cam(cam);
+    ack.set_message_id(42);
+    ack.set_warning_response(gain, 0x11);
+    ack.set_error_response(bandwidth, 0x22);
+    ack.set_error_response(aux_gain, 0x33);
+    EXPECT_EQ(ack.error_response(bandwidth), 0x22U);
+    EXPECT_EQ(ack.validate(Ack::size_bytes), ValidationError::none);
+
+    RuntimeCommandPacket view(buffer.data(), Ack::size_bytes);
+    ASSERT_TRUE(view.is_valid()) << validation_error_string(view.error());
+    EXPECT_TRUE(view.is_ack());
+    EXPECT_TRUE(view.cam().execution_ack());
+    EXPECT_TRUE(view.cam().warnings());
+    EXPECT_TRUE(view.cam().errors());
+    EXPECT_EQ(view.message_id(), 42U);
+
+    EXPECT_TRUE(view.warning_fields().contains(gain));
+    EXPECT_TRUE(view.error_fields().contains(aux_gain));
+    EXPECT_EQ(view.warning_response(gain), 0x11U);
+    EXPECT_EQ(view.error_response(rf_reference_frequency), 0U);
+    EXPECT_EQ(view.error_response(bandwidth), 0x22U);
+    EXPECT_EQ(view.error_response(aux_gain), 0x33U);
+    EXPECT_FALSE(view.error_response(gain).has_value());
+    EXPECT_EQ(view.cif0(), 0U);
+}
+
+TEST_F(CommandPacketTest, ParsePacketDispatchesCommands) {
+    using Tune = ControlPacket<NoTimestamp, NoClassId, NoCommandId, NoCommandId, bandwidth>;
+    Tune cmd(buffer.data());
+    cmd.set_stream_id(0xABCD);
+
+    auto pkt = parse_packet(std::span<const uint8_t>(buffer.data(), Tune::size_bytes));
+    ASSERT_TRUE(is_command_packet(pkt));
+    EXPECT_EQ(packet_type(pkt), PacketType::command);
+    EXPECT_EQ(stream_id(pkt), 0xABCDU);
+}
+
+TEST_F(CommandPacketTest, RejectsSizeMismatch) {
+    using Tune = ControlPacket<NoTimestamp, NoClassId, NoCommandId, NoCommandId, bandwidth>;
+    Tune cmd(buffer.data());
+    detail::write_u32(buffer.data(), 0, detail::read_u32(buffer.data(), 0) + 1);
+
+    RuntimeCommandPacket view(buffer.data(), Tune::size_bytes + 4);
+    EXPECT_EQ(view.error(), ValidationError::size_field_mismatch);
+}
+
+TEST_F(CommandPacketTest, RejectsUuidFlagWithoutId) {
+    using Tune = ControlPacket<NoTimestamp, NoClassId, NoCommandId, NoCommandId, bandwidth>;
+    Tune cmd(buffer.data());
+
+    // Controllee I bit without the E bit
+    uint32_t cam_word = detail::read_u32(buffer.data(), 8) | (1U << cam::controllee_uuid_shift);
+    detail::write_u32(buffer.data(), 8, cam_word);
+
+    RuntimeCommandPacket view(buffer.data(), Tune::size_bytes);
+    EXPECT_EQ(view.error(), ValidationError::unsupported_field);
+}
+
+TEST_F(CommandPacketTest, RejectsTruncatedBuffer) {
+    using Tune = ControlPacket<NoTimestamp, NoClassId, CommandUuid, NoCommandId, bandwidth>;
+    Tune cmd(buffer.data());
+
+    RuntimeCommandPacket view(buffer.data(), Tune::size_bytes - 4);
+    EXPECT_EQ(view.error(), ValidationError::buffer_too_small);
+}
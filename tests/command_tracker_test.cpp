@@ -0,0 +1,204 @@
+#include <array>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <vrtigo/utils/command/command_tracker.hpp>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+using namespace vrtigo::field;
+using namespace vrtigo::utils::command;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Tune = ControlPacket<NoTimestamp, NoClassId, CommandId, NoCommandId, bandwidth>;
+using Ack = AckPacket<NoTimestamp, NoClassId, CommandId, NoCommandId, FieldSet<>,
+                      FieldSet<bandwidth>>;
+using PlainAck = AckPacket<NoTimestamp, NoClassId, CommandId, NoCommandId>;
+
+CamValue requesting(bool validation, bool execution, bool not_ack_only = false) {
+    CamValue cam;
+    cam.set_action_mode(ActionMode::execute);
+    cam.set_validation_ack(validation);
+    cam.set_execution_ack(execution);
+    cam.set_not_ack_only(not_ack_only);
+    return cam;
+}
+
+class CommandTrackerTest : public ::testing::Test {
+protected:
+    CommandTracker::time_point t0 = CommandTracker::clock::now();
+    CommandTracker tracker{TrackerConfig{8, 1ms, 16, 100ms}, t0};
+    std::vector<CommandResult> results;
+    alignas(4) std::array<uint8_t, 256> cmd_buffer{};
+    alignas(4) std::array<uint8_t, 256> ack_buffer{};
+
+    CommandTracker::Callback record() {
+        return [this](const CommandResult& r) { results.push_back(r); };
+    }
+
+    // Issue a tuning command to controllee 7
+    uint32_t issue(CamValue cam, std::chrono::nanoseconds timeout = 10ms) {
+        Tune cmd(cmd_buffer.data());
+        cmd.set_controllee_id(7);
+        cmd.set_cam(cam);
+        cmd[bandwidth].set_value(20e6);
+        auto id = tracker.track(cmd, record(), timeout, t0);
+        EXPECT_TRUE(id.has_value());
+        EXPECT_EQ(cmd.message_id(), *id);
+        return *id;
+    }
+
+    // Build and parse an acknowledgement from controllee `controllee`
+    template <typename AckType = PlainAck>
+    RuntimeCommandPacket ack(uint32_t message_id, bool validation, bool execution,
+                             uint32_t controllee = 7) {
+        AckType pkt(ack_buffer.data());
+        CamValue cam;
+        cam.set_validation_ack(validation);
+        cam.set_execution_ack(execution);
+        pkt.set_cam(cam);
+        pkt.set_message_id(message_id);
+        pkt.set_controllee_id(controllee);
+        return RuntimeCommandPacket(ack_buffer.data(), AckType::size_bytes);
+    }
+};
+
+} // namespace
+
+TEST_F(CommandTrackerTest, CompletesWhenAllRequestedAcksArrive) {
+    uint32_t id = issue(requesting(true, true));
+    EXPECT_TRUE(tracker.in_flight(id));
+
+    EXPECT_EQ(tracker.on_ack(ack(id, true, false), t0 + 1ms), AckMatch::matched);
+    EXPECT_TRUE(results.empty());
+
+    EXPECT_EQ(tracker.on_ack(ack(id, false, true), t0 + 2ms), AckMatch::completed);
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_EQ(results[0].message_id, id);
+    EXPECT_EQ(results[0].status, CommandStatus::completed);
+    EXPECT_TRUE(results[0].validated);
+    EXPECT_TRUE(results[0].executed);
+    EXPECT_EQ(results[0].round_trip, 2ms);
+    EXPECT_FALSE(tracker.in_flight(id));
+    EXPECT_EQ(tracker.in_flight_count(), 0U);
+
+    // Duplicate ack after completion
+    EXPECT_EQ(tracker.on_ack(ack(id, false, true), t0 + 3ms), AckMatch::unknown);
+    EXPECT_EQ(tracker.stats().unknown_acks, 1U);
+}
+
+TEST_F(CommandTrackerTest, ErrorAckFailsImmediately) {
+    uint32_t id = issue(requesting(true, true));
+
+    Ack pkt(ack_buffer.data());
+    CamValue cam;
+    cam.set_validation_ack(true);
+    pkt.set_cam(cam);
+    pkt.set_message_id(id);
+    pkt.set_controllee_id(7);
+    pkt.set_error_response(bandwidth, 1);
+    RuntimeCommandPacket view(ack_buffer.data(), Ack::size_bytes);
+
+    EXPECT_EQ(tracker.on_packet(PacketVariant{view}, t0 + 1ms), AckMatch::completed);
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_EQ(results[0].status, CommandStatus::failed);
+    EXPECT_EQ(tracker.stats().failed, 1U);
+}
+
+TEST_F(CommandTrackerTest, RejectsWrongControllee) {
+    uint32_t id = issue(requesting(false, true));
+    EXPECT_EQ(tracker.on_ack(ack(id, false, true, 8), t0 + 1ms), AckMatch::controllee_mismatch);
+    EXPECT_TRUE(tracker.in_flight(id));
+    EXPECT_EQ(tracker.stats().mismatched_acks, 1U);
+}
+
+TEST_F(CommandTrackerTest, TimesOutOnTheWheel) {
+    uint32_t fast = issue(requesting(false, true), 5ms);
+    uint32_t slow = issue(requesting(false, true), 40ms); // Beyond one wheel revolution
+
+    EXPECT_EQ(tracker.poll(t0 + 4ms), 0U);
+    EXPECT_EQ(tracker.poll(t0 + 5ms), 1U);
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_EQ(results[0].message_id, fast);
+    EXPECT_EQ(results[0].status, CommandStatus::timed_out);
+
+    // Revisiting the slow command's bucket before its deadline keeps it
+    EXPECT_EQ(tracker.poll(t0 + 30ms), 0U);
+    EXPECT_TRUE(tracker.in_flight(slow));
+
+    // A jump of several revolutions still expires it
+    EXPECT_EQ(tracker.poll(t0 + 500ms), 1U);
+    ASSERT_EQ(results.size(), 2U);
+    EXPECT_EQ(results[1].message_id, slow);
+    EXPECT_EQ(tracker.stats().timed_out, 2U);
+}
+
+TEST_F(CommandTrackerTest, NotAckOnlySilenceIsSuccess) {
+    issue(requesting(false, true, true), 5ms);
+    EXPECT_EQ(tracker.poll(t0 + 5ms), 1U);
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_EQ(results[0].status, CommandStatus::completed);
+}
+
+TEST_F(CommandTrackerTest, TableFullAndSlotReuse) {
+    std::vector<uint32_t> ids;
+    for (size_t i = 0; i < tracker.capacity(); ++i) {
+        ids.push_back(issue(requesting(false, true)));
+    }
+    Tune cmd(cmd_buffer.data());
+    EXPECT_FALSE(tracker.track(cmd, record(), 10ms, t0).has_value());
+    EXPECT_EQ(tracker.stats().rejected, 1U);
+
+    // Reused slot gets a new message ID; the old one no longer matches
+    EXPECT_TRUE(tracker.cancel(ids[0], t0));
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_EQ(results[0].status, CommandStatus::cancelled);
+    uint32_t reused = issue(requesting(false, true));
+    EXPECT_NE(reused, ids[0]);
+    EXPECT_EQ(tracker.on_ack(ack(ids[0], false, true), t0 + 1ms), AckMatch::unknown);
+    EXPECT_EQ(tracker.on_ack(ack(reused, false, true), t0 + 1ms), AckMatch::completed);
+}
+
+TEST_F(CommandTrackerTest, CallbackMayTrackAgain) {
+    std::optional<uint32_t> retry;
+    Tune cmd(cmd_buffer.data());
+    cmd.set_controllee_id(7);
+    cmd.set_cam(requesting(false, true));
+    tracker.track(
+        cmd,
+        [&](const CommandResult& r) {
+            if (r.status == CommandStatus::timed_out) {
+                retry = tracker.track(cmd, record(), 10ms, t0 + 5ms);
+            }
+        },
+        5ms, t0);
+
+    EXPECT_EQ(tracker.poll(t0 + 5ms), 1U);
+    ASSERT_TRUE(retry.has_value());
+    EXPECT_TRUE(tracker.in_flight(*retry));
+    EXPECT_EQ(tracker.in_flight_count(), 1U);
+}
+
+TEST_F(CommandTrackerTest, FutureCompletes) {
+    Tune cmd(cmd_buffer.data());
+    cmd.set_controllee_id(7);
+    cmd.set_cam(requesting(true, false));
+    auto future = tracker.track_future(cmd, 10ms, t0);
+    ASSERT_TRUE(future.has_value());
+
+    tracker.on_ack(ack(cmd.message_id(), true, false), t0 + 1ms);
+    ASSERT_EQ(future->wait_for(0s), std::future_status::ready);
+    auto result = future->get();
+    EXPECT_EQ(result.status, CommandStatus::completed);
+    EXPECT_TRUE(result.validated);
+}
+
+TEST(CommandTrackerConfigTest, RejectsInvalidConfig) {
+    EXPECT_THROW(CommandTracker(TrackerConfig{0, 1ms, 16, 100ms}), std::invalid_argument);
+    EXPECT_THROW(CommandTracker(TrackerConfig{8, 0ms, 16, 100ms}), std::invalid_argument);
+    EXPECT_THROW(CommandTracker(TrackerConfig{8, 1ms, 0, 100ms}), std::invalid_argument);
+}
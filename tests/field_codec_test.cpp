@@ -0,0 +1,98 @@
+#include <array>
+
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+using namespace vrtigo::field;
+
+namespace {
+
+using Tuning = FieldCodec<sample_rate, bandwidth, rf_reference_frequency, aux_gain>;
+
+static_assert(Tuning::cif0 == Tuning::packet_type<>::cif0_value);
+static_assert(Tuning::cif1 == Tuning::packet_type<>::cif1_value);
+static_assert(Tuning::fields_size_bytes == 3 * 8 + 4);
+
+class FieldCodecTest : public ::testing::Test {
+protected:
+    alignas(4) std::array<uint8_t, 256> buffer{};
+};
+
+} // namespace
+
+TEST_F(FieldCodecTest, DecodeMatchesFieldAccess) {
+    Tuning::packet_type<UtcRealTimestamp> pkt(buffer.data());
+    pkt[sample_rate].set_value(10e6);
+    pkt[bandwidth].set_value(8e6);
+    pkt[rf_reference_frequency].set_encoded(0x0000000100000000ULL);
+    pkt[aux_gain].set_encoded(0x00050006U);
+
+    RuntimeContextPacket view(buffer.data(), decltype(pkt)::size_bytes);
+    ASSERT_TRUE(view.is_valid());
+
+    Tuning::record_type rec;
+    ASSERT_TRUE(Tuning::decode(view, rec));
+    EXPECT_DOUBLE_EQ(rec.value(sample_rate), 10e6);
+    EXPECT_DOUBLE_EQ(rec.value(bandwidth), 8e6);
+    EXPECT_EQ(rec[rf_reference_frequency], view[rf_reference_frequency].encoded());
+    EXPECT_EQ(rec[aux_gain], 0x00050006U);
+
+    // Compile-time packets decode the same way
+    Tuning::record_type direct;
+    ASSERT_TRUE(Tuning::decode(pkt, direct));
+    EXPECT_EQ(direct, rec);
+}
+
+TEST_F(FieldCodecTest, EncodeRoundTrip) {
+    Tuning::record_type rec;
+    rec.set_value(sample_rate, 30.72e6);
+    rec.set_value(bandwidth, 20e6);
+    rec[rf_reference_frequency] = 0x123456789ULL;
+    rec[aux_gain] = 0x00010002U;
+
+    Tuning::packet_type<> pkt(buffer.data());
+    ASSERT_TRUE(Tuning::encode(pkt, rec));
+
+    RuntimeContextPacket view(buffer.data(), Tuning::packet_type<>::size_bytes);
+    ASSERT_TRUE(view.is_valid());
+    EXPECT_DOUBLE_EQ(view[sample_rate].value(), 30.72e6);
+    EXPECT_DOUBLE_EQ(view[bandwidth].value(), 20e6);
+    EXPECT_EQ(view[rf_reference_frequency].encoded(), 0x123456789ULL);
+    EXPECT_EQ(view[aux_gain].encoded(), 0x00010002U);
+
+    Tuning::record_type back;
+    ASSERT_TRUE(Tuning::decode(view, back));
+    EXPECT_EQ(back, rec);
+}
+
+TEST_F(FieldCodecTest, RejectsOtherFieldSets) {
+    using Other = ContextPacket<NoTimestamp, NoClassId, sample_rate, bandwidth>;
+    Other pkt(buffer.data());
+    RuntimeContextPacket view(buffer.data(), Other::size_bytes);
+    ASSERT_TRUE(view.is_valid());
+
+    Tuning::record_type rec;
+    rec[aux_gain] = 7;
+    EXPECT_FALSE(Tuning::matches(view));
+    EXPECT_FALSE(Tuning::decode(view, rec));
+    EXPECT_EQ(rec[aux_gain], 7U);
+    EXPECT_FALSE(Tuning::encode(pkt, rec));
+
+    // Invalid views are rejected even if the CIF words would match
+    Tuning::packet_type<> tuned(buffer.data());
+    RuntimeContextPacket truncated(buffer.data(), Tuning::packet_type<>::size_bytes - 4);
+    EXPECT_FALSE(Tuning::decode(truncated, rec));
+}
+
+TEST_F(FieldCodecTest, FieldOrderDoesNotMatter) {
+    using Reordered = FieldCodec<aux_gain, rf_reference_frequency, bandwidth, sample_rate>;
+    static_assert(Reordered::cif0 == Tuning::cif0);
+    static_assert(Reordered::offset_of(bandwidth) == Tuning::offset_of(bandwidth));
+
+    Tuning::packet_type<> pkt(buffer.data());
+    pkt[bandwidth].set_value(5e6);
+    Reordered::record_type rec;
+    ASSERT_TRUE(Reordered::decode(pkt, rec));
+    EXPECT_DOUBLE_EQ(rec.value(bandwidth), 5e6);
+}
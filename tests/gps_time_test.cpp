@@ -0,0 +1,140 @@
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+
+// Built-in table is usable at compile time
+static_assert(builtin_leap_second_table.size() == 18);
+static_assert(builtin_leap_second_table.gps_minus_utc_at_utc(gps_epoch_unix_seconds) == 0);
+static_assert(builtin_leap_second_table.gps_minus_utc_at_utc(1483228800) == 18);
+static_assert(builtin_leap_second_table.gps_minus_utc_at_utc(1483228799) == 17);
+static_assert(GpsRealTimestamp::from_gps_week(2000, 3600).gps_week() == 2000);
+
+class GpsTimeTest : public ::testing::Test {
+protected:
+    void TearDown() override { reset_leap_second_table(); }
+
+    // 2017-01-01 00:00:00 UTC (leap second 18 takes effect)
+    static constexpr uint32_t leap_2017_utc = 1483228800;
+    // 2024-01-01 00:00:00 UTC
+    static constexpr uint32_t utc_2024 = 1704067200;
+};
+
+TEST_F(GpsTimeTest, EpochAndKnownOffsets) {
+    // GPS epoch maps to GPS second 0
+    auto epoch = UtcRealTimestamp(gps_epoch_unix_seconds, 0).to_gps();
+    EXPECT_EQ(epoch.tsi(), 0U);
+
+    // 2024-01-01: 18 leap seconds
+    auto gps = UtcRealTimestamp(utc_2024, 250'000'000'000ULL).to_gps();
+    EXPECT_EQ(gps.tsi(), utc_2024 - gps_epoch_unix_seconds + 18);
+    EXPECT_EQ(gps.tsf(), 250'000'000'000ULL);
+    EXPECT_EQ(gps.gps_week(), 2295U);
+    EXPECT_EQ(gps.gps_seconds_of_week(), gps.tsi() % gps_seconds_per_week);
+
+    // Before the first leap second (1981-07-01)
+    EXPECT_EQ(UtcRealTimestamp(362793599, 0).to_gps().tsi(), 362793599U - gps_epoch_unix_seconds);
+
+    // Pre-epoch clamps to zero
+    EXPECT_EQ(UtcRealTimestamp(1000, 5).to_gps(), GpsRealTimestamp(0, 0));
+}
+
+TEST_F(GpsTimeTest, RoundTripAcrossLeapSecond) {
+    for (uint32_t utc = leap_2017_utc - 5; utc < leap_2017_utc + 5; ++utc) {
+        auto gps = UtcRealTimestamp(utc, 123).to_gps();
+        EXPECT_EQ(gps.to_utc(), UtcRealTimestamp(utc, 123)) << utc;
+    }
+
+    // The inserted second (23:59:60 UTC) has a GPS time but no distinct POSIX time:
+    // the GPS seconds on either side of it both map to the first second of 2017
+    auto after = UtcRealTimestamp(leap_2017_utc, 0).to_gps();
+    auto during = GpsRealTimestamp(after.tsi() - 1, 0);
+    auto before = GpsRealTimestamp(after.tsi() - 2, 0);
+    EXPECT_EQ(during.to_utc().tsi(), leap_2017_utc);
+    EXPECT_EQ(before.to_utc().tsi(), leap_2017_utc - 1);
+}
+
+TEST_F(GpsTimeTest, ChronoConversions) {
+    auto now_utc = std::chrono::system_clock::now();
+    auto gps = GpsRealTimestamp::from_chrono(now_utc);
+    auto back = gps.to_chrono();
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::nanoseconds>(back - now_utc).count(), 0);
+
+    auto gps_now = GpsRealTimestamp::now();
+    auto utc_now = UtcRealTimestamp::now();
+    auto offset = static_cast<int64_t>(gps_now.tsi()) -
+                  (static_cast<int64_t>(utc_now.tsi()) - gps_epoch_unix_seconds);
+    EXPECT_GE(offset, 17);
+    EXPECT_LE(offset, 19);
+}
+
+TEST_F(GpsTimeTest, GpsArithmetic) {
+    auto ts = GpsRealTimestamp(1'000'000'000, 900'000'000'000ULL);
+    auto later = ts + std::chrono::milliseconds(200);
+    EXPECT_EQ(later.tsi(), 1'000'000'001U);
+    EXPECT_EQ(later.tsf(), 100'000'000'000ULL);
+    EXPECT_EQ(later - ts, std::chrono::milliseconds(200));
+}
+
+TEST_F(GpsTimeTest, GpsWeekHelpers) {
+    auto ts = GpsRealTimestamp::from_gps_week(2295, 86400, 5);
+    EXPECT_EQ(ts.gps_week(), 2295U);
+    EXPECT_EQ(ts.gps_seconds_of_week(), 86400U);
+    EXPECT_EQ(ts.tsf(), 5U);
+    EXPECT_EQ(ts.tsi(), 2295U * gps_seconds_per_week + 86400);
+}
+
+TEST_F(GpsTimeTest, RuntimeTableOverride) {
+    // Hypothetical future leap second on 2030-01-01
+    static constexpr uint32_t utc_2030 = 1893456000;
+    static const LeapSecondTable extended = [] {
+        LeapSecondTable table(builtin_leap_second_table.entries());
+        table.push_back({utc_2030, 19});
+        return table;
+    }();
+
+    auto gps_before = UtcRealTimestamp(utc_2030 + 10, 0).to_gps();
+    EXPECT_EQ(gps_before.tsi(), utc_2030 + 10 - gps_epoch_unix_seconds + 18);
+
+    set_leap_second_table(extended);
+    EXPECT_EQ(&leap_second_table(), &extended);
+
+    // Cached offsets are invalidated by the swap
+    auto gps_after = UtcRealTimestamp(utc_2030 + 10, 0).to_gps();
+    EXPECT_EQ(gps_after.tsi(), gps_before.tsi() + 1);
+    EXPECT_EQ(gps_after.to_utc(), UtcRealTimestamp(utc_2030 + 10, 0));
+
+    // Other threads see the new table too
+    uint32_t thread_result = 0;
+    std::thread([&] { thread_result = UtcRealTimestamp(utc_2030 + 10, 0).to_gps().tsi(); }).join();
+    EXPECT_EQ(thread_result, gps_after.tsi());
+
+    reset_leap_second_table();
+    EXPECT_EQ(UtcRealTimestamp(utc_2030 + 10, 0).to_gps(), gps_before);
+}
+
+TEST_F(GpsTimeTest, TableRejectsOutOfOrderEntries) {
+    LeapSecondTable table{{100, 1}, {200, 2}};
+    EXPECT_EQ(table.size(), 2U);
+    EXPECT_FALSE(table.push_back({150, 3}));
+    EXPECT_FALSE(table.push_back({200, 3}));
+    EXPECT_TRUE(table.push_back({300, 3}));
+    EXPECT_EQ(table.gps_minus_utc_at_utc(99), 0);
+    EXPECT_EQ(table.gps_minus_utc_at_utc(250), 2);
+    EXPECT_EQ(table.gps_minus_utc_at_utc(UINT32_MAX), 3);
+}
+
+TEST_F(GpsTimeTest, CacheMatchesTableLookup) {
+    LeapSecondCache cache;
+    const auto& table = leap_second_table();
+    // Sweep forward and backward across the table so the cache both hits and misses
+    for (uint32_t utc = gps_epoch_unix_seconds; utc < utc_2024; utc += 86'400 * 7) {
+        EXPECT_EQ(cache.gps_minus_utc_at_utc(utc), table.gps_minus_utc_at_utc(utc)) << utc;
+    }
+    for (uint32_t gps = 1'400'000'000; gps > 1000; gps -= 86'400 * 11) {
+        EXPECT_EQ(cache.gps_minus_utc_at_gps(gps), table.gps_minus_utc_at_gps(gps)) << gps;
+    }
+}
@@ -64,6 +64,23 @@ TEST(EnhancedReaderTest, ReadAllPacketsWithValidation) {
     EXPECT_GT(valid_count, 0);
 }
 
+TEST(EnhancedReaderTest, TrustedReplayMatchesValidatedRead) {
+    fileio::VRTFileReader<> checked(sample_data_file.string());
+    fileio::VRTFileReader<> replay(sample_data_file.string(), trusted);
+
+    while (auto expected = checked.read_next_packet()) {
+        auto pkt = replay.read_next_packet();
+        ASSERT_TRUE(pkt.has_value());
+        EXPECT_EQ(packet_type(*pkt), packet_type(*expected));
+        EXPECT_EQ(stream_id(*pkt), stream_id(*expected));
+        if (is_data_packet(*expected)) {
+            auto payload = std::get<RuntimeDataPacket>(*pkt).payload();
+            EXPECT_EQ(payload.size(), std::get<RuntimeDataPacket>(*expected).payload().size());
+        }
+    }
+    EXPECT_FALSE(replay.read_next_packet().has_value());
+}
+
 TEST(EnhancedReaderTest, RewindAndReread) {
     fileio::VRTFileReader<> reader(sample_data_file.c_str());
 
@@ -0,0 +1,201 @@
+// Built with VRTIGO_ENABLE_INSTRUMENTATION=1 (see tests/io/CMakeLists.txt)
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+#include <vrtigo/vrtigo_io.hpp>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using vrtigo::utils::detail::LatencyHistogram;
+using vrtigo::utils::detail::NullInstrumentation;
+using vrtigo::utils::detail::TransportInstrumentation;
+
+static_assert(utils::detail::instrumentation_enabled);
+static_assert(std::is_same_v<utils::detail::Instrumentation, TransportInstrumentation>);
+static_assert(std::is_empty_v<NullInstrumentation>,
+              "Disabled instrumentation must not add storage to readers/writers");
+
+// =============================================================================
+// Histogram
+// =============================================================================
+
+TEST(LatencyHistogramTest, BucketBoundsRoundTrip) {
+    using Snap = LatencyHistogramSnapshot;
+    for (uint64_t ns : {0ULL, 1ULL, 31ULL, 32ULL, 33ULL, 1000ULL, 123456ULL, 10000000000ULL}) {
+        auto index = Snap::bucket_index(ns);
+        EXPECT_LE(Snap::bucket_lower_bound(index), ns) << ns;
+        EXPECT_GE(Snap::bucket_upper_bound(index), ns) << ns;
+    }
+
+    // Exact below 2x sub-bucket count, then within one sub-bucket (~6%)
+    EXPECT_EQ(Snap::bucket_index(17), 17U);
+    auto index = Snap::bucket_index(1000000);
+    auto width = Snap::bucket_upper_bound(index) - Snap::bucket_lower_bound(index) + 1;
+    EXPECT_LE(static_cast<double>(width) / 1000000.0, 1.0 / Snap::sub_bucket_count);
+
+    // Values beyond the tracked range saturate into the last bucket
+    EXPECT_EQ(Snap::bucket_index(UINT64_MAX), Snap::bucket_count - 1);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram hist;
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        hist.record(i * 1000); // 1us .. 1ms
+    }
+
+    auto snap = hist.snapshot();
+    EXPECT_EQ(snap.total_count, 1000U);
+    EXPECT_NEAR(snap.mean(), 500500.0, 1.0);
+
+    auto p50 = static_cast<double>(snap.value_at_percentile(50.0));
+    auto p99 = static_cast<double>(snap.value_at_percentile(99.0));
+    EXPECT_NEAR(p50, 500000.0, 500000.0 * 0.07);
+    EXPECT_NEAR(p99, 990000.0, 990000.0 * 0.07);
+    EXPECT_GE(snap.value_at_percentile(100.0), 1000000U);
+}
+
+TEST(LatencyHistogramTest, MovePreservesCounts) {
+    LatencyHistogram hist;
+    hist.record(100);
+    hist.record(200);
+
+    LatencyHistogram moved(std::move(hist));
+    EXPECT_EQ(moved.snapshot().total_count, 2U);
+    EXPECT_EQ(moved.snapshot().total_ns, 300U);
+}
+
+// =============================================================================
+// Counters
+// =============================================================================
+
+TEST(TransportInstrumentationTest, CountsByTypeAndError) {
+    TransportInstrumentation inst;
+    auto data = test_utils::create_minimal_vrt_packet();
+    auto data_pkt = parse_packet(data);
+    auto invalid_pkt = parse_packet(std::span<const uint8_t>(data.data(), 2));
+
+    inst.record_received(data_pkt, data.size(), inst.now());
+    inst.record_received(data_pkt, data.size(), inst.now());
+    inst.record_received(invalid_pkt, 2, inst.now());
+    inst.record_truncation();
+    inst.record_kernel_drops(4);
+    inst.record_kernel_drops(7); // Cumulative: replaces, does not add
+    inst.record_timeout();
+    inst.record_io_error();
+    inst.record_sent(data, inst.now());
+
+    auto snap = inst.snapshot();
+    EXPECT_EQ(snap.packets(PacketType::signal_data), 3U);
+    EXPECT_EQ(snap.total_packets(), 3U);
+    EXPECT_EQ(snap.errors(ValidationError::buffer_too_small), 2U); // invalid + truncation
+    EXPECT_EQ(snap.total_errors(), 2U);
+    EXPECT_EQ(snap.truncations, 1U);
+    EXPECT_EQ(snap.kernel_drops, 7U);
+    EXPECT_EQ(snap.timeouts, 1U);
+    EXPECT_EQ(snap.io_errors, 1U);
+    EXPECT_EQ(snap.bytes, 3 * data.size());
+    EXPECT_EQ(snap.receive_to_parse.total_count, 3U);
+    EXPECT_EQ(snap.build_to_send.total_count, 1U);
+}
+
+TEST(TransportInstrumentationTest, ConcurrentSnapshot) {
+    TransportInstrumentation inst;
+    auto data = test_utils::create_minimal_vrt_packet();
+    auto pkt = parse_packet(data);
+    constexpr uint64_t iterations = 200000;
+
+    std::atomic<bool> done{false};
+    std::thread scraper([&] {
+        uint64_t last = 0;
+        while (!done.load()) {
+            auto total = inst.snapshot().total_packets();
+            EXPECT_GE(total, last); // Counters are monotonic
+            last = total;
+        }
+    });
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        inst.record_received(pkt, data.size(), inst.now());
+    }
+    done = true;
+    scraper.join();
+
+    EXPECT_EQ(inst.snapshot().total_packets(), iterations);
+}
+
+// =============================================================================
+// Transport integration
+// =============================================================================
+
+TEST(InstrumentedTransportTest, UDPReaderAndWriter) {
+    utils::netio::UDPVRTReader<8> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(100));
+    utils::netio::UDPVRTWriter writer("127.0.0.1", reader.socket_port());
+
+    auto small = test_utils::create_minimal_vrt_packet(0x1);
+    auto large = test_utils::create_vrt_packet_with_payload(0x2, 16); // exceeds 8 words
+    auto small_pkt = parse_packet(small);
+    auto large_pkt = parse_packet(large);
+
+    ASSERT_TRUE(writer.write_packet(small_pkt));
+    ASSERT_TRUE(writer.write_packet(large_pkt));
+    ASSERT_TRUE(writer.write_packet(small_pkt));
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(reader.read_next_packet().has_value());
+    }
+    EXPECT_FALSE(reader.read_next_packet().has_value()); // timeout
+
+    auto rx = reader.instrumentation().snapshot();
+    EXPECT_EQ(rx.packets(PacketType::signal_data), 2U);
+    EXPECT_EQ(rx.truncations, 1U);
+    EXPECT_EQ(rx.errors(ValidationError::buffer_too_small), 1U);
+    EXPECT_EQ(rx.timeouts, 1U);
+    EXPECT_EQ(rx.bytes, 2 * small.size());
+    EXPECT_EQ(rx.receive_to_parse.total_count, 2U);
+
+    auto tx = writer.instrumentation().snapshot();
+    EXPECT_EQ(tx.packets(PacketType::signal_data), 3U);
+    EXPECT_EQ(tx.bytes, 2 * small.size() + large.size());
+    EXPECT_EQ(tx.build_to_send.total_count, 3U);
+    EXPECT_GT(tx.build_to_send.total_ns, 0U);
+}
+
+TEST(InstrumentedTransportTest, FileAndPCAPRoundTrip) {
+    auto data = test_utils::create_minimal_vrt_packet();
+    auto pkt = parse_packet(data);
+    auto dir = std::filesystem::temp_directory_path();
+    auto vrt_path = (dir / "vrtigo_instrumentation_test.vrt").string();
+    auto pcap_path = (dir / "vrtigo_instrumentation_test.pcap").string();
+
+    {
+        VRTFileWriter<> vrt_writer(vrt_path);
+        PCAPVRTWriter pcap_writer(pcap_path);
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(vrt_writer.write_packet(pkt));
+            ASSERT_TRUE(pcap_writer.write_packet(pkt));
+        }
+        EXPECT_EQ(vrt_writer.instrumentation().snapshot().total_packets(), 4U);
+        EXPECT_EQ(pcap_writer.instrumentation().snapshot().bytes, 4 * data.size());
+    }
+
+    VRTFileReader<> vrt_reader(vrt_path);
+    PCAPVRTReader<> pcap_reader(pcap_path);
+    while (vrt_reader.read_next_packet()) {
+    }
+    while (pcap_reader.read_next_packet()) {
+    }
+
+    EXPECT_EQ(vrt_reader.instrumentation().snapshot().packets(PacketType::signal_data), 4U);
+    EXPECT_EQ(pcap_reader.instrumentation().snapshot().packets(PacketType::signal_data), 4U);
+
+    std::filesystem::remove(vrt_path);
+    std::filesystem::remove(pcap_path);
+}
@@ -0,0 +1,107 @@
+#include <filesystem>
+#include <vector>
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "pcap_test_helpers.hpp"
+
+using namespace vrtigo;
+
+namespace {
+
+using TimedData = SignalDataPacket<NoClassId, UtcRealTimestamp, Trailer::none, 16>;
+
+std::vector<uint8_t> timed_data(uint32_t stream_id, uint32_t tsi) {
+    std::vector<uint8_t> bytes(TimedData::size_bytes);
+    PacketBuilder<TimedData>(bytes.data())
+        .stream_id(stream_id)
+        .timestamp(UtcRealTimestamp(tsi, 1000))
+        .packet_count(uint8_t(tsi & 0xF))
+        .build();
+    return bytes;
+}
+
+} // namespace
+
+TEST(MetadataScannerTest, RawVRTFile) {
+    std::filesystem::path path = "test_metadata_scan.vrt";
+    {
+        RawVRTFileWriter<> writer(path.string());
+        for (uint32_t i = 0; i < 300; ++i) {
+            ASSERT_TRUE(writer.write_packet(timed_data(0x40 + (i % 3), 5000 + i)));
+        }
+    }
+
+    VRTMetadataScanner scanner(path.string());
+    std::vector<uint32_t> tsi(128);
+    std::vector<uint32_t> stream_id(128);
+    std::vector<uint8_t> count(128);
+    MetadataColumns columns{.tsi = tsi, .stream_id = stream_id, .packet_count = count};
+
+    uint32_t expected = 0;
+    while (size_t rows = scanner.next(columns)) {
+        for (size_t i = 0; i < rows; ++i, ++expected) {
+            EXPECT_EQ(tsi[i], 5000 + expected);
+            EXPECT_EQ(stream_id[i], 0x40 + (expected % 3));
+            EXPECT_EQ(count[i], (5000 + expected) & 0xF);
+        }
+    }
+    EXPECT_EQ(expected, 300U);
+    EXPECT_TRUE(scanner.at_end());
+    EXPECT_EQ(scanner.packets_scanned(), 300U);
+
+    scanner.rewind();
+    EXPECT_EQ(scanner.next(columns), 128U);
+    EXPECT_EQ(tsi[0], 5000U);
+
+    std::filesystem::remove(path);
+}
+
+TEST(MetadataScannerTest, PCAPFileWithCaptureTimes) {
+    std::filesystem::path path = "test_metadata_scan.pcap";
+    {
+        PCAPVRTWriter writer(path.c_str());
+        for (uint32_t i = 0; i < 100; ++i) {
+            auto bytes = timed_data(7, 100 + i);
+            ASSERT_TRUE(writer.write_packet(utils::pcapio::test::parse_test_packet(bytes)));
+        }
+    }
+
+    PCAPMetadataScanner scanner(path.string());
+    std::vector<uint32_t> tsi(64);
+    std::vector<uint64_t> tsf(64);
+    std::vector<uint8_t> status(64);
+    std::vector<uint64_t> capture_ns(64);
+    MetadataColumns columns{.tsi = tsi, .tsf = tsf, .status = status};
+
+    uint32_t expected = 0;
+    uint64_t previous_capture = 0;
+    while (size_t rows = scanner.next(columns, capture_ns)) {
+        for (size_t i = 0; i < rows; ++i, ++expected) {
+            EXPECT_EQ(tsi[i], 100 + expected);
+            EXPECT_EQ(tsf[i], 1000U);
+            EXPECT_TRUE(status[i] & metadata_status::valid);
+            EXPECT_GE(capture_ns[i], previous_capture);
+            EXPECT_GT(capture_ns[i], 1'600'000'000ULL * 1'000'000'000ULL);
+            previous_capture = capture_ns[i];
+        }
+    }
+    EXPECT_EQ(expected, 100U);
+    EXPECT_TRUE(scanner.at_end());
+
+    std::filesystem::remove(path);
+}
+
+TEST(MetadataScannerTest, RejectsMissingAndInvalidFiles) {
+    EXPECT_THROW(VRTMetadataScanner("does_not_exist.vrt"), std::runtime_error);
+
+    std::filesystem::path path = "test_metadata_not_pcap.pcap";
+    {
+        RawVRTFileWriter<> writer(path.string());
+        writer.write_packet(timed_data(1, 1));
+    }
+    EXPECT_THROW(PCAPMetadataScanner(path.string()), std::runtime_error);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,176 @@
+#include <array>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include <arpa/inet.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace std::chrono_literals;
+
+// Multicast over loopback: groups are joined and sent on 127.0.0.1, so the tests need no
+// external network. They skip if the kernel refuses multicast on the loopback interface.
+
+namespace {
+
+using test_utils::stream_id_of;
+
+using TestPacket = SignalDataPacket<NoClassId, NoTimestamp, Trailer::none, 4>;
+
+constexpr const char* loopback = "127.0.0.1";
+
+class MulticastTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sender_.try_set_multicast_interface(loopback);
+        sender_.try_set_multicast_loopback(true);
+        sender_.try_set_multicast_ttl(1);
+    }
+
+    bool send(const std::string& address, uint16_t port, uint32_t stream_id) {
+        PacketBuilder<TestPacket>(buffer_.data()).stream_id(stream_id).build();
+        RuntimeDataPacket view(buffer_.data(), buffer_.size());
+        sockaddr_in dest{};
+        dest.sin_family = AF_INET;
+        dest.sin_port = htons(port);
+        inet_pton(AF_INET, address.c_str(), &dest.sin_addr);
+        return sender_.write_packet(PacketVariant{view}, dest);
+    }
+
+    UDPVRTWriter sender_;
+    alignas(4) std::array<uint8_t, TestPacket::size_bytes> buffer_{};
+};
+
+} // namespace
+
+TEST(MulticastGroupTest, Parse) {
+    auto asm_group = MulticastGroup::parse("239.1.2.3");
+    EXPECT_FALSE(asm_group.is_source_specific());
+    EXPECT_EQ(ntohl(asm_group.group.s_addr), 0xEF010203U);
+    EXPECT_EQ(asm_group.interface_addr.s_addr, htonl(INADDR_ANY));
+
+    auto ssm = MulticastGroup::parse("232.0.0.7", "127.0.0.1", "10.0.0.9");
+    EXPECT_TRUE(ssm.is_source_specific());
+    EXPECT_EQ(ntohl(ssm.interface_addr.s_addr), 0x7F000001U);
+    EXPECT_EQ(ntohl(ssm.source.s_addr), 0x0A000009U);
+
+    EXPECT_THROW(MulticastGroup::parse("10.0.0.1"), std::invalid_argument);
+    EXPECT_THROW(MulticastGroup::parse("239.1.2"), std::invalid_argument);
+    EXPECT_THROW(MulticastGroup::parse("239.1.2.3", "eth0"), std::invalid_argument);
+}
+
+TEST_F(MulticastTest, SingleGroupReader) {
+    auto group = MulticastGroup::parse("239.77.0.1", loopback);
+    std::optional<UDPVRTReader<>> reader;
+    try {
+        reader.emplace(0, group);
+    } catch (const std::runtime_error& e) {
+        GTEST_SKIP() << "Multicast unavailable on loopback: " << e.what();
+    }
+    reader->try_set_timeout(500ms);
+
+    ASSERT_TRUE(send("239.77.0.1", reader->socket_port(), 0x11));
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x11U);
+
+    // Bound to the group address: the same port on another group is not delivered
+    ASSERT_TRUE(reader->try_join_group(MulticastGroup::parse("239.77.0.2", loopback)));
+    ASSERT_TRUE(send("239.77.0.2", reader->socket_port(), 0x22));
+    ASSERT_TRUE(send("239.77.0.1", reader->socket_port(), 0x33));
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x33U);
+
+    EXPECT_TRUE(reader->try_leave_group(group));
+    EXPECT_FALSE(reader->try_leave_group(group)); // not a member any more
+    EXPECT_NE(reader->transport_status().errno_value, 0);
+}
+
+TEST_F(MulticastTest, MultiGroupDemux) {
+    MulticastVRTReader<> reader(0);
+    std::array<size_t, 3> groups{};
+    try {
+        for (size_t i = 0; i < groups.size(); ++i) {
+            groups[i] = reader.join(
+                MulticastGroup::parse("239.77.1." + std::to_string(i + 1), loopback));
+        }
+    } catch (const std::runtime_error& e) {
+        GTEST_SKIP() << "Multicast unavailable on loopback: " << e.what();
+    }
+    EXPECT_EQ(groups[0], 0U);
+    EXPECT_EQ(groups[2], 2U);
+    EXPECT_EQ(reader.group_count(), 3U);
+    // Joining the same membership again is a no-op returning the same index
+    EXPECT_EQ(reader.join(MulticastGroup::parse("239.77.1.2", loopback)), groups[1]);
+
+    reader.try_set_timeout(300ms);
+    uint16_t port = reader.socket_port();
+    for (uint32_t n = 0; n < 6; ++n) {
+        ASSERT_TRUE(send("239.77.1." + std::to_string(n % 3 + 1), port, 100 + n));
+    }
+    ASSERT_TRUE(send(loopback, port, 999)); // unicast to the same socket
+
+    for (uint32_t n = 0; n < 6; ++n) {
+        auto pkt = reader.read_next_group_packet();
+        ASSERT_TRUE(pkt.has_value());
+        EXPECT_EQ(pkt->group, groups[n % 3]);
+        EXPECT_EQ(stream_id_of(pkt->packet), 100 + n);
+    }
+    auto unicast = reader.read_next_group_packet();
+    ASSERT_TRUE(unicast.has_value());
+    EXPECT_EQ(unicast->group, MulticastVRTReader<>::no_group);
+    EXPECT_EQ(reader.unmatched_packets(), 1U);
+
+    EXPECT_EQ(reader.group_stats(groups[1]).packets, 2U);
+    EXPECT_EQ(reader.group_stats(groups[1]).bytes, 2 * TestPacket::size_bytes);
+
+    // After leaving, the group is no longer delivered to this socket
+    EXPECT_TRUE(reader.leave(groups[0]));
+    EXPECT_FALSE(reader.is_joined(groups[0]));
+    ASSERT_TRUE(send("239.77.1.1", port, 500));
+    ASSERT_TRUE(send("239.77.1.3", port, 501));
+    auto after = reader.read_next_group_packet();
+    ASSERT_TRUE(after.has_value());
+    EXPECT_EQ(after->group, groups[2]);
+    EXPECT_FALSE(reader.read_next_group_packet().has_value());
+    EXPECT_EQ(reader.transport_status().state, utils::netio::UDPTransportStatus::State::timeout);
+
+    // Rejoining keeps the original index
+    EXPECT_EQ(reader.join(MulticastGroup::parse("239.77.1.1", loopback)), groups[0]);
+    EXPECT_TRUE(reader.is_joined(groups[0]));
+}
+
+TEST_F(MulticastTest, SourceSpecificMembership) {
+    MulticastVRTReader<> reader(0);
+    size_t from_loopback = 0;
+    try {
+        from_loopback = reader.join(MulticastGroup::parse("232.77.0.1", loopback, loopback));
+        reader.join(MulticastGroup::parse("232.77.0.2", loopback, "10.255.255.1"));
+    } catch (const std::runtime_error& e) {
+        GTEST_SKIP() << "Source-specific multicast unavailable: " << e.what();
+    }
+    reader.try_set_timeout(300ms);
+    uint16_t port = reader.socket_port();
+
+    // Only the (S,G) whose source matches the sender is delivered
+    ASSERT_TRUE(send("232.77.0.2", port, 2));
+    ASSERT_TRUE(send("232.77.0.1", port, 1));
+    auto pkt = reader.read_next_group_packet();
+    ASSERT_TRUE(pkt.has_value());
+    EXPECT_EQ(pkt->group, from_loopback);
+    EXPECT_EQ(stream_id_of(pkt->packet), 1U);
+    EXPECT_FALSE(reader.read_next_group_packet().has_value());
+}
+
+TEST(MulticastWriterTest, SendOptions) {
+    UDPVRTWriter writer;
+    EXPECT_TRUE(writer.try_set_multicast_ttl(8));
+    EXPECT_TRUE(writer.try_set_multicast_loopback(false));
+    EXPECT_TRUE(writer.try_set_multicast_interface(""));
+    EXPECT_FALSE(writer.try_set_multicast_interface("not-an-address"));
+    EXPECT_EQ(writer.transport_status().errno_value, EINVAL);
+}
@@ -0,0 +1,170 @@
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace std::chrono_literals;
+using utils::shmio::ShmTransportStatus;
+
+namespace {
+
+using test_utils::build;
+using test_utils::LargePacket;
+using test_utils::SmallPacket;
+using test_utils::stream_id_of;
+
+static_assert(utils::detail::PacketReader<ShmVRTReader>);
+
+bool write(ShmVRTWriter& writer, const std::vector<uint8_t>& bytes) {
+    return writer.write_packet(RuntimeDataPacket(bytes.data(), bytes.size()));
+}
+
+std::string unique_name() { return "/vrtigo-shm-test-" + std::to_string(::getpid()); }
+
+} // namespace
+
+TEST(ShmTransportTest, ZeroCopyViewsInOrder) {
+    ShmVRTWriter writer(64 * 1024);
+    ShmVRTReader reader(writer.fd());
+    EXPECT_EQ(writer.consumer_count(), 1U);
+
+    for (uint32_t n = 0; n < 3; ++n) {
+        ASSERT_TRUE(write(writer, build<SmallPacket>(n)));
+    }
+    EXPECT_EQ(reader.backlog_bytes(), 3 * SmallPacket::size_bytes);
+
+    // Consecutive packets are adjacent views into the shared ring
+    auto first = reader.read_next_packet();
+    ASSERT_EQ(stream_id_of(first), 0U);
+    const uint8_t* first_bytes = std::get<RuntimeDataPacket>(*first).as_bytes().data();
+    auto second = reader.read_next_packet();
+    ASSERT_EQ(stream_id_of(second), 1U);
+    EXPECT_EQ(std::get<RuntimeDataPacket>(*second).as_bytes().data(),
+              first_bytes + SmallPacket::size_bytes);
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 2U);
+}
+
+TEST(ShmTransportTest, WrapsWithPadding) {
+    ShmVRTWriter writer(4096);
+    ShmVRTReader reader(writer.fd());
+    ASSERT_EQ(writer.capacity(), 4096U);
+
+    // 1212-byte packets do not divide the ring, so the producer pads at the wrap point
+    for (uint32_t n = 0; n < 40; ++n) {
+        ASSERT_TRUE(write(writer, build<LargePacket>(n)));
+        auto pkt = reader.read_next_packet();
+        ASSERT_EQ(stream_id_of(pkt), n);
+        EXPECT_EQ(std::get<RuntimeDataPacket>(*pkt).as_bytes().size(), LargePacket::size_bytes);
+    }
+}
+
+TEST(ShmTransportTest, IndependentConsumersAndDropPolicy) {
+    ShmVRTWriter writer(4096);
+    ShmVRTReader fast(writer.fd());
+    ShmVRTReader slow(writer.fd());
+    slow.try_set_timeout(20ms);
+    EXPECT_EQ(writer.consumer_count(), 2U);
+
+    // The slow consumer pins the ring: the fourth large packet is dropped for both
+    ASSERT_TRUE(write(writer, build<LargePacket>(0)));
+    ASSERT_TRUE(write(writer, build<LargePacket>(1)));
+    EXPECT_EQ(stream_id_of(fast.read_next_packet()), 0U);
+    EXPECT_EQ(stream_id_of(fast.read_next_packet()), 1U);
+    ASSERT_TRUE(write(writer, build<LargePacket>(2)));
+    EXPECT_FALSE(write(writer, build<LargePacket>(3)));
+    EXPECT_EQ(writer.transport_status().state, ShmTransportStatus::State::ring_full);
+    EXPECT_EQ(writer.packets_dropped(), 1U);
+
+    // Each consumer still sees every published packet at its own pace
+    for (uint32_t n = 0; n < 3; ++n) {
+        EXPECT_EQ(stream_id_of(slow.read_next_packet()), n);
+    }
+    EXPECT_EQ(stream_id_of(fast.read_next_packet()), 2U);
+    EXPECT_EQ(stream_id_of(slow.read_next_packet()), std::nullopt);
+}
+
+TEST(ShmTransportTest, NamedRingWakesSleepingReader) {
+    ShmVRTWriter writer(unique_name(), 1024 * 1024);
+    ShmVRTReader reader(unique_name());
+    reader.try_set_timeout(5000ms);
+
+    constexpr uint32_t count = 20000;
+    std::thread producer([&] {
+        for (uint32_t n = 0; n < count; ++n) {
+            while (!write(writer, build<SmallPacket>(n))) {
+                std::this_thread::yield();
+            }
+            if (n % 1000 == 0) {
+                std::this_thread::sleep_for(1ms); // let the reader fall asleep
+            }
+        }
+        writer.close();
+    });
+
+    uint32_t expected = 0;
+    reader.for_each_data_packet([&](const RuntimeDataPacket& pkt) {
+        EXPECT_EQ(pkt.stream_id(), expected);
+        ++expected;
+        return true;
+    });
+    producer.join();
+
+    EXPECT_EQ(expected, count);
+    EXPECT_EQ(reader.transport_status().state, ShmTransportStatus::State::producer_closed);
+    EXPECT_THROW(ShmVRTReader{unique_name()}, std::runtime_error); // unlinked on close
+}
+
+TEST(ShmTransportTest, BlockPolicyWaitsForConsumer) {
+    ShmVRTWriter writer(4096);
+    writer.set_full_policy(ShmFullPolicy::block);
+    writer.set_block_timeout(5000ms);
+    ShmVRTReader reader(writer.fd());
+
+    std::thread producer([&] {
+        for (uint32_t n = 0; n < 50; ++n) {
+            ASSERT_TRUE(write(writer, build<LargePacket>(n)));
+        }
+    });
+    for (uint32_t n = 0; n < 50; ++n) {
+        EXPECT_EQ(stream_id_of(reader.read_next_packet()), n);
+    }
+    producer.join();
+    EXPECT_EQ(writer.packets_dropped(), 0U);
+
+    // With the consumer stalled, a bounded wait gives up once the ring fills
+    writer.set_block_timeout(20ms);
+    uint32_t accepted = 0;
+    while (accepted < 4 && write(writer, build<LargePacket>(50 + accepted))) {
+        ++accepted;
+    }
+    EXPECT_GE(accepted, 2U);
+    EXPECT_LT(accepted, 4U);
+    EXPECT_EQ(writer.transport_status().state, ShmTransportStatus::State::timeout);
+}
+
+TEST(ShmTransportTest, TimeoutAndRejectedPackets) {
+    ShmVRTWriter writer(4096);
+    ShmVRTReader reader(writer.fd());
+    reader.try_set_timeout(20ms);
+
+    EXPECT_FALSE(reader.read_next_packet().has_value());
+    EXPECT_EQ(reader.transport_status().state, ShmTransportStatus::State::timeout);
+    EXPECT_TRUE(reader.is_open());
+
+    EXPECT_FALSE(writer.write_packet(PacketVariant{InvalidPacket{}}));
+    auto huge = build<SignalDataPacket<NoClassId, NoTimestamp, Trailer::none, 600>>(1);
+    EXPECT_FALSE(write(writer, huge)); // larger than half the ring
+    EXPECT_EQ(writer.transport_status().errno_value, EMSGSIZE);
+
+    ASSERT_TRUE(write(writer, build<SmallPacket>(4)));
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 4U);
+}
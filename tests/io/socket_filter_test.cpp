@@ -0,0 +1,215 @@
+#include <array>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vrtigo.hpp>
+#include <vrtigo/utils/netio/multicast_vrt_reader.hpp>
+#include <vrtigo/utils/netio/socket_filter.hpp>
+#include <vrtigo/utils/netio/udp_vrt_reader.hpp>
+#include <vrtigo/utils/netio/udp_vrt_writer.hpp>
+#include <vrtigo/utils/netio/unix_vrt_reader.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace vrtigo::utils::netio;
+using namespace std::chrono_literals;
+
+namespace {
+
+using CtxPkt = ContextPacket<NoTimestamp, NoClassId, field::bandwidth>;
+
+std::vector<uint8_t> make_context_packet(uint32_t stream_id) {
+    std::vector<uint8_t> bytes(CtxPkt::size_bytes);
+    CtxPkt pkt(bytes.data());
+    pkt.set_stream_id(stream_id);
+    pkt[field::bandwidth].set_value(1e6);
+    return bytes;
+}
+
+class SocketFilterTest : public ::testing::Test {
+protected:
+    int sender_socket_ = -1;
+    UDPVRTReader<> reader_{uint16_t(0)};
+
+    void SetUp() override {
+        sender_socket_ = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(sender_socket_, 0) << "Failed to create sender socket: " << strerror(errno);
+        ASSERT_TRUE(reader_.try_set_timeout(100ms));
+    }
+
+    void TearDown() override {
+        if (sender_socket_ >= 0) {
+            close(sender_socket_);
+        }
+    }
+
+    void send(const std::vector<uint8_t>& packet) {
+        struct sockaddr_in dest {};
+        dest.sin_family = AF_INET;
+        dest.sin_port = htons(reader_.socket_port());
+        dest.sin_addr.s_addr = inet_addr("127.0.0.1");
+        ssize_t sent = sendto(sender_socket_, packet.data(), packet.size(), 0,
+                              reinterpret_cast<struct sockaddr*>(&dest), sizeof(dest));
+        ASSERT_EQ(sent, static_cast<ssize_t>(packet.size())) << strerror(errno);
+    }
+
+    /// Stream IDs of the packets delivered until the read times out
+    std::vector<uint32_t> drain() {
+        std::vector<uint32_t> ids;
+        while (auto handle = reader_.read_next_handle()) {
+            ids.push_back(handle->stream_id().value_or(0));
+        }
+        return ids;
+    }
+};
+
+} // namespace
+
+TEST_F(SocketFilterTest, StreamIdSet) {
+    PacketFilter filter;
+    filter.stream_ids = {1, 3};
+    ASSERT_TRUE(reader_.try_set_packet_filter(filter)) << strerror(errno);
+
+    for (uint32_t id : {1U, 2U, 3U, 4U}) {
+        send(test_utils::create_minimal_vrt_packet(id));
+    }
+    EXPECT_EQ(drain(), (std::vector<uint32_t>{1, 3}));
+}
+
+TEST_F(SocketFilterTest, PacketTypeMask) {
+    PacketFilter filter;
+    filter.accept_only({PacketType::context});
+    ASSERT_TRUE(reader_.try_set_packet_filter(filter)) << strerror(errno);
+
+    send(test_utils::create_minimal_vrt_packet(10));
+    send(make_context_packet(11));
+    send(test_utils::create_minimal_vrt_packet(12));
+    EXPECT_EQ(drain(), (std::vector<uint32_t>{11}));
+}
+
+TEST_F(SocketFilterTest, SizeRange) {
+    PacketFilter filter;
+    filter.min_size = 16;
+    filter.max_size = 20;
+    ASSERT_TRUE(reader_.try_set_packet_filter(filter)) << strerror(errno);
+
+    send(test_utils::create_minimal_vrt_packet(1));         // 12 bytes
+    send(test_utils::create_vrt_packet_with_payload(2, 2)); // 16 bytes
+    send(test_utils::create_vrt_packet_with_payload(3, 3)); // 20 bytes
+    send(test_utils::create_vrt_packet_with_payload(4, 4)); // 24 bytes
+    EXPECT_EQ(drain(), (std::vector<uint32_t>{2, 3}));
+}
+
+TEST_F(SocketFilterTest, ReplaceAndClear) {
+    PacketFilter filter;
+    filter.stream_ids = {1};
+    ASSERT_TRUE(reader_.try_set_packet_filter(filter));
+    send(test_utils::create_minimal_vrt_packet(1));
+    send(test_utils::create_minimal_vrt_packet(2));
+    EXPECT_EQ(drain(), (std::vector<uint32_t>{1}));
+
+    filter.stream_ids = {2};
+    ASSERT_TRUE(reader_.try_set_packet_filter(filter));
+    send(test_utils::create_minimal_vrt_packet(1));
+    send(test_utils::create_minimal_vrt_packet(2));
+    EXPECT_EQ(drain(), (std::vector<uint32_t>{2}));
+
+    ASSERT_TRUE(reader_.try_set_packet_filter(PacketFilter{}));
+    ASSERT_TRUE(reader_.try_set_packet_filter(PacketFilter{})); // Nothing left to detach
+    send(test_utils::create_minimal_vrt_packet(1));
+    send(test_utils::create_minimal_vrt_packet(2));
+    EXPECT_EQ(drain(), (std::vector<uint32_t>{1, 2}));
+}
+
+TEST_F(SocketFilterTest, ContextPacketsMatchStreamIds) {
+    PacketFilter filter;
+    filter.stream_ids = {7};
+    ASSERT_TRUE(reader_.try_set_packet_filter(filter));
+
+    send(make_context_packet(7));
+    send(make_context_packet(8));
+    EXPECT_EQ(drain(), (std::vector<uint32_t>{7}));
+}
+
+TEST(SocketFilterCompileTest, RejectsInvalidFilters) {
+    PacketFilter filter;
+    filter.min_size = 100;
+    filter.max_size = 50;
+    EXPECT_THROW(compile_packet_filter(filter, 8), std::invalid_argument);
+
+    PacketFilter large;
+    large.stream_ids.resize(PacketFilter::max_stream_ids + 1);
+    EXPECT_THROW(compile_packet_filter(large, 8), std::invalid_argument);
+
+    large.stream_ids.resize(PacketFilter::max_stream_ids);
+    EXPECT_LE(compile_packet_filter(large, 8).size(), size_t{BPF_MAXINSNS});
+    EXPECT_TRUE(PacketFilter{}.accepts_all());
+}
+
+TEST(SocketFilterUnixTest, FiltersAtHeaderOffsetZero) {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, fds), 0);
+    UnixVRTReader<> reader(fds[0], true);
+    ASSERT_TRUE(reader.try_set_timeout(100ms));
+
+    PacketFilter filter;
+    filter.stream_ids = {5};
+    ASSERT_TRUE(reader.try_set_packet_filter(filter)) << strerror(errno);
+
+    for (uint32_t id : {4U, 5U, 6U}) {
+        auto packet = test_utils::create_minimal_vrt_packet(id);
+        ASSERT_EQ(::send(fds[1], packet.data(), packet.size(), 0),
+                  static_cast<ssize_t>(packet.size()));
+    }
+    close(fds[1]);
+
+    std::vector<uint32_t> ids;
+    while (auto packet = reader.read_next_packet()) {
+        ids.push_back(stream_id(*packet).value_or(0));
+    }
+    EXPECT_EQ(ids, (std::vector<uint32_t>{5}));
+}
+
+TEST(SocketFilterMulticastTest, FiltersAcrossJoinedGroups) {
+    MulticastVRTReader<> reader(0);
+    try {
+        reader.join(MulticastGroup::parse("239.77.2.1", "127.0.0.1"));
+        reader.join(MulticastGroup::parse("239.77.2.2", "127.0.0.1"));
+    } catch (const std::runtime_error& e) {
+        GTEST_SKIP() << "Multicast unavailable on loopback: " << e.what();
+    }
+    ASSERT_TRUE(reader.try_set_timeout(100ms));
+
+    PacketFilter filter;
+    filter.stream_ids = {21, 22};
+    ASSERT_TRUE(reader.try_set_packet_filter(filter)) << strerror(errno);
+
+    UDPVRTWriter sender;
+    sender.try_set_multicast_interface("127.0.0.1");
+    sender.try_set_multicast_loopback(true);
+    for (uint32_t id : {20U, 21U, 22U, 23U}) {
+        auto packet = test_utils::create_minimal_vrt_packet(id);
+        sockaddr_in dest{};
+        dest.sin_family = AF_INET;
+        dest.sin_port = htons(reader.socket_port());
+        inet_pton(AF_INET, id % 2 == 0 ? "239.77.2.1" : "239.77.2.2", &dest.sin_addr);
+        ASSERT_TRUE(sender.write_packet(
+            PacketVariant{RuntimeDataPacket(packet.data(), packet.size())}, dest));
+    }
+
+    std::vector<uint32_t> ids;
+    while (auto packet = reader.read_next_packet()) {
+        ids.push_back(stream_id(*packet).value_or(0));
+    }
+    EXPECT_EQ(ids, (std::vector<uint32_t>{21, 22}));
+}
@@ -0,0 +1,225 @@
+#include <array>
+#include <chrono>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace std::chrono_literals;
+using utils::netio::TCPTransportStatus;
+
+namespace {
+
+using test_utils::build;
+using test_utils::LargePacket;
+using test_utils::SmallPacket;
+using test_utils::stream_id_of;
+
+using MediumPacket = SignalDataPacket<NoClassId, NoTimestamp, Trailer::none, 97>;
+
+static_assert(utils::detail::PacketReader<TCPVRTReader<>>);
+static_assert(utils::detail::FlushableWriter<TCPVRTWriter>);
+
+// Packet n of a repeating small/medium/large sequence, stream ID n
+std::vector<uint8_t> packet_for(uint32_t n) {
+    switch (n % 3) {
+        case 0:
+            return build<SmallPacket>(n);
+        case 1:
+            return build<MediumPacket>(n);
+        default:
+            return build<LargePacket>(n);
+    }
+}
+
+// Connected stream socket pair: [0] for the reader, [1] for the sender
+struct StreamPair {
+    StreamPair() { EXPECT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()), 0); }
+    ~StreamPair() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+    void send(const std::vector<uint8_t>& bytes) const {
+        ASSERT_EQ(::send(fds[1], bytes.data(), bytes.size(), 0),
+                  static_cast<ssize_t>(bytes.size()));
+    }
+    void close_sender() { ::close(std::exchange(fds[1], -1)); }
+
+    std::array<int, 2> fds{-1, -1};
+};
+
+} // namespace
+
+TEST(TCPTransportTest, LoopbackRoundTripWithWrap) {
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listener, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ASSERT_EQ(::listen(listener, 1), 0);
+    socklen_t length = sizeof(addr);
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &length);
+
+    constexpr uint32_t count = 3000;
+    size_t send_calls = 0;
+    std::thread sender([&] {
+        TCPVRTWriter writer("127.0.0.1", ntohs(addr.sin_port));
+        writer.try_set_no_delay();
+        for (uint32_t n = 0; n < count; ++n) {
+            auto bytes = packet_for(n);
+            ASSERT_TRUE(writer.write_packet(RuntimeDataPacket(bytes.data(), bytes.size())));
+        }
+        ASSERT_TRUE(writer.flush());
+        EXPECT_EQ(writer.packets_written(), count);
+        send_calls = writer.send_calls();
+    });
+
+    int fd = ::accept(listener, nullptr, nullptr);
+    ::close(listener);
+    ASSERT_GE(fd, 0);
+    TCPVRTReader<> reader(fd, true, 0); // minimum ring: one maximum-size packet
+
+    uint32_t expected = 0;
+    size_t bytes = 0;
+    reader.for_each_data_packet([&](const RuntimeDataPacket& pkt) {
+        EXPECT_EQ(pkt.stream_id(), expected);
+        EXPECT_EQ(pkt.as_bytes().size(), packet_for(expected).size());
+        bytes += pkt.as_bytes().size();
+        ++expected;
+        return true;
+    });
+    sender.join();
+
+    EXPECT_EQ(expected, count);
+    EXPECT_EQ(reader.transport_status().state, TCPTransportStatus::State::socket_closed);
+    EXPECT_EQ(reader.transport_status().buffered_bytes, 0U);
+    EXPECT_EQ(reader.ring_capacity(), 256U * 1024);
+    EXPECT_GT(bytes, 2 * reader.ring_capacity());
+    EXPECT_GT(reader.wrapped_packets(), 0U);
+    EXPECT_LT(send_calls, count / 10); // coalesced
+}
+
+TEST(TCPTransportTest, FramesByteAtATimeStream) {
+    StreamPair pair;
+    TCPVRTReader<512> reader(pair.fds[0], false, 4096);
+
+    std::thread sender([&] {
+        for (uint32_t n = 0; n < 6; ++n) {
+            for (uint8_t byte : packet_for(n)) {
+                pair.send({byte});
+            }
+        }
+    });
+    for (uint32_t n = 0; n < 6; ++n) {
+        EXPECT_EQ(stream_id_of(reader.read_next_packet()), n);
+    }
+    sender.join();
+}
+
+TEST(TCPTransportTest, OversizedPacketIsSkipped) {
+    StreamPair pair;
+    TCPVRTReader<64> reader(pair.fds[0]);
+    pair.send(build<MediumPacket>(1)); // larger than 64 words
+    pair.send(build<SmallPacket>(2));
+
+    auto oversized = reader.read_next_packet();
+    ASSERT_TRUE(oversized.has_value());
+    ASSERT_TRUE(std::holds_alternative<InvalidPacket>(*oversized));
+    EXPECT_EQ(std::get<InvalidPacket>(*oversized).error, ValidationError::buffer_too_small);
+    EXPECT_EQ(reader.transport_status().state, TCPTransportStatus::State::packet_oversized);
+    EXPECT_EQ(reader.transport_status().packet_size, MediumPacket::size_bytes);
+
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 2U);
+}
+
+TEST(TCPTransportTest, ZeroSizeHeaderLosesSync) {
+    StreamPair pair;
+    TCPVRTReader<64> reader(pair.fds[0]);
+    pair.send({0x10, 0x00, 0x00, 0x00, 0xAA, 0xBB, 0xCC, 0xDD});
+
+    EXPECT_FALSE(reader.read_next_packet().has_value());
+    EXPECT_EQ(reader.transport_status().state, TCPTransportStatus::State::framing_error);
+    EXPECT_FALSE(reader.is_open());
+}
+
+TEST(TCPTransportTest, PartialPacketAtClose) {
+    StreamPair pair;
+    TCPVRTReader<512> reader(pair.fds[0]);
+    pair.send(build<SmallPacket>(7));
+    auto cut = build<MediumPacket>(8);
+    cut.resize(cut.size() / 2);
+    pair.send(cut);
+    pair.close_sender();
+
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 7U);
+    EXPECT_FALSE(reader.read_next_packet().has_value());
+    EXPECT_EQ(reader.transport_status().state, TCPTransportStatus::State::socket_closed);
+    EXPECT_EQ(reader.transport_status().buffered_bytes, cut.size());
+}
+
+TEST(TCPTransportTest, TimeoutKeepsBufferedBytes) {
+    StreamPair pair;
+    TCPVRTReader<512> reader(pair.fds[0]);
+    ASSERT_TRUE(reader.try_set_timeout(50ms));
+
+    auto packet = build<MediumPacket>(9);
+    pair.send(std::vector<uint8_t>(packet.begin(), packet.begin() + 40));
+    EXPECT_FALSE(reader.read_next_packet().has_value());
+    EXPECT_EQ(reader.transport_status().state, TCPTransportStatus::State::timeout);
+    EXPECT_TRUE(reader.is_open());
+
+    pair.send(std::vector<uint8_t>(packet.begin() + 40, packet.end()));
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 9U);
+}
+
+TEST(TCPTransportTest, BatchWriteAndImmediateMode) {
+    StreamPair pair;
+    TCPVRTReader<512> reader(pair.fds[0]);
+    TCPVRTWriter writer(pair.fds[1]);
+
+    // Staged packet goes out ahead of the batch, all in one gather write
+    auto first = build<SmallPacket>(0);
+    ASSERT_TRUE(writer.write_packet(RuntimeDataPacket(first.data(), first.size())));
+    EXPECT_EQ(writer.staged_bytes(), first.size());
+
+    std::vector<std::vector<uint8_t>> storage;
+    std::vector<PacketVariant> batch;
+    for (uint32_t n = 1; n <= 4; ++n) {
+        storage.push_back(packet_for(n));
+    }
+    for (auto& bytes : storage) {
+        batch.emplace_back(RuntimeDataPacket(bytes.data(), bytes.size()));
+    }
+    EXPECT_EQ(writer.write_packets(batch), 4U);
+    EXPECT_EQ(writer.staged_bytes(), 0U);
+    EXPECT_EQ(writer.send_calls(), 1U);
+
+    writer.set_coalesce_bytes(0);
+    auto last = build<SmallPacket>(5);
+    ASSERT_TRUE(writer.write_packet(RuntimeDataPacket(last.data(), last.size())));
+    EXPECT_EQ(writer.send_calls(), 2U);
+    EXPECT_EQ(writer.packets_written(), 6U);
+
+    for (uint32_t n = 0; n <= 5; ++n) {
+        EXPECT_EQ(stream_id_of(reader.read_next_packet()), n);
+    }
+
+    // An InvalidPacket stops the batch after the packets before it
+    batch.insert(batch.begin() + 2, PacketVariant{InvalidPacket{}});
+    EXPECT_EQ(writer.write_packets(batch), 2U);
+    EXPECT_EQ(writer.transport_status().errno_value, EINVAL);
+}
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <complex>
+#include <optional>
 #include <span>
+#include <variant>
 #include <vector>
 
 #include <cstdint>
 #include <cstring>
+#include <vrtigo.hpp>
 
 namespace test_utils {
 
@@ -268,4 +271,39 @@ inline std::vector<uint8_t> create_vrt_packet_with_payload(uint32_t stream_id,
     return packet;
 }
 
+/// Signal data packet with a stream ID and 5 words in total
+using SmallPacket =
+    vrtigo::SignalDataPacket<vrtigo::NoClassId, vrtigo::NoTimestamp, vrtigo::Trailer::none, 5>;
+
+/// Signal data packet with a stream ID and 301 words in total
+using LargePacket =
+    vrtigo::SignalDataPacket<vrtigo::NoClassId, vrtigo::NoTimestamp, vrtigo::Trailer::none, 301>;
+
+/**
+ * @brief Serialize a compile-time packet type with the given stream ID
+ *
+ * @tparam Packet Packet type to build (e.g. SmallPacket)
+ * @param stream_id Stream identifier to use
+ * @return Packet bytes in network byte order
+ */
+template <typename Packet>
+std::vector<uint8_t> build(uint32_t stream_id) {
+    std::vector<uint8_t> bytes(Packet::size_bytes);
+    vrtigo::PacketBuilder<Packet>(bytes.data()).stream_id(stream_id).build();
+    return bytes;
+}
+
+/**
+ * @brief Stream ID of a received data packet
+ *
+ * @param pkt Result of a reader's read_next_packet()
+ * @return Stream ID, or nullopt if nothing was read or it is not a data packet
+ */
+inline std::optional<uint32_t> stream_id_of(const std::optional<vrtigo::PacketVariant>& pkt) {
+    if (!pkt || !std::holds_alternative<vrtigo::RuntimeDataPacket>(*pkt)) {
+        return std::nullopt;
+    }
+    return std::get<vrtigo::RuntimeDataPacket>(*pkt).stream_id();
+}
+
 } // namespace test_utils
@@ -0,0 +1,201 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vrtigo.hpp>
+#include <vrtigo/utils/netio/udp_fanout_writer.hpp>
+#include <vrtigo/utils/netio/udp_vrt_reader.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace vrtigo::utils::netio;
+using namespace std::chrono_literals;
+
+namespace {
+
+SocketAddress loopback(uint16_t port) {
+    return SocketAddress::resolve("127.0.0.1", port, AF_INET);
+}
+
+// A loopback port with nothing bound to it (answers with ICMP port unreachable)
+uint16_t closed_port() {
+    UDPVRTReader<> probe(uint16_t(0));
+    return probe.socket_port();
+}
+
+struct Batch {
+    std::vector<std::vector<uint8_t>> storage;
+    std::vector<PacketVariant> packets;
+
+    Batch(uint32_t first, uint32_t count) {
+        for (uint32_t n = first; n < first + count; ++n) {
+            storage.push_back(test_utils::create_minimal_vrt_packet(n));
+        }
+        for (auto& bytes : storage) {
+            packets.emplace_back(RuntimeDataPacket(bytes.data(), bytes.size()));
+        }
+    }
+};
+
+class UDPFanoutTest : public ::testing::Test {
+protected:
+    std::vector<std::unique_ptr<UDPVRTReader<>>> readers_;
+    UDPFanoutWriter writer_;
+
+    UDPVRTReader<>& add_reader() {
+        readers_.push_back(std::make_unique<UDPVRTReader<>>(uint16_t(0)));
+        readers_.back()->try_set_timeout(100ms);
+        writer_.add_subscriber(loopback(readers_.back()->socket_port()));
+        return *readers_.back();
+    }
+
+    static std::vector<uint32_t> drain(UDPVRTReader<>& reader) {
+        std::vector<uint32_t> ids;
+        while (auto handle = reader.read_next_handle()) {
+            ids.push_back(*handle->stream_id());
+        }
+        return ids;
+    }
+
+    static std::vector<uint32_t> sequence(uint32_t first, uint32_t count) {
+        std::vector<uint32_t> ids;
+        for (uint32_t n = first; n < first + count; ++n) {
+            ids.push_back(n);
+        }
+        return ids;
+    }
+};
+
+} // namespace
+
+TEST_F(UDPFanoutTest, BatchGoesOutInOneSyscall) {
+    for (int i = 0; i < 3; ++i) {
+        add_reader();
+    }
+
+    Batch batch(0, 8);
+    EXPECT_EQ(writer_.write_packets(batch.packets), 8U);
+    EXPECT_EQ(writer_.send_calls(), 1U);
+    EXPECT_EQ(writer_.datagrams_sent(), 24U);
+    EXPECT_EQ(writer_.packets_written(), 8U);
+    EXPECT_EQ(writer_.bytes_sent(), 24U * 12U);
+
+    for (auto& reader : readers_) {
+        EXPECT_EQ(drain(*reader), sequence(0, 8)); // in order per subscriber
+    }
+    for (const auto& subscriber : writer_.subscribers()) {
+        EXPECT_EQ(subscriber.packets_sent, 8U);
+        EXPECT_EQ(subscriber.errors, 0U);
+    }
+}
+
+TEST_F(UDPFanoutTest, SinglePacketAndSubscriberTable) {
+    auto& first = add_reader();
+    auto& second = add_reader();
+    auto second_id = writer_.subscribers()[1].id;
+
+    // Duplicates resolve to the existing subscriber
+    EXPECT_EQ(writer_.add_subscriber(loopback(second.socket_port())), second_id);
+    EXPECT_EQ(writer_.subscribers().size(), 2U);
+
+    auto bytes = test_utils::create_minimal_vrt_packet(42);
+    EXPECT_TRUE(writer_.write_packet(RuntimeDataPacket(bytes.data(), bytes.size())));
+    EXPECT_EQ(drain(first), std::vector<uint32_t>{42});
+    EXPECT_EQ(drain(second), std::vector<uint32_t>{42});
+
+    EXPECT_TRUE(writer_.remove_subscriber(second_id));
+    EXPECT_FALSE(writer_.remove_subscriber(second_id));
+    EXPECT_EQ(writer_.find_subscriber(second_id), nullptr);
+    EXPECT_TRUE(writer_.write_packet(RuntimeDataPacket(bytes.data(), bytes.size())));
+    EXPECT_EQ(drain(first), std::vector<uint32_t>{42});
+    EXPECT_TRUE(drain(second).empty());
+
+    // An IPv4 writer cannot reach IPv6 destinations
+    EXPECT_THROW(writer_.add_subscriber(SocketAddress::resolve("::1", 5000, AF_INET6)),
+                 std::runtime_error);
+}
+
+TEST_F(UDPFanoutTest, InvalidAndOversizedPacketsStopTheBatch) {
+    auto& reader = add_reader();
+
+    Batch batch(0, 4);
+    batch.packets.insert(batch.packets.begin() + 2, PacketVariant{InvalidPacket{}});
+    EXPECT_EQ(writer_.write_packets(batch.packets), 2U);
+    EXPECT_EQ(writer_.transport_status().errno_value, EINVAL);
+    EXPECT_EQ(drain(reader), sequence(0, 2));
+
+    writer_.set_mtu(8);
+    auto bytes = test_utils::create_minimal_vrt_packet(7);
+    EXPECT_FALSE(writer_.write_packet(RuntimeDataPacket(bytes.data(), bytes.size())));
+    EXPECT_EQ(writer_.transport_status().errno_value, EMSGSIZE);
+    EXPECT_TRUE(drain(reader).empty());
+}
+
+TEST_F(UDPFanoutTest, DeadSubscriberBacksOffWithoutAffectingOthers) {
+    auto& first = add_reader();
+    auto dead_id = writer_.add_subscriber(loopback(closed_port()));
+    auto& last = add_reader();
+    writer_.set_backoff({10s, 10s});
+
+    // The ICMP port unreachable is charged to the dead subscriber, not to whichever entry
+    // surfaced it
+    Batch batch(0, 16);
+    EXPECT_EQ(writer_.write_packets(batch.packets), 16U);
+    EXPECT_EQ(drain(first), sequence(0, 16));
+    EXPECT_EQ(drain(last), sequence(0, 16));
+
+    const auto* dead = writer_.find_subscriber(dead_id);
+    ASSERT_NE(dead, nullptr);
+    EXPECT_GE(dead->errors, 1U);
+    EXPECT_EQ(dead->last_errno, ECONNREFUSED);
+    EXPECT_TRUE(dead->backing_off(std::chrono::steady_clock::now()));
+    for (const auto& subscriber : writer_.subscribers()) {
+        if (subscriber.id != dead_id) {
+            EXPECT_EQ(subscriber.errors, 0U);
+            EXPECT_EQ(subscriber.packets_sent, 16U);
+        }
+    }
+
+    // While backing off the dead subscriber is skipped entirely
+    const auto errors = dead->errors;
+    const auto skipped = dead->packets_skipped;
+    const auto calls = writer_.send_calls();
+    Batch more(16, 16);
+    EXPECT_EQ(writer_.write_packets(more.packets), 16U);
+    EXPECT_EQ(writer_.send_calls(), calls + 1);
+    EXPECT_EQ(dead->errors, errors);
+    EXPECT_EQ(dead->packets_skipped, skipped + 16);
+    EXPECT_EQ(drain(first), sequence(16, 16));
+    EXPECT_EQ(drain(last), sequence(16, 16));
+    EXPECT_EQ(writer_.transport_status().state, UDPTransportStatus::State::packet_ready);
+}
+
+TEST_F(UDPFanoutTest, ProbeAfterBackoffExpires) {
+    auto& reader = add_reader();
+    auto dead_id = writer_.add_subscriber(loopback(closed_port()));
+    writer_.set_backoff({20ms, 20ms});
+
+    auto bytes = test_utils::create_minimal_vrt_packet(1);
+    RuntimeDataPacket packet(bytes.data(), bytes.size());
+    EXPECT_FALSE(writer_.write_packet(packet));
+    const auto* dead = writer_.find_subscriber(dead_id);
+    ASSERT_NE(dead, nullptr);
+    EXPECT_EQ(dead->consecutive_failures, 1U);
+
+    // Skipped during the back-off, probed again once it runs out
+    EXPECT_TRUE(writer_.write_packet(packet));
+    EXPECT_EQ(dead->consecutive_failures, 1U);
+    std::this_thread::sleep_for(30ms);
+    EXPECT_FALSE(writer_.write_packet(packet));
+    EXPECT_EQ(dead->consecutive_failures, 2U);
+    EXPECT_EQ(drain(reader).size(), 3U);
+    EXPECT_EQ(writer_.subscriber_errors(), 2U);
+}
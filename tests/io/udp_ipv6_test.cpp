@@ -0,0 +1,210 @@
+#include <array>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include <arpa/inet.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace std::chrono_literals;
+
+// IPv6 tests run over ::1 and skip when the host has no IPv6 loopback. The multicast test
+// sends on the default interface and skips if the kernel has no IPv6 multicast route.
+
+namespace {
+
+using test_utils::stream_id_of;
+
+using TestPacket = SignalDataPacket<NoClassId, NoTimestamp, Trailer::none, 4>;
+
+PacketVariant make_packet(std::array<uint8_t, TestPacket::size_bytes>& buffer,
+                          uint32_t stream_id) {
+    PacketBuilder<TestPacket>(buffer.data()).stream_id(stream_id).build();
+    return PacketVariant{RuntimeDataPacket(buffer.data(), buffer.size())};
+}
+
+std::optional<UDPVRTReader<>> open_reader(IPFamily family) {
+    std::optional<UDPVRTReader<>> reader;
+    try {
+        reader.emplace(0, family);
+        reader->try_set_timeout(500ms);
+    } catch (const std::runtime_error&) {
+        reader.reset();
+    }
+    return reader;
+}
+
+} // namespace
+
+TEST(SocketAddressTest, ResolveAndFormat) {
+    auto v4 = SocketAddress::resolve("127.0.0.1", 5000);
+    EXPECT_EQ(v4.family(), AF_INET);
+    EXPECT_EQ(v4.port(), 5000);
+    EXPECT_EQ(v4.to_string(), "127.0.0.1:5000");
+    EXPECT_FALSE(v4.is_multicast());
+
+    auto v6 = SocketAddress::resolve("::1", 6000);
+    EXPECT_EQ(v6.family(), AF_INET6);
+    EXPECT_EQ(v6.length(), sizeof(sockaddr_in6));
+    EXPECT_EQ(v6.to_string(), "[::1]:6000");
+
+    auto mapped = v4.to_v4_mapped();
+    EXPECT_EQ(mapped.family(), AF_INET6);
+    EXPECT_EQ(mapped.to_string(), "[::ffff:127.0.0.1]:5000");
+    EXPECT_EQ(v6.to_v4_mapped(), v6);
+
+    EXPECT_TRUE(SocketAddress::resolve("ff15::1234", 1).is_multicast());
+    EXPECT_TRUE(SocketAddress::resolve("239.0.0.1", 1).is_multicast());
+    EXPECT_THROW(SocketAddress::resolve("::1", 1, AF_INET), std::runtime_error);
+
+    // IPFamily resolution: dual stack prefers IPv4 and falls back to IPv6
+    EXPECT_EQ(SocketAddress::resolve("localhost", 1, IPFamily::ipv4).family(), AF_INET);
+    EXPECT_EQ(SocketAddress::resolve("localhost", 1, IPFamily::dual_stack).family(), AF_INET);
+    EXPECT_EQ(SocketAddress::resolve("::1", 1, IPFamily::dual_stack).family(), AF_INET6);
+    EXPECT_THROW(SocketAddress::resolve("127.0.0.1", 1, IPFamily::ipv6), std::runtime_error);
+
+    SocketAddress empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.family(), AF_UNSPEC);
+    EXPECT_EQ(empty.port(), 0);
+}
+
+TEST(MulticastGroupV6Test, Parse) {
+    auto group = MulticastGroupV6::parse("ff15::77", "1");
+    EXPECT_EQ(group.interface_index, 1U);
+    EXPECT_FALSE(group.is_source_specific());
+
+    auto ssm = MulticastGroupV6::parse("ff35::77", "", "fd00::9");
+    EXPECT_TRUE(ssm.is_source_specific());
+    EXPECT_EQ(ssm.interface_index, 0U);
+
+    EXPECT_THROW(MulticastGroupV6::parse("fd00::1"), std::invalid_argument);
+    EXPECT_THROW(MulticastGroupV6::parse("239.1.2.3"), std::invalid_argument);
+    EXPECT_THROW(MulticastGroupV6::parse("ff15::1", "no-such-interface0"), std::invalid_argument);
+}
+
+TEST(UDPIPv6Test, BoundWriterToIPv6Reader) {
+    auto reader = open_reader(IPFamily::ipv6);
+    if (!reader) {
+        GTEST_SKIP() << "IPv6 unavailable";
+    }
+
+    // Names resolve to IPv4 unless the writer asks for IPv6
+    EXPECT_THROW(UDPVRTWriter("::1", reader->socket_port()), std::runtime_error);
+    UDPVRTWriter writer("::1", reader->socket_port(), IPFamily::ipv6);
+    EXPECT_EQ(writer.destination().family(), AF_INET6);
+
+    std::array<uint8_t, TestPacket::size_bytes> buffer{};
+    PacketBuilder<TestPacket>(buffer.data()).stream_id(0x61).build();
+    ASSERT_TRUE(writer.write_packet(RuntimeDataPacket(buffer.data(), buffer.size())));
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x61U);
+}
+
+TEST(UDPIPv6Test, UnboundWriterCachedDestination) {
+    auto reader = open_reader(IPFamily::ipv6);
+    if (!reader) {
+        GTEST_SKIP() << "IPv6 unavailable";
+    }
+
+    UDPVRTWriter writer(0, IPFamily::ipv6);
+    auto dest = writer.resolve_destination("::1", reader->socket_port());
+    EXPECT_THROW(writer.resolve_destination("127.0.0.1", 1), std::runtime_error);
+
+    std::array<uint8_t, TestPacket::size_bytes> buffer{};
+    for (uint32_t id = 1; id <= 3; ++id) {
+        ASSERT_TRUE(writer.write_packet(make_packet(buffer, id), dest));
+        EXPECT_EQ(stream_id_of(reader->read_next_packet()), id);
+    }
+    EXPECT_EQ(writer.packets_sent(), 3U);
+}
+
+TEST(UDPIPv6Test, DualStackReaderAndWriter) {
+    auto reader = open_reader(IPFamily::dual_stack);
+    if (!reader) {
+        GTEST_SKIP() << "IPv6 unavailable";
+    }
+    uint16_t port = reader->socket_port();
+    std::array<uint8_t, TestPacket::size_bytes> buffer{};
+
+    // Plain IPv4 sender reaches the dual-stack reader
+    UDPVRTWriter v4_writer("127.0.0.1", port);
+    ASSERT_TRUE(v4_writer.write_packet(make_packet(buffer, 0x40)));
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x40U);
+
+    // Dual-stack writer: IPv4 destinations resolve v4-mapped, IPv6 ones unchanged
+    UDPVRTWriter writer(0, IPFamily::dual_stack);
+    auto v4_dest = writer.resolve_destination("127.0.0.1", port);
+    auto v6_dest = writer.resolve_destination("::1", port);
+    EXPECT_EQ(v4_dest.family(), AF_INET6);
+    EXPECT_EQ(v4_dest.to_string(), "[::ffff:127.0.0.1]:" + std::to_string(port));
+    ASSERT_TRUE(writer.write_packet(make_packet(buffer, 0x41), v4_dest));
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x41U);
+    ASSERT_TRUE(writer.write_packet(make_packet(buffer, 0x42), v6_dest));
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x42U);
+
+    // Legacy sockaddr_in destinations are mapped for the IPv6 socket
+    sockaddr_in legacy{};
+    legacy.sin_family = AF_INET;
+    legacy.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &legacy.sin_addr);
+    ASSERT_TRUE(writer.write_packet(make_packet(buffer, 0x43), legacy));
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x43U);
+}
+
+TEST(UDPIPv6Test, IPv6OnlyReaderRejectsIPv4) {
+    auto reader = open_reader(IPFamily::ipv6);
+    if (!reader) {
+        GTEST_SKIP() << "IPv6 unavailable";
+    }
+    reader->try_set_timeout(100ms);
+
+    UDPVRTWriter v4_writer("127.0.0.1", reader->socket_port());
+    std::array<uint8_t, TestPacket::size_bytes> buffer{};
+    v4_writer.write_packet(make_packet(buffer, 0x44));
+    EXPECT_FALSE(reader->read_next_packet().has_value());
+}
+
+TEST(UDPIPv6Test, MulticastSendOptions) {
+    UDPVRTWriter writer(0, IPFamily::dual_stack);
+    EXPECT_TRUE(writer.try_set_multicast_ttl(4));
+    EXPECT_TRUE(writer.try_set_multicast_loopback(true));
+    EXPECT_TRUE(writer.try_set_multicast_interface(""));
+    EXPECT_TRUE(writer.try_set_multicast_interface("lo"));
+    EXPECT_TRUE(writer.try_set_multicast_interface("127.0.0.1")); // IPv4 side of dual stack
+    EXPECT_FALSE(writer.try_set_multicast_interface("no-such-interface0"));
+    EXPECT_EQ(writer.transport_status().errno_value, EINVAL);
+
+    UDPVRTWriter v6_writer(0, IPFamily::ipv6);
+    EXPECT_FALSE(v6_writer.try_set_multicast_interface("127.0.0.1"));
+}
+
+TEST(UDPIPv6Test, MulticastGroup) {
+    auto group = MulticastGroupV6::parse("ff15::7707");
+    std::optional<UDPVRTReader<>> reader;
+    try {
+        reader.emplace(0, group);
+    } catch (const std::runtime_error& e) {
+        GTEST_SKIP() << "IPv6 multicast unavailable: " << e.what();
+    }
+    reader->try_set_timeout(500ms);
+
+    UDPVRTWriter writer(0, IPFamily::ipv6);
+    writer.try_set_multicast_loopback(true);
+    auto dest = writer.resolve_destination("ff15::7707", reader->socket_port());
+    std::array<uint8_t, TestPacket::size_bytes> buffer{};
+    if (!writer.write_packet(make_packet(buffer, 0x66), dest)) {
+        GTEST_SKIP() << "No IPv6 multicast route (errno "
+                     << writer.transport_status().errno_value << ")";
+    }
+    EXPECT_EQ(stream_id_of(reader->read_next_packet()), 0x66U);
+
+    EXPECT_TRUE(reader->try_leave_group(group));
+    EXPECT_FALSE(reader->try_leave_group(group));
+}
@@ -8,6 +8,7 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#include <vrtigo.hpp>
 #include <vrtigo/utils/netio/udp_vrt_reader.hpp>
 
 #include "test_utils.hpp"
@@ -173,6 +174,22 @@ TEST_F(UDPReaderTest, ReceiveSinglePacket) {
     EXPECT_EQ(payload[3], 0xEF);
 }
 
+TEST_F(UDPReaderTest, ReceiveHandle) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(1000));
+    send_vrt_packet(test_utils::create_minimal_vrt_packet(0x12345678), reader.socket_port());
+
+    auto handle = reader.read_next_handle();
+    ASSERT_TRUE(handle.has_value());
+    ASSERT_EQ(handle->kind(), PacketKind::data);
+    EXPECT_EQ(handle->stream_id(), 0x12345678U);
+    EXPECT_EQ(handle->payload().size(), 4U);
+
+    // Timeout is not a packet
+    reader.try_set_timeout(std::chrono::milliseconds(10));
+    EXPECT_FALSE(reader.read_next_handle().has_value());
+}
+
 TEST_F(UDPReaderTest, ReceiveMultiplePackets) {
     UDPVRTReader<> reader(uint16_t(0));
     reader.try_set_timeout(std::chrono::milliseconds(1000));
@@ -445,3 +462,273 @@ TEST_F(UDPReaderTest, TimeoutIsNonTerminal) {
     ASSERT_TRUE(pkt2.has_value()) << "Should receive packet after timeout";
     EXPECT_TRUE(is_valid(*pkt2)) << "Packet should be valid";
 }
+
+// =============================================================================
+// Receive Timestamps
+// =============================================================================
+
+namespace {
+
+using TimedPacket =
+    vrtigo::SignalDataPacket<vrtigo::NoClassId, vrtigo::UtcRealTimestamp, vrtigo::Trailer::none, 1>;
+
+std::vector<uint8_t> create_timed_packet(vrtigo::UtcRealTimestamp ts) {
+    std::vector<uint8_t> bytes(TimedPacket::size_bytes);
+    vrtigo::PacketBuilder<TimedPacket>(bytes.data()).stream_id(0x1234).timestamp(ts).build();
+    return bytes;
+}
+
+} // namespace
+
+TEST_F(UDPReaderTest, ReceiveTimestampsDisabledByDefault) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(1000));
+    EXPECT_EQ(reader.receive_timestamp_mode(), ReceiveTimestampMode::none);
+
+    send_vrt_packet(test_utils::create_minimal_vrt_packet(), reader.socket_port());
+
+    auto result = reader.read_next_timestamped_packet();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(is_valid(result->packet));
+    EXPECT_FALSE(result->receive_time.has_value());
+    EXPECT_FALSE(vrt_to_arrival_latency(*result).has_value());
+}
+
+TEST_F(UDPReaderTest, SoftwareReceiveTimestamp) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(1000));
+    ASSERT_TRUE(reader.try_enable_receive_timestamps(ReceiveTimestampMode::software));
+
+    auto before = std::chrono::system_clock::now();
+    send_vrt_packet(create_timed_packet(vrtigo::UtcRealTimestamp::now()), reader.socket_port());
+
+    auto result = reader.read_next_timestamped_packet();
+    auto after = std::chrono::system_clock::now();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(is_valid(result->packet));
+
+    const auto& arrival = result->receive_time;
+    ASSERT_EQ(arrival.source, ReceiveTimestampSource::software);
+    EXPECT_GE(arrival.time, before - std::chrono::milliseconds(1));
+    EXPECT_LE(arrival.time, after);
+    EXPECT_EQ(reader.transport_status().receive_time.time, arrival.time);
+
+    auto latency = vrt_to_arrival_latency(*result);
+    ASSERT_TRUE(latency.has_value());
+    EXPECT_GE(latency->count(), -1000000); // within clock granularity
+    EXPECT_LT(*latency, std::chrono::seconds(1));
+}
+
+TEST_F(UDPReaderTest, TimestampingReceiveTimestamp) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(1000));
+    if (!reader.try_enable_receive_timestamps(ReceiveTimestampMode::timestamping)) {
+        GTEST_SKIP() << "SO_TIMESTAMPING not supported";
+    }
+    EXPECT_EQ(reader.receive_timestamp_mode(), ReceiveTimestampMode::timestamping);
+
+    send_vrt_packet(test_utils::create_minimal_vrt_packet(), reader.socket_port());
+
+    auto result = reader.read_next_timestamped_packet();
+    ASSERT_TRUE(result.has_value());
+    // Loopback has no hardware stamping; the software RX stamp must be reported
+    EXPECT_TRUE(result->receive_time.has_value());
+
+    // Disabling stops delivery
+    ASSERT_TRUE(reader.try_enable_receive_timestamps(ReceiveTimestampMode::none));
+    send_vrt_packet(test_utils::create_minimal_vrt_packet(), reader.socket_port());
+    result = reader.read_next_timestamped_packet();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result->receive_time.has_value());
+}
+
+TEST_F(UDPReaderTest, ArrivalLatencyHelper) {
+    auto bytes = create_timed_packet(vrtigo::UtcRealTimestamp(1700000000, 250000000000ULL));
+    RuntimeDataPacket packet(bytes.data(), bytes.size());
+    ASSERT_TRUE(packet.is_valid());
+
+    ReceiveTimestamp arrival{vrtigo::UtcRealTimestamp(1700000001, 0).to_chrono(),
+                             ReceiveTimestampSource::software};
+    auto latency = vrt_to_arrival_latency(packet, arrival);
+    ASSERT_TRUE(latency.has_value());
+    EXPECT_EQ(*latency, std::chrono::milliseconds(750));
+
+    // No UTC timestamp, no arrival time, or invalid packet: no latency
+    auto untimed = test_utils::create_minimal_vrt_packet();
+    EXPECT_FALSE(vrt_to_arrival_latency(RuntimeDataPacket(untimed.data(), untimed.size()), arrival)
+                     .has_value());
+    EXPECT_FALSE(vrt_to_arrival_latency(packet, ReceiveTimestamp{}).has_value());
+    auto invalid = vrtigo::detail::parse_packet(std::span<const uint8_t>(bytes.data(), 2));
+    EXPECT_FALSE(vrt_to_arrival_latency(invalid, arrival).has_value());
+}
+
+// =============================================================================
+// Kernel Drop Accounting
+// =============================================================================
+
+TEST_F(UDPReaderTest, KernelDropsReportedAfterOverflow) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(100));
+    if (!reader.try_enable_drop_accounting()) {
+        GTEST_SKIP() << "SO_RXQ_OVFL not supported";
+    }
+    ASSERT_TRUE(reader.try_set_receive_buffer_size(1)); // Clamped to the kernel minimum
+
+    // Overflow the queue without reading
+    auto packet = test_utils::create_vrt_packet_with_payload(0x1234, 64);
+    for (int i = 0; i < 200; ++i) {
+        send_vrt_packet(packet, reader.socket_port());
+    }
+
+    size_t received = 0;
+    while (reader.read_next_packet()) {
+        ++received;
+    }
+    // Each datagram carries the counter as of its own enqueue, so the drops behind the
+    // queued datagrams are reported by the next one
+    send_vrt_packet(packet, reader.socket_port());
+    ASSERT_TRUE(reader.read_next_packet().has_value());
+
+    EXPECT_GT(received, 0U);
+    EXPECT_EQ(reader.transport_status().kernel_drops, 200U - received);
+}
+
+TEST_F(UDPReaderTest, AdaptiveReceiveBufferGrowsOnDrops) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(100));
+    ASSERT_TRUE(reader.try_set_receive_buffer_size(1));
+    ReceiveBufferPolicy policy;
+    policy.min_interval = std::chrono::milliseconds(0);
+    if (!reader.try_enable_adaptive_receive_buffer(policy)) {
+        GTEST_SKIP() << "SO_RXQ_OVFL not supported";
+    }
+    const auto& controller = reader.receive_buffer_controller();
+    ASSERT_TRUE(controller.has_value());
+    const size_t initial = controller->size_bytes();
+    EXPECT_EQ(controller->resizes(), 0U);
+
+    auto packet = test_utils::create_vrt_packet_with_payload(0x1234, 64);
+    for (int i = 0; i < 200; ++i) {
+        send_vrt_packet(packet, reader.socket_port());
+    }
+    while (reader.read_next_packet()) {
+    }
+    send_vrt_packet(packet, reader.socket_port());
+    ASSERT_TRUE(reader.read_next_packet().has_value());
+
+    ASSERT_GT(reader.transport_status().kernel_drops, 0U);
+    EXPECT_EQ(controller->drops_seen(), reader.transport_status().kernel_drops);
+    EXPECT_GE(controller->resizes(), 1U);
+    EXPECT_GT(controller->size_bytes(), initial);
+}
+
+TEST(ReceiveBufferControllerTest, RespectsIntervalAndLimit) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(fd, 0);
+    int size = 1;
+    ASSERT_EQ(setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)), 0);
+
+    ReceiveBufferPolicy policy;
+    policy.min_interval = std::chrono::seconds(1);
+    policy.max_bytes = vrtigo::utils::detail::receive_buffer_size(fd) * 3;
+    ReceiveBufferController controller(fd, policy);
+    auto t0 = ReceiveBufferController::clock::now();
+    auto t1 = t0 + std::chrono::seconds(2);
+
+    EXPECT_FALSE(controller.observe(0, t0)); // No drops
+    EXPECT_TRUE(controller.observe(5, t0));  // Grows to 2x
+    EXPECT_FALSE(controller.observe(9, t0)); // Within min_interval
+    EXPECT_FALSE(controller.observe(9, t1)); // Counter unchanged
+    EXPECT_TRUE(controller.observe(10, t1)); // Capped at 3x
+    EXPECT_LE(controller.size_bytes(), policy.max_bytes);
+    EXPECT_FALSE(controller.observe(20, t1 + std::chrono::seconds(2)));
+    EXPECT_TRUE(controller.at_limit());
+    EXPECT_EQ(controller.resizes(), 2U);
+    close(fd);
+}
+
+// =============================================================================
+// Low-Latency Receive Modes
+// =============================================================================
+
+TEST_F(UDPReaderTest, SpinModeReceivesAndTimesOut) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(100));
+    reader.set_receive_mode(ReceiveMode::spin);
+    EXPECT_EQ(reader.receive_mode(), ReceiveMode::spin);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(reader.read_next_packet().has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    EXPECT_EQ(reader.transport_status().state, UDPTransportStatus::State::timeout);
+    EXPECT_TRUE(reader.is_open());
+
+    uint16_t port = reader.socket_port();
+    auto packet_data = test_utils::create_minimal_vrt_packet(0xABCD);
+    ThreadGuard sender(std::thread([this, packet_data, port]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        send_vrt_packet(packet_data, port);
+    }));
+
+    auto pkt = reader.read_next_packet();
+    ASSERT_TRUE(pkt.has_value());
+    EXPECT_EQ(stream_id(*pkt), 0xABCDU);
+}
+
+TEST_F(UDPReaderTest, SpinThenBlockFallsBackToBlocking) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(1000));
+    reader.set_receive_mode(ReceiveMode::spin_then_block, std::chrono::microseconds(200));
+
+    // The datagram arrives long after the spin budget, so it is received by the blocking
+    // recvmsg()
+    uint16_t port = reader.socket_port();
+    auto packet_data = test_utils::create_minimal_vrt_packet();
+    ThreadGuard sender(std::thread([this, packet_data, port]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        send_vrt_packet(packet_data, port);
+    }));
+
+    auto pkt = reader.read_next_packet();
+    ASSERT_TRUE(pkt.has_value());
+    EXPECT_TRUE(is_valid(*pkt));
+}
+
+TEST_F(UDPReaderTest, WakeupLatencyReported) {
+    UDPVRTReader<> reader(uint16_t(0));
+    reader.try_set_timeout(std::chrono::milliseconds(1000));
+    ASSERT_TRUE(reader.try_enable_receive_timestamps());
+    EXPECT_FALSE(reader.transport_status().wakeup_latency().has_value());
+
+    for (auto mode : {ReceiveMode::blocking, ReceiveMode::spin}) {
+        reader.set_receive_mode(mode);
+        send_vrt_packet(test_utils::create_minimal_vrt_packet(), reader.socket_port());
+        ASSERT_TRUE(reader.read_next_packet().has_value());
+
+        auto latency = reader.transport_status().wakeup_latency();
+        ASSERT_TRUE(latency.has_value());
+        EXPECT_GE(latency->count(), 0);
+        EXPECT_LT(*latency, std::chrono::seconds(1));
+    }
+}
+
+TEST_F(UDPReaderTest, BusyPollOptions) {
+    UDPVRTReader<> reader(uint16_t(0));
+    BusyPollOptions options;
+    options.poll_time = std::chrono::microseconds(20);
+    options.prefer_busy_poll = false;
+    if (!reader.try_enable_busy_poll(options)) {
+        GTEST_SKIP() << "SO_BUSY_POLL rejected: "
+                     << strerror(reader.transport_status().errno_value);
+    }
+
+    int value = 0;
+    socklen_t len = sizeof(value);
+    ASSERT_EQ(getsockopt(reader.socket_fd(), SOL_SOCKET, SO_BUSY_POLL, &value, &len), 0);
+    EXPECT_EQ(value, 20);
+
+    // Disabling never needs privileges
+    EXPECT_TRUE(reader.try_enable_busy_poll(BusyPollOptions{std::chrono::microseconds(0)}));
+    ASSERT_EQ(getsockopt(reader.socket_fd(), SOL_SOCKET, SO_BUSY_POLL, &value, &len), 0);
+    EXPECT_EQ(value, 0);
+}
@@ -0,0 +1,243 @@
+#include <array>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vrtigo/vrtigo_utils.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace std::chrono_literals;
+using utils::netio::UDPTransportStatus;
+
+namespace {
+
+using test_utils::build;
+using test_utils::LargePacket;
+using test_utils::SmallPacket;
+using test_utils::stream_id_of;
+
+static_assert(utils::detail::PacketReader<UnixVRTReader<>>);
+static_assert(utils::detail::FlushableWriter<UnixVRTWriter>);
+
+PacketVariant view(const std::vector<uint8_t>& bytes) {
+    return RuntimeDataPacket(bytes.data(), bytes.size());
+}
+
+std::string socket_path(const char* tag) {
+    return "/tmp/vrtigo-unix-" + std::string(tag) + "-" + std::to_string(::getpid()) + ".sock";
+}
+
+bool path_exists(const std::string& path) {
+    struct stat info {};
+    return ::lstat(path.c_str(), &info) == 0;
+}
+
+// Connected socket pair of the given type: [0] for the reader, [1] for the writer
+std::array<int, 2> socket_pair(int type) {
+    std::array<int, 2> fds{-1, -1};
+    EXPECT_EQ(::socketpair(AF_UNIX, type, 0, fds.data()), 0);
+    return fds;
+}
+
+} // namespace
+
+TEST(UnixTransportTest, DatagramPathRoundTrip) {
+    const auto path = socket_path("dgram");
+    {
+        UnixVRTReader<> reader(path);
+        EXPECT_EQ(reader.bound_path(), path);
+        EXPECT_TRUE(path_exists(path));
+
+        UnixVRTWriter writer(path);
+        auto small = build<SmallPacket>(7);
+        auto large = build<LargePacket>(8);
+        ASSERT_TRUE(writer.write_packet(view(small)));
+        ASSERT_TRUE(writer.write_packet(view(large)));
+        EXPECT_EQ(writer.packets_written(), 2U);
+        EXPECT_EQ(writer.bytes_written(), small.size() + large.size());
+
+        EXPECT_EQ(stream_id_of(reader.read_next_packet()), 7U);
+        auto pkt = reader.read_next_packet();
+        ASSERT_EQ(stream_id_of(pkt), 8U);
+        EXPECT_EQ(std::get<RuntimeDataPacket>(*pkt).as_bytes().size(), large.size());
+        EXPECT_EQ(reader.transport_status().bytes_received, large.size());
+    }
+    EXPECT_FALSE(path_exists(path)); // removed with the reader
+}
+
+TEST(UnixTransportTest, TruncatedDatagramIsReported) {
+    auto fds = socket_pair(SOCK_DGRAM);
+    UnixVRTReader<64> reader(fds[0], true);
+    UnixVRTWriter writer(fds[1], true);
+
+    ASSERT_TRUE(writer.write_packet(view(build<LargePacket>(1))));
+    ASSERT_TRUE(writer.write_packet(view(build<SmallPacket>(2))));
+
+    auto pkt = reader.read_next_packet();
+    ASSERT_TRUE(pkt.has_value());
+    ASSERT_TRUE(std::holds_alternative<InvalidPacket>(*pkt));
+    EXPECT_EQ(std::get<InvalidPacket>(*pkt).error, ValidationError::buffer_too_small);
+    EXPECT_EQ(reader.transport_status().state, UDPTransportStatus::State::datagram_truncated);
+    EXPECT_EQ(reader.transport_status().actual_size, LargePacket::size_bytes);
+
+    // Message boundaries hold: the next read is the next packet
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 2U);
+}
+
+TEST(UnixTransportTest, BatchedWritesUseFewSyscalls) {
+    auto fds = socket_pair(SOCK_DGRAM);
+    UnixVRTReader<> reader(fds[0], true);
+    UnixVRTWriter writer(fds[1], true);
+
+    constexpr uint32_t count = 3000;
+    std::vector<std::vector<uint8_t>> storage;
+    std::vector<PacketVariant> batch;
+    for (uint32_t n = 0; n < count; ++n) {
+        storage.push_back(build<SmallPacket>(n));
+    }
+    for (const auto& bytes : storage) {
+        batch.push_back(view(bytes));
+    }
+
+    uint32_t received = 0;
+    std::thread consumer([&] {
+        reader.try_set_timeout(2000ms);
+        reader.for_each_data_packet([&](const RuntimeDataPacket& pkt) {
+            EXPECT_EQ(pkt.stream_id(), received);
+            return ++received < count;
+        });
+    });
+    EXPECT_EQ(writer.write_packets(batch), count);
+    consumer.join();
+
+    EXPECT_EQ(received, count);
+    EXPECT_EQ(writer.packets_written(), count);
+    EXPECT_LE(writer.send_calls(), 8U); // 3 sendmmsg() calls unless the queue fills
+}
+
+TEST(UnixTransportTest, BatchStopsAtInvalidPacket) {
+    auto fds = socket_pair(SOCK_DGRAM);
+    UnixVRTReader<> reader(fds[0], true);
+    UnixVRTWriter writer(fds[1], true);
+
+    auto first = build<SmallPacket>(1);
+    auto third = build<SmallPacket>(3);
+    std::vector<PacketVariant> batch{view(first), InvalidPacket{}, view(third)};
+    EXPECT_EQ(writer.write_packets(batch), 1U);
+    EXPECT_EQ(writer.transport_status().errno_value, EINVAL);
+
+    reader.try_set_timeout(20ms);
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 1U);
+    EXPECT_FALSE(reader.read_next_packet().has_value());
+}
+
+TEST(UnixTransportTest, BatchedHandles) {
+    auto fds = socket_pair(SOCK_DGRAM);
+    UnixVRTReader<> reader(fds[0], true);
+    UnixVRTWriter writer(fds[1], true);
+
+    auto first = build<SmallPacket>(1);
+    auto second = build<SmallPacket>(2);
+    std::vector<PacketHandle> batch{PacketHandle::parse(first), PacketHandle::parse(second),
+                                    PacketHandle{}};
+    EXPECT_EQ(writer.write_packets(batch), 2U);
+    EXPECT_EQ(writer.transport_status().errno_value, EINVAL);
+
+    reader.try_set_timeout(20ms);
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 1U);
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 2U);
+    EXPECT_FALSE(reader.read_next_packet().has_value());
+}
+
+TEST(UnixTransportTest, SeqpacketListenerAndPeerClose) {
+    const std::string path = "@vrtigo-unix-seq-" + std::to_string(::getpid());
+    UnixSeqpacketListener listener(path);
+    UnixVRTReader<> reader(path, UnixSocketType::seqpacket);
+    EXPECT_TRUE(reader.bound_path().empty());
+
+    {
+        listener.try_set_timeout(1000ms);
+        int peer = listener.accept();
+        ASSERT_GE(peer, 0);
+        UnixVRTWriter writer(peer, true);
+        for (uint32_t n = 0; n < 10; ++n) {
+            ASSERT_TRUE(writer.write_packet(view(build<LargePacket>(n))));
+        }
+    }
+
+    // The reader drains what was sent, then sees the orderly close
+    uint32_t expected = 0;
+    reader.for_each_data_packet([&](const RuntimeDataPacket& pkt) {
+        EXPECT_EQ(pkt.stream_id(), expected++);
+        return true;
+    });
+    EXPECT_EQ(expected, 10U);
+    EXPECT_EQ(reader.transport_status().state, UDPTransportStatus::State::socket_closed);
+    EXPECT_FALSE(reader.is_open());
+}
+
+TEST(UnixTransportTest, TimeoutAndVanishedReader) {
+    const auto path = socket_path("gone");
+    auto reader = std::make_optional<UnixVRTReader<>>(path);
+    ASSERT_TRUE(reader->try_set_timeout(20ms));
+    EXPECT_FALSE(reader->read_next_packet().has_value());
+    EXPECT_EQ(reader->transport_status().state, UDPTransportStatus::State::timeout);
+    EXPECT_TRUE(reader->is_open());
+
+    UnixVRTWriter writer(path);
+    reader.reset();
+    EXPECT_FALSE(writer.write_packet(view(build<SmallPacket>(1))));
+    EXPECT_EQ(writer.transport_status().state, UDPTransportStatus::State::socket_closed);
+    EXPECT_FALSE(writer.is_open());
+
+    EXPECT_THROW(UnixVRTWriter{path}, std::runtime_error);
+    EXPECT_THROW(UnixVRTReader<>{std::string(200, 'x')}, std::invalid_argument);
+}
+
+TEST(UnixTransportTest, BindLeavesLiveSocketsAlone) {
+    const auto path = socket_path("live");
+    UnixVRTReader<> reader(path);
+    reader.try_set_timeout(20ms);
+
+    // A second reader must not steal the path from a reader that is still bound to it
+    EXPECT_THROW(UnixVRTReader<>{path}, std::runtime_error);
+    EXPECT_TRUE(path_exists(path));
+    UnixVRTWriter writer(path);
+    ASSERT_TRUE(writer.write_packet(view(build<SmallPacket>(3))));
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 3U);
+    EXPECT_FALSE(reader.read_next_packet().has_value()); // the probe sent nothing
+
+    // Probing a live listener must not leave a connection in its accept queue
+    const auto seq_path = socket_path("live-seq");
+    UnixSeqpacketListener listener(seq_path);
+    EXPECT_THROW(UnixSeqpacketListener{seq_path}, std::runtime_error);
+    EXPECT_TRUE(path_exists(seq_path));
+    pollfd pending{listener.socket_fd(), POLLIN, 0};
+    EXPECT_EQ(::poll(&pending, 1, 0), 0);
+}
+
+TEST(UnixTransportTest, BindReplacesStaleSocketFile) {
+    // A socket file whose owner closed without unlinking it
+    const auto path = socket_path("stale");
+    int stale = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    ASSERT_GE(stale, 0);
+    utils::detail::UnixAddress address(path);
+    ASSERT_EQ(::bind(stale, address.get(), address.length), 0);
+    ::close(stale);
+    ASSERT_TRUE(path_exists(path));
+
+    UnixVRTReader<> reader(path);
+    UnixVRTWriter writer(path);
+    ASSERT_TRUE(writer.write_packet(view(build<SmallPacket>(9))));
+    EXPECT_EQ(stream_id_of(reader.read_next_packet()), 9U);
+}
@@ -0,0 +1,264 @@
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vrtigo.hpp>
+#include <vrtigo/utils/netio/xdp_vrt_reader.hpp>
+
+#include "test_utils.hpp"
+
+using namespace vrtigo;
+using namespace vrtigo::utils::netio;
+
+namespace {
+
+static_assert(vrtigo::utils::detail::PacketReader<XDPVRTReader>);
+
+constexpr uint16_t vrt_port = 4991;
+
+/**
+ * @brief Build an Ethernet/IPv4/UDP frame around a payload
+ */
+std::vector<uint8_t> make_frame(const std::vector<uint8_t>& payload, uint16_t port,
+                                uint8_t protocol = 17) {
+    std::vector<uint8_t> frame(14 + 20 + 8 + payload.size());
+    std::fill(frame.begin(), frame.begin() + 12, 0x02); // Locally administered MACs
+    frame[12] = 0x08;
+    frame[13] = 0x00;
+
+    uint8_t* ip = frame.data() + 14;
+    const size_t ip_length = frame.size() - 14;
+    ip[0] = 0x45;
+    ip[2] = static_cast<uint8_t>(ip_length >> 8);
+    ip[3] = static_cast<uint8_t>(ip_length);
+    ip[8] = 64;
+    ip[9] = protocol;
+    const uint8_t src[4] = {10, 99, 0, 1};
+    const uint8_t dst[4] = {10, 99, 0, 2};
+    std::memcpy(ip + 12, src, 4);
+    std::memcpy(ip + 16, dst, 4);
+
+    uint8_t* udp = ip + 20;
+    const size_t udp_length = 8 + payload.size();
+    udp[0] = 0x30;
+    udp[1] = 0x39;
+    udp[2] = static_cast<uint8_t>(port >> 8);
+    udp[3] = static_cast<uint8_t>(port);
+    udp[4] = static_cast<uint8_t>(udp_length >> 8);
+    udp[5] = static_cast<uint8_t>(udp_length);
+    std::copy(payload.begin(), payload.end(), udp + 8);
+    return frame;
+}
+
+/**
+ * @brief veth pair with an XDP reader on one end and a packet socket on the other
+ *
+ * Skips when the environment cannot create interfaces or load XDP programs.
+ */
+class XDPReaderTest : public ::testing::Test {
+protected:
+    std::string tx_name_;
+    std::string rx_name_;
+    bool created_ = false;
+    int tx_socket_ = -1;
+    int tx_ifindex_ = 0;
+
+    void SetUp() override {
+        const std::string base = "vrtx" + std::to_string(::getpid() % 100000);
+        tx_name_ = base + "a";
+        rx_name_ = base + "b";
+        const std::string create = "ip link add " + tx_name_ + " type veth peer name " +
+                                   rx_name_ + " >/dev/null 2>&1";
+        if (std::system(create.c_str()) != 0) {
+            GTEST_SKIP() << "Cannot create a veth pair (needs CAP_NET_ADMIN and iproute2)";
+        }
+        created_ = true;
+        for (const auto& name : {tx_name_, rx_name_}) {
+            ASSERT_EQ(std::system(("ip link set " + name + " up").c_str()), 0);
+        }
+
+        tx_ifindex_ = static_cast<int>(if_nametoindex(tx_name_.c_str()));
+        tx_socket_ = socket(AF_PACKET, SOCK_RAW, 0);
+        ASSERT_GE(tx_socket_, 0) << strerror(errno);
+    }
+
+    void TearDown() override {
+        if (tx_socket_ >= 0) {
+            close(tx_socket_);
+        }
+        if (created_) {
+            std::system(("ip link del " + tx_name_ + " >/dev/null 2>&1").c_str());
+        }
+    }
+
+    std::unique_ptr<XDPVRTReader> make_reader(XDPOptions options = {}) {
+        try {
+            auto reader = std::make_unique<XDPVRTReader>(rx_name_, vrt_port, 0,
+                                                         XDPMode::generic, options);
+            reader->try_set_timeout(std::chrono::milliseconds(200));
+            return reader;
+        } catch (const std::runtime_error& e) {
+            if (errno == EPERM || errno == EACCES || errno == EAFNOSUPPORT ||
+                errno == EINVAL || errno == ENOSYS) {
+                return nullptr;
+            }
+            throw;
+        }
+    }
+
+    void inject(const std::vector<uint8_t>& frame) {
+        struct sockaddr_ll addr {};
+        addr.sll_family = AF_PACKET;
+        addr.sll_ifindex = tx_ifindex_;
+        addr.sll_halen = 6;
+        ssize_t sent = sendto(tx_socket_, frame.data(), frame.size(), 0,
+                              reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        ASSERT_EQ(sent, static_cast<ssize_t>(frame.size())) << strerror(errno);
+    }
+};
+
+} // namespace
+
+#define MAKE_READER_OR_SKIP(reader, ...)                                                        \
+    auto reader = make_reader(__VA_ARGS__);                                                     \
+    if (!reader) {                                                                              \
+        GTEST_SKIP() << "Cannot load XDP programs or open AF_XDP sockets here";               \
+    }
+
+// =============================================================================
+// User-space header parsing (no privileges needed)
+// =============================================================================
+
+TEST(XDPFrameParseTest, ExtractsUdpPayload) {
+    using vrtigo::utils::detail::udp_payload_of_frame;
+    auto vrt = test_utils::create_minimal_vrt_packet(0x42);
+
+    auto frame = make_frame(vrt, vrt_port);
+    frame.resize(frame.size() + 6); // Ethernet padding after the datagram
+    auto payload = udp_payload_of_frame(frame, vrt_port);
+    ASSERT_EQ(payload.size(), vrt.size());
+    EXPECT_EQ(std::vector<uint8_t>(payload.begin(), payload.end()), vrt);
+    EXPECT_EQ(udp_payload_of_frame(frame, 0).size(), vrt.size()); // Any port
+
+    EXPECT_TRUE(udp_payload_of_frame(make_frame(vrt, vrt_port + 1), vrt_port).empty());
+    EXPECT_TRUE(udp_payload_of_frame(make_frame(vrt, vrt_port, 6), vrt_port).empty()); // TCP
+
+    auto fragment = make_frame(vrt, vrt_port);
+    fragment[14 + 6] = 0x20; // More fragments
+    EXPECT_TRUE(udp_payload_of_frame(fragment, vrt_port).empty());
+
+    auto truncated = make_frame(vrt, vrt_port);
+    truncated.resize(truncated.size() - 4); // UDP length exceeds the frame
+    EXPECT_TRUE(udp_payload_of_frame(truncated, vrt_port).empty());
+
+    auto arp = make_frame(vrt, vrt_port);
+    arp[12] = 0x08;
+    arp[13] = 0x06;
+    EXPECT_TRUE(udp_payload_of_frame(arp, vrt_port).empty());
+}
+
+// =============================================================================
+// Receive over veth (generic mode)
+// =============================================================================
+
+TEST_F(XDPReaderTest, ReceivesVrtPackets) {
+    MAKE_READER_OR_SKIP(reader);
+
+    for (uint32_t id : {1U, 2U, 3U}) {
+        inject(make_frame(test_utils::create_minimal_vrt_packet(id), vrt_port));
+    }
+    inject(make_frame(test_utils::create_minimal_vrt_packet(9), vrt_port + 1)); // Other port
+
+    std::vector<uint32_t> ids;
+    while (auto pkt = reader->read_next_packet()) {
+        ASSERT_TRUE(is_valid(*pkt));
+        ids.push_back(stream_id(*pkt).value_or(0));
+    }
+    EXPECT_EQ(ids, (std::vector<uint32_t>{1, 2, 3}));
+    EXPECT_EQ(reader->transport_status().state, UDPTransportStatus::State::timeout);
+    EXPECT_TRUE(reader->is_open());
+}
+
+TEST_F(XDPReaderTest, ViewsPointIntoUmem) {
+    MAKE_READER_OR_SKIP(reader);
+
+    inject(make_frame(test_utils::create_vrt_packet_with_payload(7, 16), vrt_port));
+    auto pkt = reader->read_next_packet();
+    ASSERT_TRUE(pkt.has_value());
+    auto* data = std::get_if<RuntimeDataPacket>(&*pkt);
+    ASSERT_NE(data, nullptr);
+    EXPECT_TRUE(reader->owns_frame(data->payload().data()));
+    EXPECT_EQ(data->payload().size(), 16U * 4);
+}
+
+TEST_F(XDPReaderTest, HeldFramesAreRecycledOnRelease) {
+    XDPOptions options;
+    options.frame_count = 64;
+    options.ring_size = 32;
+    MAKE_READER_OR_SKIP(reader, options);
+
+    // 8 rounds of 16 frames: twice the UMEM, so frames must come back through the fill ring
+    size_t received = 0;
+    for (uint32_t round = 0; round < 8; ++round) {
+        for (uint32_t i = 0; i < 16; ++i) {
+            inject(make_frame(test_utils::create_minimal_vrt_packet(round * 16 + i), vrt_port));
+        }
+        std::vector<XDPFrame> held;
+        while (held.size() < 16) {
+            auto frame = reader->read_next_frame();
+            ASSERT_TRUE(frame.has_value()) << "round " << round;
+            held.push_back(*frame);
+        }
+        for (size_t i = 0; i < held.size(); ++i) {
+            RuntimeDataPacket view(held[i].packet.data(), held[i].packet.size());
+            ASSERT_TRUE(view.is_valid());
+            EXPECT_EQ(view.stream_id(), round * 16 + i);
+            for (size_t j = 0; j < i; ++j) {
+                EXPECT_NE(held[i].addr, held[j].addr);
+            }
+        }
+        for (const auto& frame : held) {
+            reader->release(frame);
+        }
+        received += held.size();
+    }
+    EXPECT_EQ(received, 128U);
+    EXPECT_EQ(reader->statistics().rx_dropped, 0U);
+}
+
+TEST_F(XDPReaderTest, QueueReadersShareOneProgram) {
+    std::shared_ptr<XDPProgram> program;
+    try {
+        program = XDPProgram::attach(rx_name_, vrt_port);
+    } catch (const std::runtime_error&) {
+        GTEST_SKIP() << "Cannot load XDP programs here";
+    }
+    XDPVRTReader reader(program, 0);
+    reader.try_set_timeout(std::chrono::milliseconds(200));
+    EXPECT_EQ(reader.program(), program);
+    EXPECT_EQ(program.use_count(), 2);
+
+    EXPECT_THROW(XDPVRTReader(program, program->max_queues()), std::invalid_argument);
+    XDPOptions bad;
+    bad.frame_size = 3000;
+    EXPECT_THROW(XDPVRTReader(program, 1, bad), std::invalid_argument);
+
+    inject(make_frame(test_utils::create_minimal_vrt_packet(5), vrt_port));
+    size_t count = reader.for_each_data_packet([](const RuntimeDataPacket& pkt) {
+        EXPECT_EQ(pkt.stream_id(), 5U);
+        return true;
+    });
+    EXPECT_EQ(count, 1U);
+}
@@ -0,0 +1,117 @@
+#include <array>
+#include <span>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+using namespace vrtigo::field;
+
+namespace {
+
+using DataPkt = SignalDataPacket<ClassId, UtcRealTimestamp, Trailer::included, 4>;
+using CtxPkt = ContextPacket<UtcRealTimestamp, NoClassId, bandwidth>;
+using CmdPkt = ControlPacket<NoTimestamp, NoClassId, CommandId, NoCommandId, bandwidth>;
+
+static_assert(std::is_trivially_copyable_v<PacketHandle>);
+static_assert(sizeof(PacketHandle) < sizeof(PacketVariant));
+
+class PacketHandleTest : public ::testing::Test {
+protected:
+    alignas(4) std::array<uint8_t, 256> buffer{};
+
+    std::span<const uint8_t> bytes(size_t size) const { return {buffer.data(), size}; }
+};
+
+} // namespace
+
+TEST_F(PacketHandleTest, DataPacketFieldsMatchRuntimeView) {
+    std::array<uint8_t, DataPkt::payload_size_bytes> payload{};
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i + 1);
+    }
+    DataPkt pkt(buffer.data());
+    pkt.set_stream_id(0xCAFE);
+    pkt.set_class_id(ClassIdValue(0x123456, 0x11, 0x22));
+    pkt.set_timestamp(UtcRealTimestamp(1'700'000'000, 250));
+    pkt.set_packet_count(9);
+    pkt.set_payload(payload.data(), payload.size());
+
+    auto handle = PacketHandle::parse(bytes(DataPkt::size_bytes));
+    RuntimeDataPacket view(buffer.data(), DataPkt::size_bytes);
+    ASSERT_TRUE(view.is_valid());
+    ASSERT_TRUE(handle.is_valid()) << validation_error_string(handle.error());
+
+    EXPECT_EQ(handle.kind(), PacketKind::data);
+    EXPECT_EQ(handle.type(), PacketType::signal_data);
+    EXPECT_EQ(handle.packet_size_bytes(), DataPkt::size_bytes);
+    EXPECT_EQ(handle.packet_count(), 9U);
+    EXPECT_EQ(handle.stream_id(), view.stream_id());
+    EXPECT_EQ(handle.timestamp_integer(), view.timestamp_integer());
+    EXPECT_EQ(handle.timestamp_fractional(), view.timestamp_fractional());
+    ASSERT_TRUE(handle.class_id().has_value());
+    EXPECT_EQ(handle.class_id()->oui(), 0x123456U);
+    EXPECT_EQ(handle.class_id()->pcc(), 0x22U);
+
+    // Payload excludes the trailer
+    auto body = handle.payload();
+    ASSERT_EQ(body.size(), payload.size());
+    EXPECT_EQ(body.data(), view.payload().data());
+    EXPECT_EQ(body[0], 1U);
+
+    ASSERT_TRUE(handle.as_data().has_value());
+    EXPECT_FALSE(handle.as_context().has_value());
+    EXPECT_TRUE(is_data_packet(handle.to_variant()));
+}
+
+TEST_F(PacketHandleTest, ContextAndCommandKinds) {
+    CtxPkt ctx(buffer.data());
+    ctx.set_stream_id(0x42);
+    ctx[bandwidth].set_value(20e6);
+
+    auto handle = PacketHandle::parse(bytes(CtxPkt::size_bytes));
+    ASSERT_TRUE(handle.is_valid()) << validation_error_string(handle.error());
+    EXPECT_EQ(handle.kind(), PacketKind::context);
+    EXPECT_EQ(handle.stream_id(), 0x42U);
+    EXPECT_TRUE(handle.payload().empty());
+    auto view = handle.as_context();
+    ASSERT_TRUE(view.has_value());
+    EXPECT_DOUBLE_EQ((*view)[bandwidth].value(), 20e6);
+
+    CmdPkt cmd(buffer.data());
+    cmd.set_stream_id(0x43);
+    cmd.set_message_id(7);
+    handle = PacketHandle::parse(bytes(CmdPkt::size_bytes));
+    ASSERT_TRUE(handle.is_valid()) << validation_error_string(handle.error());
+    EXPECT_EQ(handle.kind(), PacketKind::command);
+    EXPECT_EQ(handle.stream_id(), 0x43U);
+    ASSERT_TRUE(handle.as_command().has_value());
+    EXPECT_EQ(handle.as_command()->message_id(), 7U);
+    EXPECT_TRUE(is_command_packet(handle.to_variant()));
+}
+
+TEST_F(PacketHandleTest, InvalidPacketsKeepTheError) {
+    EXPECT_FALSE(PacketHandle{}.is_valid());
+    EXPECT_EQ(PacketHandle::parse(bytes(2)).error(), ValidationError::buffer_too_small);
+
+    CtxPkt ctx(buffer.data());
+    auto handle = PacketHandle::parse(bytes(CtxPkt::size_bytes - 4));
+    EXPECT_FALSE(handle.is_valid());
+    EXPECT_EQ(handle.kind(), PacketKind::invalid);
+    EXPECT_EQ(handle.error(), RuntimeContextPacket(buffer.data(), CtxPkt::size_bytes - 4).error());
+    EXPECT_TRUE(handle.as_bytes().empty());
+    EXPECT_FALSE(handle.stream_id().has_value());
+    EXPECT_FALSE(handle.as_context().has_value());
+
+    auto variant = handle.to_variant();
+    ASSERT_FALSE(is_valid(variant));
+    EXPECT_EQ(std::get<InvalidPacket>(variant).error, handle.error());
+}
+
+TEST_F(PacketHandleTest, TrailingBytesAreNotPartOfThePacket) {
+    CmdPkt cmd(buffer.data());
+    auto handle = PacketHandle::parse(bytes(CmdPkt::size_bytes + 8));
+    ASSERT_TRUE(handle.is_valid()) << validation_error_string(handle.error());
+    EXPECT_EQ(handle.as_bytes().size(), CmdPkt::size_bytes);
+}
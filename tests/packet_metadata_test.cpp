@@ -0,0 +1,195 @@
+#include <array>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+
+namespace {
+
+using TimedData = SignalDataPacket<NoClassId, UtcRealTimestamp, Trailer::none, 6>;
+using ClassedData = SignalDataPacket<ClassId, UtcRealTimestamp, Trailer::none, 2>;
+using NoIdData = SignalDataPacketNoId<NoClassId, NoTimestamp, Trailer::none, 3>;
+using TimedContext = ContextPacket<UtcRealTimestamp, NoClassId>;
+
+std::vector<uint8_t> timed_data(uint32_t stream_id, uint32_t tsi, uint64_t tsf, uint8_t count) {
+    std::vector<uint8_t> bytes(TimedData::size_bytes);
+    PacketBuilder<TimedData>(bytes.data())
+        .stream_id(stream_id)
+        .timestamp(UtcRealTimestamp(tsi, tsf))
+        .packet_count(count)
+        .build();
+    return bytes;
+}
+
+std::vector<uint8_t> classed_data(uint32_t stream_id, uint32_t tsi, uint64_t tsf) {
+    std::vector<uint8_t> bytes(ClassedData::size_bytes);
+    PacketBuilder<ClassedData>(bytes.data())
+        .stream_id(stream_id)
+        .class_id(ClassIdValue(0x123456, 0x5678, 0xABCD))
+        .timestamp(UtcRealTimestamp(tsi, tsf))
+        .build();
+    return bytes;
+}
+
+std::vector<uint8_t> no_id_data() {
+    std::vector<uint8_t> bytes(NoIdData::size_bytes);
+    PacketBuilder<NoIdData>(bytes.data()).packet_count(9).build();
+    return bytes;
+}
+
+std::vector<uint8_t> timed_context(uint32_t stream_id, uint32_t tsi, uint64_t tsf) {
+    std::vector<uint8_t> bytes(TimedContext::size_bytes);
+    TimedContext packet(bytes.data());
+    packet.set_stream_id(stream_id);
+    packet.set_timestamp(UtcRealTimestamp(tsi, tsf));
+    packet.set_packet_count(3);
+    return bytes;
+}
+
+struct Columns {
+    explicit Columns(size_t rows)
+        : tsi(rows),
+          tsf(rows),
+          stream_id(rows),
+          packet_count(rows),
+          header(rows),
+          status(rows) {}
+
+    MetadataColumns view() {
+        return {tsi, tsf, stream_id, packet_count, header, status};
+    }
+
+    std::vector<uint32_t> tsi;
+    std::vector<uint64_t> tsf;
+    std::vector<uint32_t> stream_id;
+    std::vector<uint8_t> packet_count;
+    std::vector<uint32_t> header;
+    std::vector<uint8_t> status;
+};
+
+constexpr uint8_t full_status = metadata_status::valid | metadata_status::has_stream_id |
+                                metadata_status::has_tsi | metadata_status::has_tsf;
+
+} // namespace
+
+TEST(PacketMetadataTest, MixedPacketKinds) {
+    std::vector<std::vector<uint8_t>> packets{
+        timed_data(0x100, 1'700'000'000, 250'000'000'000ULL, 5),
+        classed_data(0x200, 1'700'000'001, 7),
+        no_id_data(),
+        timed_context(0x300, 1'700'000'002, 42),
+    };
+    std::vector<std::span<const uint8_t>> spans(packets.begin(), packets.end());
+
+    Columns out(8);
+    ASSERT_EQ(extract_packet_metadata(spans, out.view()), 4U);
+
+    EXPECT_EQ(out.status[0], full_status);
+    EXPECT_EQ(out.stream_id[0], 0x100U);
+    EXPECT_EQ(out.tsi[0], 1'700'000'000U);
+    EXPECT_EQ(out.tsf[0], 250'000'000'000ULL);
+    EXPECT_EQ(out.packet_count[0], 5U);
+
+    // Class ID words are skipped
+    EXPECT_EQ(out.status[1], full_status);
+    EXPECT_EQ(out.stream_id[1], 0x200U);
+    EXPECT_EQ(out.tsi[1], 1'700'000'001U);
+    EXPECT_EQ(out.tsf[1], 7U);
+
+    EXPECT_EQ(out.status[2], metadata_status::valid);
+    EXPECT_EQ(out.stream_id[2], 0U);
+    EXPECT_EQ(out.tsi[2], 0U);
+    EXPECT_EQ(out.packet_count[2], 9U);
+
+    EXPECT_EQ(out.status[3], full_status);
+    EXPECT_EQ(out.stream_id[3], 0x300U);
+    EXPECT_EQ(out.tsf[3], 42U);
+    EXPECT_EQ(static_cast<PacketType>(out.header[3] >> 28), PacketType::context);
+}
+
+TEST(PacketMetadataTest, MatchesRuntimeParser) {
+    // Enough packets to span several decode blocks, with a partial last block
+    std::vector<std::vector<uint8_t>> packets;
+    for (uint32_t i = 0; i < 200; ++i) {
+        packets.push_back(timed_data(i * 3, 1'000 + i, i * 1'000'000ULL, uint8_t(i & 0xF)));
+    }
+    std::vector<std::span<const uint8_t>> spans(packets.begin(), packets.end());
+
+    Columns out(spans.size());
+    ASSERT_EQ(extract_packet_metadata(spans, out.view()), spans.size());
+    for (size_t i = 0; i < spans.size(); ++i) {
+        RuntimeDataPacket parsed(spans[i].data(), spans[i].size());
+        ASSERT_TRUE(parsed.is_valid());
+        EXPECT_EQ(out.stream_id[i], *parsed.stream_id()) << i;
+        EXPECT_EQ(out.tsi[i], *parsed.timestamp_integer()) << i;
+        EXPECT_EQ(out.tsf[i], *parsed.timestamp_fractional()) << i;
+        EXPECT_EQ(out.packet_count[i], parsed.packet_count()) << i;
+    }
+}
+
+TEST(PacketMetadataTest, SparseColumnsLimitRows) {
+    std::vector<std::vector<uint8_t>> packets;
+    for (uint32_t i = 0; i < 10; ++i) {
+        packets.push_back(timed_data(i, i, 0, 0));
+    }
+    std::vector<std::span<const uint8_t>> spans(packets.begin(), packets.end());
+
+    // Only the TSI column is requested, and it holds 6 rows
+    std::vector<uint32_t> tsi(6);
+    EXPECT_EQ(extract_packet_metadata(spans, MetadataColumns{.tsi = tsi}), 6U);
+    EXPECT_EQ(tsi[5], 5U);
+
+    EXPECT_EQ(extract_packet_metadata(spans, MetadataColumns{}), 0U);
+}
+
+TEST(PacketMetadataTest, MalformedPacketsFlaggedInvalid) {
+    auto good = timed_data(1, 2, 3, 4);
+    auto truncated = std::span<const uint8_t>(good).first(good.size() - 4);
+    std::array<uint8_t, 2> tiny{0x10, 0x00};
+    auto reserved = good;
+    reserved[0] = 0x90; // type 9 is reserved
+
+    std::array<std::span<const uint8_t>, 4> spans{std::span<const uint8_t>(good), truncated,
+                                                  std::span<const uint8_t>(tiny),
+                                                  std::span<const uint8_t>(reserved)};
+    Columns out(4);
+    ASSERT_EQ(extract_packet_metadata(spans, out.view()), 4U);
+    EXPECT_EQ(out.status[0], full_status);
+    for (size_t i = 1; i < 4; ++i) {
+        EXPECT_EQ(out.status[i], 0U) << i;
+        EXPECT_EQ(out.stream_id[i], 0U) << i;
+        EXPECT_EQ(out.tsi[i], 0U) << i;
+    }
+}
+
+TEST(PacketMetadataTest, ScanContiguousBuffer) {
+    std::vector<uint8_t> stream;
+    for (uint32_t i = 0; i < 100; ++i) {
+        auto packet = (i % 2 == 0) ? timed_data(i, i, i, 0) : timed_context(i, i, i);
+        stream.insert(stream.end(), packet.begin(), packet.end());
+    }
+    // Trailing partial packet is left for the next call
+    auto partial = timed_data(999, 0, 0, 0);
+    stream.insert(stream.end(), partial.begin(), partial.begin() + 8);
+
+    Columns out(40);
+    size_t total = 0;
+    size_t offset = 0;
+    while (true) {
+        auto result = scan_packet_metadata(std::span(stream).subspan(offset), out.view());
+        if (result.rows == 0) {
+            break;
+        }
+        for (size_t i = 0; i < result.rows; ++i) {
+            EXPECT_EQ(out.stream_id[i], total + i);
+            EXPECT_EQ(out.status[i], full_status);
+        }
+        total += result.rows;
+        offset += result.bytes_consumed;
+    }
+    EXPECT_EQ(total, 100U);
+    EXPECT_EQ(stream.size() - offset, 8U);
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+
+using UtcSampleTimestamp = Timestamp<TsiType::utc, TsfType::sample_count>;
+using GpsSampleTimestamp = Timestamp<TsiType::gps, TsfType::sample_count>;
+using FreeSampleTimestamp = Timestamp<TsiType::none, TsfType::sample_count>;
+
+// Integer rate (30.72 MHz) and non-integer rate (1 GHz / 3)
+constexpr SampleTimebase lte_rate(SampleRate{30'720'000});
+constexpr SampleTimebase third_ghz(SampleRate{1'000'000'000, 3});
+
+// Everything below must be usable in constant expressions
+static_assert(lte_rate.advance(UtcSampleTimestamp(100, 30'719'000), 2048).tsi() == 101);
+static_assert(lte_rate.advance(UtcSampleTimestamp(100, 30'719'000), 2048).tsf() == 1048);
+static_assert(lte_rate.picoseconds_at(30'720'000) == picoseconds_per_second);
+static_assert(third_ghz.picoseconds_at(1) == 3000);
+static_assert(third_ghz.sample_at(3000) == 1);
+static_assert(SampleClock<UtcRealTimestamp>(third_ghz, UtcRealTimestamp(5, 0), 3).timestamp() ==
+              UtcRealTimestamp(5, 9000));
+
+TEST(SampleRateTest, Properties) {
+    EXPECT_TRUE(SampleRate{30'720'000}.is_integer());
+    EXPECT_FALSE((SampleRate{1'000'000'000, 3}.is_integer()));
+    EXPECT_TRUE((SampleRate{2000, 2}.is_integer()));
+    EXPECT_FALSE(SampleRate{}.is_valid());
+    EXPECT_DOUBLE_EQ((SampleRate{1000, 8}.hz()), 125.0);
+}
+
+TEST(SampleTimebaseTest, IndexToPicoseconds) {
+    // 1 GHz / 3: every sample is exactly 3 ns apart
+    EXPECT_EQ(third_ghz.picoseconds_at(0), 0U);
+    EXPECT_EQ(third_ghz.picoseconds_at(1'000'000'000), 3 * picoseconds_per_second);
+
+    // 3 samples per second: 333333333333.33 ps per sample, floored
+    SampleTimebase three_hz(SampleRate{3});
+    EXPECT_EQ(three_hz.picoseconds_at(1), 333'333'333'333U);
+    EXPECT_EQ(three_hz.picoseconds_at(3), picoseconds_per_second); // no accumulated error
+    EXPECT_EQ(three_hz.sample_at(333'333'333'333), 0U);
+    EXPECT_EQ(three_hz.sample_at(333'333'333'334), 1U);
+    EXPECT_EQ(three_hz.sample_at_or_after(333'333'333'333), 1U);
+    EXPECT_EQ(three_hz.sample_at_or_after(0), 0U);
+
+    // Round trip for every index in a range
+    for (uint64_t i = 0; i < 10000; ++i) {
+        EXPECT_EQ(three_hz.sample_at_or_after(three_hz.picoseconds_at(i)), i);
+        EXPECT_EQ(lte_rate.sample_at_or_after(lte_rate.picoseconds_at(i)), i);
+    }
+
+    // Saturates rather than wraps
+    EXPECT_EQ(SampleTimebase(SampleRate{1}).picoseconds_at(UINT64_MAX), UINT64_MAX);
+}
+
+TEST(SampleTimebaseTest, AdvanceSampleCountIntegerRate) {
+    auto ts = UtcSampleTimestamp(1700000000, 0);
+    ts = lte_rate.advance(ts, 30'720'000 - 1);
+    EXPECT_EQ(ts.tsi(), 1700000000U);
+    EXPECT_EQ(ts.tsf(), 30'720'000U - 1);
+
+    ts = lte_rate.advance(ts, 1);
+    EXPECT_EQ(ts.tsi(), 1700000001U);
+    EXPECT_EQ(ts.tsf(), 0U);
+
+    // Multi-second jumps
+    ts = lte_rate.advance(ts, 5 * 30'720'000ULL + 7);
+    EXPECT_EQ(ts.tsi(), 1700000006U);
+    EXPECT_EQ(ts.tsf(), 7U);
+
+    // Non-normalized input (count past the second) is carried
+    auto unnormalized = GpsSampleTimestamp(10, 30'720'000 + 5);
+    auto normalized = lte_rate.advance(unnormalized, 0);
+    EXPECT_EQ(normalized.tsi(), 11U);
+    EXPECT_EQ(normalized.tsf(), 5U);
+}
+
+TEST(SampleTimebaseTest, AdvanceSampleCountFractionalRate) {
+    // 2.5 samples per second: seconds start at samples 0, 3 (ceil 2.5), 5, 8 (ceil 7.5), 10
+    SampleTimebase rate(SampleRate{5, 2});
+    EXPECT_EQ(rate.first_sample_of_second(1), 3U);
+    EXPECT_EQ(rate.first_sample_of_second(2), 5U);
+    EXPECT_EQ(rate.first_sample_of_second(3), 8U);
+
+    auto ts = UtcSampleTimestamp(0, 0);
+    const uint32_t expected_seconds[] = {0, 0, 0, 1, 1, 2, 2, 2, 3, 3, 4};
+    const uint64_t expected_counts[] = {0, 1, 2, 0, 1, 0, 1, 2, 0, 1, 0};
+    for (size_t i = 0; i < std::size(expected_seconds); ++i) {
+        auto at = rate.advance(ts, i);
+        EXPECT_EQ(at.tsi(), expected_seconds[i]) << i;
+        EXPECT_EQ(at.tsf(), expected_counts[i]) << i;
+    }
+
+    // Stepping one sample at a time lands on the same place as one big step
+    auto stepped = ts;
+    for (int i = 0; i < 1001; ++i) {
+        stepped = rate.advance(stepped, 1);
+    }
+    EXPECT_EQ(stepped, rate.advance(ts, 1001));
+    EXPECT_EQ(rate.samples_between(ts, stepped), 1001);
+    EXPECT_EQ(rate.samples_between(stepped, ts), -1001);
+}
+
+TEST(SampleTimebaseTest, FreeRunningSampleCount) {
+    auto ts = FreeSampleTimestamp(0, 1000);
+    ts = lte_rate.advance(ts, 100'000'000);
+    EXPECT_EQ(ts.tsf(), 100'001'000U);
+    EXPECT_EQ(lte_rate.samples_between(FreeSampleTimestamp(0, 1000), ts), 100'000'000);
+}
+
+TEST(SampleTimebaseTest, AdvanceRealTime) {
+    auto start = UtcRealTimestamp(1700000000, picoseconds_per_second - 1500);
+    auto next = third_ghz.advance(start, 1); // +3000 ps crosses the second
+    EXPECT_EQ(next.tsi(), 1700000001U);
+    EXPECT_EQ(next.tsf(), 1500U);
+
+    // 10 seconds worth of samples in one step
+    auto later = third_ghz.advance(start, 10ULL * 1'000'000'000 / 3);
+    EXPECT_EQ(later.tsi(), 1700000010U); // 3333333333 samples = 10 s - 1 ns
+    EXPECT_EQ(later.tsf(), picoseconds_per_second - 1500 - 1000);
+
+    // Saturates at the end of the TSI range
+    auto end = third_ghz.advance(UtcRealTimestamp(UINT32_MAX, 0), 1'000'000'000);
+    EXPECT_EQ(end.tsi(), UINT32_MAX);
+}
+
+TEST(SampleTimebaseTest, PayloadSampleTimestamps) {
+    // At 3 Hz the payload samples land on thirds of a second
+    SampleTimebase three_hz(SampleRate{3});
+    auto first = UtcRealTimestamp(100, 0);
+    EXPECT_EQ(three_hz.sample_timestamp(first, 0), first);
+    EXPECT_EQ(three_hz.sample_timestamp(first, 2), UtcRealTimestamp(100, 666'666'666'666));
+    EXPECT_EQ(three_hz.sample_timestamp(first, 3), UtcRealTimestamp(101, 0));
+
+    auto first_count = UtcSampleTimestamp(100, 2);
+    EXPECT_EQ(three_hz.sample_timestamp(first_count, 1), UtcSampleTimestamp(101, 0));
+}
+
+TEST(SampleTimebaseTest, SampleCountRealTimeConversion) {
+    auto ts = UtcSampleTimestamp(1700000000, 15'360'000); // half-way through the second
+    auto real = lte_rate.to_real_time(ts);
+    EXPECT_EQ(real.tsi(), 1700000000U);
+    EXPECT_EQ(real.tsf(), picoseconds_per_second / 2);
+    EXPECT_EQ(lte_rate.to_sample_count(real), ts);
+
+    // Round trip at a non-integer rate, across many seconds
+    SampleTimebase rate(SampleRate{10'000'001, 7});
+    auto start = GpsSampleTimestamp(1000, 0);
+    for (uint64_t i = 0; i < 50'000'000; i += 999'983) {
+        auto count = rate.advance(start, i);
+        EXPECT_EQ(rate.to_sample_count(rate.to_real_time(count)), count) << i;
+    }
+
+    // A time between samples maps to the next sample
+    EXPECT_EQ(lte_rate.to_sample_count(UtcRealTimestamp(5, 1)), UtcSampleTimestamp(5, 1));
+}
+
+TEST(SampleClockTest, DriftFreeStepping) {
+    // 3 Hz cannot be stepped exactly in picoseconds; chained advances drift, the clock does not
+    SampleTimebase three_hz(SampleRate{3});
+    auto anchor = UtcRealTimestamp(1700000000, 0);
+    SampleClock<UtcRealTimestamp> clock(three_hz, anchor);
+
+    auto chained = anchor;
+    for (int i = 0; i < 3000; ++i) {
+        clock.advance(1);
+        chained = three_hz.advance(chained, 1);
+    }
+    EXPECT_EQ(clock.position(), 3000U);
+    EXPECT_EQ(clock.timestamp(), UtcRealTimestamp(1700001000, 0));
+    EXPECT_LT(chained, clock.timestamp()); // rounding accumulated
+
+    EXPECT_EQ(clock.timestamp_of(3), UtcRealTimestamp(1700001001, 0));
+
+    clock.reset(UtcRealTimestamp(5, 0));
+    EXPECT_EQ(clock.position(), 0U);
+    EXPECT_EQ(clock.timestamp(), UtcRealTimestamp(5, 0));
+}
+
+TEST(SampleClockTest, SampleCountPacketizer) {
+    constexpr uint64_t samples_per_packet = 2048;
+    SampleClock<UtcSampleTimestamp> clock(lte_rate, UtcSampleTimestamp(1700000000, 0));
+
+    UtcSampleTimestamp previous = clock.timestamp();
+    for (int i = 0; i < 20000; ++i) {
+        clock.advance(samples_per_packet);
+        auto current = clock.timestamp();
+        EXPECT_EQ(lte_rate.samples_between(previous, current),
+                  static_cast<int64_t>(samples_per_packet));
+        previous = current;
+    }
+    // 20000 * 2048 = 40960000 = 1 s + 10240000 samples
+    EXPECT_EQ(previous, UtcSampleTimestamp(1700000001, 10'240'000));
+}
+
+TEST(SampleTimebaseTest, InvalidRateReturnsZero) {
+    SampleTimebase invalid(SampleRate{0});
+    EXPECT_FALSE(invalid.is_valid());
+    EXPECT_EQ(invalid.picoseconds_at(10), 0U);
+    EXPECT_EQ(invalid.sample_at(10), 0U);
+    EXPECT_EQ(invalid.advance(UtcSampleTimestamp(1, 1), 5), UtcSampleTimestamp());
+    EXPECT_EQ(invalid.to_real_time(UtcSampleTimestamp(1, 1)), UtcRealTimestamp());
+}
@@ -0,0 +1,262 @@
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vrtigo/utils/align/stream_aligner.hpp>
+#include <vrtigo.hpp>
+
+using namespace vrtigo;
+using namespace vrtigo::utils::align;
+
+namespace {
+
+using UtcSampleTimestamp = Timestamp<TsiType::utc, TsfType::sample_count>;
+
+// 1 kHz keeps sample indices easy to reason about; 4-byte samples
+constexpr SampleTimebase khz_rate(SampleRate{1000});
+constexpr uint32_t start_second = 1'700'000'000;
+
+template <size_t Samples, typename TimeStampType = UtcSampleTimestamp>
+std::vector<uint8_t> make_packet(uint32_t stream_id, TimeStampType ts, uint32_t first_value) {
+    using Packet = SignalDataPacket<NoClassId, TimeStampType, Trailer::none, Samples>;
+    std::array<uint32_t, Samples> samples{};
+    for (size_t i = 0; i < Samples; ++i) {
+        samples[i] = first_value + static_cast<uint32_t>(i);
+    }
+    std::vector<uint8_t> bytes(Packet::size_bytes);
+    PacketBuilder<Packet>(bytes.data())
+        .stream_id(stream_id)
+        .timestamp(ts)
+        .payload(reinterpret_cast<const uint8_t*>(samples.data()), sizeof(samples))
+        .build();
+    return bytes;
+}
+
+// Sample value at stream position: values encode the absolute sample index
+UtcSampleTimestamp at(uint64_t sample) {
+    return khz_rate.advance(UtcSampleTimestamp(start_second, 0), sample);
+}
+
+PushResult push(StreamAligner& aligner, const std::vector<uint8_t>& bytes) {
+    return aligner.push(RuntimeDataPacket(bytes.data(), bytes.size()));
+}
+
+std::vector<uint32_t> gather(const AlignedSlice& slice) {
+    std::vector<uint32_t> values((slice.first.size() + slice.second.size()) / 4);
+    slice.copy_to(std::span<uint8_t>(reinterpret_cast<uint8_t*>(values.data()),
+                                     values.size() * 4));
+    return values;
+}
+
+AlignerConfig small_config() {
+    AlignerConfig config;
+    config.timebase = khz_rate;
+    config.bytes_per_sample = 4;
+    config.capacity_samples = 64;
+    config.max_block_samples = 16;
+    config.max_gap_samples = 24;
+    return config;
+}
+
+} // namespace
+
+TEST(StreamAlignerTest, RejectsInvalidConfiguration) {
+    std::array<uint32_t, 2> ids{1, 2};
+    auto config = small_config();
+    config.max_block_samples = 128;
+    EXPECT_THROW(StreamAligner(config, ids), std::invalid_argument);
+    EXPECT_THROW(StreamAligner(small_config(), std::span<const uint32_t>{}),
+                 std::invalid_argument);
+    std::array<uint32_t, 2> duplicate{1, 1};
+    EXPECT_THROW(StreamAligner(small_config(), duplicate), std::invalid_argument);
+}
+
+TEST(StreamAlignerTest, AlignsDifferentPacketBoundaries) {
+    std::array<uint32_t, 2> ids{0xA, 0xB};
+    StreamAligner aligner(small_config(), ids);
+
+    // Stream A: 8-sample packets from sample 0; stream B: 12-sample packets from sample 4
+    EXPECT_EQ(push(aligner, make_packet<8>(0xA, at(0), 0)), PushResult::accepted);
+    EXPECT_EQ(push(aligner, make_packet<8>(0xA, at(8), 8)), PushResult::accepted);
+    EXPECT_EQ(push(aligner, make_packet<12>(0xB, at(4), 4)), PushResult::accepted);
+
+    auto [begin, end] = aligner.window();
+    EXPECT_EQ(end - begin, 12U); // samples 4..16
+
+    auto block = aligner.next_block(10);
+    ASSERT_TRUE(block.has_value());
+    ASSERT_EQ(block->streams.size(), 2U);
+    EXPECT_EQ(block->samples, 10U);
+    EXPECT_EQ(block->tsi_kind, TsiType::utc);
+    EXPECT_EQ(block->tsi, start_second);
+    EXPECT_EQ(block->tsf, 4 * picoseconds_per_second / 1000);
+    for (const auto& slice : block->streams) {
+        auto values = gather(slice);
+        ASSERT_EQ(values.size(), 10U);
+        EXPECT_EQ(values.front(), 4U);
+        EXPECT_EQ(values.back(), 13U);
+        EXPECT_FALSE(slice.zero_filled);
+    }
+    EXPECT_EQ(block->streams[0].stream_id, 0xAU);
+    EXPECT_EQ(block->streams[1].stream_id, 0xBU);
+
+    // Only 2 aligned samples remain
+    EXPECT_FALSE(aligner.next_block(4).has_value());
+    EXPECT_EQ(aligner.stats(0).dropped_samples, 4U); // A's samples 0..3 had no partner
+}
+
+TEST(StreamAlignerTest, ContinuousStreamsWrapRing) {
+    std::array<uint32_t, 3> ids{1, 2, 3};
+    StreamAligner aligner(small_config(), ids);
+
+    uint64_t next_expected = 0;
+    std::optional<uint64_t> first_start;
+    size_t wrapped_blocks = 0;
+    for (uint64_t packet = 0; packet < 50; ++packet) {
+        for (uint32_t id : ids) {
+            auto sample = packet * 8;
+            EXPECT_EQ(push(aligner, make_packet<8>(id, at(sample), uint32_t(sample))),
+                      PushResult::accepted);
+        }
+        while (auto block = aligner.next_block(12)) {
+            if (!first_start) {
+                first_start = block->start_sample;
+            }
+            EXPECT_EQ(block->start_sample - *first_start, next_expected);
+            for (size_t s = 0; s < block->streams.size(); ++s) {
+                auto values = gather(block->streams[s]);
+                EXPECT_EQ(values.front(), next_expected);
+                EXPECT_EQ(values.back(), next_expected + 11);
+                if (!block->streams[s].second.empty()) {
+                    ++wrapped_blocks;
+                    auto linear = aligner.linearize(s);
+                    ASSERT_EQ(linear.size(), 48U);
+                    EXPECT_EQ(0, std::memcmp(linear.data(), values.data(), linear.size()));
+                }
+            }
+            next_expected += 12;
+        }
+    }
+    EXPECT_EQ(next_expected, 396U); // 400 samples, whole 12-sample blocks
+    EXPECT_GT(wrapped_blocks, 0U);
+    for (size_t s = 0; s < ids.size(); ++s) {
+        EXPECT_EQ(aligner.stats(s).packets, 50U);
+        EXPECT_EQ(aligner.stats(s).dropped_samples, 0U);
+    }
+}
+
+TEST(StreamAlignerTest, MissingPacketZeroFilled) {
+    std::array<uint32_t, 2> ids{1, 2};
+    StreamAligner aligner(small_config(), ids);
+
+    push(aligner, make_packet<8>(1, at(0), 0));
+    push(aligner, make_packet<8>(1, at(8), 8));
+    push(aligner, make_packet<8>(1, at(16), 16));
+    push(aligner, make_packet<8>(2, at(0), 0));
+    // Stream 2 loses the packet at sample 8
+    EXPECT_EQ(push(aligner, make_packet<8>(2, at(16), 16)), PushResult::gap_filled);
+    EXPECT_EQ(aligner.stats(1).filled_samples, 8U);
+
+    auto first = aligner.next_block(8);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_FALSE(first->streams[1].zero_filled);
+
+    auto gap = aligner.next_block(8);
+    ASSERT_TRUE(gap.has_value());
+    EXPECT_FALSE(gap->streams[0].zero_filled);
+    EXPECT_TRUE(gap->streams[1].zero_filled);
+    for (uint32_t v : gather(gap->streams[1])) {
+        EXPECT_EQ(v, 0U);
+    }
+
+    auto after = aligner.next_block(8);
+    ASSERT_TRUE(after.has_value());
+    EXPECT_FALSE(after->streams[1].zero_filled);
+    EXPECT_EQ(gather(after->streams[1]).front(), 16U);
+}
+
+TEST(StreamAlignerTest, LateDuplicateAndOverlap) {
+    std::array<uint32_t, 1> ids{7};
+    StreamAligner aligner(small_config(), ids);
+
+    push(aligner, make_packet<8>(7, at(0), 0));
+    EXPECT_EQ(push(aligner, make_packet<8>(7, at(0), 0)), PushResult::late);
+    // Overlaps by 4: only samples 8..11 are new
+    EXPECT_EQ(push(aligner, make_packet<8>(7, at(4), 4)), PushResult::accepted);
+    EXPECT_EQ(aligner.window().second - aligner.window().first, 12U);
+    EXPECT_EQ(aligner.stats(0).late_packets, 1U);
+
+    auto block = aligner.next_block(12);
+    ASSERT_TRUE(block.has_value());
+    auto values = gather(block->streams[0]);
+    for (uint32_t i = 0; i < 12; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+}
+
+TEST(StreamAlignerTest, LargeGapResyncs) {
+    std::array<uint32_t, 1> ids{7};
+    StreamAligner aligner(small_config(), ids);
+
+    push(aligner, make_packet<8>(7, at(0), 0));
+    EXPECT_EQ(push(aligner, make_packet<8>(7, at(1000), 1000)), PushResult::resynced);
+    EXPECT_EQ(aligner.stats(0).resyncs, 1U);
+    EXPECT_EQ(aligner.stats(0).dropped_samples, 8U);
+
+    auto block = aligner.next_block(8);
+    ASSERT_TRUE(block.has_value());
+    EXPECT_EQ(gather(block->streams[0]).front(), 1000U);
+    EXPECT_EQ(block->tsi, start_second + 1);
+    EXPECT_EQ(block->tsf, 0U);
+}
+
+TEST(StreamAlignerTest, OverflowDropsOldest) {
+    std::array<uint32_t, 2> ids{1, 2};
+    StreamAligner aligner(small_config(), ids);
+
+    // Stream 2 never arrives; stream 1 keeps only the newest 64 samples
+    for (uint64_t sample = 0; sample < 80; sample += 8) {
+        push(aligner, make_packet<8>(1, at(sample), uint32_t(sample)));
+    }
+    EXPECT_EQ(aligner.stats(0).dropped_samples, 16U);
+    EXPECT_FALSE(aligner.next_block(8).has_value());
+
+    push(aligner, make_packet<16>(2, at(40), 40));
+    auto block = aligner.next_block(16);
+    ASSERT_TRUE(block.has_value());
+    EXPECT_EQ(gather(block->streams[0]).front(), 40U);
+    EXPECT_EQ(gather(block->streams[1]).front(), 40U);
+}
+
+TEST(StreamAlignerTest, RealTimeTimestamps) {
+    std::array<uint32_t, 2> ids{1, 2};
+    StreamAligner aligner(small_config(), ids);
+
+    // Real-time TSF is mapped onto the sample grid
+    auto real_at = [](uint64_t sample) { return khz_rate.to_real_time(at(sample)); };
+    push(aligner, make_packet<8, UtcRealTimestamp>(1, real_at(996), 996));
+    push(aligner, make_packet<8, UtcRealTimestamp>(2, real_at(998), 998));
+    auto block = aligner.next_block(6);
+    ASSERT_TRUE(block.has_value());
+    EXPECT_EQ(gather(block->streams[0]).front(), 998U);
+    EXPECT_EQ(gather(block->streams[1]).front(), 998U);
+    EXPECT_EQ(block->tsi, start_second);
+    EXPECT_EQ(block->tsf, 998 * picoseconds_per_second / 1000);
+}
+
+TEST(StreamAlignerTest, RejectsUnusablePackets) {
+    std::array<uint32_t, 1> ids{1};
+    StreamAligner aligner(small_config(), ids);
+
+    EXPECT_EQ(push(aligner, make_packet<8>(99, at(0), 0)), PushResult::unknown_stream);
+
+    using GpsSample = Timestamp<TsiType::gps, TsfType::sample_count>;
+    push(aligner, make_packet<8>(1, at(0), 0));
+    EXPECT_EQ(push(aligner, make_packet<8, GpsSample>(1, GpsSample(start_second, 8), 8)),
+              PushResult::timestamp_mismatch);
+
+    std::vector<uint8_t> truncated(8, 0);
+    EXPECT_EQ(push(aligner, truncated), PushResult::no_timestamp);
+}
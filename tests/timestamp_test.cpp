@@ -294,29 +294,43 @@ TEST_F(TimestampTest, BuilderIntegration) {
     EXPECT_EQ(read_ts.tsf(), test_picoseconds);
 }
 
-// Test that non-UTC timestamp types are not implemented
-TEST_F(TimestampTest, NonUTCTimestampsNotImplemented) {
-    // GPS and other timestamp types are not implemented through the typed API
+namespace {
+
+template <typename T>
+concept ConvertsToChrono = requires(const T& ts) { ts.to_chrono(); };
+
+template <typename T>
+concept HasNow = requires { T::now(); };
+
+} // namespace
+
+// Test that TSI=other timestamps get no conversions
+TEST_F(TimestampTest, OtherTsiTimestampsNotImplemented) {
+    // TSI=other timestamps are not implemented through the typed API
     // This is by design - users must handle these manually based on their
     // specific requirements (different epochs, conversions, etc.)
+    // GPS real-time conversions are covered in gps_time_test.cpp
 
-    // The primary template's static_assert ensures compile-time failure
-    // if someone tries to instantiate an unsupported timestamp type:
-    // Timestamp<tsi_type::gps, tsf_type::real_time> would fail to compile if instantiated
+    // The conversion members are constrained to UTC and GPS real-time timestamps, so
+    // they do not exist for other TSI types
+    using OtherRealTimestamp = Timestamp<TsiType::other, TsfType::real_time>;
+    static_assert(!ConvertsToChrono<OtherRealTimestamp>);
+    static_assert(!HasNow<OtherRealTimestamp>);
+    static_assert(ConvertsToChrono<GpsRealTimestamp> && HasNow<GpsRealTimestamp>);
 
-    // Only UTC+RealTime is fully supported with conversions
+    // UTC+RealTime and GPS+RealTime are supported with conversions
     UtcRealTimestamp utc_ts(1234567890, 500'000'000'000ULL);
     EXPECT_EQ(utc_ts.tsi(), 1234567890);
     EXPECT_EQ(utc_ts.tsf(), 500'000'000'000ULL);
 
-    // For packets needing GPS or other timestamp types, use Timestamp<tsi, tsf>
+    // For packets needing other timestamp types, use Timestamp<tsi, tsf>
     // as the template parameter to configure packet structure correctly
 }
 
 // Test that GPS timestamps can be used to configure packet structure
 TEST_F(TimestampTest, GPSTimestampPacketStructure) {
-    // GPS timestamps can be used to configure packet structure
-    // even though the timestamp type itself is not fully implemented
+    // GPS timestamps configure packet structure like UTC ones
+    // (conversions are covered in gps_time_test.cpp)
     using GPSPacket =
         SignalDataPacket<vrtigo::NoClassId, Timestamp<TsiType::gps, TsfType::real_time>,
                          vrtigo::Trailer::none, 256>;
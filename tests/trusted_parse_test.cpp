@@ -0,0 +1,132 @@
+#include <array>
+#include <span>
+
+#include <gtest/gtest.h>
+#include <vrtigo.hpp>
+#include <vrtigo/vrtigo_io.hpp>
+
+using namespace vrtigo;
+using namespace vrtigo::field;
+
+namespace {
+
+using DataPkt = SignalDataPacket<ClassId, UtcRealTimestamp, Trailer::included, 8>;
+using CtxPkt = ContextPacket<UtcRealTimestamp, ClassId, bandwidth, sample_rate, aux_gain>;
+
+class TrustedParseTest : public ::testing::Test {
+protected:
+    alignas(4) std::array<uint8_t, 256> buffer{};
+};
+
+} // namespace
+
+TEST_F(TrustedParseTest, DataViewMatchesValidatedView) {
+    DataPkt pkt(buffer.data());
+    pkt.set_stream_id(0x1234);
+    pkt.set_timestamp(UtcRealTimestamp(1'700'000'000, 77));
+    pkt.set_packet_count(3);
+
+    RuntimeDataPacket checked(buffer.data(), DataPkt::size_bytes);
+    RuntimeDataPacket view(buffer.data(), DataPkt::size_bytes, trusted);
+    ASSERT_TRUE(checked.is_valid());
+    ASSERT_TRUE(view.is_valid());
+
+    EXPECT_EQ(view.stream_id(), checked.stream_id());
+    EXPECT_EQ(view.timestamp_integer(), checked.timestamp_integer());
+    EXPECT_EQ(view.timestamp_fractional(), checked.timestamp_fractional());
+    EXPECT_EQ(view.packet_count(), 3U);
+    EXPECT_EQ(view.payload().data(), checked.payload().data());
+    EXPECT_EQ(view.payload().size(), checked.payload().size());
+    EXPECT_EQ(view.trailer().has_value(), checked.trailer().has_value());
+
+    EXPECT_EQ(view.validate(), ValidationError::none);
+    EXPECT_EQ(view.payload().size(), checked.payload().size());
+}
+
+TEST_F(TrustedParseTest, ContextViewAccessesFieldsLazily) {
+    CtxPkt pkt(buffer.data());
+    pkt.set_stream_id(0x42);
+    pkt[bandwidth].set_value(20e6);
+    pkt[sample_rate].set_value(10e6);
+    pkt[aux_gain].set_encoded(0x00110022U);
+
+    RuntimeContextPacket view(buffer.data(), CtxPkt::size_bytes, trusted);
+    ASSERT_TRUE(view.is_valid());
+    EXPECT_EQ(view.stream_id(), 0x42U);
+    EXPECT_EQ(view.cif0(), CtxPkt::cif0_value);
+    EXPECT_EQ(view.cif1(), CtxPkt::cif1_value);
+    EXPECT_EQ(view.context_base_offset(), CtxPkt::context_base_offset());
+    EXPECT_DOUBLE_EQ(view[bandwidth].value(), 20e6);
+    EXPECT_DOUBLE_EQ(view[sample_rate].value(), 10e6);
+    EXPECT_EQ(view[aux_gain].encoded(), 0x00110022U);
+    EXPECT_FALSE(view[gain].has_value());
+    EXPECT_EQ(view.as_bytes().size(), CtxPkt::size_bytes);
+
+    EXPECT_EQ(view.validate(), ValidationError::none);
+    EXPECT_DOUBLE_EQ(view[bandwidth].value(), 20e6);
+}
+
+TEST_F(TrustedParseTest, ParsePacketDispatch) {
+    DataPkt data(buffer.data());
+    data.set_stream_id(1);
+    auto pkt = parse_packet(std::span<const uint8_t>(buffer.data(), DataPkt::size_bytes), trusted);
+    ASSERT_TRUE(is_data_packet(pkt));
+    EXPECT_EQ(stream_id(pkt), 1U);
+
+    CtxPkt ctx(buffer.data());
+    ctx.set_stream_id(2);
+    pkt = parse_packet(std::span<const uint8_t>(buffer.data(), CtxPkt::size_bytes), trusted);
+    ASSERT_TRUE(is_context_packet(pkt));
+    EXPECT_EQ(stream_id(pkt), 2U);
+
+    // A missing header is reported; reserved types fall back to full validation
+    EXPECT_FALSE(is_valid(parse_packet(std::span<const uint8_t>(buffer.data(), 2), trusted)));
+    detail::write_u32(buffer.data(), 0, 0xF0000001U);
+    EXPECT_FALSE(is_valid(parse_packet(std::span<const uint8_t>(buffer.data(), 4), trusted)));
+}
+
+TEST_F(TrustedParseTest, ValidateOnDemandCatchesBadPackets) {
+    CtxPkt pkt(buffer.data());
+    // Reserved CIF0 bit 4
+    detail::write_u32(buffer.data(), CtxPkt::context_base_offset() - 8,
+                      CtxPkt::cif0_value | (1U << 4));
+
+#ifdef NDEBUG
+    RuntimeContextPacket view(buffer.data(), CtxPkt::size_bytes, trusted);
+    EXPECT_TRUE(view.is_valid());
+    EXPECT_EQ(view.validate(), ValidationError::unsupported_field);
+    EXPECT_FALSE(view.is_valid());
+#else
+    // Debug builds cross-check trusted views against full validation
+    EXPECT_DEATH(RuntimeContextPacket(buffer.data(), CtxPkt::size_bytes, trusted),
+                 "trusted context packet failed validation");
+#endif
+}
+
+TEST_F(TrustedParseTest, SizeWordMustFitBufferAndPrologue) {
+    // Type 1 with stream ID: the header claims one word, too short for the stream ID
+    detail::write_u32(buffer.data(), 0, 0x10000001U);
+    RuntimeDataPacket short_data(buffer.data(), 8, trusted);
+    EXPECT_EQ(short_data.error(), ValidationError::size_field_mismatch);
+    EXPECT_TRUE(short_data.payload().empty());
+
+    // The header claims 256 words of an 8-byte buffer
+    detail::write_u32(buffer.data(), 0, 0x10000100U);
+    RuntimeDataPacket long_data(buffer.data(), 8, trusted);
+    EXPECT_EQ(long_data.error(), ValidationError::buffer_too_small);
+
+    // Context packet whose size ends before CIF0
+    detail::write_u32(buffer.data(), 0, 0x40000002U);
+    RuntimeContextPacket no_cif(buffer.data(), 8, trusted);
+    EXPECT_EQ(no_cif.error(), ValidationError::size_field_mismatch);
+
+    // CIF0 enables CIF1, but the packet ends after CIF0
+    detail::write_u32(buffer.data(), 0, 0x40000003U);
+    detail::write_u32(buffer.data(), 8, 1U << cif::CIF1_ENABLE_BIT);
+    RuntimeContextPacket no_cif1(buffer.data(), buffer.size(), trusted);
+    EXPECT_EQ(no_cif1.error(), ValidationError::size_field_mismatch);
+
+    detail::write_u32(buffer.data(), 0, 0x40000100U);
+    RuntimeContextPacket long_context(buffer.data(), 12, trusted);
+    EXPECT_EQ(long_context.error(), ValidationError::buffer_too_small);
+}